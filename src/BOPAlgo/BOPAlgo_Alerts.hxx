@@ -144,4 +144,10 @@ DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertShapeIsNotPeriodic)
 //! Unable to make closed edge on face (to make a seam)
 DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertUnableToMakeClosedEdgeOnFace)
 
+//! The face has no triangulation (mesh Boolean operation)
+DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertNoTriangulation)
+
+//! The result of the mesh Boolean operation is not closed
+DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertMeshNotClosed)
+
 #endif // _BOPAlgo_Alerts_HeaderFile
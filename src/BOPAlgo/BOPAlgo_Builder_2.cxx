@@ -509,8 +509,12 @@ void BOPAlgo_Builder::BuildSplitFaces(const Message_ProgressRange& theRange)
     BOPAlgo_SplitFace& aBF = aVBF.ChangeValue(iF);
     aBF.SetProgressRange(aPSParallel.Next());
   }
+  // The contexts of the tasks share the classifiers and boxes of the stage
+  // context, which has its own storage so that the tools built for the draft
+  // shapes of the tasks are released together with it
+  Handle(IntTools_Context) aCtx = new IntTools_Context;
   //===================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVBF);
+  BOPTools_Parallel::Perform (myRunParallel, aVBF, aCtx);
   //===================================================
   if (UserBreak(aPSOuter))
   {
@@ -484,8 +484,12 @@ void BOPAlgo_Builder::BuildSplitSolids(TopTools_DataMapOfShapeShape& theDraftSol
     aSplitSolid.SetProgressRange(aPSParallel.Next());
   }
   //
+  // The contexts of the tasks share the classifiers and boxes of the stage
+  // context, which has its own storage so that the tools built for the draft
+  // shapes of the tasks are released together with it
+  Handle(IntTools_Context) aCtx = new IntTools_Context;
   //===================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVBS);
+  BOPTools_Parallel::Perform (myRunParallel, aVBS, aCtx);
   //===================================================
   if (UserBreak(aPSOuter))
   {
@@ -154,6 +154,7 @@ void BOPAlgo_CheckerSI::Init(const Message_ProgressRange& /*theRange*/)
   //
   // 3.myIterator 
   BOPDS_PIteratorSI theIterSI=new BOPDS_IteratorSI(myAllocator);
+  theIterSI->SetRunParallel(myRunParallel);
   theIterSI->SetDS(myDS);
   theIterSI->Prepare(myContext, myUseOBB, myFuzzyValue);
   theIterSI->UpdateByLevelOfCheck(myLevelOfCheck);
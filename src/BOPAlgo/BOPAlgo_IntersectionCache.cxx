@@ -0,0 +1,542 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPAlgo_IntersectionCache.hxx>
+
+#include <BinTools_Curve2dSet.hxx>
+#include <BinTools_CurveSet.hxx>
+#include <BinTools_OStream.hxx>
+#include <BinTools_SurfaceSet.hxx>
+#include <BRep_Tool.hxx>
+#include <IntSurf_PntOn2S.hxx>
+#include <IntTools_CommonPrt.hxx>
+#include <IntTools_Curve.hxx>
+#include <IntTools_PntOn2Faces.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_HashUtils.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Iterator.hxx>
+
+#include <sstream>
+
+IMPLEMENT_STANDARD_RTTIEXT(BOPAlgo_IntersectionCache, Standard_Transient)
+
+namespace
+{
+  //! Tool computing the digest of the data written into its binary stream.
+  class DigestWriter
+  {
+  public:
+
+    DigestWriter()
+    : myStream (std::ios::out | std::ios::binary),
+      myOStream (myStream) {}
+
+    //! Returns the stream to write the data.
+    BinTools_OStream& Stream() { return myOStream; }
+
+    //! Writes the digest.
+    void Add (const BOPAlgo_IntersectionCache::Digest& theDigest)
+    {
+      myStream.write ((const char* )&theDigest.Hash1, sizeof (uint64_t));
+      myStream.write ((const char* )&theDigest.Hash2, sizeof (uint64_t));
+    }
+
+    //! Writes the orientation.
+    void Add (const TopAbs_Orientation theOrientation)
+    {
+      myOStream << (Standard_Byte )theOrientation;
+    }
+
+    //! Returns the digest of written data.
+    BOPAlgo_IntersectionCache::Digest Result() const
+    {
+      const std::string aData = myStream.str();
+      BOPAlgo_IntersectionCache::Digest aDigest;
+      aDigest.Hash1 = opencascade::MurmurHash::MurmurHash64A (aData.data(), (int )aData.size(), 0);
+      aDigest.Hash2 = opencascade::FNVHash::FNVHash64A (aData.data(), (int )aData.size(), 0);
+      return aDigest;
+    }
+
+  private:
+    std::ostringstream myStream;
+    BinTools_OStream   myOStream;
+  };
+
+  //! Copies the curves with their geometry.
+  static void copyCurves (const IntTools_SequenceOfCurves& theSource,
+                          IntTools_SequenceOfCurves& theTarget)
+  {
+    theTarget.Clear();
+    for (IntTools_SequenceOfCurves::Iterator aCurveIt (theSource); aCurveIt.More(); aCurveIt.Next())
+    {
+      IntTools_Curve aCurve = aCurveIt.Value();
+      if (!aCurve.Curve().IsNull())
+      {
+        aCurve.SetCurve (Handle(Geom_Curve)::DownCast (aCurve.Curve()->Copy()));
+      }
+      if (!aCurve.FirstCurve2d().IsNull())
+      {
+        aCurve.SetFirstCurve2d (Handle(Geom2d_Curve)::DownCast (aCurve.FirstCurve2d()->Copy()));
+      }
+      if (!aCurve.SecondCurve2d().IsNull())
+      {
+        aCurve.SetSecondCurve2d (Handle(Geom2d_Curve)::DownCast (aCurve.SecondCurve2d()->Copy()));
+      }
+      theTarget.Append (aCurve);
+    }
+  }
+
+  //! Copies the point on face without reference to the face.
+  static IntTools_PntOnFace copyPoint (const IntTools_PntOnFace& thePoint)
+  {
+    Standard_Real aU = 0.0, aV = 0.0;
+    thePoint.Parameters (aU, aV);
+    IntTools_PntOnFace aPoint;
+    aPoint.Init (TopoDS_Face(), thePoint.Pnt(), aU, aV);
+    aPoint.SetValid (thePoint.Valid());
+    return aPoint;
+  }
+}
+
+//=======================================================================
+//function : BOPAlgo_IntersectionCache
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::BOPAlgo_IntersectionCache()
+: myRun (0),
+  myMaxUnusedRuns (1),
+  myNbHits (0),
+  myNbMisses (0)
+{
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BOPAlgo_IntersectionCache::Clear()
+{
+  myFaceFace.Clear();
+  myEdgeEdge.Clear();
+  myVertexFace.Clear();
+  myShapeDigests.Clear();
+  myGeometryDigests.Clear();
+  myNbHits = 0;
+  myNbMisses = 0;
+}
+
+//=======================================================================
+//function : StartRun
+//purpose  :
+//=======================================================================
+void BOPAlgo_IntersectionCache::StartRun()
+{
+  ++myRun;
+  myShapeDigests.Clear();
+  myGeometryDigests.Clear();
+  removeUnused (myFaceFace);
+  removeUnused (myEdgeEdge);
+  removeUnused (myVertexFace);
+}
+
+//=======================================================================
+//function : ClearShapeDigests
+//purpose  :
+//=======================================================================
+void BOPAlgo_IntersectionCache::ClearShapeDigests()
+{
+  myShapeDigests.Clear();
+}
+
+//=======================================================================
+//function : removeUnused
+//purpose  :
+//=======================================================================
+template<class TheEntry>
+void BOPAlgo_IntersectionCache::removeUnused (NCollection_DataMap<Digest, TheEntry, DigestHasher>& theMap)
+{
+  NCollection_Vector<Digest> anUnused;
+  for (typename NCollection_DataMap<Digest, TheEntry, DigestHasher>::Iterator anIt (theMap); anIt.More(); anIt.Next())
+  {
+    if (myRun - anIt.Value().Run > myMaxUnusedRuns)
+    {
+      anUnused.Append (anIt.Key());
+    }
+  }
+  for (NCollection_Vector<Digest>::Iterator anIt (anUnused); anIt.More(); anIt.Next())
+  {
+    theMap.UnBind (anIt.Value());
+  }
+}
+
+//=======================================================================
+//function : seekEntry
+//purpose  :
+//=======================================================================
+template<class TheEntry>
+const TheEntry* BOPAlgo_IntersectionCache::seekEntry (NCollection_DataMap<Digest, TheEntry, DigestHasher>& theMap,
+                                                      const Digest& theKey)
+{
+  TheEntry* anEntry = theMap.ChangeSeek (theKey);
+  if (anEntry == NULL)
+  {
+    ++myNbMisses;
+    return NULL;
+  }
+  ++myNbHits;
+  anEntry->Run = myRun;
+  return anEntry;
+}
+
+//=======================================================================
+//function : surfaceDigest
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::Digest BOPAlgo_IntersectionCache::surfaceDigest (const Handle(Geom_Surface)& theSurface)
+{
+  if (theSurface.IsNull())
+  {
+    return Digest();
+  }
+  if (const Digest* aDigest = myGeometryDigests.Seek (theSurface))
+  {
+    return *aDigest;
+  }
+
+  DigestWriter aWriter;
+  BinTools_SurfaceSet::WriteSurface (theSurface, aWriter.Stream());
+  return *myGeometryDigests.Bound (theSurface, aWriter.Result());
+}
+
+//=======================================================================
+//function : curveDigest
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::Digest BOPAlgo_IntersectionCache::curveDigest (const Handle(Geom_Curve)& theCurve)
+{
+  if (theCurve.IsNull())
+  {
+    return Digest();
+  }
+  if (const Digest* aDigest = myGeometryDigests.Seek (theCurve))
+  {
+    return *aDigest;
+  }
+
+  DigestWriter aWriter;
+  BinTools_CurveSet::WriteCurve (theCurve, aWriter.Stream());
+  return *myGeometryDigests.Bound (theCurve, aWriter.Result());
+}
+
+//=======================================================================
+//function : curve2dDigest
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::Digest BOPAlgo_IntersectionCache::curve2dDigest (const Handle(Geom2d_Curve)& theCurve)
+{
+  if (theCurve.IsNull())
+  {
+    return Digest();
+  }
+  if (const Digest* aDigest = myGeometryDigests.Seek (theCurve))
+  {
+    return *aDigest;
+  }
+
+  DigestWriter aWriter;
+  BinTools_Curve2dSet::WriteCurve2d (theCurve, aWriter.Stream());
+  return *myGeometryDigests.Bound (theCurve, aWriter.Result());
+}
+
+//=======================================================================
+//function : vertexDigest
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::Digest BOPAlgo_IntersectionCache::vertexDigest (const TopoDS_Vertex& theVertex)
+{
+  if (const Digest* aDigest = myShapeDigests.Seek (theVertex))
+  {
+    return *aDigest;
+  }
+
+  DigestWriter aWriter;
+  aWriter.Stream() << BRep_Tool::Pnt (theVertex) << BRep_Tool::Tolerance (theVertex);
+  return *myShapeDigests.Bound (theVertex, aWriter.Result());
+}
+
+//=======================================================================
+//function : edgeDigest
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::Digest BOPAlgo_IntersectionCache::edgeDigest (const TopoDS_Edge& theEdge)
+{
+  if (const Digest* aDigest = myShapeDigests.Seek (theEdge))
+  {
+    return *aDigest;
+  }
+
+  DigestWriter aWriter;
+  TopLoc_Location aLoc;
+  Standard_Real aT1 = 0.0, aT2 = 0.0;
+  const Handle(Geom_Curve)& aCurve = BRep_Tool::Curve (theEdge, aLoc, aT1, aT2);
+  aWriter.Add (curveDigest (aCurve));
+  aWriter.Stream() << aLoc.Transformation() << aT1 << aT2 << BRep_Tool::Tolerance (theEdge);
+  aWriter.Stream().PutBools (BRep_Tool::Degenerated (theEdge),
+                             BRep_Tool::SameParameter (theEdge),
+                             BRep_Tool::SameRange (theEdge));
+  for (TopoDS_Iterator aVertexIt (theEdge); aVertexIt.More(); aVertexIt.Next())
+  {
+    aWriter.Add (aVertexIt.Value().Orientation());
+    aWriter.Add (vertexDigest (TopoDS::Vertex (aVertexIt.Value())));
+  }
+  return *myShapeDigests.Bound (theEdge, aWriter.Result());
+}
+
+//=======================================================================
+//function : faceDigest
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::Digest BOPAlgo_IntersectionCache::faceDigest (const TopoDS_Face& theFace)
+{
+  if (const Digest* aDigest = myShapeDigests.Seek (theFace))
+  {
+    return *aDigest;
+  }
+
+  DigestWriter aWriter;
+  TopLoc_Location aLoc;
+  const Handle(Geom_Surface)& aSurface = BRep_Tool::Surface (theFace, aLoc);
+  aWriter.Add (surfaceDigest (aSurface));
+  aWriter.Stream() << aLoc.Transformation() << BRep_Tool::Tolerance (theFace);
+  aWriter.Stream() << BRep_Tool::NaturalRestriction (theFace);
+
+  // boundaries of the face: wires with the edges and their p-curves, internal vertices
+  const TopoDS_Face aFace = TopoDS::Face (theFace.Oriented (TopAbs_FORWARD));
+  for (TopoDS_Iterator aSubIt (aFace); aSubIt.More(); aSubIt.Next())
+  {
+    const TopoDS_Shape& aSubShape = aSubIt.Value();
+    aWriter.Add (aSubShape.Orientation());
+    if (aSubShape.ShapeType() == TopAbs_VERTEX)
+    {
+      aWriter.Add (vertexDigest (TopoDS::Vertex (aSubShape)));
+      continue;
+    }
+
+    aWriter.Stream() << (Standard_Integer )aSubShape.NbChildren();
+    for (TopoDS_Iterator anEdgeIt (aSubShape); anEdgeIt.More(); anEdgeIt.Next())
+    {
+      if (anEdgeIt.Value().ShapeType() != TopAbs_EDGE)
+      {
+        continue;
+      }
+      const TopoDS_Edge& anEdge = TopoDS::Edge (anEdgeIt.Value());
+      aWriter.Add (anEdge.Orientation());
+      aWriter.Add (edgeDigest (anEdge));
+
+      Standard_Real aT1 = 0.0, aT2 = 0.0;
+      const Handle(Geom2d_Curve) aPCurve = BRep_Tool::CurveOnSurface (anEdge, aFace, aT1, aT2);
+      aWriter.Add (curve2dDigest (aPCurve));
+      aWriter.Stream() << aT1 << aT2;
+    }
+  }
+  return *myShapeDigests.Bound (theFace, aWriter.Result());
+}
+
+//=======================================================================
+//function : FaceFaceKey
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::Digest BOPAlgo_IntersectionCache::FaceFaceKey (const TopoDS_Face& theFace1,
+                                                                          const TopoDS_Face& theFace2,
+                                                                          const Standard_Real theTolFF,
+                                                                          const Standard_Real theFuzzyValue,
+                                                                          const Standard_Boolean theApprox,
+                                                                          const Standard_Boolean theCompC2D1,
+                                                                          const Standard_Boolean theCompC2D2,
+                                                                          const Standard_Real theApproxTol,
+                                                                          const IntSurf_ListOfPntOn2S& thePoints)
+{
+  DigestWriter aWriter;
+  aWriter.Stream() << (Standard_Byte )TopAbs_FACE;
+  aWriter.Add (theFace1.Orientation());
+  aWriter.Add (faceDigest (theFace1));
+  aWriter.Add (theFace2.Orientation());
+  aWriter.Add (faceDigest (theFace2));
+  aWriter.Stream() << theTolFF << theFuzzyValue << theApproxTol;
+  aWriter.Stream().PutBools (theApprox, theCompC2D1, theCompC2D2);
+
+  // starting points of intersection
+  aWriter.Stream() << thePoints.Extent();
+  for (IntSurf_ListOfPntOn2S::Iterator aPntIt (thePoints); aPntIt.More(); aPntIt.Next())
+  {
+    Standard_Real aU1 = 0.0, aV1 = 0.0, aU2 = 0.0, aV2 = 0.0;
+    aPntIt.Value().Parameters (aU1, aV1, aU2, aV2);
+    aWriter.Stream() << aPntIt.Value().Value() << aU1 << aV1 << aU2 << aV2;
+  }
+  return aWriter.Result();
+}
+
+//=======================================================================
+//function : EdgeEdgeKey
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::Digest BOPAlgo_IntersectionCache::EdgeEdgeKey (const TopoDS_Edge& theEdge1,
+                                                                          const Standard_Real theT11,
+                                                                          const Standard_Real theT12,
+                                                                          const TopoDS_Edge& theEdge2,
+                                                                          const Standard_Real theT21,
+                                                                          const Standard_Real theT22,
+                                                                          const Standard_Real theFuzzyValue,
+                                                                          const Standard_Boolean theQuickCoincidenceCheck)
+{
+  DigestWriter aWriter;
+  aWriter.Stream() << (Standard_Byte )TopAbs_EDGE;
+  aWriter.Add (theEdge1.Orientation());
+  aWriter.Add (edgeDigest (theEdge1));
+  aWriter.Add (theEdge2.Orientation());
+  aWriter.Add (edgeDigest (theEdge2));
+  aWriter.Stream() << theT11 << theT12 << theT21 << theT22 << theFuzzyValue << theQuickCoincidenceCheck;
+  return aWriter.Result();
+}
+
+//=======================================================================
+//function : VertexFaceKey
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::Digest BOPAlgo_IntersectionCache::VertexFaceKey (const TopoDS_Vertex& theVertex,
+                                                                            const TopoDS_Face& theFace,
+                                                                            const Standard_Real theFuzzyValue)
+{
+  DigestWriter aWriter;
+  aWriter.Stream() << (Standard_Byte )TopAbs_VERTEX;
+  aWriter.Add (vertexDigest (theVertex));
+  aWriter.Add (theFace.Orientation());
+  aWriter.Add (faceDigest (theFace));
+  aWriter.Stream() << theFuzzyValue;
+  return aWriter.Result();
+}
+
+//=======================================================================
+//function : FindFaceFace
+//purpose  :
+//=======================================================================
+Standard_Boolean BOPAlgo_IntersectionCache::FindFaceFace (const Digest& theKey,
+                                                          Standard_Boolean& theTangentFaces,
+                                                          IntTools_SequenceOfCurves& theCurves,
+                                                          IntTools_SequenceOfPntOn2Faces& thePoints)
+{
+  const FaceFaceEntry* anEntry = seekEntry (myFaceFace, theKey);
+  if (anEntry == NULL)
+  {
+    return Standard_False;
+  }
+
+  theTangentFaces = anEntry->TangentFaces;
+  copyCurves (anEntry->Curves, theCurves);
+  thePoints = anEntry->Points;
+  return Standard_True;
+}
+
+//=======================================================================
+//function : AddFaceFace
+//purpose  :
+//=======================================================================
+void BOPAlgo_IntersectionCache::AddFaceFace (const Digest& theKey,
+                                             const Standard_Boolean theTangentFaces,
+                                             const IntTools_SequenceOfCurves& theCurves,
+                                             const IntTools_SequenceOfPntOn2Faces& thePoints)
+{
+  FaceFaceEntry anEntry;
+  anEntry.Run = myRun;
+  anEntry.TangentFaces = theTangentFaces;
+  copyCurves (theCurves, anEntry.Curves);
+  for (IntTools_SequenceOfPntOn2Faces::Iterator aPntIt (thePoints); aPntIt.More(); aPntIt.Next())
+  {
+    IntTools_PntOn2Faces aPoint (copyPoint (aPntIt.Value().P1()), copyPoint (aPntIt.Value().P2()));
+    aPoint.SetValid (aPntIt.Value().IsValid());
+    anEntry.Points.Append (aPoint);
+  }
+  myFaceFace.Bind (theKey, anEntry);
+}
+
+//=======================================================================
+//function : FindEdgeEdge
+//purpose  :
+//=======================================================================
+Standard_Boolean BOPAlgo_IntersectionCache::FindEdgeEdge (const Digest& theKey,
+                                                          const TopoDS_Edge& theEdge1,
+                                                          const TopoDS_Edge& theEdge2,
+                                                          IntTools_SequenceOfCommonPrts& theCommonParts)
+{
+  const EdgeEdgeEntry* anEntry = seekEntry (myEdgeEdge, theKey);
+  if (anEntry == NULL)
+  {
+    return Standard_False;
+  }
+
+  theCommonParts = anEntry->CommonParts;
+  for (IntTools_SequenceOfCommonPrts::Iterator aPartIt (theCommonParts); aPartIt.More(); aPartIt.Next())
+  {
+    aPartIt.ChangeValue().SetEdge1 (theEdge1);
+    aPartIt.ChangeValue().SetEdge2 (theEdge2);
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : AddEdgeEdge
+//purpose  :
+//=======================================================================
+void BOPAlgo_IntersectionCache::AddEdgeEdge (const Digest& theKey,
+                                             const IntTools_SequenceOfCommonPrts& theCommonParts)
+{
+  EdgeEdgeEntry anEntry;
+  anEntry.Run = myRun;
+  anEntry.CommonParts = theCommonParts;
+  for (IntTools_SequenceOfCommonPrts::Iterator aPartIt (anEntry.CommonParts); aPartIt.More(); aPartIt.Next())
+  {
+    aPartIt.ChangeValue().SetEdge1 (TopoDS_Edge());
+    aPartIt.ChangeValue().SetEdge2 (TopoDS_Edge());
+  }
+  myEdgeEdge.Bind (theKey, anEntry);
+}
+
+//=======================================================================
+//function : FindVertexFace
+//purpose  :
+//=======================================================================
+Standard_Boolean BOPAlgo_IntersectionCache::FindVertexFace (const Digest& theKey,
+                                                            VertexFaceResult& theResult)
+{
+  const VertexFaceEntry* anEntry = seekEntry (myVertexFace, theKey);
+  if (anEntry == NULL)
+  {
+    return Standard_False;
+  }
+  theResult = anEntry->Result;
+  return Standard_True;
+}
+
+//=======================================================================
+//function : AddVertexFace
+//purpose  :
+//=======================================================================
+void BOPAlgo_IntersectionCache::AddVertexFace (const Digest& theKey,
+                                               const VertexFaceResult& theResult)
+{
+  VertexFaceEntry anEntry;
+  anEntry.Run = myRun;
+  anEntry.Result = theResult;
+  myVertexFace.Bind (theKey, anEntry);
+}
@@ -0,0 +1,263 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BOPAlgo_IntersectionCache_HeaderFile
+#define _BOPAlgo_IntersectionCache_HeaderFile
+
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
+#include <Geom2d_Curve.hxx>
+#include <IntSurf_ListOfPntOn2S.hxx>
+#include <IntTools_SequenceOfCommonPrts.hxx>
+#include <IntTools_SequenceOfCurves.hxx>
+#include <IntTools_SequenceOfPntOn2Faces.hxx>
+#include <NCollection_DataMap.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+DEFINE_STANDARD_HANDLE(BOPAlgo_IntersectionCache, Standard_Transient)
+
+//! Cache of the results of intersection of sub-shapes kept between the runs
+//! of the Intersection algorithm (BOPAlgo_PaveFiller), which allows repeating
+//! the Boolean operations on the modified arguments without recomputation
+//! of the interferences of their unchanged parts.
+//!
+//! The results of Face/Face (IntTools_FaceFace), Edge/Edge (IntTools_EdgeEdge)
+//! and Vertex/Face intersections are stored.
+//! The key of the result is the digest (a pair of 64-bit hashes) of all data affecting
+//! the intersection: binary representation of geometry of the shapes and of their sub-shapes
+//! bounding them, locations, tolerances, parameter ranges and the options of intersection.
+//! Thus the results are reused for the shapes with the same geometry regardless of their identity,
+//! and the changes of geometry, including in-place modification of Geom_Surface or Geom_Curve,
+//! or of the tolerances of shapes invalidate them.
+//! Digests of geometries are computed once per run of the Intersection algorithm.
+//!
+//! Since the tolerances of argument shapes may be increased by the operation in destructive mode,
+//! the non-destructive mode should be used to reuse the results in the next run most efficiently.
+//!
+//! The entries not used during the last MaxUnusedRuns() runs are removed on the start of the new run.
+//! The cache may be used by one algorithm at a time.
+class BOPAlgo_IntersectionCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BOPAlgo_IntersectionCache, Standard_Transient)
+public:
+
+  //! Digest of data defining the intersection.
+  struct Digest
+  {
+    uint64_t Hash1;
+    uint64_t Hash2;
+
+    Digest() : Hash1 (0), Hash2 (0) {}
+
+    bool operator== (const Digest& theOther) const
+    {
+      return Hash1 == theOther.Hash1 && Hash2 == theOther.Hash2;
+    }
+  };
+
+  //! Hasher of digests.
+  struct DigestHasher
+  {
+    size_t operator() (const Digest& theDigest) const noexcept
+    {
+      return static_cast<size_t> (theDigest.Hash1);
+    }
+
+    bool operator() (const Digest& theDigest1, const Digest& theDigest2) const noexcept
+    {
+      return theDigest1 == theDigest2;
+    }
+  };
+
+  //! Result of Vertex/Face intersection.
+  struct VertexFaceResult
+  {
+    Standard_Integer Flag;    //!< status of intersection (see IntTools_Context::ComputeVF())
+    Standard_Real    U;       //!< parameters of the vertex on the face
+    Standard_Real    V;
+    Standard_Real    TolVNew; //!< new tolerance of the vertex
+
+    VertexFaceResult() : Flag (-1), U (0.0), V (0.0), TolVNew (0.0) {}
+  };
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT BOPAlgo_IntersectionCache();
+
+  //! Returns the number of runs the unused entries are kept; 1 by default.
+  Standard_Integer MaxUnusedRuns() const { return myMaxUnusedRuns; }
+
+  //! Sets the number of runs the unused entries are kept.
+  void SetMaxUnusedRuns (const Standard_Integer theNbRuns) { myMaxUnusedRuns = theNbRuns; }
+
+  //! Removes all entries and resets the counters.
+  Standard_EXPORT void Clear();
+
+  //! Returns the number of stored results of Face/Face intersection.
+  Standard_Integer NbFaceFace() const { return myFaceFace.Extent(); }
+
+  //! Returns the number of stored results of Edge/Edge intersection.
+  Standard_Integer NbEdgeEdge() const { return myEdgeEdge.Extent(); }
+
+  //! Returns the number of stored results of Vertex/Face intersection.
+  Standard_Integer NbVertexFace() const { return myVertexFace.Extent(); }
+
+  //! Returns the number of found results since the last Clear().
+  Standard_Size NbHits() const { return myNbHits; }
+
+  //! Returns the number of missing results since the last Clear().
+  Standard_Size NbMisses() const { return myNbMisses; }
+
+public: //! @name Interface for the Intersection algorithm
+
+  //! Starts new run of the Intersection algorithm: forgets the computed digests
+  //! and removes the entries unused for more than MaxUnusedRuns() runs.
+  Standard_EXPORT void StartRun();
+
+  //! Forgets the digests of shapes (but not of geometries) computed before.
+  //! Should be called before each stage of intersection, as the tolerances of shapes
+  //! may be increased by the previous stage.
+  Standard_EXPORT void ClearShapeDigests();
+
+  //! Computes the key of Face/Face intersection.
+  Standard_EXPORT Digest FaceFaceKey (const TopoDS_Face& theFace1,
+                                      const TopoDS_Face& theFace2,
+                                      const Standard_Real theTolFF,
+                                      const Standard_Real theFuzzyValue,
+                                      const Standard_Boolean theApprox,
+                                      const Standard_Boolean theCompC2D1,
+                                      const Standard_Boolean theCompC2D2,
+                                      const Standard_Real theApproxTol,
+                                      const IntSurf_ListOfPntOn2S& thePoints);
+
+  //! Computes the key of Edge/Edge intersection of the given ranges of edges.
+  Standard_EXPORT Digest EdgeEdgeKey (const TopoDS_Edge& theEdge1,
+                                      const Standard_Real theT11,
+                                      const Standard_Real theT12,
+                                      const TopoDS_Edge& theEdge2,
+                                      const Standard_Real theT21,
+                                      const Standard_Real theT22,
+                                      const Standard_Real theFuzzyValue,
+                                      const Standard_Boolean theQuickCoincidenceCheck);
+
+  //! Computes the key of Vertex/Face intersection.
+  Standard_EXPORT Digest VertexFaceKey (const TopoDS_Vertex& theVertex,
+                                        const TopoDS_Face& theFace,
+                                        const Standard_Real theFuzzyValue);
+
+  //! Finds the result of Face/Face intersection.
+  //! The returned curves are the copies of stored ones.
+  Standard_EXPORT Standard_Boolean FindFaceFace (const Digest& theKey,
+                                                 Standard_Boolean& theTangentFaces,
+                                                 IntTools_SequenceOfCurves& theCurves,
+                                                 IntTools_SequenceOfPntOn2Faces& thePoints);
+
+  //! Stores the result of Face/Face intersection (the copies of curves are stored).
+  Standard_EXPORT void AddFaceFace (const Digest& theKey,
+                                    const Standard_Boolean theTangentFaces,
+                                    const IntTools_SequenceOfCurves& theCurves,
+                                    const IntTools_SequenceOfPntOn2Faces& thePoints);
+
+  //! Finds the result of Edge/Edge intersection; the common parts are bound to the given edges.
+  Standard_EXPORT Standard_Boolean FindEdgeEdge (const Digest& theKey,
+                                                 const TopoDS_Edge& theEdge1,
+                                                 const TopoDS_Edge& theEdge2,
+                                                 IntTools_SequenceOfCommonPrts& theCommonParts);
+
+  //! Stores the result of Edge/Edge intersection.
+  Standard_EXPORT void AddEdgeEdge (const Digest& theKey,
+                                    const IntTools_SequenceOfCommonPrts& theCommonParts);
+
+  //! Finds the result of Vertex/Face intersection.
+  Standard_EXPORT Standard_Boolean FindVertexFace (const Digest& theKey,
+                                                   VertexFaceResult& theResult);
+
+  //! Stores the result of Vertex/Face intersection.
+  Standard_EXPORT void AddVertexFace (const Digest& theKey,
+                                      const VertexFaceResult& theResult);
+
+private:
+
+  //! Returns the digest of the face: its surface, location, tolerance and boundaries.
+  Digest faceDigest (const TopoDS_Face& theFace);
+
+  //! Returns the digest of the edge: its 3D curve, location, range, tolerance and vertices.
+  Digest edgeDigest (const TopoDS_Edge& theEdge);
+
+  //! Returns the digest of the vertex: its point and tolerance.
+  Digest vertexDigest (const TopoDS_Vertex& theVertex);
+
+  //! Returns the digest of the surface.
+  Digest surfaceDigest (const Handle(Geom_Surface)& theSurface);
+
+  //! Returns the digest of the 3D curve.
+  Digest curveDigest (const Handle(Geom_Curve)& theCurve);
+
+  //! Returns the digest of the 2D curve.
+  Digest curve2dDigest (const Handle(Geom2d_Curve)& theCurve);
+
+  //! Marks the entry as used in the current run and updates the counters.
+  template<class TheEntry>
+  const TheEntry* seekEntry (NCollection_DataMap<Digest, TheEntry, DigestHasher>& theMap,
+                             const Digest& theKey);
+
+  //! Removes the entries unused for more than MaxUnusedRuns() runs.
+  template<class TheEntry>
+  void removeUnused (NCollection_DataMap<Digest, TheEntry, DigestHasher>& theMap);
+
+private:
+
+  //! Stored result of Face/Face intersection.
+  struct FaceFaceEntry
+  {
+    Standard_Integer               Run;
+    Standard_Boolean               TangentFaces;
+    IntTools_SequenceOfCurves      Curves;
+    IntTools_SequenceOfPntOn2Faces Points;
+  };
+
+  //! Stored result of Edge/Edge intersection.
+  struct EdgeEdgeEntry
+  {
+    Standard_Integer              Run;
+    IntTools_SequenceOfCommonPrts CommonParts;
+  };
+
+  //! Stored result of Vertex/Face intersection.
+  struct VertexFaceEntry
+  {
+    Standard_Integer Run;
+    VertexFaceResult Result;
+  };
+
+private:
+
+  NCollection_DataMap<Digest, FaceFaceEntry, DigestHasher>   myFaceFace;   //!< results of Face/Face intersection
+  NCollection_DataMap<Digest, EdgeEdgeEntry, DigestHasher>   myEdgeEdge;   //!< results of Edge/Edge intersection
+  NCollection_DataMap<Digest, VertexFaceEntry, DigestHasher> myVertexFace; //!< results of Vertex/Face intersection
+
+  NCollection_DataMap<TopoDS_Shape, Digest, TopTools_ShapeMapHasher> myShapeDigests;    //!< digests of shapes
+  NCollection_DataMap<Handle(Standard_Transient), Digest>            myGeometryDigests; //!< digests of geometries
+
+  Standard_Integer myRun;           //!< index of the current run
+  Standard_Integer myMaxUnusedRuns; //!< number of runs the unused entries are kept
+  Standard_Size    myNbHits;        //!< number of found results
+  Standard_Size    myNbMisses;      //!< number of missing results
+
+};
+
+#endif // _BOPAlgo_IntersectionCache_HeaderFile
@@ -224,6 +224,10 @@ void BOPAlgo_PaveFiller::Init (const Message_ProgressRange& theRange)
   // 2 myContext
   myContext = new IntTools_Context;
   //
+  if (!myIntersectionCache.IsNull()) {
+    myIntersectionCache->StartRun();
+  }
+  //
   // 3.myIterator 
   myIterator = new BOPDS_Iterator (myAllocator);
   myIterator->SetRunParallel (myRunParallel);
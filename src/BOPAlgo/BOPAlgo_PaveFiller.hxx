@@ -24,6 +24,7 @@
 
 #include <BOPAlgo_Algo.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_IntersectionCache.hxx>
 #include <BOPAlgo_SectionAttribute.hxx>
 #include <BOPDS_DataMapOfPaveBlockListOfPaveBlock.hxx>
 #include <BOPDS_IndexedDataMapOfPaveBlockListOfInteger.hxx>
@@ -176,6 +177,22 @@ public:
     return myAvoidBuildPCurve;
   }
 
+  //! Sets the cache of intersection results to be used by the algorithm.
+  //! The results of Vertex/Face, Edge/Edge and Face/Face intersections found
+  //! in the cache are not recomputed, the computed ones are added into it.
+  //! The cache may be shared between the subsequent runs of the algorithm
+  //! to speed up the repeated operations on the partially modified arguments.
+  void SetIntersectionCache (const Handle(BOPAlgo_IntersectionCache)& theCache)
+  {
+    myIntersectionCache = theCache;
+  }
+
+  //! Returns the cache of intersection results.
+  const Handle(BOPAlgo_IntersectionCache)& IntersectionCache() const
+  {
+    return myIntersectionCache;
+  }
+
 protected:
 
   typedef NCollection_DataMap
@@ -647,6 +664,7 @@ protected: //! Fields
   Standard_Boolean myIsPrimary;
   Standard_Boolean myAvoidBuildPCurve;
   BOPAlgo_GlueEnum myGlue;
+  Handle(BOPAlgo_IntersectionCache) myIntersectionCache; //!< Cache of intersection results
 
   BOPAlgo_DataMapOfIntegerMapOfPaveBlock myFPBDone; //!< Fence map of intersected faces and pave blocks
   TColStd_MapOfInteger myIncreasedSS; //!< Sub-shapes with increased tolerance during the operation
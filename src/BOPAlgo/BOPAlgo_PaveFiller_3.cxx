@@ -63,7 +63,8 @@ class BOPAlgo_EdgeEdge :
   //
   BOPAlgo_EdgeEdge(): 
     IntTools_EdgeEdge(),
-    BOPAlgo_ParallelAlgo() {
+    BOPAlgo_ParallelAlgo(),
+    myIsCached(Standard_False) {
   };
   //
   virtual ~BOPAlgo_EdgeEdge(){
@@ -96,9 +97,31 @@ class BOPAlgo_EdgeEdge :
     IntTools_EdgeEdge::SetFuzzyValue(theFuzz);
   }
   //
+  //! Sets the key of the intersection in the cache of intersection results
+  void SetCacheKey(const BOPAlgo_IntersectionCache::Digest& theKey) {
+    myCacheKey = theKey;
+  }
+  //
+  const BOPAlgo_IntersectionCache::Digest& CacheKey() const {
+    return myCacheKey;
+  }
+  //
+  //! Sets the result of intersection found in the cache,
+  //! so that the intersection is not performed
+  void SetCachedResult(const IntTools_SequenceOfCommonPrts& theCommonParts) {
+    myCommonParts = theCommonParts;
+    myErrorStatus = 0;
+    myIsCached = Standard_True;
+  }
+  //
+  //! Returns true if the result has been taken from the cache
+  Standard_Boolean IsCached() const {
+    return myIsCached;
+  }
+  //
   virtual void Perform() {
     Message_ProgressScope aPS(myProgressRange, NULL, 1);
-    if (UserBreak(aPS))
+    if (myIsCached || UserBreak(aPS))
     {
       return;
     }
@@ -145,6 +168,8 @@ class BOPAlgo_EdgeEdge :
   Handle(BOPDS_PaveBlock) myPB2;
   Bnd_Box myBox1;
   Bnd_Box myBox2;
+  BOPAlgo_IntersectionCache::Digest myCacheKey;
+  Standard_Boolean myIsCached;
 };
 //
 //=======================================================================
@@ -186,6 +211,11 @@ void BOPAlgo_PaveFiller::PerformEE(const Message_ProgressRange& theRange)
   BOPDS_VectorOfInterfEE& aEEs=myDS->InterfEE();
   aEEs.SetIncrement(iSize);
   //
+  // The tolerances of shapes could have been changed on the previous steps
+  if (!myIntersectionCache.IsNull()) {
+    myIntersectionCache->ClearShapeDigests();
+  }
+  //
   for (; myIterator->More(); myIterator->Next()) {
     if (UserBreak(aPSOuter))
     {
@@ -261,6 +291,17 @@ void BOPAlgo_PaveFiller::PerformEE(const Message_ProgressRange& theRange)
         anEdgeEdge.SetEdge2(aE2, aT21, aT22);
         anEdgeEdge.SetBoxes (aBB1, aBB2);
         anEdgeEdge.SetFuzzyValue(myFuzzyValue);
+        //
+        if (!myIntersectionCache.IsNull()) {
+          // Take the result of intersection of the same edges from the cache
+          anEdgeEdge.SetCacheKey(myIntersectionCache->EdgeEdgeKey
+            (aE1, aT11, aT12, aE2, aT21, aT22, myFuzzyValue, bExpressCompute));
+          //
+          IntTools_SequenceOfCommonPrts aCachedCPrts;
+          if (myIntersectionCache->FindEdgeEdge(anEdgeEdge.CacheKey(), aE1, aE2, aCachedCPrts)) {
+            anEdgeEdge.SetCachedResult(aCachedCPrts);
+          }
+        }
       }//for (; aIt2.More(); aIt2.Next()) {
     }//for (; aIt1.More(); aIt1.Next()) {
   }//for (; myIterator->More(); myIterator->Next()) {
@@ -297,6 +338,10 @@ void BOPAlgo_PaveFiller::PerformEE(const Message_ProgressRange& theRange)
       continue;
     }
     //
+    if (!myIntersectionCache.IsNull() && !anEdgeEdge.IsCached()) {
+      myIntersectionCache->AddEdgeEdge(anEdgeEdge.CacheKey(), anEdgeEdge.CommonParts());
+    }
+    //
     const IntTools_SequenceOfCommonPrts& aCPrts = anEdgeEdge.CommonParts();
     aNbCPrts = aCPrts.Length();
     if (!aNbCPrts) {
@@ -43,7 +43,8 @@ class BOPAlgo_VertexFace : public BOPAlgo_ParallelAlgo {
   BOPAlgo_VertexFace() : 
     BOPAlgo_ParallelAlgo(),
     myIV(-1), myIF(-1),
-    myFlag(-1), myT1(-1.),  myT2(-1.), myTolVNew(-1.) {
+    myFlag(-1), myT1(-1.),  myT2(-1.), myTolVNew(-1.),
+    myIsCached(Standard_False) {
   }
   //
   virtual ~BOPAlgo_VertexFace(){
@@ -99,9 +100,33 @@ class BOPAlgo_VertexFace : public BOPAlgo_ParallelAlgo {
     return myContext;
   }
   //
+  //! Sets the key of the intersection in the cache of intersection results
+  void SetCacheKey(const BOPAlgo_IntersectionCache::Digest& theKey) {
+    myCacheKey = theKey;
+  }
+  //
+  const BOPAlgo_IntersectionCache::Digest& CacheKey() const {
+    return myCacheKey;
+  }
+  //
+  //! Sets the result of intersection found in the cache,
+  //! so that the intersection is not performed
+  void SetCachedResult(const BOPAlgo_IntersectionCache::VertexFaceResult& theResult) {
+    myFlag = theResult.Flag;
+    myT1 = theResult.U;
+    myT2 = theResult.V;
+    myTolVNew = theResult.TolVNew;
+    myIsCached = Standard_True;
+  }
+  //
+  //! Returns true if the result has been taken from the cache
+  Standard_Boolean IsCached() const {
+    return myIsCached;
+  }
+  //
   virtual void Perform() {
     Message_ProgressScope aPS(myProgressRange, NULL, 1);
-    if (UserBreak(aPS))
+    if (myIsCached || UserBreak(aPS))
     {
       return;
     }
@@ -127,6 +152,8 @@ class BOPAlgo_VertexFace : public BOPAlgo_ParallelAlgo {
   TopoDS_Vertex myV;
   TopoDS_Face myF;
   Handle(IntTools_Context) myContext;
+  BOPAlgo_IntersectionCache::Digest myCacheKey;
+  Standard_Boolean myIsCached;
 };
 //=======================================================================
 typedef NCollection_Vector<BOPAlgo_VertexFace> BOPAlgo_VectorOfVertexFace;
@@ -170,6 +197,11 @@ void BOPAlgo_PaveFiller::PerformVF(const Message_ProgressRange& theRange)
   //
   aVFs.SetIncrement(iSize);
   //
+  // The tolerances of shapes could have been changed on the previous steps
+  if (!myIntersectionCache.IsNull()) {
+    myIntersectionCache->ClearShapeDigests();
+  }
+  //
   // Avoid repeated intersection of the same vertex with face in case
   // the group of vertices formed a single SD vertex
   NCollection_DataMap<BOPDS_Pair, TColStd_MapOfInteger> aMVFPairs;
@@ -218,7 +250,16 @@ void BOPAlgo_PaveFiller::PerformVF(const Message_ProgressRange& theRange)
     aVertexFace.SetVertex(aV);
     aVertexFace.SetFace(aF);
     aVertexFace.SetFuzzyValue(myFuzzyValue);
-    
+    //
+    if (!myIntersectionCache.IsNull()) {
+      // Take the result of intersection of the same vertex and face from the cache
+      aVertexFace.SetCacheKey(myIntersectionCache->VertexFaceKey(aV, aF, myFuzzyValue));
+      //
+      BOPAlgo_IntersectionCache::VertexFaceResult aCachedResult;
+      if (myIntersectionCache->FindVertexFace(aVertexFace.CacheKey(), aCachedResult)) {
+        aVertexFace.SetCachedResult(aCachedResult);
+      }
+    }
   }//for (; myIterator->More(); myIterator->Next()) {
   //
   aNbVF=aVVF.Length();
@@ -244,6 +285,13 @@ void BOPAlgo_PaveFiller::PerformVF(const Message_ProgressRange& theRange)
     const BOPAlgo_VertexFace& aVertexFace=aVVF(k);
     // 
     iFlag=aVertexFace.Flag();
+    if (!myIntersectionCache.IsNull() && !aVertexFace.IsCached() && !aVertexFace.HasErrors()) {
+      BOPAlgo_IntersectionCache::VertexFaceResult aResult;
+      aResult.Flag = iFlag;
+      aVertexFace.Parameters(aResult.U, aResult.V);
+      aResult.TolVNew = aVertexFace.VertexNewTolerance();
+      myIntersectionCache->AddVertexFace(aVertexFace.CacheKey(), aResult);
+    }
     if (iFlag != 0) {
       if (aVertexFace.HasErrors())
       {
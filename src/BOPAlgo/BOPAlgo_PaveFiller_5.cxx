@@ -33,6 +33,7 @@
 #include <BOPTools_Parallel.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
 #include <gp_Pnt.hxx>
 #include <IntTools_CommonPrt.hxx>
@@ -203,6 +204,8 @@ void BOPAlgo_PaveFiller::PerformEF(const Message_ProgressRange& theRange)
   TopAbs_ShapeEnum aType;
   BOPDS_ListIteratorOfListOfPaveBlock aIt;
   BOPAlgo_VectorOfEdgeFace aVEdgeFace; 
+  // Estimated costs of the intersections, used to start the most expensive ones first
+  NCollection_Vector<Standard_Real> aCosts;
   //-----------------------------------------------------scope f
   //
   aAllocator=NCollection_BaseAllocator::CommonBaseAllocator();
@@ -240,6 +243,10 @@ void BOPAlgo_PaveFiller::PerformEF(const Message_ProgressRange& theRange)
     aTolE=BRep_Tool::Tolerance(aE);
     aTolF=BRep_Tool::Tolerance(aF);
     //
+    const Standard_Real aCost =
+      BOPAlgo_Tools::IntersectionCost (BRepAdaptor_Curve (aE)) *
+      BOPAlgo_Tools::IntersectionCost (myContext->SurfaceAdaptor (aF));
+    //
     BOPDS_ListOfPaveBlock& aLPB=myDS->ChangePaveBlocks(nE);
     aIt.Initialize(aLPB);
     for (; aIt.More(); aIt.Next()) {
@@ -269,6 +276,7 @@ void BOPAlgo_PaveFiller::PerformEF(const Message_ProgressRange& theRange)
       bExpressCompute=bV1 && bV2;
       //
       BOPAlgo_EdgeFace& aEdgeFace=aVEdgeFace.Appended();
+      aCosts.Append (aCost);
       //
       aEdgeFace.SetIndices(nE, nF);
       aEdgeFace.SetPaveBlock(aPB);
@@ -305,7 +313,7 @@ void BOPAlgo_PaveFiller::PerformEF(const Message_ProgressRange& theRange)
     aEdgeFace.SetProgressRange(aPS.Next());
   }
   //=================================================================
-  BOPTools_Parallel::Perform (myRunParallel, aVEdgeFace, myContext);
+  BOPTools_Parallel::Perform (myRunParallel, aVEdgeFace, myContext, aCosts);
   //=================================================================
   if (UserBreak(aPSOuter))
   {
@@ -95,7 +95,7 @@ class BOPAlgo_FaceFace :
   BOPAlgo_FaceFace() : 
     IntTools_FaceFace(),  
     BOPAlgo_ParallelAlgo(),
-    myIF1(-1), myIF2(-1), myTolFF(1.e-7) {
+    myIF1(-1), myIF2(-1), myTolFF(1.e-7), myIsCached(Standard_False) {
   }
   //
   virtual ~BOPAlgo_FaceFace() {
@@ -147,9 +147,35 @@ class BOPAlgo_FaceFace :
   //
   const gp_Trsf& Trsf() const { return myTrsf; }
   //
+  //! Sets the key of the intersection in the cache of intersection results
+  void SetCacheKey(const BOPAlgo_IntersectionCache::Digest& theKey) {
+    myCacheKey = theKey;
+  }
+  //
+  const BOPAlgo_IntersectionCache::Digest& CacheKey() const {
+    return myCacheKey;
+  }
+  //
+  //! Sets the result of intersection found in the cache,
+  //! so that the intersection is not performed
+  void SetCachedResult(const Standard_Boolean theTangentFaces,
+                       const IntTools_SequenceOfCurves& theCurves,
+                       const IntTools_SequenceOfPntOn2Faces& thePoints) {
+    myTangentFaces = theTangentFaces;
+    mySeqOfCurve = theCurves;
+    myPnts = thePoints;
+    myIsDone = Standard_True;
+    myIsCached = Standard_True;
+  }
+  //
+  //! Returns true if the result has been taken from the cache
+  Standard_Boolean IsCached() const {
+    return myIsCached;
+  }
+  //
   virtual void Perform() {
     Message_ProgressScope aPS(myProgressRange, NULL, 1);
-    if (UserBreak(aPS))
+    if (myIsCached || UserBreak(aPS))
     {
       return;
     }
@@ -220,6 +246,8 @@ class BOPAlgo_FaceFace :
   Bnd_Box myBox1;
   Bnd_Box myBox2;
   gp_Trsf myTrsf;
+  BOPAlgo_IntersectionCache::Digest myCacheKey;
+  Standard_Boolean myIsCached;
 };
 //
 //=======================================================================
@@ -308,8 +336,15 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
     }
   }
 
+  // The tolerances of shapes could have been changed on the previous steps
+  if (!myIntersectionCache.IsNull()) {
+    myIntersectionCache->ClearShapeDigests();
+  }
+  //
   // Prepare the pairs of faces for intersection
   BOPAlgo_VectorOfFaceFace aVFaceFace;
+  // Estimated costs of the intersections, used to start the most expensive ones first
+  NCollection_Vector<Standard_Real> aCosts;
   myIterator->Initialize(TopAbs_FACE, TopAbs_FACE);
   for (; myIterator->More(); myIterator->Next()) {
     if (UserBreak(aPSOuter))
@@ -428,6 +463,24 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
       //
       aFaceFace.SetParameters(bApprox, bCompC2D1, bCompC2D2, anApproxTol);
       aFaceFace.SetFuzzyValue(myFuzzyValue);
+      //
+      if (!myIntersectionCache.IsNull()) {
+        // Take the result of intersection of the same faces from the cache
+        aFaceFace.SetCacheKey(myIntersectionCache->FaceFaceKey
+          (aFShifted1, aFShifted2, aTolFF, myFuzzyValue, bApprox,
+           bCompC2D1, bCompC2D2, anApproxTol, aListOfPnts));
+        //
+        Standard_Boolean bCachedTangent = Standard_False;
+        IntTools_SequenceOfCurves aCachedCurves;
+        IntTools_SequenceOfPntOn2Faces aCachedPoints;
+        if (myIntersectionCache->FindFaceFace(aFaceFace.CacheKey(), bCachedTangent,
+                                              aCachedCurves, aCachedPoints)) {
+          aFaceFace.SetCachedResult(bCachedTangent, aCachedCurves, aCachedPoints);
+        }
+      }
+      //
+      aCosts.Append (aFaceFace.IsCached() ? 0. :
+                     BOPAlgo_Tools::IntersectionCost (aBAS1) * BOPAlgo_Tools::IntersectionCost (aBAS2));
     }
     else {
       // for the Glue mode just add all interferences of that type
@@ -447,7 +500,7 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
   }
   //======================================================
   // Perform intersection
-  BOPTools_Parallel::Perform (myRunParallel, aVFaceFace);
+  BOPTools_Parallel::Perform (myRunParallel, aVFaceFace, aCosts);
   if (UserBreak(aPSOuter))
   {
     return;
@@ -474,9 +527,16 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
     Standard_Boolean bTangentFaces = aFaceFace.TangentFaces();
     Standard_Real aTolFF = aFaceFace.TolFF();
     //
-    aFaceFace.PrepareLines3D(bSplitCurve);
-    //
-    aFaceFace.ApplyTrsf();
+    if (!aFaceFace.IsCached()) {
+      aFaceFace.PrepareLines3D(bSplitCurve);
+      //
+      aFaceFace.ApplyTrsf();
+      //
+      if (!myIntersectionCache.IsNull()) {
+        myIntersectionCache->AddFaceFace(aFaceFace.CacheKey(), bTangentFaces,
+                                         aFaceFace.Lines(), aFaceFace.Points());
+      }
+    }
     //
     const IntTools_SequenceOfCurves& aCvsX = aFaceFace.Lines();
     const IntTools_SequenceOfPntOn2Faces& aPntsX = aFaceFace.Points();
@@ -30,6 +30,8 @@
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepLib.hxx>
 #include <Bnd_Tools.hxx>
+#include <Geom_OffsetCurve.hxx>
+#include <GeomAdaptor_Curve.hxx>
 #include <GeomAPI_ProjectPointOnCurve.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
 #include <gp_Circ.hxx>
@@ -1777,3 +1779,62 @@ Standard_Boolean BOPAlgo_Tools::TrsfToPoint (const Bnd_Box& theBox1,
   theTrsf.SetTranslation (gp_Vec (aBox.CornerMin(), thePoint));
   return Standard_True;
 }
+
+//=======================================================================
+//function : IntersectionCost
+//purpose  : 
+//=======================================================================
+Standard_Real BOPAlgo_Tools::IntersectionCost (const Adaptor3d_Curve& theCurve)
+{
+  switch (theCurve.GetType())
+  {
+    case GeomAbs_Line:
+      return 1.;
+    case GeomAbs_Circle:
+    case GeomAbs_Ellipse:
+      return 2.;
+    case GeomAbs_Hyperbola:
+    case GeomAbs_Parabola:
+      return 3.;
+    case GeomAbs_BezierCurve:
+    case GeomAbs_BSplineCurve:
+      // the intersection is computed on the spans of the curve
+      return 2. + 0.5 * theCurve.Degree() * theCurve.NbPoles();
+    case GeomAbs_OffsetCurve:
+      return 2. * IntersectionCost (GeomAdaptor_Curve (theCurve.OffsetCurve()->BasisCurve()));
+    default:
+      return 16.;
+  }
+}
+
+//=======================================================================
+//function : IntersectionCost
+//purpose  : 
+//=======================================================================
+Standard_Real BOPAlgo_Tools::IntersectionCost (const Adaptor3d_Surface& theSurface)
+{
+  switch (theSurface.GetType())
+  {
+    case GeomAbs_Plane:
+      return 1.;
+    case GeomAbs_Cylinder:
+    case GeomAbs_Cone:
+      return 2.;
+    case GeomAbs_Sphere:
+      return 3.;
+    case GeomAbs_Torus:
+      return 4.;
+    case GeomAbs_BezierSurface:
+    case GeomAbs_BSplineSurface:
+      // the intersection is computed on the patches of the surface
+      return 4. + theSurface.UDegree() * theSurface.VDegree() *
+                  theSurface.NbUPoles() * theSurface.NbVPoles() / 16.;
+    case GeomAbs_SurfaceOfRevolution:
+    case GeomAbs_SurfaceOfExtrusion:
+      return 4. * IntersectionCost (*theSurface.BasisCurve());
+    case GeomAbs_OffsetSurface:
+      return 2. * IntersectionCost (*theSurface.BasisSurface());
+    default:
+      return 16.;
+  }
+}
@@ -32,6 +32,8 @@
 #include <Standard_Integer.hxx>
 #include <Message_ProgressRange.hxx>
 
+class Adaptor3d_Curve;
+class Adaptor3d_Surface;
 class BOPDS_PaveBlock;
 class BOPDS_CommonBlock;
 class IntTools_Context;
@@ -213,6 +215,16 @@ public:
                                                        gp_Trsf&       theTrsf,
                                                        const gp_Pnt&  thePoint = gp_Pnt (0.0, 0.0, 0.0),
                                                        const Standard_Real theCriteria = 1.e+5);
+
+  //! Estimates the relative cost of the intersection of the curve with other shapes
+  //! by the type of the curve, its degree and the number of poles (the cost of the line is 1).
+  //! The estimated costs are used to start the most expensive intersections first in parallel mode.
+  Standard_EXPORT static Standard_Real IntersectionCost (const Adaptor3d_Curve& theCurve);
+
+  //! Estimates the relative cost of the intersection of the surface with other shapes
+  //! by the type of the surface, its degrees and the number of poles (the cost of the plane is 1).
+  //! The cost of intersection of two shapes is estimated as the product of their costs.
+  Standard_EXPORT static Standard_Real IntersectionCost (const Adaptor3d_Surface& theSurface);
 };
 
 #endif // _BOPAlgo_Tools_HeaderFile
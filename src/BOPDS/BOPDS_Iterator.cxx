@@ -296,13 +296,14 @@ void BOPDS_Iterator::Intersect(const Handle(IntTools_Context)& theCtx,
   }
 
   // Build BVH
+  aBoxTree.Builder()->SetParallel (myRunParallel);
   aBoxTree.Build();
 
   // Select pairs of shapes with interfering bounding boxes
   BOPTools_BoxPairSelector aPairSelector;
   aPairSelector.SetBVHSets (&aBoxTree, &aBoxTree);
   aPairSelector.SetSame (Standard_True);
-  aPairSelector.Select();
+  aPairSelector.Select (myRunParallel);
   aPairSelector.Sort();
 
   // Treat the selected pairs
@@ -87,13 +87,14 @@ void BOPDS_IteratorSI::Intersect (const Handle(IntTools_Context)& theCtx,
     aBBTree.Add (i, Bnd_Tools::Bnd2BVH (aBoxEx));
   }
 
+  aBBTree.Builder()->SetParallel (myRunParallel);
   aBBTree.Build();
 
   // Select pairs of shapes with interfering bounding boxes
   BOPTools_BoxPairSelector aPairSelector;
   aPairSelector.SetBVHSets (&aBBTree, &aBBTree);
   aPairSelector.SetSame (Standard_True);
-  aPairSelector.Select();
+  aPairSelector.Select (myRunParallel);
   aPairSelector.Sort();
 
   // Treat the selected pairs
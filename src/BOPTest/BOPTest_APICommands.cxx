@@ -19,6 +19,7 @@
 #include <BRepAlgoAPI_Common.hxx>
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepAlgoAPI_MeshBooleanOperation.hxx>
 #include <BRepAlgoAPI_Section.hxx>
 #include <BRepAlgoAPI_Splitter.hxx>
 #include <BRepTest_Objects.hxx>
@@ -33,6 +34,7 @@
 static Standard_Integer bapibuild(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bapibop  (Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bapisplit(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bmeshbop (Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
 //function : APICommands
@@ -68,6 +70,23 @@ void BOPTest::APICommands(Draw_Interpretor& theCommands)
                   "\t\tObjects for the operation are added using commands baddobjects and baddtools.\n"
                   "\t\tUsage: bapisplit result",
                   __FILE__, bapisplit, g);
+
+  theCommands.Add("bmeshbop", "Builds the result of Boolean operation on the triangulations of the shapes.\n"
+                  "\t\tUsage: bmeshbop r s1 s2 operation [-parallel]\n"
+                  "\t\tWhere:\n"
+                  "\t\tresult - name of the result shape\n"
+                  "\t\ts1, s2 - arguments of the operation with the triangulated faces\n"
+                  "\t\top - type of Boolean operation. Possible values:\n"
+                  "\t\t     - 0/common - for Common operation\n"
+                  "\t\t     - 1/fuse - for Fuse operation\n"
+                  "\t\t     - 2/cut - for Cut operation\n"
+                  "\t\t     - 3/tuc/cut21 - for Cut21 operation\n"
+                  "\t\t     - 4/section - for Section operation\n"
+                  "\t\t-parallel - enables the parallel processing mode\n"
+                  "\t\tThe result of Fuse, Common and Cut operations is the face with the triangulation only,\n"
+                  "\t\tthe result of Section operation is the compound of the edges with the 3D polygons only.\n"
+                  "\t\tThe fuzzy value set by bfuzzyvalue is used for merging of the nodes of the arguments.",
+                  __FILE__, bmeshbop, g);
 }
 //=======================================================================
 //function : bapibop
@@ -144,6 +163,7 @@ Standard_Integer bapibop(Draw_Interpretor& di,
   pBuilder->SetGlue(aGlue);
   pBuilder->SetCheckInverted(BOPTest_Objects::CheckInverted());
   pBuilder->SetUseOBB(BOPTest_Objects::UseOBB());
+  pBuilder->SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   pBuilder->SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -212,6 +232,7 @@ Standard_Integer bapibuild(Draw_Interpretor& di,
   aBuilder.SetGlue(aGlue);
   aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBuilder.SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -310,3 +331,60 @@ Standard_Integer bapisplit(Draw_Interpretor& di,
   DBRep::Set(a[1], aR);
   return 0;
 }
+//=======================================================================
+//function : bmeshbop
+//purpose  : 
+//=======================================================================
+Standard_Integer bmeshbop(Draw_Interpretor& di,
+                          Standard_Integer n,
+                          const char** a)
+{
+  if (n != 5 && n != 6) {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+  //
+  TopoDS_Shape aS1 = DBRep::Get(a[2]);
+  TopoDS_Shape aS2 = DBRep::Get(a[3]);
+  if (aS1.IsNull() || aS2.IsNull()) {
+    di << "Null shapes are not allowed\n";
+    return 1;
+  }
+  //
+  BOPAlgo_Operation anOp = BOPTest::GetOperationType(a[4]);
+  if (anOp == BOPAlgo_UNKNOWN)
+  {
+    di << "Invalid operation type\n";
+    return 0;
+  }
+  //
+  Standard_Boolean bRunParallel = BOPTest_Objects::RunParallel();
+  if (n == 6) {
+    if (strcmp(a[5], "-parallel")) {
+      di << "Syntax error at " << a[5] << "\n";
+      return 1;
+    }
+    bRunParallel = Standard_True;
+  }
+  //
+  BRepAlgoAPI_MeshBooleanOperation aBuilder;
+  aBuilder.SetObject(aS1);
+  aBuilder.SetTool(aS2);
+  aBuilder.SetOperation(anOp);
+  aBuilder.SetRunParallel(bRunParallel);
+  aBuilder.SetFuzzyValue(BOPTest_Objects::FuzzyValue());
+  //
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
+  aBuilder.Build(aProgress->Start());
+  //
+  BOPTest::ReportAlerts(aBuilder.GetReport());
+  if (aBuilder.HasErrors()) {
+    return 0;
+  }
+  //
+  di << "Pairs of interfering triangles: " << aBuilder.NbCandidatePairs() << "\n";
+  di << "Split triangles:                " << aBuilder.NbSplitTriangles() << "\n";
+  //
+  DBRep::Set(a[1], aBuilder.Shape());
+  return 0;
+}
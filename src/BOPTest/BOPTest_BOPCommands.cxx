@@ -159,6 +159,7 @@ Standard_Integer bop(Draw_Interpretor& di,
   pPF->SetNonDestructive(bNonDestructive);
   pPF->SetGlue(aGlue);
   pPF->SetUseOBB(BOPTest_Objects::UseOBB());
+  pPF->SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   //
   pPF->Perform(aProgress->Start());
   BOPTest::ReportAlerts(pPF->GetReport());
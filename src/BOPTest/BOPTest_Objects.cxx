@@ -111,6 +111,7 @@ class BOPTest_Session {
     myUnifyEdges = Standard_False;
     myUnifyFaces = Standard_False;
     myAngTol = Precision::Angular();
+    myIntersectionCache.Nullify();
   }
   //
   void SetRunParallel(const Standard_Boolean bFlag) {
@@ -184,6 +185,11 @@ class BOPTest_Session {
   // Returns angular tolerance
   Standard_Real Angular() const { return myAngTol; }
 
+  // Sets the cache of intersection results shared between the operations
+  void SetIntersectionCache(const Handle(BOPAlgo_IntersectionCache)& theCache) { myIntersectionCache = theCache; }
+  // Returns the cache of intersection results
+  const Handle(BOPAlgo_IntersectionCache)& IntersectionCache() const { return myIntersectionCache; }
+
 protected:
   //
   BOPTest_Session(const BOPTest_Session&);
@@ -207,6 +213,7 @@ protected:
   Standard_Boolean myUnifyEdges;
   Standard_Boolean myUnifyFaces;
   Standard_Real myAngTol;
+  Handle(BOPAlgo_IntersectionCache) myIntersectionCache;
 };
 //
 //=======================================================================
@@ -505,6 +512,22 @@ Standard_Real BOPTest_Objects::Angular()
   return GetSession().Angular();
 }
 //=======================================================================
+//function : SetIntersectionCache
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetIntersectionCache(const Handle(BOPAlgo_IntersectionCache)& theCache)
+{
+  GetSession().SetIntersectionCache(theCache);
+}
+//=======================================================================
+//function : IntersectionCache
+//purpose  : 
+//=======================================================================
+const Handle(BOPAlgo_IntersectionCache)& BOPTest_Objects::IntersectionCache()
+{
+  return GetSession().IntersectionCache();
+}
+//=======================================================================
 //function : Allocator1
 //purpose  : 
 //=======================================================================
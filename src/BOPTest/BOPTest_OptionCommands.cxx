@@ -29,6 +29,7 @@ static Standard_Integer bdrawwarnshapes(Draw_Interpretor&, Standard_Integer, con
 static Standard_Integer bcheckinverted(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer buseobb(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bsimplify(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bintcache(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
 //function : OptionCommands
@@ -81,6 +82,13 @@ void BOPTest::OptionCommands(Draw_Interpretor& theCommands)
                                "\t\t-f 0/1 - enables/disables faces unification\n"
                                "\t\t-a tol - changes default angular tolerance of unification algo (accepts value in degrees).",
                   __FILE__, bsimplify, g);
+
+  theCommands.Add("bintcache", "Enables/Disables the cache of intersection results shared between BOP operations\n"
+                               "\t\tUsage: bintcache [0 (off) / 1 (on)] [-runs N] [-clear]\n"
+                               "\t\tw/o arguments shows the statistics of the cache\n"
+                               "\t\t-runs N - number of operations the unused results are kept (1 by default)\n"
+                               "\t\t-clear  - removes all results from the cache",
+                  __FILE__, bintcache, g);
 }
 //=======================================================================
 //function : boptions
@@ -143,6 +151,9 @@ Standard_Integer boptions(Draw_Interpretor& di,
   Sprintf(buf, " Angular: %g \t\t(%s)\n", BOPTest_Objects::Angular(),
                "use \"bsimplify -a\" command to change");
   di << buf;
+  Sprintf(buf, " Intersection cache: %s \t(%s)\n", !BOPTest_Objects::IntersectionCache().IsNull() ? "Yes" : "No",
+               "use \"bintcache\" command to change");
+  di << buf;
   //
   return 0;
 }
@@ -325,3 +336,67 @@ Standard_Integer bsimplify(Draw_Interpretor& di,
   }
   return 0;
 }
+
+//=======================================================================
+//function : bintcache
+//purpose  : 
+//=======================================================================
+Standard_Integer bintcache(Draw_Interpretor& di,
+                           Standard_Integer n,
+                           const char** a)
+{
+  if (n == 1)
+  {
+    const Handle(BOPAlgo_IntersectionCache)& aCache = BOPTest_Objects::IntersectionCache();
+    if (aCache.IsNull())
+    {
+      di << "Intersection cache is not used\n";
+      return 0;
+    }
+    di << "Face/Face results: " << aCache->NbFaceFace() << "\n";
+    di << "Edge/Edge results: " << aCache->NbEdgeEdge() << "\n";
+    di << "Vertex/Face results: " << aCache->NbVertexFace() << "\n";
+    di << "Hits: " << (Standard_Integer )aCache->NbHits() << "\n";
+    di << "Misses: " << (Standard_Integer )aCache->NbMisses() << "\n";
+    return 0;
+  }
+
+  Handle(BOPAlgo_IntersectionCache) aCache = BOPTest_Objects::IntersectionCache();
+  for (Standard_Integer i = 1; i < n; ++i)
+  {
+    if (!strcmp(a[i], "-runs") && i + 1 < n)
+    {
+      if (aCache.IsNull())
+      {
+        aCache = new BOPAlgo_IntersectionCache();
+      }
+      aCache->SetMaxUnusedRuns(Draw::Atoi(a[++i]));
+    }
+    else if (!strcmp(a[i], "-clear"))
+    {
+      if (!aCache.IsNull())
+      {
+        aCache->Clear();
+      }
+    }
+    else if (!strcmp(a[i], "0"))
+    {
+      aCache.Nullify();
+    }
+    else if (!strcmp(a[i], "1"))
+    {
+      if (aCache.IsNull())
+      {
+        aCache = new BOPAlgo_IntersectionCache();
+      }
+    }
+    else
+    {
+      di << "Wrong key option.\n";
+      di.PrintHelp(a[0]);
+      return 1;
+    }
+  }
+  BOPTest_Objects::SetIntersectionCache(aCache);
+  return 0;
+}
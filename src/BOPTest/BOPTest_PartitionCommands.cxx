@@ -165,6 +165,7 @@ Standard_Integer bfillds(Draw_Interpretor& di,
   aPF.SetFuzzyValue(aTol);
   aPF.SetGlue(aGlue);
   aPF.SetUseOBB(BOPTest_Objects::UseOBB());
+  aPF.SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   //
   OSD_Timer aTimer;
   aTimer.Start();
@@ -17,9 +17,11 @@
 
 #include <BVH_Traverse.hxx>
 #include <BVH_BoxSet.hxx>
+#include <OSD_Parallel.hxx>
 
 #include <Standard_Integer.hxx>
 #include <algorithm>
+#include <vector>
 
 //! Template Selector for selection of the elements from two BVH trees.
 template <int Dimension>
@@ -87,6 +89,58 @@ public: //! @name public interfaces
     return myPairs;
   }
 
+public: //! @name Selection
+
+  using BVH_PairTraverse <Standard_Real, Dimension, BVH_BoxSet <Standard_Real, Dimension, Standard_Integer>>::Select;
+
+  //! Selects the pairs of elements of the BVH trees, using several threads if requested.
+  //! In parallel mode, the pairs of nodes of the upper levels of the trees with interfering boxes
+  //! are collected first, and then the sub-trees of these pairs of nodes are traversed concurrently,
+  //! each task collecting the pairs of elements separately. The pairs of elements are concatenated
+  //! in the order of the pairs of nodes, so that the result does not depend on the number of threads,
+  //! but the order of the pairs differs from the one of sequential selection (use Sort() to get the same order).
+  //! Returns the number of accepted pairs of elements.
+  Standard_Integer Select (const Standard_Boolean theToRunParallel)
+  {
+    if (!theToRunParallel || !this->myBVHSet1 || !this->myBVHSet2)
+    {
+      return Select();
+    }
+
+    const opencascade::handle<BVH_Tree<Standard_Real, Dimension>>& aBVH1 = this->myBVHSet1->BVH();
+    const opencascade::handle<BVH_Tree<Standard_Real, Dimension>>& aBVH2 = this->myBVHSet2->BVH();
+    if (aBVH1.IsNull() || aBVH2.IsNull()
+     || aBVH1->NodeInfoBuffer().empty() || aBVH2->NodeInfoBuffer().empty())
+    {
+      return 0;
+    }
+
+    // Collect the pairs of nodes for independent traversal
+    std::vector<PairIDs> aNodePairs;
+    splitNodePairs (aBVH1, aBVH2, 4 * OSD_Parallel::NbLogicalProcessors(), aNodePairs);
+
+    // Traverse the sub-trees concurrently
+    const Standard_Integer aNbTasks = static_cast<Standard_Integer> (aNodePairs.size());
+    std::vector<std::vector<PairIDs>> aTaskPairs (aNbTasks);
+    SubTreeFunctor aFunctor (*this, aBVH1, aBVH2, aNodePairs, aTaskPairs);
+    OSD_Parallel::For (0, aNbTasks, aFunctor);
+
+    // Concatenate the pairs in the order of tasks
+    size_t aNbPairs = myPairs.size();
+    for (Standard_Integer iTask = 0; iTask < aNbTasks; ++iTask)
+    {
+      aNbPairs += aTaskPairs[iTask].size();
+    }
+    myPairs.reserve (aNbPairs);
+    Standard_Integer aNbAccepted = 0;
+    for (Standard_Integer iTask = 0; iTask < aNbTasks; ++iTask)
+    {
+      myPairs.insert (myPairs.end(), aTaskPairs[iTask].begin(), aTaskPairs[iTask].end());
+      aNbAccepted += static_cast<Standard_Integer> (aTaskPairs[iTask].size());
+    }
+    return aNbAccepted;
+  }
+
 public: //! @name Rejection/Acceptance rules
 
   //! Basing on the bounding boxes of the nodes checks if the pair of nodes should be rejected.
@@ -121,6 +175,110 @@ public: //! @name Rejection/Acceptance rules
     return Standard_False;
   }
 
+protected: //! @name Parallel selection
+
+  //! Splits the traversal of the trees on the pairs of nodes with interfering boxes,
+  //! descending level by level from the root nodes until the number of pairs
+  //! reaches the given value or all pairs consist of the leaves.
+  void splitNodePairs (const opencascade::handle<BVH_Tree<Standard_Real, Dimension>>& theBVH1,
+                       const opencascade::handle<BVH_Tree<Standard_Real, Dimension>>& theBVH2,
+                       const Standard_Integer theNbPairsMin,
+                       std::vector<PairIDs>& theNodePairs) const
+  {
+    const BVH_Array4i& aBVHNodes1 = theBVH1->NodeInfoBuffer();
+    const BVH_Array4i& aBVHNodes2 = theBVH2->NodeInfoBuffer();
+
+    theNodePairs.assign (1, PairIDs (0, 0));
+    std::vector<PairIDs> aNextPairs;
+    while (static_cast<Standard_Integer> (theNodePairs.size()) < theNbPairsMin)
+    {
+      Standard_Boolean isSplit = Standard_False;
+      aNextPairs.clear();
+      for (size_t iPair = 0; iPair < theNodePairs.size(); ++iPair)
+      {
+        const PairIDs& aPair = theNodePairs[iPair];
+        const BVH_Vec4i& aData1 = aBVHNodes1[aPair.ID1];
+        const BVH_Vec4i& aData2 = aBVHNodes2[aPair.ID2];
+        if (aData1.x() != 0 && aData2.x() != 0)
+        {
+          // Both nodes are leaves
+          aNextPairs.push_back (aPair);
+          continue;
+        }
+
+        isSplit = Standard_True;
+        PairIDs aChildren[4];
+        Standard_Integer aNbChildren = 0;
+        if (aData1.x() == 0 && aData2.x() == 0)
+        {
+          aChildren[aNbChildren++] = PairIDs (aData1.y(), aData2.y());
+          aChildren[aNbChildren++] = PairIDs (aData1.y(), aData2.z());
+          aChildren[aNbChildren++] = PairIDs (aData1.z(), aData2.y());
+          aChildren[aNbChildren++] = PairIDs (aData1.z(), aData2.z());
+        }
+        else if (aData1.x() == 0)
+        {
+          aChildren[aNbChildren++] = PairIDs (aData1.y(), aPair.ID2);
+          aChildren[aNbChildren++] = PairIDs (aData1.z(), aPair.ID2);
+        }
+        else
+        {
+          aChildren[aNbChildren++] = PairIDs (aPair.ID1, aData2.y());
+          aChildren[aNbChildren++] = PairIDs (aPair.ID1, aData2.z());
+        }
+
+        for (Standard_Integer iChild = 0; iChild < aNbChildren; ++iChild)
+        {
+          const PairIDs& aChild = aChildren[iChild];
+          Standard_Real aMetric = 0.0;
+          if (!RejectNode (theBVH1->MinPoint (aChild.ID1), theBVH1->MaxPoint (aChild.ID1),
+                           theBVH2->MinPoint (aChild.ID2), theBVH2->MaxPoint (aChild.ID2), aMetric))
+          {
+            aNextPairs.push_back (aChild);
+          }
+        }
+      }
+      theNodePairs.swap (aNextPairs);
+      if (!isSplit)
+      {
+        break;
+      }
+    }
+  }
+
+  //! Functor traversing the sub-trees of the pair of nodes by separate selector.
+  class SubTreeFunctor
+  {
+  public:
+    SubTreeFunctor (const BOPTools_PairSelector& theSelector,
+                    const opencascade::handle<BVH_Tree<Standard_Real, Dimension>>& theBVH1,
+                    const opencascade::handle<BVH_Tree<Standard_Real, Dimension>>& theBVH2,
+                    const std::vector<PairIDs>& theNodePairs,
+                    std::vector<std::vector<PairIDs>>& theTaskPairs)
+    : mySelector (theSelector), myBVH1 (theBVH1), myBVH2 (theBVH2),
+      myNodePairs (theNodePairs), myTaskPairs (theTaskPairs) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BOPTools_PairSelector aSelector;
+      aSelector.SetBVHSets (mySelector.myBVHSet1, mySelector.myBVHSet2);
+      aSelector.SetSame (mySelector.mySameBVHs);
+      aSelector.Select (myBVH1, myBVH2, myNodePairs[theIndex].ID1, myNodePairs[theIndex].ID2);
+      myTaskPairs[theIndex].swap (aSelector.myPairs);
+    }
+
+  private:
+    SubTreeFunctor (const SubTreeFunctor&);
+    SubTreeFunctor& operator= (const SubTreeFunctor&);
+
+  private:
+    const BOPTools_PairSelector& mySelector;
+    const opencascade::handle<BVH_Tree<Standard_Real, Dimension>>& myBVH1;
+    const opencascade::handle<BVH_Tree<Standard_Real, Dimension>>& myBVH2;
+    const std::vector<PairIDs>& myNodePairs;
+    std::vector<std::vector<PairIDs>>& myTaskPairs;
+  };
+
 protected: //! @name Fields
 
   std::vector<PairIDs> myPairs; //!< Selected pairs of indices
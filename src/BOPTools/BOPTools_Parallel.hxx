@@ -18,9 +18,13 @@
 #include <OSD_Parallel.hxx>
 #include <OSD_ThreadPool.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
 #include <Standard_Mutex.hxx>
 #include <OSD_Thread.hxx>
 
+#include <algorithm>
+#include <vector>
+
 //! Implementation of Functors/Starters
 class BOPTools_Parallel
 {
@@ -46,6 +50,19 @@ class BOPTools_Parallel
     TypeSolverVector& mySolvers;
   };
 
+  //! Creates the context for the worker thread sharing the thread-safe
+  //! tools (classifiers and bounding boxes) with the main thread context
+  template<class TypeContext>
+  static opencascade::handle<TypeContext> newThreadContext (const opencascade::handle<TypeContext>& theMainContext)
+  {
+    opencascade::handle<TypeContext> aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+    if (!theMainContext.IsNull())
+    {
+      aContext->SetSharedContext (theMainContext->SharedContext());
+    }
+    return aContext;
+  }
+
   //! Functor storing map of thread id -> algorithm context
   template<class TypeSolverVector, class TypeContext>
   class ContextFunctor
@@ -59,6 +76,7 @@ class BOPTools_Parallel
     void SetContext (const opencascade::handle<TypeContext>& theContext)
     {
       myContextMap.Bind (OSD_Thread::Current(), theContext);
+      myMainContext = theContext;
     }
 
     //! Returns current thread context
@@ -73,8 +91,8 @@ class BOPTools_Parallel
         }
       }
 
-      // Create new context
-      opencascade::handle<TypeContext> aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+      // Create new context sharing the thread-safe tools with the main thread context
+      opencascade::handle<TypeContext> aContext = newThreadContext (myMainContext);
 
       Standard_Mutex::Sentry aLocker (myMutex);
       myContextMap.Bind (aThreadID, aContext);
@@ -99,6 +117,7 @@ class BOPTools_Parallel
     TypeSolverVector& mySolverVector;
     mutable NCollection_DataMap<Standard_ThreadId, opencascade::handle<TypeContext>> myContextMap;
     mutable Standard_Mutex myMutex;
+    opencascade::handle<TypeContext> myMainContext;
   };
 
   //! Functor storing array of algorithm contexts per thread in pool
@@ -116,6 +135,7 @@ class BOPTools_Parallel
     void SetContext (const opencascade::handle<TypeContext>& theContext)
     {
       myContextArray.ChangeLast() = theContext; // OSD_ThreadPool::Launcher::UpperThreadIndex() is reserved for a main thread
+      myMainContext = theContext;
     }
 
     //! Defines functor interface with serialized thread index.
@@ -125,7 +145,7 @@ class BOPTools_Parallel
       opencascade::handle<TypeContext>& aContext = myContextArray.ChangeValue (theThreadIndex);
       if (aContext.IsNull())
       {
-        aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+        aContext = newThreadContext (myMainContext);
       }
       typename TypeSolverVector::value_type& aSolver = mySolverVector[theIndex];
       aSolver.SetContext (aContext);
@@ -139,8 +159,63 @@ class BOPTools_Parallel
   private:
     TypeSolverVector& mySolverVector;
     mutable NCollection_Array1< opencascade::handle<TypeContext> > myContextArray;
+    opencascade::handle<TypeContext> myMainContext;
+  };
+
+  //! Adaptor of the vector of solvers giving access to the solvers in the given order
+  template<class TypeSolverVector>
+  class OrderedVector
+  {
+  public:
+    typedef typename TypeSolverVector::value_type value_type;
+
+    //! Constructor.
+    OrderedVector (TypeSolverVector& theSolverVec, const std::vector<Standard_Integer>& theOrder)
+    : mySolvers (theSolverVec), myOrder (theOrder) {}
+
+    //! Returns the number of solvers.
+    Standard_Integer Length() const { return mySolvers.Length(); }
+
+    //! Returns the solver with the given position in the order.
+    value_type& operator[] (const Standard_Integer theIndex) const { return mySolvers[myOrder[theIndex]]; }
+
+  private:
+    OrderedVector(const OrderedVector&);
+    OrderedVector& operator= (const OrderedVector&);
+
+  private:
+    TypeSolverVector& mySolvers;
+    const std::vector<Standard_Integer>& myOrder;
+  };
+
+  //! Compares the indices of the solvers by decreasing cost
+  class CostComparator
+  {
+  public:
+    CostComparator (const NCollection_Vector<Standard_Real>& theCosts) : myCosts (&theCosts) {}
+
+    bool operator() (const Standard_Integer theIndex1, const Standard_Integer theIndex2) const
+    {
+      return myCosts->Value (theIndex1) > myCosts->Value (theIndex2);
+    }
+
+  private:
+    const NCollection_Vector<Standard_Real>* myCosts;
   };
 
+  //! Returns the indices of the solvers sorted by decreasing cost,
+  //! keeping the initial order of the solvers with equal cost
+  static std::vector<Standard_Integer> decreasingCostOrder (const NCollection_Vector<Standard_Real>& theCosts)
+  {
+    std::vector<Standard_Integer> anOrder (theCosts.Length());
+    for (Standard_Integer i = 0; i < theCosts.Length(); ++i)
+    {
+      anOrder[i] = i;
+    }
+    std::stable_sort (anOrder.begin(), anOrder.end(), CostComparator (theCosts));
+    return anOrder;
+  }
+
 public:
 
   //! Pure version
@@ -173,6 +248,45 @@ public:
       OSD_Parallel::For (0, theSolverVector.Length(), aFunctor, !theIsRunParallel);
     }
   }
+
+  //! Pure version with the solvers started in the order of decreasing estimated cost.
+  //! The solvers are distributed among the threads dynamically, so that starting
+  //! the most expensive solvers first prevents the long tail of expensive solvers
+  //! processed by few threads at the end, while the other threads are idle.
+  //! In single-threaded mode the solvers are processed in the initial order.
+  //! @param theCosts estimated costs of the solvers, in the order of the vector
+  template<class TypeSolverVector>
+  static void Perform (Standard_Boolean theIsRunParallel,
+                       TypeSolverVector& theSolverVector,
+                       const NCollection_Vector<Standard_Real>& theCosts)
+  {
+    if (!theIsRunParallel || theCosts.Length() != theSolverVector.Length())
+    {
+      Perform (theIsRunParallel, theSolverVector);
+      return;
+    }
+    const std::vector<Standard_Integer> anOrder = decreasingCostOrder (theCosts);
+    OrderedVector<TypeSolverVector> anOrderedVector (theSolverVector, anOrder);
+    Perform (theIsRunParallel, anOrderedVector);
+  }
+
+  //! Context dependent version with the solvers started in the order of decreasing estimated cost.
+  //! @param theCosts estimated costs of the solvers, in the order of the vector
+  template<class TypeSolverVector, class TypeContext>
+  static void Perform (Standard_Boolean  theIsRunParallel,
+                       TypeSolverVector& theSolverVector,
+                       opencascade::handle<TypeContext>& theContext,
+                       const NCollection_Vector<Standard_Real>& theCosts)
+  {
+    if (!theIsRunParallel || theCosts.Length() != theSolverVector.Length())
+    {
+      Perform (theIsRunParallel, theSolverVector, theContext);
+      return;
+    }
+    const std::vector<Standard_Integer> anOrder = decreasingCostOrder (theCosts);
+    OrderedVector<TypeSolverVector> anOrderedVector (theSolverVector, anOrder);
+    Perform (theIsRunParallel, anOrderedVector, theContext);
+  }
 };
 
 #endif
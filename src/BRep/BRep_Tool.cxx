@@ -114,7 +114,12 @@ const Handle(Poly_Triangulation)& BRep_Tool::Triangulation (const TopoDS_Face& t
 {
   theLocation = theFace.Location();
   const BRep_TFace* aTFace = static_cast<const BRep_TFace*>(theFace.TShape().get());
-  return aTFace->Triangulation (theMeshPurpose);
+  const Handle(Poly_Triangulation)& aTriangulation = aTFace->Triangulation (theMeshPurpose);
+  if (!aTriangulation.IsNull())
+  {
+    aTriangulation->LoadOnAccess();
+  }
+  return aTriangulation;
 }
 
 //=======================================================================
@@ -677,6 +682,10 @@ BRep_Tool::PolygonOnTriangulation(const TopoDS_Edge&                   E,
       P = PT->PolygonOnTriangulation();
       T = PT->Triangulation();
       L = E.Location() * PT->Location();
+      if (!T.IsNull())
+      {
+        T->LoadOnAccess();
+      }
       return;
     }
     itcr.Next();
@@ -716,6 +725,10 @@ BRep_Tool::PolygonOnTriangulation(const TopoDS_Edge&                   E,
         T = PT->Triangulation();
         P = PT->PolygonOnTriangulation();
         L = E.Location() * PT->Location();
+        if (!T.IsNull())
+        {
+          T->LoadOnAccess();
+        }
         return;
       }
     }
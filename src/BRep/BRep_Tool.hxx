@@ -72,6 +72,8 @@ public:
   //!         the first triangulation appropriate for the input purpose,
   //!         just the first triangulation if none matching other criteria and input purpose is AnyFallback
   //!         or null handle if there is no any suitable triangulation.
+  //! Data of the found triangulation is loaded from deferred storage if it allows loading on access
+  //! (see Poly_Triangulation::LoadOnAccess()).
   Standard_EXPORT static const Handle(Poly_Triangulation)& Triangulation (const TopoDS_Face& theFace, TopLoc_Location& theLocation,
                                                                           const Poly_MeshPurpose theMeshPurpose = Poly_MeshPurpose_NONE);
 
@@ -130,6 +130,7 @@ void BRepAlgoAPI_BuilderAlgo::IntersectShapes(const TopTools_ListOfShape& theArg
   myDSFiller->SetNonDestructive(myNonDestructive);
   myDSFiller->SetGlue(myGlue);
   myDSFiller->SetUseOBB(myUseOBB);
+  myDSFiller->SetIntersectionCache(myIntersectionCache);
   // Set Face/Face intersection options to the intersection algorithm
   SetAttributes();
   // Perform intersection
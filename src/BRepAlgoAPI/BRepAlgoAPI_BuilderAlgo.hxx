@@ -20,6 +20,7 @@
 #include <Standard_Handle.hxx>
 
 #include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_IntersectionCache.hxx>
 #include <BOPAlgo_PPaveFiller.hxx>
 #include <BOPAlgo_PBuilder.hxx>
 #include <BRepAlgoAPI_Algo.hxx>
@@ -133,6 +134,21 @@ public: //! @name Setting options
     return myCheckInverted;
   }
 
+  //! Sets the cache of intersection results to be shared between the operations.
+  //! Repeating the operation on the arguments modified partially (e.g. moved tool)
+  //! the intersections of their unchanged parts are not recomputed.
+  //! The cache is most efficient in non-destructive mode (see SetNonDestructive()).
+  void SetIntersectionCache(const Handle(BOPAlgo_IntersectionCache)& theCache)
+  {
+    myIntersectionCache = theCache;
+  }
+
+  //! Returns the cache of intersection results.
+  const Handle(BOPAlgo_IntersectionCache)& IntersectionCache() const
+  {
+    return myIntersectionCache;
+  }
+
 
 public: //! @name Performing the operation
 
@@ -270,6 +286,7 @@ protected: //! @name Fields
   Standard_Boolean myNonDestructive; //!< Non-destructive mode management
   BOPAlgo_GlueEnum myGlue;           //!< Gluing mode management
   Standard_Boolean myCheckInverted;  //!< Check for inverted solids management
+  Handle(BOPAlgo_IntersectionCache) myIntersectionCache; //!< Cache of intersection results
   Standard_Boolean myFillHistory;    //!< Controls the history collection
 
   // Tools
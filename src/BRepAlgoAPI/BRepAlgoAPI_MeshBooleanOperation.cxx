@@ -0,0 +1,333 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepAlgoAPI_MeshBooleanOperation.hxx>
+
+#include <BOPAlgo_Alerts.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Vector.hxx>
+#include <Poly_MeshBoolean.hxx>
+#include <Precision.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Vertex.hxx>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  //! Compares the indexes of the nodes by the X coordinate of the nodes.
+  struct NodeXComparator
+  {
+    NodeXComparator (const NCollection_Vector<gp_XYZ>& theNodes) : myNodes (&theNodes) {}
+
+    bool operator() (const int theIndex1, const int theIndex2) const
+    {
+      return myNodes->Value (theIndex1).X() < myNodes->Value (theIndex2).X();
+    }
+
+    const NCollection_Vector<gp_XYZ>* myNodes;
+  };
+}
+
+//=======================================================================
+//function : BRepAlgoAPI_MeshBooleanOperation
+//purpose  :
+//=======================================================================
+BRepAlgoAPI_MeshBooleanOperation::BRepAlgoAPI_MeshBooleanOperation()
+:
+  BRepAlgoAPI_Algo(),
+  myOperation(BOPAlgo_UNKNOWN),
+  myNbCandidatePairs(0),
+  myNbSplitTriangles(0)
+{
+}
+
+//=======================================================================
+//function : BRepAlgoAPI_MeshBooleanOperation
+//purpose  :
+//=======================================================================
+BRepAlgoAPI_MeshBooleanOperation::BRepAlgoAPI_MeshBooleanOperation
+  (const TopoDS_Shape& theS1,
+   const TopoDS_Shape& theS2,
+   const BOPAlgo_Operation theOperation,
+   const Message_ProgressRange& theRange)
+:
+  BRepAlgoAPI_Algo(),
+  myObject(theS1),
+  myTool(theS2),
+  myOperation(theOperation),
+  myNbCandidatePairs(0),
+  myNbSplitTriangles(0)
+{
+  Build(theRange);
+}
+
+//=======================================================================
+//function : Build
+//purpose  :
+//=======================================================================
+void BRepAlgoAPI_MeshBooleanOperation::Build(const Message_ProgressRange& theRange)
+{
+  // Set not done state for the operation
+  NotDone();
+
+  // Clear the contents
+  Clear();
+  myShape.Nullify();
+  myTriangulation.Nullify();
+  myNbCandidatePairs = 0;
+  myNbSplitTriangles = 0;
+
+  if (myObject.IsNull() || myTool.IsNull())
+  {
+    AddError (new BOPAlgo_AlertNullInputShapes);
+    return;
+  }
+
+  Poly_MeshBoolean::Operation anOperation = Poly_MeshBoolean::Operation_Fuse;
+  Standard_Boolean isSwapped = Standard_False;
+  switch (myOperation)
+  {
+    case BOPAlgo_FUSE:    anOperation = Poly_MeshBoolean::Operation_Fuse;    break;
+    case BOPAlgo_COMMON:  anOperation = Poly_MeshBoolean::Operation_Common;  break;
+    case BOPAlgo_CUT:     anOperation = Poly_MeshBoolean::Operation_Cut;     break;
+    case BOPAlgo_CUT21:   anOperation = Poly_MeshBoolean::Operation_Cut;
+                          isSwapped = Standard_True;                          break;
+    case BOPAlgo_SECTION: anOperation = Poly_MeshBoolean::Operation_Section; break;
+    default:
+    {
+      AddError (new BOPAlgo_AlertBOPNotSet);
+      return;
+    }
+  }
+
+  Message_ProgressScope aPS (theRange, "Performing mesh Boolean operation", 10);
+
+  // Combine the triangulations of the faces of the arguments
+  const Standard_Real aTolerance = Precision::Confusion() + myFuzzyValue;
+  Handle(Poly_Triangulation) aMeshes[2];
+  const TopoDS_Shape* anArgs[2] = { &myObject, &myTool };
+  for (Standard_Integer anArgIter = 0; anArgIter < 2; ++anArgIter)
+  {
+    TopoDS_Shape aFaceWithoutMesh;
+    aMeshes[anArgIter] = CombineTriangulations (*anArgs[anArgIter], aTolerance, aFaceWithoutMesh);
+    if (aMeshes[anArgIter].IsNull())
+    {
+      AddError (new BOPAlgo_AlertNoTriangulation (aFaceWithoutMesh));
+      return;
+    }
+  }
+  if (isSwapped)
+  {
+    std::swap (aMeshes[0], aMeshes[1]);
+  }
+  aPS.Next();
+  if (UserBreak (aPS))
+  {
+    return;
+  }
+
+  Handle(Poly_MeshBoolean) aTool = new Poly_MeshBoolean();
+  aTool->SetOperation (anOperation);
+  aTool->SetRunParallel (myRunParallel == Standard_True);
+  aTool->SetTolerance (aTolerance);
+  const bool isDone = aTool->Perform (aMeshes[0], aMeshes[1], aPS.Next (9));
+  myNbCandidatePairs = aTool->NbCandidatePairs();
+  myNbSplitTriangles = aTool->NbSplitTriangles();
+
+  BRep_Builder aBB;
+  if (!isDone)
+  {
+    if (UserBreak (aPS))
+    {
+      return;
+    }
+    if (aTool->NbOpenEdges() > 0)
+    {
+      // the open result is attached to the alert for analysis
+      TopoDS_Face aFace;
+      aBB.MakeFace (aFace, aTool->Result());
+      AddError (new BOPAlgo_AlertMeshNotClosed (aFace));
+      return;
+    }
+    AddError (new BOPAlgo_AlertBuilderFailed);
+    return;
+  }
+
+  if (anOperation == Poly_MeshBoolean::Operation_Section)
+  {
+    // Make the edges from the intersection lines
+    TopoDS_Compound aCompound;
+    aBB.MakeCompound (aCompound);
+    for (NCollection_Sequence<Handle(Poly_Polygon3D)>::Iterator aLineIter (aTool->SectionLines()); aLineIter.More(); aLineIter.Next())
+    {
+      const Handle(Poly_Polygon3D)& aPolygon = aLineIter.Value();
+      const TColgp_Array1OfPnt& aNodes = aPolygon->Nodes();
+      const Standard_Real aDeflection = aPolygon->Deflection();
+      TopoDS_Vertex aV1, aV2;
+      aBB.MakeVertex (aV1, aNodes.First(), Precision::Confusion());
+      if (aNodes.First().IsEqual (aNodes.Last(), 0.0))
+      {
+        aV2 = aV1;
+      }
+      else
+      {
+        aBB.MakeVertex (aV2, aNodes.Last(), Precision::Confusion());
+      }
+
+      TopoDS_Edge anEdge;
+      aBB.MakeEdge (anEdge, aPolygon);
+      aBB.Add (anEdge, aV1.Oriented (TopAbs_FORWARD));
+      aBB.Add (anEdge, aV2.Oriented (TopAbs_REVERSED));
+      aBB.UpdateEdge (anEdge, Max (aDeflection, Precision::Confusion()));
+      aBB.Add (aCompound, anEdge);
+    }
+    myShape = aCompound;
+  }
+  else if (aTool->Result()->NbTriangles() > 0)
+  {
+    myTriangulation = aTool->Result();
+    TopoDS_Face aFace;
+    aBB.MakeFace (aFace, myTriangulation);
+    myShape = aFace;
+  }
+  else
+  {
+    TopoDS_Compound aCompound;
+    aBB.MakeCompound (aCompound);
+    myShape = aCompound;
+  }
+
+  // Set done state
+  Done();
+}
+
+//=======================================================================
+//function : CombineTriangulations
+//purpose  :
+//=======================================================================
+Handle(Poly_Triangulation) BRepAlgoAPI_MeshBooleanOperation::CombineTriangulations
+  (const TopoDS_Shape& theShape,
+   const Standard_Real theTolerance,
+   TopoDS_Shape& theFaceWithoutMesh)
+{
+  NCollection_Vector<gp_XYZ> aNodes;
+  NCollection_Vector<Poly_Triangle> aTriangles;
+  Standard_Real aDeflection = 0.0;
+  for (TopExp_Explorer anExp (theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (anExp.Current());
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+    if (aTriangulation.IsNull())
+    {
+      theFaceWithoutMesh = aFace;
+      return Handle(Poly_Triangulation)();
+    }
+
+    aDeflection = Max (aDeflection, aTriangulation->Deflection());
+    const gp_Trsf& aTrsf = aLoc.Transformation();
+    const Standard_Integer aNodeOffset = aNodes.Length();
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aTriangulation->NbNodes(); ++aNodeIter)
+    {
+      aNodes.Append (aTriangulation->Node (aNodeIter).Transformed (aTrsf).XYZ());
+    }
+
+    const Standard_Boolean isReversed = (aFace.Orientation() == TopAbs_REVERSED) != (aTrsf.IsNegative() == Standard_True);
+    for (Standard_Integer aTriIter = 1; aTriIter <= aTriangulation->NbTriangles(); ++aTriIter)
+    {
+      Standard_Integer aN1, aN2, aN3;
+      aTriangulation->Triangle (aTriIter).Get (aN1, aN2, aN3);
+      if (isReversed)
+      {
+        std::swap (aN2, aN3);
+      }
+      aTriangles.Append (Poly_Triangle (aN1 + aNodeOffset, aN2 + aNodeOffset, aN3 + aNodeOffset));
+    }
+  }
+
+  // Merge the coincident nodes of the adjacent faces, sweeping the nodes sorted by X coordinate
+  const Standard_Integer aNbNodes = aNodes.Length();
+  std::vector<int> aSorted (aNbNodes);
+  for (Standard_Integer aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+  {
+    aSorted[aNodeIter] = aNodeIter;
+  }
+  std::sort (aSorted.begin(), aSorted.end(), NodeXComparator (aNodes));
+
+  const Standard_Real aSqTolerance = theTolerance * theTolerance;
+  std::vector<int> aNodeMap (aNbNodes, -1);
+  std::vector<gp_XYZ> aMergedNodes;
+  aMergedNodes.reserve (aNbNodes);
+  for (Standard_Integer aSortIter = 0; aSortIter < aNbNodes; ++aSortIter)
+  {
+    const Standard_Integer aNode = aSorted[aSortIter];
+    if (aNodeMap[aNode] != -1)
+    {
+      continue;
+    }
+
+    const gp_XYZ& aPnt = aNodes.Value (aNode);
+    aMergedNodes.push_back (aPnt);
+    const Standard_Integer aMergedIndex = Standard_Integer (aMergedNodes.size());
+    aNodeMap[aNode] = aMergedIndex;
+    for (Standard_Integer aNextIter = aSortIter + 1; aNextIter < aNbNodes; ++aNextIter)
+    {
+      const Standard_Integer anOther = aSorted[aNextIter];
+      const gp_XYZ& anOtherPnt = aNodes.Value (anOther);
+      if (anOtherPnt.X() - aPnt.X() > theTolerance)
+      {
+        break;
+      }
+      if (aNodeMap[anOther] == -1
+       && (anOtherPnt - aPnt).SquareModulus() <= aSqTolerance)
+      {
+        aNodeMap[anOther] = aMergedIndex;
+      }
+    }
+  }
+
+  Handle(Poly_Triangulation) aMesh = new Poly_Triangulation();
+  aMesh->SetDoublePrecision (true);
+  aMesh->ResizeNodes (Standard_Integer (aMergedNodes.size()), false);
+  for (size_t aNodeIter = 0; aNodeIter < aMergedNodes.size(); ++aNodeIter)
+  {
+    aMesh->SetNode (Standard_Integer (aNodeIter) + 1, gp_Pnt (aMergedNodes[aNodeIter]));
+  }
+
+  // Skip the triangles degenerated by merging of the nodes
+  Standard_Integer aNbTriangles = 0;
+  aMesh->ResizeTriangles (aTriangles.Length(), false);
+  for (NCollection_Vector<Poly_Triangle>::Iterator aTriIter (aTriangles); aTriIter.More(); aTriIter.Next())
+  {
+    Standard_Integer aN1, aN2, aN3;
+    aTriIter.Value().Get (aN1, aN2, aN3);
+    aN1 = aNodeMap[aN1 - 1];
+    aN2 = aNodeMap[aN2 - 1];
+    aN3 = aNodeMap[aN3 - 1];
+    if (aN1 != aN2 && aN2 != aN3 && aN1 != aN3)
+    {
+      aMesh->SetTriangle (++aNbTriangles, Poly_Triangle (aN1, aN2, aN3));
+    }
+  }
+  aMesh->ResizeTriangles (aNbTriangles, true);
+  aMesh->Deflection (aDeflection);
+  return aMesh;
+}
@@ -0,0 +1,190 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepAlgoAPI_MeshBooleanOperation_HeaderFile
+#define _BRepAlgoAPI_MeshBooleanOperation_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Handle.hxx>
+
+#include <BOPAlgo_Operation.hxx>
+#include <BRepAlgoAPI_Algo.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! The class BRepAlgoAPI_MeshBooleanOperation is the API algorithm performing
+//! the Boolean operations (Fuse, Common, Cut and Section) on the triangulations
+//! of the shapes instead of their geometry.
+//!
+//! The operation is performed by the polyhedral Boolean engine *Poly_MeshBoolean*,
+//! which is much faster than the general Boolean operation on the shapes defined by
+//! the triangulations only (e.g. the shapes read from STL, OBJ or tessellated STEP files),
+//! or on the shapes which are to be exported as meshes anyway.
+//!
+//! <b>Input data</b>
+//!
+//! Each argument may be any shape with the triangulated faces, e.g. the single face
+//! with the triangulation only or the solid meshed by *BRepMesh_IncrementalMesh*.
+//! The triangulations of all faces of the argument are combined into one mesh
+//! taking into account the locations and the orientations of the faces, and the nodes
+//! of the adjacent faces are merged with the tolerance *Precision::Confusion()*
+//! increased by the fuzzy value of the operation.
+//! The combined mesh should be closed (watertight) and bound a volume.
+//! The nodes of one argument lying within the same tolerance from the nodes of the other one
+//! are moved onto these nodes, so that the shared surfaces meshed with rounding differences
+//! coincide exactly in the operation.
+//!
+//! <b>Result</b>
+//!
+//! The result of the Fuse, Common and Cut operations is the face with the closed
+//! triangulation only (without the surface), the result of the Section operation
+//! is the compound of the edges defined by the 3D polygons only.
+//! The result of the Common operation of disjoint arguments is the empty compound.
+//!
+//! <b>Options</b>
+//!
+//! The algorithm supports the following options of the base class:
+//! - Error/Warning reporting system;
+//! - Parallel processing mode;
+//! - Fuzzy tolerance, used for merging of the nodes within each argument and between the arguments.
+//!
+//! The history of the modification of the shapes is not supported.
+//!
+//! The algorithm returns the following Error alerts:
+//! - *BOPAlgo_AlertNullInputShapes* - in case some of the arguments are null shapes;
+//! - *BOPAlgo_AlertBOPNotSet* - in case the type of the operation is not set;
+//! - *BOPAlgo_AlertNoTriangulation* - in case some face of the arguments has no triangulation;
+//! - *BOPAlgo_AlertMeshNotClosed* - in case the result is not closed, i.e. some edge of the resulting
+//!   triangulation has no single oppositely oriented partner; the open result is attached to the alert;
+//! - *BOPAlgo_AlertBuilderFailed* - in case the operation has failed;
+//! - *BOPAlgo_AlertUserBreak* - in case the operation was stopped by the user.
+//!
+//! Here is the example of usage of the algorithm:
+//! ~~~~
+//! BRepMesh_IncrementalMesh (aS1, 0.01);
+//! BRepMesh_IncrementalMesh (aS2, 0.01);
+//! BRepAlgoAPI_MeshBooleanOperation aBOP (aS1, aS2, BOPAlgo_CUT);
+//! if (!aBOP.IsDone())
+//! {
+//!   // errors treatment
+//! }
+//! const TopoDS_Shape& aResult = aBOP.Shape(); // face with the resulting triangulation
+//! ~~~~
+class BRepAlgoAPI_MeshBooleanOperation : public BRepAlgoAPI_Algo
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+public: //! @name Constructors
+
+  //! Empty constructor
+  Standard_EXPORT BRepAlgoAPI_MeshBooleanOperation();
+
+  //! Constructor performing the operation on the given arguments
+  //! @param theS1 [in] The first argument (object) of the operation
+  //! @param theS2 [in] The second argument (tool) of the operation
+  //! @param theOperation [in] The type of the operation
+  //! @param theRange [in] The progress indicator
+  Standard_EXPORT BRepAlgoAPI_MeshBooleanOperation(const TopoDS_Shape& theS1,
+                                                   const TopoDS_Shape& theS2,
+                                                   const BOPAlgo_Operation theOperation,
+                                                   const Message_ProgressRange& theRange = Message_ProgressRange());
+
+public: //! @name Setting/getting arguments
+
+  //! Sets the first argument (object) of the operation
+  void SetObject(const TopoDS_Shape& theShape)
+  {
+    myObject = theShape;
+  }
+
+  //! Returns the first argument (object) of the operation
+  const TopoDS_Shape& Object() const
+  {
+    return myObject;
+  }
+
+  //! Sets the second argument (tool) of the operation
+  void SetTool(const TopoDS_Shape& theShape)
+  {
+    myTool = theShape;
+  }
+
+  //! Returns the second argument (tool) of the operation
+  const TopoDS_Shape& Tool() const
+  {
+    return myTool;
+  }
+
+  //! Sets the type of the operation
+  void SetOperation(const BOPAlgo_Operation theOperation)
+  {
+    myOperation = theOperation;
+  }
+
+  //! Returns the type of the operation
+  BOPAlgo_Operation Operation() const
+  {
+    return myOperation;
+  }
+
+public: //! @name Performing the operation
+
+  //! Performs the operation
+  Standard_EXPORT virtual void Build(const Message_ProgressRange& theRange = Message_ProgressRange()) Standard_OVERRIDE;
+
+  //! Returns the resulting triangulation of the Fuse, Common and Cut operations.
+  const Handle(Poly_Triangulation)& Triangulation() const
+  {
+    return myTriangulation;
+  }
+
+  //! Returns the number of pairs of triangles with interfering bounding boxes.
+  Standard_Integer NbCandidatePairs() const
+  {
+    return myNbCandidatePairs;
+  }
+
+  //! Returns the number of triangles of the arguments split by the intersection lines.
+  Standard_Integer NbSplitTriangles() const
+  {
+    return myNbSplitTriangles;
+  }
+
+public: //! @name Auxiliary methods
+
+  //! Combines the triangulations of all faces of the shape into one mesh
+  //! with the locations of the faces applied and the triangles of the reversed faces reversed.
+  //! The coincident nodes of the adjacent faces are merged with the given tolerance.
+  //! @param theShape [in] The shape to combine the triangulations of the faces
+  //! @param theTolerance [in] The tolerance for merging of the nodes
+  //! @param theFaceWithoutMesh [out] The face without triangulation, in case of failure
+  //! @return the combined mesh or NULL if some face has no triangulation
+  Standard_EXPORT static Handle(Poly_Triangulation) CombineTriangulations (const TopoDS_Shape& theShape,
+                                                                          const Standard_Real theTolerance,
+                                                                          TopoDS_Shape& theFaceWithoutMesh);
+
+protected: //! @name Fields
+
+  TopoDS_Shape myObject;                      //!< First argument of the operation
+  TopoDS_Shape myTool;                        //!< Second argument of the operation
+  BOPAlgo_Operation myOperation;              //!< Type of the operation
+  Handle(Poly_Triangulation) myTriangulation; //!< Resulting triangulation
+  Standard_Integer myNbCandidatePairs;        //!< Number of pairs of interfering triangles
+  Standard_Integer myNbSplitTriangles;        //!< Number of split triangles
+
+};
+
+#endif // _BRepAlgoAPI_MeshBooleanOperation_HeaderFile
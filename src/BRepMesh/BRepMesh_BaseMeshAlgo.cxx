@@ -56,7 +56,9 @@ void BRepMesh_BaseMeshAlgo::Perform(
     myDFace      = theDFace;
     myParameters = theParameters;
     myAllocator  = new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
-    myStructure  = new BRepMesh_DataStructureOfDelaun(myAllocator);
+    myStructure  = new BRepMesh_DataStructureOfDelaun(myAllocator, 100,
+      theParameters.FlatDataStructure ? BRepMesh_DataStructureOfDelaun::Storage_Flat
+                                      : BRepMesh_DataStructureOfDelaun::Storage_Maps);
     myNodesMap   = new VectorOfPnt(256, myAllocator);
     myUsedNodes  = new DMapOfIntegerInteger(1, myAllocator);
 
@@ -0,0 +1,505 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_CircleCells.hxx>
+
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define HAVE_SSE2_KERNEL
+  #include <emmintrin.h>
+
+  #if defined(_MSC_VER) && !defined(__clang__)
+    #define HAVE_AVX2_KERNEL
+    #define AVX2_KERNEL_TARGET
+    #include <immintrin.h>
+    #include <intrin.h>
+  #elif (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))) || defined(__clang__)
+    #define HAVE_AVX2_KERNEL
+    #define AVX2_KERNEL_TARGET __attribute__((target("avx2")))
+    #include <immintrin.h>
+  #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #define HAVE_NEON_KERNEL
+  #include <arm_neon.h>
+#endif
+
+namespace
+{
+  //! Kernel checking circles of a cell against the point.
+  //! Writes positions of circles shot by the point into theHits and returns their number.
+  //! The check is the same for all kernels: (dx * dx + dy * dy) - R^2 <= Tol.
+  typedef Standard_Integer (*CircleKernel) (const Standard_Real*   theLocationX,
+                                            const Standard_Real*   theLocationY,
+                                            const Standard_Real*   theSqRadius,
+                                            const Standard_Integer theNbCircles,
+                                            const Standard_Real    thePointX,
+                                            const Standard_Real    thePointY,
+                                            const Standard_Real    theSqTolerance,
+                                            Standard_Integer*      theHits);
+
+  //! Checks circles one by one starting from the given position.
+  inline Standard_Integer checkCircles (const Standard_Real*   theLocationX,
+                                        const Standard_Real*   theLocationY,
+                                        const Standard_Real*   theSqRadius,
+                                        const Standard_Integer theFrom,
+                                        const Standard_Integer theNbCircles,
+                                        const Standard_Real    thePointX,
+                                        const Standard_Real    thePointY,
+                                        const Standard_Real    theSqTolerance,
+                                        Standard_Integer*      theHits,
+                                        Standard_Integer       theNbHits)
+  {
+    for (Standard_Integer aCircleIt = theFrom; aCircleIt < theNbCircles; ++aCircleIt)
+    {
+      const Standard_Real aDX = thePointX - theLocationX[aCircleIt];
+      const Standard_Real aDY = thePointY - theLocationY[aCircleIt];
+      if ((aDX * aDX + aDY * aDY) - theSqRadius[aCircleIt] <= theSqTolerance)
+      {
+        theHits[theNbHits++] = aCircleIt;
+      }
+    }
+    return theNbHits;
+  }
+
+  //! Scalar kernel.
+  Standard_Integer scalarKernel (const Standard_Real*   theLocationX,
+                                 const Standard_Real*   theLocationY,
+                                 const Standard_Real*   theSqRadius,
+                                 const Standard_Integer theNbCircles,
+                                 const Standard_Real    thePointX,
+                                 const Standard_Real    thePointY,
+                                 const Standard_Real    theSqTolerance,
+                                 Standard_Integer*      theHits)
+  {
+    return checkCircles (theLocationX, theLocationY, theSqRadius, 0, theNbCircles,
+                         thePointX, thePointY, theSqTolerance, theHits, 0);
+  }
+
+#ifdef HAVE_SSE2_KERNEL
+  //! SSE2 kernel checking two circles at once.
+  Standard_Integer sse2Kernel (const Standard_Real*   theLocationX,
+                               const Standard_Real*   theLocationY,
+                               const Standard_Real*   theSqRadius,
+                               const Standard_Integer theNbCircles,
+                               const Standard_Real    thePointX,
+                               const Standard_Real    thePointY,
+                               const Standard_Real    theSqTolerance,
+                               Standard_Integer*      theHits)
+  {
+    const __m128d aPointX = _mm_set1_pd (thePointX);
+    const __m128d aPointY = _mm_set1_pd (thePointY);
+    const __m128d aSqTol  = _mm_set1_pd (theSqTolerance);
+
+    Standard_Integer aNbHits = 0, aCircleIt = 0;
+    for (; aCircleIt + 2 <= theNbCircles; aCircleIt += 2)
+    {
+      const __m128d aDX = _mm_sub_pd (aPointX, _mm_loadu_pd (theLocationX + aCircleIt));
+      const __m128d aDY = _mm_sub_pd (aPointY, _mm_loadu_pd (theLocationY + aCircleIt));
+      const __m128d aSqDist = _mm_add_pd (_mm_mul_pd (aDX, aDX), _mm_mul_pd (aDY, aDY));
+      const int aMask = _mm_movemask_pd (
+        _mm_cmple_pd (_mm_sub_pd (aSqDist, _mm_loadu_pd (theSqRadius + aCircleIt)), aSqTol));
+      if (aMask != 0)
+      {
+        if (aMask & 1) theHits[aNbHits++] = aCircleIt;
+        if (aMask & 2) theHits[aNbHits++] = aCircleIt + 1;
+      }
+    }
+    return checkCircles (theLocationX, theLocationY, theSqRadius, aCircleIt, theNbCircles,
+                         thePointX, thePointY, theSqTolerance, theHits, aNbHits);
+  }
+#endif
+
+#ifdef HAVE_AVX2_KERNEL
+  //! AVX2 kernel checking four circles at once.
+  //! Multiplication and addition are not fused to give exactly the same result as other kernels.
+  AVX2_KERNEL_TARGET
+  Standard_Integer avx2Kernel (const Standard_Real*   theLocationX,
+                               const Standard_Real*   theLocationY,
+                               const Standard_Real*   theSqRadius,
+                               const Standard_Integer theNbCircles,
+                               const Standard_Real    thePointX,
+                               const Standard_Real    thePointY,
+                               const Standard_Real    theSqTolerance,
+                               Standard_Integer*      theHits)
+  {
+    const __m256d aPointX = _mm256_set1_pd (thePointX);
+    const __m256d aPointY = _mm256_set1_pd (thePointY);
+    const __m256d aSqTol  = _mm256_set1_pd (theSqTolerance);
+
+    Standard_Integer aNbHits = 0, aCircleIt = 0;
+    for (; aCircleIt + 4 <= theNbCircles; aCircleIt += 4)
+    {
+      const __m256d aDX = _mm256_sub_pd (aPointX, _mm256_loadu_pd (theLocationX + aCircleIt));
+      const __m256d aDY = _mm256_sub_pd (aPointY, _mm256_loadu_pd (theLocationY + aCircleIt));
+      const __m256d aSqDist = _mm256_add_pd (_mm256_mul_pd (aDX, aDX), _mm256_mul_pd (aDY, aDY));
+      const int aMask = _mm256_movemask_pd (
+        _mm256_cmp_pd (_mm256_sub_pd (aSqDist, _mm256_loadu_pd (theSqRadius + aCircleIt)), aSqTol, _CMP_LE_OQ));
+      for (int aMaskIt = aMask; aMaskIt != 0; aMaskIt &= aMaskIt - 1)
+      {
+        const int aLane = (aMaskIt & 1) ? 0 : (aMaskIt & 2) ? 1 : (aMaskIt & 4) ? 2 : 3;
+        theHits[aNbHits++] = aCircleIt + aLane;
+      }
+    }
+    return checkCircles (theLocationX, theLocationY, theSqRadius, aCircleIt, theNbCircles,
+                         thePointX, thePointY, theSqTolerance, theHits, aNbHits);
+  }
+
+  //! Returns TRUE if the processor and the system support AVX2 instructions.
+  bool hasAvx2()
+  {
+  #if defined(_MSC_VER) && !defined(__clang__)
+    int aRegs[4];
+    __cpuid (aRegs, 0);
+    if (aRegs[0] < 7)
+    {
+      return false;
+    }
+    __cpuid (aRegs, 1);
+    const bool hasOsXSave = (aRegs[2] & (1 << 27)) != 0;
+    const bool hasAvx     = (aRegs[2] & (1 << 28)) != 0;
+    if (!hasOsXSave || !hasAvx || (_xgetbv (0) & 0x6) != 0x6)
+    {
+      return false;
+    }
+    __cpuidex (aRegs, 7, 0);
+    return (aRegs[1] & (1 << 5)) != 0;
+  #else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports ("avx2") != 0;
+  #endif
+  }
+#endif
+
+#ifdef HAVE_NEON_KERNEL
+  //! NEON kernel checking two circles at once.
+  Standard_Integer neonKernel (const Standard_Real*   theLocationX,
+                               const Standard_Real*   theLocationY,
+                               const Standard_Real*   theSqRadius,
+                               const Standard_Integer theNbCircles,
+                               const Standard_Real    thePointX,
+                               const Standard_Real    thePointY,
+                               const Standard_Real    theSqTolerance,
+                               Standard_Integer*      theHits)
+  {
+    const float64x2_t aPointX = vdupq_n_f64 (thePointX);
+    const float64x2_t aPointY = vdupq_n_f64 (thePointY);
+    const float64x2_t aSqTol  = vdupq_n_f64 (theSqTolerance);
+
+    Standard_Integer aNbHits = 0, aCircleIt = 0;
+    for (; aCircleIt + 2 <= theNbCircles; aCircleIt += 2)
+    {
+      const float64x2_t aDX = vsubq_f64 (aPointX, vld1q_f64 (theLocationX + aCircleIt));
+      const float64x2_t aDY = vsubq_f64 (aPointY, vld1q_f64 (theLocationY + aCircleIt));
+      const float64x2_t aSqDist = vaddq_f64 (vmulq_f64 (aDX, aDX), vmulq_f64 (aDY, aDY));
+      const uint64x2_t aMask = vcleq_f64 (vsubq_f64 (aSqDist, vld1q_f64 (theSqRadius + aCircleIt)), aSqTol);
+      if (vgetq_lane_u64 (aMask, 0) != 0) theHits[aNbHits++] = aCircleIt;
+      if (vgetq_lane_u64 (aMask, 1) != 0) theHits[aNbHits++] = aCircleIt + 1;
+    }
+    return checkCircles (theLocationX, theLocationY, theSqRadius, aCircleIt, theNbCircles,
+                         thePointX, thePointY, theSqTolerance, theHits, aNbHits);
+  }
+#endif
+
+  //! Kernel with its name.
+  struct KernelInfo
+  {
+    CircleKernel     Kernel;
+    Standard_CString Name;
+  };
+
+  //! Kernels built for the current platform, from the slowest to the fastest one.
+  const KernelInfo THE_KERNELS[] =
+  {
+    { scalarKernel, "scalar" },
+  #if defined(HAVE_SSE2_KERNEL)
+    { sse2Kernel,   "sse2" },
+  #endif
+  #if defined(HAVE_AVX2_KERNEL)
+    { avx2Kernel,   "avx2" },
+  #endif
+  #if defined(HAVE_NEON_KERNEL)
+    { neonKernel,   "neon" },
+  #endif
+  };
+
+  const Standard_Integer THE_NB_KERNELS = Standard_Integer (sizeof(THE_KERNELS) / sizeof(THE_KERNELS[0]));
+
+  //! Returns TRUE if the processor supports the instructions of the kernel.
+  bool isSupported (const KernelInfo& theKernel)
+  {
+  #if defined(HAVE_AVX2_KERNEL)
+    if (theKernel.Kernel == avx2Kernel)
+    {
+      static const bool THE_HAS_AVX2 = hasAvx2();
+      return THE_HAS_AVX2;
+    }
+  #else
+    (void )theKernel;
+  #endif
+    return true;
+  }
+
+  //! Returns the fastest kernel supported by the current processor.
+  const KernelInfo* bestKernel()
+  {
+    for (Standard_Integer aKernelIt = THE_NB_KERNELS - 1; aKernelIt > 0; --aKernelIt)
+    {
+      if (isSupported (THE_KERNELS[aKernelIt]))
+      {
+        return &THE_KERNELS[aKernelIt];
+      }
+    }
+    return &THE_KERNELS[0];
+  }
+
+  //! Returns the kernel used by all cells.
+  std::atomic<const KernelInfo*>& currentKernel()
+  {
+    static std::atomic<const KernelInfo*> THE_CURRENT_KERNEL (bestKernel());
+    return THE_CURRENT_KERNEL;
+  }
+}
+
+//=======================================================================
+//function : BRepMesh_CircleCells
+//purpose  :
+//=======================================================================
+BRepMesh_CircleCells::BRepMesh_CircleCells(
+  const Handle(NCollection_IncAllocator)& theAllocator)
+: myAllocator (theAllocator),
+  myCells     (1, theAllocator),
+  myHits      (0, 63)
+{
+  mySize[0] = mySize[1] = 10.0;
+}
+
+//=======================================================================
+//function : Reset
+//purpose  :
+//=======================================================================
+void BRepMesh_CircleCells::Reset(const Standard_Real                     theSizeX,
+                                 const Standard_Real                     theSizeY,
+                                 const Handle(NCollection_IncAllocator)& theAllocator)
+{
+  myAllocator = theAllocator;
+  myCells.Clear(theAllocator);
+  mySize[0] = theSizeX;
+  mySize[1] = theSizeY;
+}
+
+//=======================================================================
+//function : cellIndex
+//purpose  : Computes index as NCollection_CellFilter does
+//=======================================================================
+Standard_Integer BRepMesh_CircleCells::cellIndex(const Standard_Real theCoord,
+                                                 const Standard_Real theSize)
+{
+  const Standard_Real aVal = theCoord / theSize;
+  return Standard_Integer ((aVal > INT_MAX - 1) ? fmod (aVal, (Standard_Real) INT_MAX)
+                                                : (aVal < INT_MIN + 1) ? fmod (aVal, (Standard_Real) INT_MIN)
+                                                                       : aVal);
+}
+
+//=======================================================================
+//function : grow
+//purpose  :
+//=======================================================================
+void BRepMesh_CircleCells::grow(Cell& theCell)
+{
+  const Standard_Integer aCapacity = Max (2 * theCell.Capacity, 8);
+  Standard_Real* aReals = static_cast<Standard_Real*> (
+    myAllocator->Allocate (aCapacity * (3 * sizeof(Standard_Real) + sizeof(Standard_Integer))));
+  Standard_Integer* anIndices = reinterpret_cast<Standard_Integer*> (aReals + 3 * aCapacity);
+  if (theCell.Size > 0)
+  {
+    memcpy (aReals,                 theCell.LocationX, theCell.Size * sizeof(Standard_Real));
+    memcpy (aReals + aCapacity,     theCell.LocationY, theCell.Size * sizeof(Standard_Real));
+    memcpy (aReals + 2 * aCapacity, theCell.SqRadius,  theCell.Size * sizeof(Standard_Real));
+    memcpy (anIndices,              theCell.Indices,   theCell.Size * sizeof(Standard_Integer));
+  }
+
+  // the previous arrays are released together with the incremental allocator
+  theCell.LocationX = aReals;
+  theCell.LocationY = aReals + aCapacity;
+  theCell.SqRadius  = aReals + 2 * aCapacity;
+  theCell.Indices   = anIndices;
+  theCell.Capacity  = aCapacity;
+
+  if (myHits.Length() < aCapacity)
+  {
+    myHits.Resize (0, aCapacity - 1, Standard_False);
+  }
+}
+
+//=======================================================================
+//function : Add
+//purpose  :
+//=======================================================================
+void BRepMesh_CircleCells::Add(const Standard_Integer theIndex,
+                               const gp_XY&           theLocation,
+                               const Standard_Real    theRadius,
+                               const gp_XY&           theMin,
+                               const gp_XY&           theMax)
+{
+  const Standard_Real aSqRadius = theRadius * theRadius;
+  const Standard_Integer aMinX = cellIndex (theMin.X(), mySize[0]);
+  const Standard_Integer aMaxX = cellIndex (theMax.X(), mySize[0]);
+  const Standard_Integer aMinY = cellIndex (theMin.Y(), mySize[1]);
+  const Standard_Integer aMaxY = cellIndex (theMax.Y(), mySize[1]);
+  for (Standard_Integer aCellX = aMinX; aCellX <= aMaxX; ++aCellX)
+  {
+    for (Standard_Integer aCellY = aMinY; aCellY <= aMaxY; ++aCellY)
+    {
+      const uint64_t aKey = cellKey (aCellX, aCellY);
+      Cell* aCell = myCells.ChangeSeek (aKey);
+      if (aCell == NULL)
+      {
+        aCell = myCells.Bound (aKey, Cell());
+      }
+      if (aCell->Size == aCell->Capacity)
+      {
+        grow (*aCell);
+      }
+
+      const Standard_Integer aPos = aCell->Size++;
+      aCell->LocationX[aPos] = theLocation.X();
+      aCell->LocationY[aPos] = theLocation.Y();
+      aCell->SqRadius [aPos] = aSqRadius;
+      aCell->Indices  [aPos] = theIndex;
+    }
+  }
+}
+
+//=======================================================================
+//function : Remove
+//purpose  :
+//=======================================================================
+void BRepMesh_CircleCells::Remove(const Standard_Integer theIndex,
+                                  const gp_XY&           theMin,
+                                  const gp_XY&           theMax)
+{
+  const Standard_Integer aMinX = cellIndex (theMin.X(), mySize[0]);
+  const Standard_Integer aMaxX = cellIndex (theMax.X(), mySize[0]);
+  const Standard_Integer aMinY = cellIndex (theMin.Y(), mySize[1]);
+  const Standard_Integer aMaxY = cellIndex (theMax.Y(), mySize[1]);
+  for (Standard_Integer aCellX = aMinX; aCellX <= aMaxX; ++aCellX)
+  {
+    for (Standard_Integer aCellY = aMinY; aCellY <= aMaxY; ++aCellY)
+    {
+      Cell* aCell = myCells.ChangeSeek (cellKey (aCellX, aCellY));
+      if (aCell == NULL)
+      {
+        continue;
+      }
+
+      // keep the order of remaining circles to return them in the order of addition
+      for (Standard_Integer aPos = aCell->Size - 1; aPos >= 0; --aPos)
+      {
+        if (aCell->Indices[aPos] != theIndex)
+        {
+          continue;
+        }
+
+        const size_t aNbMoved = aCell->Size - aPos - 1;
+        memmove (aCell->LocationX + aPos, aCell->LocationX + aPos + 1, aNbMoved * sizeof(Standard_Real));
+        memmove (aCell->LocationY + aPos, aCell->LocationY + aPos + 1, aNbMoved * sizeof(Standard_Real));
+        memmove (aCell->SqRadius  + aPos, aCell->SqRadius  + aPos + 1, aNbMoved * sizeof(Standard_Real));
+        memmove (aCell->Indices   + aPos, aCell->Indices   + aPos + 1, aNbMoved * sizeof(Standard_Integer));
+        --aCell->Size;
+        break;
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : Select
+//purpose  :
+//=======================================================================
+void BRepMesh_CircleCells::Select(const gp_XY&              thePoint,
+                                  const Standard_Real       theSqTolerance,
+                                  IMeshData::ListOfInteger& theCircles)
+{
+  const Cell* aCell = myCells.Seek (cellKey (cellIndex (thePoint.X(), mySize[0]),
+                                             cellIndex (thePoint.Y(), mySize[1])));
+  if (aCell == NULL || aCell->Size == 0)
+  {
+    return;
+  }
+
+  Standard_Integer* aHits = &myHits.ChangeFirst();
+  const Standard_Integer aNbHits = currentKernel().load (std::memory_order_relaxed)->Kernel (aCell->LocationX, aCell->LocationY, aCell->SqRadius, aCell->Size,
+                                                        thePoint.X(), thePoint.Y(), theSqTolerance, aHits);
+
+  // the last added circles go first
+  for (Standard_Integer aHitIt = aNbHits - 1; aHitIt >= 0; --aHitIt)
+  {
+    theCircles.Append (aCell->Indices[aHits[aHitIt]]);
+  }
+}
+
+//=======================================================================
+//function : KernelName
+//purpose  :
+//=======================================================================
+Standard_CString BRepMesh_CircleCells::KernelName()
+{
+  return currentKernel().load (std::memory_order_relaxed)->Name;
+}
+
+//=======================================================================
+//function : SetKernel
+//purpose  :
+//=======================================================================
+Standard_Boolean BRepMesh_CircleCells::SetKernel(const Standard_CString theName)
+{
+  if (strcmp (theName, "auto") == 0)
+  {
+    currentKernel().store (bestKernel());
+    return Standard_True;
+  }
+
+  for (Standard_Integer aKernelIt = 0; aKernelIt < THE_NB_KERNELS; ++aKernelIt)
+  {
+    if (strcmp (theName, THE_KERNELS[aKernelIt].Name) == 0)
+    {
+      if (!isSupported (THE_KERNELS[aKernelIt]))
+      {
+        return Standard_False;
+      }
+      currentKernel().store (&THE_KERNELS[aKernelIt]);
+      return Standard_True;
+    }
+  }
+  return Standard_False;
+}
+
+//=======================================================================
+//function : IsKernelSupported
+//purpose  :
+//=======================================================================
+Standard_Boolean BRepMesh_CircleCells::IsKernelSupported(const Standard_CString theName)
+{
+  for (Standard_Integer aKernelIt = 0; aKernelIt < THE_NB_KERNELS; ++aKernelIt)
+  {
+    if (strcmp (theName, THE_KERNELS[aKernelIt].Name) == 0)
+    {
+      return isSupported (THE_KERNELS[aKernelIt]);
+    }
+  }
+  return Standard_False;
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_CircleCells_HeaderFile
+#define _BRepMesh_CircleCells_HeaderFile
+
+#include <IMeshData_Types.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+
+#include <stdint.h>
+
+//! Regular grid of cells in the parametric space keeping the circles
+//! of the triangles of 2D Delaunay triangulation (see BRepMesh_CircleTool).
+//!
+//! Each cell keeps centers, squared radii and indices of the circles
+//! overlapping it in packed arrays, so that all circles of the cell are
+//! checked against a point in one pass by a vectorized kernel.
+//! The kernel (AVX2, SSE2, NEON or scalar one) is chosen at run time
+//! depending on the instruction sets supported by the processor,
+//! and may be forced by SetKernel().
+//!
+//! Cells are numbered in the same way as in NCollection_CellFilter,
+//! and the circles shot by a point are returned in the reverse order
+//! of their addition, as NCollection_CellFilter does.
+class BRepMesh_CircleCells
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Constructor.
+  //! @param theAllocator memory allocator to be used by internal structures.
+  Standard_EXPORT BRepMesh_CircleCells(const Handle(NCollection_IncAllocator)& theAllocator);
+
+  //! Removes all circles and sets new size of cells.
+  //! @param theSizeX cell size for X dimension.
+  //! @param theSizeY cell size for Y dimension.
+  //! @param theAllocator memory allocator to be used by internal structures.
+  Standard_EXPORT void Reset(const Standard_Real                     theSizeX,
+                             const Standard_Real                     theSizeY,
+                             const Handle(NCollection_IncAllocator)& theAllocator);
+
+  //! Adds the circle to all cells overlapped by the given range.
+  //! @param theIndex index of the circle.
+  //! @param theLocation center of the circle.
+  //! @param theRadius radius of the circle.
+  //! @param theMin bottom left corner of the range.
+  //! @param theMax top right corner of the range.
+  Standard_EXPORT void Add(const Standard_Integer theIndex,
+                           const gp_XY&           theLocation,
+                           const Standard_Real    theRadius,
+                           const gp_XY&           theMin,
+                           const gp_XY&           theMax);
+
+  //! Removes the circle from all cells overlapped by the given range,
+  //! which should be the same as the one used to add the circle.
+  //! @param theIndex index of the circle.
+  //! @param theMin bottom left corner of the range.
+  //! @param theMax top right corner of the range.
+  Standard_EXPORT void Remove(const Standard_Integer theIndex,
+                              const gp_XY&           theMin,
+                              const gp_XY&           theMax);
+
+  //! Appends to the list indices of circles of the cell containing the point,
+  //! for which the squared distance from the point to the center exceeds
+  //! the squared radius by not more than the given tolerance.
+  //! @param thePoint bullet point.
+  //! @param theSqTolerance tolerance of the check.
+  //! @param[out] theCircles list of indices of shot circles.
+  Standard_EXPORT void Select(const gp_XY&              thePoint,
+                              const Standard_Real       theSqTolerance,
+                              IMeshData::ListOfInteger& theCircles);
+
+  //! Returns name of the kernel used to check circles of a cell:
+  //! "avx2", "sse2", "neon" or "scalar".
+  Standard_EXPORT static Standard_CString KernelName();
+
+  //! Forces the kernel used by all cells, e.g. to compare results of kernels.
+  //! All kernels give the same result.
+  //! @param theName name of the kernel (see KernelName()),
+  //!        or "auto" to use the fastest kernel supported by the processor (default).
+  //! @return FALSE if the kernel is not built for this platform
+  //!         or not supported by the processor.
+  Standard_EXPORT static Standard_Boolean SetKernel(const Standard_CString theName);
+
+  //! Returns TRUE if the kernel with the given name (see KernelName())
+  //! is built for this platform and supported by the processor.
+  Standard_EXPORT static Standard_Boolean IsKernelSupported(const Standard_CString theName);
+
+private:
+
+  //! Circles overlapping the cell.
+  struct Cell
+  {
+    Standard_Real*    LocationX; //!< X coordinates of centers
+    Standard_Real*    LocationY; //!< Y coordinates of centers
+    Standard_Real*    SqRadius;  //!< squared radii
+    Standard_Integer* Indices;   //!< indices of circles
+    Standard_Integer  Size;      //!< number of circles
+    Standard_Integer  Capacity;  //!< size of allocated arrays
+
+    Cell()
+    : LocationX (NULL), LocationY (NULL), SqRadius (NULL), Indices (NULL),
+      Size (0), Capacity (0)
+    {}
+  };
+
+  //! Returns index of the cell along the given dimension.
+  static Standard_Integer cellIndex(const Standard_Real theCoord,
+                                    const Standard_Real theSize);
+
+  //! Returns the key of the cell with the given indices.
+  static uint64_t cellKey(const Standard_Integer theIndexX,
+                          const Standard_Integer theIndexY)
+  {
+    return (uint64_t (uint32_t (theIndexX)) << 32) | uint64_t (uint32_t (theIndexY));
+  }
+
+  //! Enlarges the arrays of the cell.
+  void grow(Cell& theCell);
+
+private:
+
+  Handle(NCollection_IncAllocator)         myAllocator;
+  NCollection_DataMap<uint64_t, Cell>      myCells;
+  Standard_Real                            mySize[2];
+  NCollection_Array1<Standard_Integer>     myHits;
+};
+
+#endif
@@ -21,6 +21,36 @@
 #include <BRepMesh_Circle.hxx>
 #include <BRepMesh_CircleInspector.hxx>
 
+#include <atomic>
+
+namespace
+{
+  //! Returns the flag to use the cell filter by new tools.
+  std::atomic<bool>& cellFilterMode()
+  {
+    static std::atomic<bool> THE_CELL_FILTER_MODE (false);
+    return THE_CELL_FILTER_MODE;
+  }
+}
+
+//=======================================================================
+//function : SetCellFilterMode
+//purpose  : 
+//=======================================================================
+void BRepMesh_CircleTool::SetCellFilterMode(const Standard_Boolean theToUse)
+{
+  cellFilterMode().store (theToUse == Standard_True);
+}
+
+//=======================================================================
+//function : IsCellFilterMode
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepMesh_CircleTool::IsCellFilterMode()
+{
+  return cellFilterMode().load();
+}
+
 //=======================================================================
 //function : BRepMesh_CircleTool
 //purpose  : 
@@ -29,6 +59,8 @@ BRepMesh_CircleTool::BRepMesh_CircleTool(
   const Handle(NCollection_IncAllocator)& theAllocator)
 : myTolerance (Precision::PConfusion()),
   myAllocator (theAllocator),
+  myToUseCellFilter (cellFilterMode().load()),
+  myCells     (theAllocator),
   myCellFilter(10.0, theAllocator),
   mySelector  (myTolerance, 64, theAllocator)
 {
@@ -43,6 +75,8 @@ BRepMesh_CircleTool::BRepMesh_CircleTool(
   const Handle(NCollection_IncAllocator)& theAllocator)
 : myTolerance (Precision::PConfusion()),
   myAllocator (theAllocator),
+  myToUseCellFilter (cellFilterMode().load()),
+  myCells     (theAllocator),
   myCellFilter(10.0, theAllocator),
   mySelector  (myTolerance, Max(theReservedSize, 64), theAllocator)
 {
@@ -58,19 +92,35 @@ void BRepMesh_CircleTool::bind(const Standard_Integer theIndex,
 {
   BRepMesh_Circle aCirle(theLocation, theRadius);
 
-  //compute coords
-  Standard_Real aMaxX = Min(theLocation.X() + theRadius, myFaceMax.X());
-  Standard_Real aMinX = Max(theLocation.X() - theRadius, myFaceMin.X());
-  Standard_Real aMaxY = Min(theLocation.Y() + theRadius, myFaceMax.Y());
-  Standard_Real aMinY = Max(theLocation.Y() - theRadius, myFaceMin.Y());
+  gp_XY aMinPnt, aMaxPnt;
+  circleRange(theLocation, theRadius, aMinPnt, aMaxPnt);
 
-  gp_XY aMinPnt(aMinX, aMinY);
-  gp_XY aMaxPnt(aMaxX, aMaxY);
-
-  myCellFilter.Add(theIndex, aMinPnt, aMaxPnt);
+  if (myToUseCellFilter)
+  {
+    myCellFilter.Add(theIndex, aMinPnt, aMaxPnt);
+  }
+  else
+  {
+    myCells.Add(theIndex, theLocation, theRadius, aMinPnt, aMaxPnt);
+  }
   mySelector.Bind(theIndex, aCirle);
 }
 
+//=======================================================================
+//function : circleRange
+//purpose  : 
+//=======================================================================
+void BRepMesh_CircleTool::circleRange(const gp_XY&        theLocation,
+                                      const Standard_Real theRadius,
+                                      gp_XY&              theMin,
+                                      gp_XY&              theMax) const
+{
+  theMax.SetCoord(Min(theLocation.X() + theRadius, myFaceMax.X()),
+                  Min(theLocation.Y() + theRadius, myFaceMax.Y()));
+  theMin.SetCoord(Max(theLocation.X() - theRadius, myFaceMin.X()),
+                  Max(theLocation.Y() - theRadius, myFaceMin.Y()));
+}
+
 //=======================================================================
 //function : Bind
 //purpose  : 
@@ -163,7 +213,20 @@ void BRepMesh_CircleTool::Delete(const Standard_Integer theIndex)
 {
   BRepMesh_Circle& aCircle = mySelector.Circle(theIndex);
   if(aCircle.Radius() > 0.)
+  {
+    // the cell filter skips deleted circles on inspection
+    if (myToUseCellFilter)
+    {
+      aCircle.SetRadius(-1);
+      return;
+    }
+
+    gp_XY aMinPnt, aMaxPnt;
+    circleRange(aCircle.Location(), aCircle.Radius(), aMinPnt, aMaxPnt);
+    myCells.Remove(theIndex, aMinPnt, aMaxPnt);
+
     aCircle.SetRadius(-1);
+  }
 }
 
 //=======================================================================
@@ -173,7 +236,12 @@ void BRepMesh_CircleTool::Delete(const Standard_Integer theIndex)
 IMeshData::ListOfInteger& BRepMesh_CircleTool::Select(const gp_XY& thePoint)
 {
   mySelector.SetPoint(thePoint);
-  myCellFilter.Inspect(thePoint, mySelector);
+  if (myToUseCellFilter)
+  {
+    myCellFilter.Inspect(thePoint, mySelector);
+    return mySelector.GetShotCircles();
+  }
+  myCells.Select(thePoint, myTolerance * myTolerance, mySelector.GetShotCircles());
   return mySelector.GetShotCircles();
 }
 
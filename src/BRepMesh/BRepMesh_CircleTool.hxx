@@ -19,6 +19,7 @@
 #include <Standard_Macro.hxx>
 
 #include <Standard_Real.hxx>
+#include <BRepMesh_CircleCells.hxx>
 #include <BRepMesh_CircleInspector.hxx>
 #include <gp_XY.hxx>
 #include <Standard_Integer.hxx>
@@ -28,7 +29,11 @@
 
 class gp_Circ2d;
 
-//! Create sort and destroy the circles used in triangulation. <br>
+//! Create sort and destroy the circles used in triangulation.
+//! Circles are kept in packed cells (see BRepMesh_CircleCells),
+//! which are checked against a point by a vectorized kernel.
+//! The former cell filter checking circles one by one by BRepMesh_CircleInspector
+//! is kept as a reference to validate the kernels (see SetCellFilterMode()).
 class BRepMesh_CircleTool
 {
 public:
@@ -47,6 +52,13 @@ public:
     const Standard_Integer                  theReservedSize,
     const Handle(NCollection_IncAllocator)& theAllocator);
 
+  //! Enables usage of the cell filter (IMeshData::CircleCellFilter) instead of
+  //! packed cells by tools created afterwards. Intended for validation of the kernels.
+  Standard_EXPORT static void SetCellFilterMode(const Standard_Boolean theToUse);
+
+  //! Returns TRUE if tools created now use the cell filter instead of packed cells.
+  Standard_EXPORT static Standard_Boolean IsCellFilterMode();
+
   //! Initializes the tool.
   //! @param theReservedSize size to be reserved for vector of circles.
   void Init(const Standard_Integer /*theReservedSize*/)
@@ -58,7 +70,12 @@ public:
   //! @param theSize cell size to be set for X and Y dimensions.
   void SetCellSize(const Standard_Real theSize)
   {
-    myCellFilter.Reset(theSize, myAllocator);
+    if (myToUseCellFilter)
+    {
+      myCellFilter.Reset(theSize, myAllocator);
+      return;
+    }
+    myCells.Reset(theSize, theSize, myAllocator);
   }
 
   //! Sets new size for cell filter.
@@ -67,9 +84,14 @@ public:
   void SetCellSize(const Standard_Real theSizeX,
                    const Standard_Real theSizeY)
   {
-    Standard_Real aCellSizeC[2] = { theSizeX, theSizeY };
-    NCollection_Array1<Standard_Real> aCellSize(aCellSizeC[0], 1, 2);
-    myCellFilter.Reset(aCellSize, myAllocator);
+    if (myToUseCellFilter)
+    {
+      Standard_Real aCellSizeC[2] = { theSizeX, theSizeY };
+      NCollection_Array1<Standard_Real> aCellSize(aCellSizeC[0], 1, 2);
+      myCellFilter.Reset(aCellSize, myAllocator);
+      return;
+    }
+    myCells.Reset(theSizeX, theSizeY, myAllocator);
   }
 
   //! Sets limits of inspection area.
@@ -142,10 +164,22 @@ private:
             const gp_XY&           theLocation,
             const Standard_Real    theRadius);
 
+  //! Computes range of cells covered by the circle.
+  //! @param theLocation location of a circle.
+  //! @param theRadius radius of a circle.
+  //! @param[out] theMin bottom left corner of the range.
+  //! @param[out] theMax top right corner of the range.
+  void circleRange(const gp_XY&        theLocation,
+                   const Standard_Real theRadius,
+                   gp_XY&              theMin,
+                   gp_XY&              theMax) const;
+
 private:
 
   Standard_Real                     myTolerance;
   Handle(NCollection_IncAllocator)  myAllocator;
+  Standard_Boolean                  myToUseCellFilter;
+  BRepMesh_CircleCells              myCells;
   IMeshData::CircleCellFilter       myCellFilter;
   BRepMesh_CircleInspector          mySelector;
   gp_XY                             myFaceMax;
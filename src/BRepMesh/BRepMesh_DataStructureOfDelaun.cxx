@@ -22,21 +22,107 @@
 #include <BRep_Builder.hxx>
 #include <BRepTools.hxx>
 #include <Standard_ErrorHandler.hxx>
+#include <Standard_OutOfRange.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_DataStructureOfDelaun, Standard_Transient)
 
+namespace
+{
+  //! Allocator of items of lists of integers keeping the released items
+  //! in a free list to reuse them, while the memory is taken from
+  //! the incremental allocator of the data structure.
+  class BRepMesh_ListItemAllocator : public NCollection_BaseAllocator
+  {
+    //! Released item
+    struct FreeItem
+    {
+      FreeItem* Next;
+    };
+
+  public:
+
+    //! Size of the allocated items
+    static size_t ItemSize()
+    {
+      return std::max (sizeof (NCollection_TListNode<Standard_Integer>), sizeof (FreeItem));
+    }
+
+    //! Constructor
+    BRepMesh_ListItemAllocator (const Handle(NCollection_IncAllocator)& theAllocator)
+    : myAllocator (theAllocator),
+      myFreeItems (NULL)
+    {
+    }
+
+    //! Returns a released item or allocates new one
+    virtual void* Allocate (const size_t theSize) Standard_OVERRIDE
+    {
+      Standard_OutOfRange_Raise_if (theSize > ItemSize(),
+        "BRepMesh_ListItemAllocator::Allocate, size of item exceeds the size of list item");
+      if (myFreeItems == NULL)
+      {
+        return myAllocator->Allocate (ItemSize());
+      }
+
+      FreeItem* anItem = myFreeItems;
+      myFreeItems = anItem->Next;
+      return anItem;
+    }
+
+    //! Returns a released item or allocates new one
+    virtual void* AllocateOptimal (const size_t theSize) Standard_OVERRIDE
+    {
+      return Allocate (theSize);
+    }
+
+    //! Puts the item to the list of released items
+    virtual void Free (void* theAddress) Standard_OVERRIDE
+    {
+      if (theAddress != NULL)
+      {
+        FreeItem* anItem = static_cast<FreeItem*> (theAddress);
+        anItem->Next = myFreeItems;
+        myFreeItems  = anItem;
+      }
+    }
+
+  private:
+
+    Handle(NCollection_IncAllocator) myAllocator;
+    FreeItem*                        myFreeItems;
+  };
+
+  //! Returns allocator of lists of links for the given storage
+  Handle(NCollection_BaseAllocator) listAllocator (
+    const BRepMesh_DataStructureOfDelaun::Storage theStorage,
+    const Handle(NCollection_IncAllocator)&       theAllocator)
+  {
+    if (theStorage == BRepMesh_DataStructureOfDelaun::Storage_Flat)
+    {
+      return new BRepMesh_ListItemAllocator (theAllocator);
+    }
+    return Handle(NCollection_BaseAllocator) (theAllocator);
+  }
+}
+
 //=======================================================================
 //function : BRepMesh_DataStructureOfDelaun
 //purpose  : 
 //=======================================================================
 BRepMesh_DataStructureOfDelaun::BRepMesh_DataStructureOfDelaun(
   const Handle(NCollection_IncAllocator)& theAllocator,
-  const Standard_Integer                  theReservedNodeSize)
-  : myAllocator       (theAllocator),
+  const Standard_Integer                  theReservedNodeSize,
+  const Storage                           theStorage)
+  : myStorage         (theStorage),
+    myAllocator       (theAllocator),
     myNodes           (new BRepMesh_VertexTool(myAllocator)),
-    myNodeLinks       (theReservedNodeSize * 3, myAllocator),
-    myLinks           (theReservedNodeSize * 3, myAllocator),
-    myDelLinks        (myAllocator),
+    myNodeLinks       (theStorage == Storage_Flat ? 1 : theReservedNodeSize * 3, myAllocator),
+    myLinks           (theStorage == Storage_Flat ? 1 : theReservedNodeSize * 3, myAllocator),
+    myListAllocator   (listAllocator(theStorage, myAllocator)),
+    myFlatNodeLinks   (theReservedNodeSize, myAllocator),
+    myFlatLinks       (theReservedNodeSize * 3, myAllocator),
+    myFlatLinkElements(theReservedNodeSize * 3, myAllocator),
+    myDelLinks        (myListAllocator),
     myElements        (theReservedNodeSize * 2, myAllocator)
 {
 }
@@ -50,7 +136,12 @@ Standard_Integer BRepMesh_DataStructureOfDelaun::AddNode(
   const Standard_Boolean isForceAdd)
 {
   const Standard_Integer aNodeId = myNodes->Add(theNode, isForceAdd);
-  if (!myNodeLinks.IsBound(aNodeId))
+  if (myStorage == Storage_Flat)
+  {
+    while (myFlatNodeLinks.Length() < aNodeId)
+      myFlatNodeLinks.Append(IMeshData::ListOfInteger(myListAllocator));
+  }
+  else if (!myNodeLinks.IsBound(aNodeId))
     myNodeLinks.Bind(aNodeId, IMeshData::ListOfInteger(myAllocator));
 
   return aNodeId;
@@ -89,11 +180,11 @@ Standard_Integer BRepMesh_DataStructureOfDelaun::AddLink(
   if (!myDelLinks.IsEmpty())
   {
     aLinkIndex = myDelLinks.First();
-    myLinks.Substitute(aLinkIndex, theLink, aPair);
+    substituteLink(aLinkIndex, theLink, aPair);
     myDelLinks.RemoveFirst();
   }
   else
-    aLinkIndex = myLinks.Add(theLink, aPair);
+    aLinkIndex = appendLink(theLink, aPair);
 
   const Standard_Integer aLinkId = Abs(aLinkIndex);
   linksConnectedTo(theLink.FirstNode()).Append(aLinkId);
@@ -103,6 +194,79 @@ Standard_Integer BRepMesh_DataStructureOfDelaun::AddLink(
   return aLinkIndex;
 }
 
+//=======================================================================
+//function : indexOfFlat
+//purpose  : 
+//=======================================================================
+Standard_Integer BRepMesh_DataStructureOfDelaun::indexOfFlat(
+  const BRepMesh_Edge& theLink) const
+{
+  const Standard_Integer aNodeId = theLink.FirstNode();
+  if (aNodeId < 1 || aNodeId > myFlatNodeLinks.Length())
+    return 0;
+
+  IMeshData::ListOfInteger::Iterator aLinkIt(myFlatNodeLinks.Value(aNodeId - 1));
+  for (; aLinkIt.More(); aLinkIt.Next())
+  {
+    const Standard_Integer aLinkId = aLinkIt.Value();
+    if (myFlatLinks.Value(aLinkId - 1).IsEqual(theLink))
+      return aLinkId;
+  }
+
+  return 0;
+}
+
+//=======================================================================
+//function : appendLink
+//purpose  : 
+//=======================================================================
+Standard_Integer BRepMesh_DataStructureOfDelaun::appendLink(
+  const BRepMesh_Edge&        theLink,
+  const BRepMesh_PairOfIndex& thePair)
+{
+  if (myStorage == Storage_Flat)
+  {
+    myFlatLinks.Append(theLink);
+    myFlatLinkElements.Append(thePair);
+    return myFlatLinks.Length();
+  }
+
+  return myLinks.Add(theLink, thePair);
+}
+
+//=======================================================================
+//function : substituteLink
+//purpose  : 
+//=======================================================================
+void BRepMesh_DataStructureOfDelaun::substituteLink(
+  const Standard_Integer      theIndex,
+  const BRepMesh_Edge&        theLink,
+  const BRepMesh_PairOfIndex& thePair)
+{
+  if (myStorage == Storage_Flat)
+  {
+    myFlatLinks       .ChangeValue(theIndex - 1) = theLink;
+    myFlatLinkElements.ChangeValue(theIndex - 1) = thePair;
+  }
+  else
+    myLinks.Substitute(theIndex, theLink, thePair);
+}
+
+//=======================================================================
+//function : removeLastLink
+//purpose  : 
+//=======================================================================
+void BRepMesh_DataStructureOfDelaun::removeLastLink()
+{
+  if (myStorage == Storage_Flat)
+  {
+    myFlatLinks       .EraseLast();
+    myFlatLinkElements.EraseLast();
+  }
+  else
+    myLinks.RemoveLast();
+}
+
 //=======================================================================
 //function : SubstituteLink
 //purpose  : 
@@ -115,7 +279,7 @@ Standard_Boolean BRepMesh_DataStructureOfDelaun::SubstituteLink(
   BRepMesh_Edge aLink = GetLink(theIndex);
   if (aLink.Movability() == BRepMesh_Deleted)
   {
-    myLinks.Substitute(theIndex, theNewLink, aPair);
+    substituteLink(theIndex, theNewLink, aPair);
     return Standard_True;
   }
 
@@ -123,13 +287,13 @@ Standard_Boolean BRepMesh_DataStructureOfDelaun::SubstituteLink(
     return Standard_False;
 
   aLink.SetMovability(BRepMesh_Deleted);
-  myLinks.Substitute(theIndex, aLink, aPair);
+  substituteLink(theIndex, aLink, aPair);
   cleanLink(theIndex, aLink);
 
   const Standard_Integer aLinkId = Abs(theIndex);
   linksConnectedTo(theNewLink.FirstNode()).Append(aLinkId);
   linksConnectedTo(theNewLink.LastNode() ).Append(aLinkId);
-  myLinks.Substitute(theIndex, theNewLink, aPair);
+  substituteLink(theIndex, theNewLink, aPair);
 
   return Standard_True;
 }
@@ -196,7 +360,7 @@ Standard_Integer BRepMesh_DataStructureOfDelaun::AddElement(
 
   const Standard_Integer (&e)[3] = theElement.myEdges;
   for (Standard_Integer i = 0; i < 3; ++i)
-    myLinks(e[i]).Append(aElementIndex);
+    linkElements(e[i]).Append(aElementIndex);
 
   return aElementIndex;
 }
@@ -230,7 +394,7 @@ void BRepMesh_DataStructureOfDelaun::cleanElement(
 
   const Standard_Integer(&e)[3] = theElement.myEdges;
   for (Standard_Integer i = 0; i < 3; ++i)
-    removeElementIndex(theIndex, myLinks(e[i]));
+    removeElementIndex(theIndex, linkElements(e[i]));
 }
 
 //=======================================================================
@@ -272,7 +436,7 @@ Standard_Boolean BRepMesh_DataStructureOfDelaun::SubstituteElement(
 
   const Standard_Integer(&e)[3] = theNewElement.myEdges;
   for (Standard_Integer i = 0; i < 3; ++i)
-    myLinks(e[i]).Append(theIndex);
+    linkElements(e[i]).Append(theIndex);
 
   return Standard_True;
 }
@@ -349,7 +513,7 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedLinks()
       if (GetLink(aLastLiveItem).Movability() != BRepMesh_Deleted)
         break;
 
-      myLinks.RemoveLast();
+      removeLastLink();
       --aLastLiveItem;
     }
 
@@ -360,10 +524,10 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedLinks()
       continue;
 
     BRepMesh_Edge aLink = GetLink(aLastLiveItem);
-    BRepMesh_PairOfIndex& aPair = myLinks(aLastLiveItem);
+    BRepMesh_PairOfIndex aPair = linkElements(aLastLiveItem);
 
-    myLinks.RemoveLast();
-    myLinks.Substitute(aDelItem, aLink, aPair);
+    removeLastLink();
+    substituteLink(aDelItem, aLink, aPair);
 
     myLinksOfDomain.Remove(aLastLiveItem);
     myLinksOfDomain.Add(aDelItem);
@@ -443,7 +607,7 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedNodes()
     --aLastLiveItem;
 
     myNodes->Substitute(aDelItem, aNode);
-    myNodeLinks.ChangeFind(aDelItem) = aLinkList;
+    linksConnectedTo(aDelItem) = aLinkList;
 
     const Standard_Integer aLastLiveItemId = aLastLiveItem + 1;
     IMeshData::ListOfInteger::Iterator aLinkIt(aLinkList);
@@ -451,7 +615,7 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedNodes()
     {
       const Standard_Integer aLinkId = aLinkIt.Value();
       const BRepMesh_Edge& aLink = GetLink(aLinkId);
-      BRepMesh_PairOfIndex& aPair = myLinks(aLinkId);
+      const BRepMesh_PairOfIndex aPair = linkElements(aLinkId);
 
       Standard_Integer v[2] = { aLink.FirstNode(), aLink.LastNode() };
       if (v[0] == aLastLiveItemId)
@@ -459,7 +623,7 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedNodes()
       else if (v[1] == aLastLiveItemId)
         v[1] = aDelItem;
 
-      myLinks.Substitute(aLinkId,
+      substituteLink(aLinkId,
         BRepMesh_Edge(v[0], v[1], aLink.Movability()), aPair);
     }
   }
@@ -475,8 +639,16 @@ void BRepMesh_DataStructureOfDelaun::Statistics(Standard_OStream& theStream) con
   myNodes->Statistics(theStream);
   theStream << "\n Deleted nodes : " << myNodes->GetListOfDelNodes().Extent() << std::endl;
 
-  theStream << "\n\n Map of Links : \n";
-  myLinks.Statistics(theStream);
+  if (myStorage == Storage_Flat)
+  {
+    theStream << "\n\n Vector of Links : \n";
+    theStream << "\n Links : " << myFlatLinks.Length() << std::endl;
+  }
+  else
+  {
+    theStream << "\n\n Map of Links : \n";
+    myLinks.Statistics(theStream);
+  }
   theStream << "\n Deleted links : " << myDelLinks.Extent() << std::endl;
 
   theStream << "\n\n Map of elements : \n";
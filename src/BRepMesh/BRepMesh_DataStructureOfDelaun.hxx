@@ -21,16 +21,48 @@ class BRepMesh_Edge;
 
 //! Describes the data structure necessary for the mesh algorithms in 
 //! two dimensions plane or on surface by meshing in UV space.
+//!
+//! Links and their connectivity can be kept in one of two storages
+//! sharing the same interface and numbering of items:
+//! - Storage_Maps keeps links in an indexed map hashed by their nodes
+//!   and links attached to each node in a map of lists;
+//! - Storage_Flat keeps links and the elements connected to them in
+//!   parallel vectors indexed by link, and links attached to each node
+//!   in a vector indexed by node. A link is found by scanning the links
+//!   attached to its first node instead of hashing. Items of the lists
+//!   of links are recycled through a free list, so that the memory does
+//!   not grow with the number of links created and removed by the algorithm.
+//!
+//! Both storages keep nodes in BRepMesh_VertexTool, whose cell filter
+//! detects coincident nodes, elements in a vector indexed by element,
+//! and indices of links and elements of the domain in packed maps.
 class BRepMesh_DataStructureOfDelaun : public Standard_Transient
 {
+public:
+
+  //! Kind of storage of links.
+  enum Storage
+  {
+    Storage_Maps, //!< hashed maps
+    Storage_Flat  //!< vectors indexed by link and by node
+  };
+
 public:
 
   //! Constructor.
   //! @param theAllocator memory allocator to be used by internal structures.
   //! @param theReservedNodeSize presumed number of nodes in this mesh.
+  //! @param theStorage kind of storage of links.
   Standard_EXPORT BRepMesh_DataStructureOfDelaun(
     const Handle(NCollection_IncAllocator)& theAllocator,
-    const Standard_Integer                  theReservedNodeSize = 100);
+    const Standard_Integer                  theReservedNodeSize = 100,
+    const Storage                           theStorage = Storage_Maps);
+
+  //! Returns kind of storage of links.
+  Storage StorageType() const
+  {
+    return myStorage;
+  }
 
 
 
@@ -112,7 +144,7 @@ public: //! @name API for accessing mesh links.
   //! Returns number of links.
   Standard_Integer NbLinks() const
   {
-    return myLinks.Extent();
+    return myStorage == Storage_Flat ? myFlatLinks.Length() : myLinks.Extent();
   }
 
   //! Adds link to the mesh if it is not already in the mesh.
@@ -125,7 +157,7 @@ public: //! @name API for accessing mesh links.
   //! @return index of the given element of zero if link is not in the mesh.
   Standard_Integer IndexOf(const BRepMesh_Edge& theLink) const
   {
-    return myLinks.FindIndex(theLink);
+    return myStorage == Storage_Flat ? indexOfFlat(theLink) : myLinks.FindIndex(theLink);
   }
 
   //! Get link by the index.
@@ -133,7 +165,7 @@ public: //! @name API for accessing mesh links.
   //! @return link with the given index.
   const BRepMesh_Edge& GetLink(const Standard_Integer theIndex)
   {
-    return myLinks.FindKey(theIndex);
+    return myStorage == Storage_Flat ? myFlatLinks.Value(theIndex - 1) : myLinks.FindKey(theIndex);
   }
 
   //! Returns map of indices of links registered in mesh.
@@ -163,7 +195,8 @@ public: //! @name API for accessing mesh links.
   const BRepMesh_PairOfIndex& ElementsConnectedTo(
     const Standard_Integer theLinkIndex) const
   {
-    return myLinks.FindFromIndex(theLinkIndex);
+    return myStorage == Storage_Flat ?
+      myFlatLinkElements.Value(theLinkIndex - 1) : myLinks.FindFromIndex(theLinkIndex);
   }
 
 
@@ -256,9 +289,34 @@ private:
   IMeshData::ListOfInteger& linksConnectedTo(
     const Standard_Integer theIndex) const
   {
-    return (IMeshData::ListOfInteger&)myNodeLinks.Find(theIndex);
+    return myStorage == Storage_Flat ?
+      (IMeshData::ListOfInteger&)myFlatNodeLinks.Value(theIndex - 1) :
+      (IMeshData::ListOfInteger&)myNodeLinks.Find(theIndex);
   }
 
+  //! Get indices of elements connected to the link with the given index.
+  BRepMesh_PairOfIndex& linkElements(const Standard_Integer theLinkIndex)
+  {
+    return myStorage == Storage_Flat ?
+      myFlatLinkElements.ChangeValue(theLinkIndex - 1) : myLinks(theLinkIndex);
+  }
+
+  //! Finds the index of the given link among links attached to its first node.
+  Standard_EXPORT Standard_Integer indexOfFlat(const BRepMesh_Edge& theLink) const;
+
+  //! Appends new link to the storage.
+  //! @return index of the link.
+  Standard_Integer appendLink(const BRepMesh_Edge&        theLink,
+                              const BRepMesh_PairOfIndex& thePair);
+
+  //! Substitutes the link with the given index in the storage.
+  void substituteLink(const Standard_Integer      theIndex,
+                      const BRepMesh_Edge&        theLink,
+                      const BRepMesh_PairOfIndex& thePair);
+
+  //! Removes the last link from the storage.
+  void removeLastLink();
+
   //! Substitutes deleted links by the last one from corresponding map 
   //! to have only non-deleted links in the structure.
   Standard_EXPORT void clearDeletedLinks();
@@ -290,10 +348,15 @@ private:
 
 private:
 
+  Storage                               myStorage;
   Handle(NCollection_IncAllocator)      myAllocator;
   Handle(BRepMesh_VertexTool)           myNodes;
   IMeshData::DMapOfIntegerListOfInteger myNodeLinks;
   IMeshData::IDMapOfLink                myLinks;
+  Handle(NCollection_BaseAllocator)     myListAllocator; //!< allocator of items of lists of links
+  IMeshData::VectorOfListOfInteger      myFlatNodeLinks;
+  IMeshData::VectorOfLinks              myFlatLinks;
+  IMeshData::VectorOfPairOfIndex        myFlatLinkElements;
   IMeshData::ListOfInteger              myDelLinks;
   IMeshData::VectorOfElements           myElements;
   IMeshData::MapOfInteger               myElementsOfDomain;
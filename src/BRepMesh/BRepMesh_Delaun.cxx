@@ -30,9 +30,12 @@
 #include <BRepMesh_Vertex.hxx>
 #include <BRepMesh_Triangle.hxx>
 
+#include <NCollection_Array1.hxx>
 #include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 
 #include <algorithm>
+#include <memory>
 #include <stack>
 
 const Standard_Real AngDeviation1Deg  = M_PI/180.;
@@ -76,8 +79,332 @@ namespace {
     theBox.Add( thePnt2 );
     theBox.Enlarge(Precision);
   }
+
+  //! Regular grid of sub-domains over the box of inserted vertices.
+  //! The points out of the box belong to the nearest cell.
+  class GridOfSubDomains
+  {
+  public:
+    //! Constructor.
+    //! @param isShifted if TRUE the grid is shifted by half of the cell and has one more cell along U and V.
+    GridOfSubDomains (const Bnd_B2d&         theBox,
+                      const Standard_Integer theNbCellsU,
+                      const Standard_Integer theNbCellsV,
+                      const Standard_Boolean isShifted)
+    : myMin      (theBox.CornerMin()),
+      myNbCellsU (isShifted ? theNbCellsU + 1 : theNbCellsU),
+      myNbCellsV (isShifted ? theNbCellsV + 1 : theNbCellsV)
+    {
+      const gp_XY aSize = theBox.CornerMax() - theBox.CornerMin();
+      myCellSize.SetCoord (Max (aSize.X() / theNbCellsU, Precision),
+                           Max (aSize.Y() / theNbCellsV, Precision));
+      if (isShifted)
+      {
+        myMin -= myCellSize / 2.;
+      }
+    }
+
+    //! Returns number of cells.
+    Standard_Integer NbCells() const
+    {
+      return myNbCellsU * myNbCellsV;
+    }
+
+    //! Returns indices of the cell containing the given point along U and V.
+    void CellIndices (const gp_XY&      thePnt,
+                      Standard_Integer& theIndexU,
+                      Standard_Integer& theIndexV) const
+    {
+      theIndexU = static_cast<Standard_Integer> (Max (0., Min (myNbCellsU - 1., (thePnt.X() - myMin.X()) / myCellSize.X())));
+      theIndexV = static_cast<Standard_Integer> (Max (0., Min (myNbCellsV - 1., (thePnt.Y() - myMin.Y()) / myCellSize.Y())));
+    }
+
+    //! Returns index of the cell containing the given point.
+    Standard_Integer Cell (const gp_XY& thePnt) const
+    {
+      Standard_Integer aIndexU, aIndexV;
+      CellIndices (thePnt, aIndexU, aIndexV);
+      return Cell (aIndexU, aIndexV);
+    }
+
+    //! Returns index of the cell with the given indices along U and V.
+    Standard_Integer Cell (const Standard_Integer theIndexU,
+                           const Standard_Integer theIndexV) const
+    {
+      return theIndexV * myNbCellsU + theIndexU;
+    }
+
+  private:
+    gp_XY            myMin;
+    gp_XY            myCellSize;
+    Standard_Integer myNbCellsU;
+    Standard_Integer myNbCellsV;
+  };
+
+  //! Number of cells of the grid used to take the first level of vertices per sub-domain along U and V.
+  //! The first levels are inserted sequentially since their triangles are large comparing to sub-domains.
+  const Standard_Integer THE_NB_CELLS_OF_FIRST_LEVEL = 4;
+
+  //! Moves the first vertex falling into each cell of the grid to the level,
+  //! or all vertices if there are less vertices than cells.
+  void takeLevelOfVertices (const Handle(BRepMesh_DataStructureOfDelaun)& theMesh,
+                            const GridOfSubDomains&                       theGrid,
+                            IMeshData::VectorOfInteger&                   theVertices,
+                            IMeshData::VectorOfInteger&                   theLevel)
+  {
+    if (theVertices.Size() <= theGrid.NbCells())
+    {
+      theLevel = theVertices;
+      theVertices.Clear();
+      return;
+    }
+
+    NCollection_Array1<Standard_Boolean> isTaken (0, theGrid.NbCells() - 1);
+    isTaken.Init (Standard_False);
+    IMeshData::VectorOfInteger aRest;
+    for (IMeshData::VectorOfInteger::Iterator aVertexIt (theVertices); aVertexIt.More(); aVertexIt.Next())
+    {
+      Standard_Boolean& isCellTaken = isTaken.ChangeValue (theGrid.Cell (theMesh->GetNode (aVertexIt.Value()).Coord()));
+      if (isCellTaken)
+      {
+        aRest.Append (aVertexIt.Value());
+      }
+      else
+      {
+        isCellTaken = Standard_True;
+        theLevel.Append (aVertexIt.Value());
+      }
+    }
+    theVertices = aRest;
+  }
 } // anonymous namespace
 
+//! Copy of the triangles of a sub-domain filled with vertices by a separate thread.
+//! The vertices with the cavities touching the links shared with other sub-domains (seams)
+//! are rejected, so that the triangles of the copy are the same as in the main structure.
+class BRepMesh_Delaun::SubDomain
+{
+public:
+
+  //! Constructor.
+  SubDomain()
+  : NbTriangles (0),
+    IsDone      (Standard_False)
+  {
+  }
+
+  //! Copies the triangles of the sub-domain from the main structure and selects
+  //! the vertices falling into them.
+  void Init (const Handle(BRepMesh_DataStructureOfDelaun)& theMainMesh,
+             const NCollection_Array1<Standard_Integer>&   theDomainsOfTriangles,
+             const Standard_Integer                        theDomain,
+             const IMeshData::VectorOfInteger&             theVertices)
+  {
+    Standard_Real aTolU, aTolV;
+    theMainMesh->Data()->GetTolerance (aTolU, aTolV);
+    const Standard_Real aNbCells = Max (1., Sqrt (static_cast<Standard_Real> (Triangles.Size())));
+    const gp_XY aSize = Box.CornerMax() - Box.CornerMin();
+
+    Mesh = new BRepMesh_DataStructureOfDelaun (
+      new NCollection_IncAllocator (IMeshData::MEMORY_BLOCK_SIZE_HUGE),
+      Triangles.Size() + Candidates.Size(), theMainMesh->StorageType());
+    Mesh->Data()->SetCellSize  (Max (aSize.X() / aNbCells, 2. * aTolU), Max (aSize.Y() / aNbCells, 2. * aTolV));
+    Mesh->Data()->SetTolerance (aTolU, aTolV);
+
+    NCollection_DataMap<Standard_Integer, Standard_Integer> aNodes (Triangles.Size());
+    Handle(IMeshData::MapOfInteger) aSeamLinks = new IMeshData::MapOfInteger;
+    NCollection_DataMap<Standard_Integer, Standard_Integer> aLinks (2 * Triangles.Size());
+    for (IMeshData::VectorOfInteger::Iterator aTriangleIt (Triangles); aTriangleIt.More(); aTriangleIt.Next())
+    {
+      const Standard_Integer   aTriangleId = aTriangleIt.Value();
+      const BRepMesh_Triangle& aTriangle   = theMainMesh->GetElement (aTriangleId);
+      Standard_Integer aNodesId[3];
+      theMainMesh->ElementNodes (aTriangle, aNodesId);
+
+      Standard_Integer anEdges[3];
+      Standard_Boolean anOri[3];
+      for (Standard_Integer anEdgeIt = 0; anEdgeIt < 3; ++anEdgeIt)
+      {
+        const Standard_Integer aLinkId = aTriangle.myEdges[anEdgeIt];
+        anOri[anEdgeIt] = aTriangle.myOrientations[anEdgeIt];
+        if (const Standard_Integer* aLocalLinkId = aLinks.Seek (aLinkId))
+        {
+          anEdges[anEdgeIt] = *aLocalLinkId;
+          continue;
+        }
+
+        // the link is a seam if the triangle on its other side belongs to another sub-domain;
+        // the triangles not taken by sub-domains are kept by the insertion
+        const BRepMesh_Edge& aLink = theMainMesh->GetLink (aLinkId);
+        const BRepMesh_PairOfIndex& aPair = theMainMesh->ElementsConnectedTo (aLinkId);
+        Standard_Boolean isSeam = Standard_False;
+        for (Standard_Integer anElemIt = 1; anElemIt <= aPair.Extent(); ++anElemIt)
+        {
+          const Standard_Integer aDomain = theDomainsOfTriangles (aPair.Index (anElemIt));
+          isSeam = isSeam || (aDomain != theDomain && aDomain != -1);
+        }
+
+        anEdges[anEdgeIt] = Mesh->AddLink (BRepMesh_Edge (
+          copyNode (theMainMesh, aLink.FirstNode(), aNodes),
+          copyNode (theMainMesh, aLink.LastNode(),  aNodes),
+          aLink.Movability()));
+        aLinks.Bind (aLinkId, anEdges[anEdgeIt]);
+        if (isSeam)
+        {
+          aSeamLinks->Add (anEdges[anEdgeIt]);
+        }
+      }
+
+      Mesh->AddElement (BRepMesh_Triangle (anEdges, anOri, BRepMesh_Free));
+    }
+    NbTriangles = Mesh->NbElements();
+
+    Mesher.reset (new BRepMesh_Delaun (Mesh, static_cast<Standard_Integer> (aNbCells),
+                                       static_cast<Standard_Integer> (aNbCells), Standard_True));
+    Mesher->mySeamLinks = aSeamLinks;
+
+    // select the vertices falling into the triangles of the sub-domain
+    const Standard_Real aSqTol = aTolU * aTolU + aTolV * aTolV;
+    for (IMeshData::VectorOfInteger::Iterator aVertexIt (Candidates); aVertexIt.More(); aVertexIt.Next())
+    {
+      const BRepMesh_Vertex& aVertex = theMainMesh->GetNode (theVertices (aVertexIt.Value()));
+      if (Box.IsOut (aVertex.Coord()))
+      {
+        continue;
+      }
+
+      IMeshData::ListOfInteger& aCircles = Mesher->myCircles.Select (aVertex.Coord());
+      for (IMeshData::ListOfInteger::Iterator aCircleIt (aCircles); aCircleIt.More(); aCircleIt.Next())
+      {
+        Standard_Integer anEdgeOn = 0;
+        if (Mesher->Contains (aCircleIt.Value(), aVertex, aSqTol, anEdgeOn))
+        {
+          Selected.Append (aVertexIt.Value());
+          break;
+        }
+      }
+    }
+    std::sort (Selected.begin(), Selected.end());
+  }
+
+  //! Inserts the vertices owned by the sub-domain into the copy of its triangles.
+  void Perform (const Handle(BRepMesh_DataStructureOfDelaun)& theMainMesh,
+                const IMeshData::VectorOfInteger&             theVertices)
+  {
+    IMeshData::VectorOfInteger aVertices (Inserted.Size());
+    for (IMeshData::VectorOfInteger::Iterator aVertexIt (Inserted); aVertexIt.More(); aVertexIt.Next())
+    {
+      const Standard_Integer aVertexId = theVertices (aVertexIt.Value());
+      const Standard_Integer aNodeId   = Mesh->AddNode (theMainMesh->GetNode (aVertexId), Standard_True);
+      NodesMap.SetValue (aNodeId - 1, aVertexId);
+      aVertices.Append (aNodeId);
+    }
+
+    // the constraints are processed on the whole mesh after the merge
+    Mesher->createTrianglesOnNewVertices (aVertices, Message_ProgressRange(), Standard_False);
+
+    // the vertices rejected by the insertion are left for the next round
+    for (Standard_Integer aVertexIt = 0; aVertexIt < aVertices.Size(); ++aVertexIt)
+    {
+      if (Mesh->LinksConnectedTo (aVertices (aVertexIt)).IsEmpty())
+      {
+        Rejected.Append (Inserted (aVertexIt));
+      }
+    }
+
+    // each seam should keep its triangle to be merged with the neighbor sub-domain
+    IsDone = Standard_True;
+    for (IMeshData::IteratorOfMapOfInteger aLinkIt (*Mesher->mySeamLinks); aLinkIt.More() && IsDone; aLinkIt.Next())
+    {
+      IsDone = Mesh->ElementsConnectedTo (aLinkIt.Key()).Extent() == 1;
+    }
+  }
+
+private:
+
+  //! Copies the node of the main structure if it is not copied yet.
+  //! @return index of the node in the copy.
+  Standard_Integer copyNode (const Handle(BRepMesh_DataStructureOfDelaun)&            theMainMesh,
+                             const Standard_Integer                                   theNodeId,
+                             NCollection_DataMap<Standard_Integer, Standard_Integer>& theNodes)
+  {
+    if (const Standard_Integer* aNodeId = theNodes.Seek (theNodeId))
+    {
+      return *aNodeId;
+    }
+
+    const Standard_Integer aNodeId = Mesh->AddNode (theMainMesh->GetNode (theNodeId), Standard_True);
+    NodesMap.SetValue (aNodeId - 1, theNodeId);
+    theNodes.Bind (theNodeId, aNodeId);
+    return aNodeId;
+  }
+
+public:
+
+  IMeshData::VectorOfInteger             Triangles;  //!< triangles of the main structure assigned to the sub-domain
+  Bnd_B2d                                Box;        //!< bounding box of the triangles
+  IMeshData::VectorOfInteger             Candidates; //!< positions of the vertices in the cells overlapping the box
+  IMeshData::VectorOfInteger             Selected;   //!< positions of the vertices falling into the triangles
+  IMeshData::VectorOfInteger             Inserted;   //!< positions of the vertices selected by this sub-domain only
+  IMeshData::VectorOfInteger             Rejected;   //!< positions of the vertices rejected by the insertion
+  Handle(BRepMesh_DataStructureOfDelaun) Mesh;       //!< copy of the triangles
+  std::unique_ptr<BRepMesh_Delaun>       Mesher;     //!< triangulator of the copy
+  IMeshData::VectorOfInteger             NodesMap;   //!< indices of the nodes of the copy in the main structure
+  Standard_Integer                       NbTriangles; //!< number of copied triangles
+  Standard_Boolean                       IsDone;     //!< the seams are kept by the insertion
+};
+
+//! Functor processing the sub-domains in parallel threads: either copies
+//! their triangles selecting the vertices, or inserts the owned vertices.
+class BRepMesh_Delaun::SubDomainFunctor
+{
+public:
+
+  //! Constructor.
+  SubDomainFunctor (const Handle(BRepMesh_DataStructureOfDelaun)& theMainMesh,
+                    NCollection_Array1<SubDomain>&                theSubDomains,
+                    const NCollection_Array1<Standard_Integer>&   theDomainsOfTriangles,
+                    const IMeshData::VectorOfInteger&             theVertices,
+                    const Standard_Boolean                        isToInit)
+  : myMainMesh            (theMainMesh),
+    mySubDomains          (theSubDomains),
+    myDomainsOfTriangles  (theDomainsOfTriangles),
+    myVertices            (theVertices),
+    myIsToInit            (isToInit)
+  {
+  }
+
+  //! Processes the sub-domain with the given index.
+  void operator() (const Standard_Integer theDomain) const
+  {
+    SubDomain& aSubDomain = mySubDomains.ChangeValue (theDomain);
+    if (myIsToInit)
+    {
+      if (!aSubDomain.Triangles.IsEmpty() && !aSubDomain.Candidates.IsEmpty())
+      {
+        aSubDomain.Init (myMainMesh, myDomainsOfTriangles, theDomain, myVertices);
+      }
+    }
+    else if (!aSubDomain.Inserted.IsEmpty())
+    {
+      aSubDomain.Perform (myMainMesh, myVertices);
+    }
+  }
+
+private:
+
+  SubDomainFunctor (const SubDomainFunctor& theOther);
+
+  void operator= (const SubDomainFunctor& theOther);
+
+private:
+  const Handle(BRepMesh_DataStructureOfDelaun)& myMainMesh;
+  NCollection_Array1<SubDomain>&                mySubDomains;
+  const NCollection_Array1<Standard_Integer>&   myDomainsOfTriangles;
+  const IMeshData::VectorOfInteger&             myVertices;
+  const Standard_Boolean                        myIsToInit;
+};
+
 //=======================================================================
 //function : BRepMesh_Delaun
 //purpose  : 
@@ -543,7 +870,8 @@ void BRepMesh_Delaun::createTriangles(const Standard_Integer          theVertexI
 //=======================================================================
 void BRepMesh_Delaun::createTrianglesOnNewVertices(
   IMeshData::VectorOfInteger&   theVertexIndexes,
-  const Message_ProgressRange& theRange)
+  const Message_ProgressRange& theRange,
+  const Standard_Boolean       isToProcessConstraints)
 {
   Handle(NCollection_IncAllocator) aAllocator =
     new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
@@ -600,6 +928,12 @@ void BRepMesh_Delaun::createTrianglesOnNewVertices(
       }
     }
 
+    if ( aTriangleId > 0 && isCavityOnSeam( aTriangleId, aCirclesList, aAllocator ) )
+    {
+      // The vertex is inserted after merge of the sub-domain
+      continue;
+    }
+
     if ( aTriangleId > 0 )
     {
       deleteTriangle( aTriangleId, aLoopEdges );
@@ -632,7 +966,10 @@ void BRepMesh_Delaun::createTrianglesOnNewVertices(
     }
   }
 
-  ProcessConstraints();
+  if (isToProcessConstraints)
+  {
+    ProcessConstraints();
+  }
 }
 
 //=======================================================================
@@ -2257,6 +2594,324 @@ void BRepMesh_Delaun::AddVertices(IMeshData::VectorOfInteger&  theVertices,
   createTrianglesOnNewVertices(theVertices, theRange);
 }
 
+//=======================================================================
+//function : AddVertices
+//purpose  : Adds some vertices in the triangulation by sub-domains
+//           processed in parallel threads.
+//=======================================================================
+void BRepMesh_Delaun::AddVertices (IMeshData::VectorOfInteger&  theVertices,
+                                   const Standard_Integer       theNbSubDomainsU,
+                                   const Standard_Integer       theNbSubDomainsV,
+                                   const Message_ProgressRange& theRange)
+{
+  if (!myInitCircles || theNbSubDomainsU < 1 || theNbSubDomainsV < 1
+   || theNbSubDomainsU * theNbSubDomainsV < 2 || theVertices.IsEmpty())
+  {
+    AddVertices (theVertices, theRange);
+    return;
+  }
+
+  ComparatorOfIndexedVertexOfDelaun aCmp(myMeshData);
+  std::make_heap(theVertices.begin(), theVertices.end(), aCmp);
+  std::sort_heap(theVertices.begin(), theVertices.end(), aCmp);
+
+  // The grids are built on the box of vertices and do not depend
+  // on the number of threads to keep the result reproducible
+  Bnd_B2d aBox;
+  for (IMeshData::VectorOfInteger::Iterator aVertexIt (theVertices); aVertexIt.More(); aVertexIt.Next())
+  {
+    aBox.Add (GetVertex (aVertexIt.Value()).Coord());
+  }
+
+  // The vertices are inserted by levels of growing density, so that the triangles
+  // are small comparing to sub-domains and the cavities of the most vertices do not
+  // reach the seams. Each level takes the first vertex in each cell of the grid twice
+  // finer than the previous one. The vertices left near the seams are inserted by
+  // the shifted grid, which has the seams far from them, the rest ones sequentially.
+  Message_ProgressScope aPS (theRange, "Add vertices by sub-domains", theVertices.Size());
+  IMeshData::VectorOfInteger aVertices (theVertices);
+  for (Standard_Integer aNbCells = THE_NB_CELLS_OF_FIRST_LEVEL; !aVertices.IsEmpty(); aNbCells *= 2)
+  {
+    IMeshData::VectorOfInteger aLevel;
+    takeLevelOfVertices (myMeshData, GridOfSubDomains (aBox, aNbCells * theNbSubDomainsU, aNbCells * theNbSubDomainsV, Standard_False),
+                         aVertices, aLevel);
+    const Standard_Integer aNbLevelVertices = aLevel.Size();
+    if (aNbCells > THE_NB_CELLS_OF_FIRST_LEVEL)
+    {
+      addVerticesBySubDomains (aLevel, aBox, theNbSubDomainsU, theNbSubDomainsV, Standard_False);
+      addVerticesBySubDomains (aLevel, aBox, theNbSubDomainsU, theNbSubDomainsV, Standard_True);
+    }
+    createTrianglesOnNewVertices (aLevel, Message_ProgressRange(), Standard_False);
+
+    aPS.Next (aNbLevelVertices);
+    if (!aPS.More())
+    {
+      return;
+    }
+  }
+
+  ProcessConstraints();
+}
+
+//=======================================================================
+//function : addVerticesBySubDomains
+//purpose  : Inserts the vertices by sub-domains of the grid
+//=======================================================================
+void BRepMesh_Delaun::addVerticesBySubDomains (IMeshData::VectorOfInteger& theVertices,
+                                               const Bnd_B2d&              theBox,
+                                               const Standard_Integer      theNbSubDomainsU,
+                                               const Standard_Integer      theNbSubDomainsV,
+                                               const Standard_Boolean      isShifted)
+{
+  if (theVertices.IsEmpty())
+  {
+    return;
+  }
+
+  const GridOfSubDomains aGrid (theBox, theNbSubDomainsU, theNbSubDomainsV, isShifted);
+
+  // Only the triangles with the circles containing vertices can be changed by insertion,
+  // they are distributed among sub-domains by their centers
+  NCollection_Array1<SubDomain> aSubDomains (0, aGrid.NbCells() - 1);
+  NCollection_Array1<Standard_Integer> aDomainsOfTriangles (1, Max (myMeshData->NbElements(), 1));
+  aDomainsOfTriangles.Init (-1);
+  for (IMeshData::VectorOfInteger::Iterator aVertexIt (theVertices); aVertexIt.More(); aVertexIt.Next())
+  {
+    const IMeshData::ListOfInteger& aCircles = myCircles.Select (GetVertex (aVertexIt.Value()).Coord());
+    for (IMeshData::ListOfInteger::Iterator aCircleIt (aCircles); aCircleIt.More(); aCircleIt.Next())
+    {
+      const Standard_Integer aTriangleId = aCircleIt.Value();
+      if (aDomainsOfTriangles (aTriangleId) != -1)
+      {
+        continue;
+      }
+
+      Standard_Integer aNodes[3];
+      myMeshData->ElementNodes (GetTriangle (aTriangleId), aNodes);
+      const gp_XY& aPnt1 = GetVertex (aNodes[0]).Coord();
+      const gp_XY& aPnt2 = GetVertex (aNodes[1]).Coord();
+      const gp_XY& aPnt3 = GetVertex (aNodes[2]).Coord();
+
+      const Standard_Integer aDomain = aGrid.Cell ((aPnt1 + aPnt2 + aPnt3) / 3.);
+      aDomainsOfTriangles (aTriangleId) = aDomain;
+
+      SubDomain& aSubDomain = aSubDomains.ChangeValue (aDomain);
+      aSubDomain.Triangles.Append (aTriangleId);
+      aSubDomain.Box.Add (aPnt1);
+      aSubDomain.Box.Add (aPnt2);
+      aSubDomain.Box.Add (aPnt3);
+    }
+  }
+
+  // Vertices falling into the cells overlapping the box of triangles are candidates for the sub-domain
+  NCollection_Array1<IMeshData::VectorOfInteger> aVerticesOfCells (0, aGrid.NbCells() - 1);
+  for (Standard_Integer aVertexIt = 0; aVertexIt < theVertices.Size(); ++aVertexIt)
+  {
+    aVerticesOfCells.ChangeValue (aGrid.Cell (GetVertex (theVertices (aVertexIt)).Coord())).Append (aVertexIt);
+  }
+  for (Standard_Integer aDomain = 0; aDomain < aGrid.NbCells(); ++aDomain)
+  {
+    SubDomain& aSubDomain = aSubDomains.ChangeValue (aDomain);
+    if (aSubDomain.Triangles.IsEmpty())
+    {
+      continue;
+    }
+
+    aSubDomain.Box.Enlarge (Precision);
+    Standard_Integer aMinU, aMinV, aMaxU, aMaxV;
+    aGrid.CellIndices (aSubDomain.Box.CornerMin(), aMinU, aMinV);
+    aGrid.CellIndices (aSubDomain.Box.CornerMax(), aMaxU, aMaxV);
+    for (Standard_Integer aCellV = aMinV; aCellV <= aMaxV; ++aCellV)
+    {
+      for (Standard_Integer aCellU = aMinU; aCellU <= aMaxU; ++aCellU)
+      {
+        const IMeshData::VectorOfInteger& aVertices = aVerticesOfCells (aGrid.Cell (aCellU, aCellV));
+        for (IMeshData::VectorOfInteger::Iterator aVertexIt (aVertices); aVertexIt.More(); aVertexIt.Next())
+        {
+          aSubDomain.Candidates.Append (aVertexIt.Value());
+        }
+      }
+    }
+  }
+
+  // Copy triangles of sub-domains and select vertices falling into them
+  OSD_Parallel::For (0, aGrid.NbCells(),
+    SubDomainFunctor (myMeshData, aSubDomains, aDomainsOfTriangles, theVertices, Standard_True));
+
+  // A vertex selected by several sub-domains lies on a seam and is left for the next round
+  NCollection_Array1<Standard_Integer> aDomainsOfVertices (0, theVertices.Size() - 1);
+  aDomainsOfVertices.Init (-1);
+  for (Standard_Integer aDomain = 0; aDomain < aGrid.NbCells(); ++aDomain)
+  {
+    for (IMeshData::VectorOfInteger::Iterator aVertexIt (aSubDomains (aDomain).Selected); aVertexIt.More(); aVertexIt.Next())
+    {
+      Standard_Integer& aVertexDomain = aDomainsOfVertices (aVertexIt.Value());
+      aVertexDomain = (aVertexDomain == -1 ? aDomain : -2);
+    }
+  }
+  for (Standard_Integer aDomain = 0; aDomain < aGrid.NbCells(); ++aDomain)
+  {
+    SubDomain& aSubDomain = aSubDomains.ChangeValue (aDomain);
+    for (IMeshData::VectorOfInteger::Iterator aVertexIt (aSubDomain.Selected); aVertexIt.More(); aVertexIt.Next())
+    {
+      if (aDomainsOfVertices (aVertexIt.Value()) == aDomain)
+      {
+        aSubDomain.Inserted.Append (aVertexIt.Value());
+      }
+    }
+  }
+
+  // Insert vertices into sub-domains
+  OSD_Parallel::For (0, aGrid.NbCells(),
+    SubDomainFunctor (myMeshData, aSubDomains, aDomainsOfTriangles, theVertices, Standard_False));
+
+  // Merge sub-domains collecting the vertices left for the next round
+  NCollection_Array1<Standard_Boolean> isInserted (0, theVertices.Size() - 1);
+  isInserted.Init (Standard_False);
+  for (Standard_Integer aDomain = 0; aDomain < aGrid.NbCells(); ++aDomain)
+  {
+    SubDomain& aSubDomain = aSubDomains.ChangeValue (aDomain);
+    if (!aSubDomain.IsDone)
+    {
+      continue;
+    }
+
+    mergeSubDomain (aSubDomain);
+    for (IMeshData::VectorOfInteger::Iterator aVertexIt (aSubDomain.Inserted); aVertexIt.More(); aVertexIt.Next())
+    {
+      isInserted (aVertexIt.Value()) = Standard_True;
+    }
+    for (IMeshData::VectorOfInteger::Iterator aVertexIt (aSubDomain.Rejected); aVertexIt.More(); aVertexIt.Next())
+    {
+      isInserted (aVertexIt.Value()) = Standard_False;
+    }
+
+    // release the copy
+    aSubDomain.Mesher.reset();
+    aSubDomain.Mesh.Nullify();
+  }
+
+  IMeshData::VectorOfInteger aVertices;
+  for (Standard_Integer aVertexIt = 0; aVertexIt < theVertices.Size(); ++aVertexIt)
+  {
+    if (!isInserted (aVertexIt))
+    {
+      aVertices.Append (theVertices (aVertexIt));
+    }
+  }
+  theVertices = aVertices;
+}
+
+//=======================================================================
+//function : mergeSubDomain
+//purpose  : Replaces the triangles of the sub-domain modified by
+//           insertion of vertices by the new ones
+//=======================================================================
+void BRepMesh_Delaun::mergeSubDomain (const SubDomain& theSubDomain)
+{
+  Handle(NCollection_IncAllocator) aAllocator =
+    new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
+  IMeshData::MapOfIntegerInteger aLoopEdges(10, aAllocator);
+
+  // Triangles of the copy are never reused, so the copied triangles
+  // kept by the insertion remain the same in the main structure
+  const Handle(BRepMesh_DataStructureOfDelaun)& aMesh = theSubDomain.Mesh;
+  for (Standard_Integer aTriangleIt = 1; aTriangleIt <= theSubDomain.NbTriangles; ++aTriangleIt)
+  {
+    if (aMesh->GetElement (aTriangleIt).Movability() == BRepMesh_Deleted)
+    {
+      deleteTriangle (theSubDomain.Triangles (aTriangleIt - 1), aLoopEdges);
+    }
+  }
+
+  for (Standard_Integer aTriangleIt = theSubDomain.NbTriangles + 1; aTriangleIt <= aMesh->NbElements(); ++aTriangleIt)
+  {
+    const BRepMesh_Triangle& aTriangle = aMesh->GetElement (aTriangleIt);
+    if (aTriangle.Movability() == BRepMesh_Deleted)
+    {
+      continue;
+    }
+
+    Standard_Integer aNodes[3];
+    aMesh->ElementNodes (aTriangle, aNodes);
+    for (Standard_Integer aNodeIt = 0; aNodeIt < 3; ++aNodeIt)
+    {
+      aNodes[aNodeIt] = theSubDomain.NodesMap (aNodes[aNodeIt] - 1);
+    }
+
+    Standard_Integer anEdges[3];
+    Standard_Boolean anOri[3];
+    for (Standard_Integer anEdgeIt = 0; anEdgeIt < 3; ++anEdgeIt)
+    {
+      const Standard_Integer aLinkId = myMeshData->AddLink (
+        BRepMesh_Edge (aNodes[anEdgeIt], aNodes[(anEdgeIt + 1) % 3], BRepMesh_Free));
+      anEdges[anEdgeIt] = Abs (aLinkId);
+      anOri  [anEdgeIt] = aLinkId > 0;
+    }
+
+    addTriangle (anEdges, anOri, aNodes);
+  }
+
+  IMeshData::MapOfIntegerInteger::Iterator aLoopEdgesIt (aLoopEdges);
+  for (; aLoopEdgesIt.More(); aLoopEdgesIt.Next())
+  {
+    if (myMeshData->ElementsConnectedTo (aLoopEdgesIt.Key()).IsEmpty())
+      myMeshData->RemoveLink (aLoopEdgesIt.Key());
+  }
+}
+
+//=======================================================================
+//function : isCavityOnSeam
+//purpose  : Checks whether the cavity of a vertex touches the seam links
+//=======================================================================
+Standard_Boolean BRepMesh_Delaun::isCavityOnSeam (
+  const Standard_Integer                  theTriangleId,
+  const IMeshData::ListOfInteger&         theCircles,
+  const Handle(NCollection_IncAllocator)& theAllocator) const
+{
+  if (mySeamLinks.IsNull())
+  {
+    return Standard_False;
+  }
+
+  IMeshData::MapOfIntegerInteger aCavity      (10, theAllocator);
+  IMeshData::MapOfIntegerInteger aCavityLinks (10, theAllocator);
+  Standard_Integer aTriangleId = theTriangleId;
+  Standard_Boolean isModified = Standard_True;
+  while (isModified)
+  {
+    if (aTriangleId > 0)
+    {
+      const Standard_Integer(&e)[3] = GetTriangle (aTriangleId).myEdges;
+      for (Standard_Integer anEdgeIt = 0; anEdgeIt < 3; ++anEdgeIt)
+      {
+        if (mySeamLinks->Contains (e[anEdgeIt]))
+        {
+          return Standard_True;
+        }
+        aCavityLinks.Bind (e[anEdgeIt], Standard_True);
+      }
+      aCavity.Bind (aTriangleId, Standard_True);
+    }
+
+    // the same growth of the cavity as in createTrianglesOnNewVertices()
+    isModified  = Standard_False;
+    aTriangleId = 0;
+    for (IMeshData::ListOfInteger::Iterator aCircleIt (theCircles); aCircleIt.More(); aCircleIt.Next())
+    {
+      const Standard_Integer(&e)[3] = GetTriangle (aCircleIt.Value()).myEdges;
+      if (!aCavity.IsBound (aCircleIt.Value())
+       && (aCavityLinks.IsBound (e[0]) || aCavityLinks.IsBound (e[1]) || aCavityLinks.IsBound (e[2])))
+      {
+        aTriangleId = aCircleIt.Value();
+        isModified  = Standard_True;
+        break;
+      }
+    }
+  }
+  return Standard_False;
+}
+
 //=======================================================================
 //function : UseEdge
 //purpose  : Modify mesh to use the edge. Return True if done
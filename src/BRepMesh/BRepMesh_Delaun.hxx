@@ -74,6 +74,21 @@ public:
   Standard_EXPORT void AddVertices (IMeshData::VectorOfInteger&  theVerticesIndices,
                                     const Message_ProgressRange& theRange = Message_ProgressRange());
 
+  //! Adds some vertices into the triangulation by sub-domains processed in parallel threads.
+  //! The domain is split into a regular grid of the given size, each sub-domain takes
+  //! the triangles with the centers in its cell and the circles containing the vertices.
+  //! The vertices falling into these triangles are inserted into their copy concurrently
+  //! with other sub-domains unless the cavity of a vertex reaches the triangles of another
+  //! sub-domain (seam), so that the merged result is the same as of sequential insertion.
+  //! The vertices are inserted by levels of growing density to keep the triangles small
+  //! comparing to sub-domains; the vertices left near the seams are inserted by the grid
+  //! shifted by half of the cell, the rest ones sequentially.
+  //! Falls back to sequential insertion if the circles of triangles are not filled.
+  Standard_EXPORT void AddVertices (IMeshData::VectorOfInteger&  theVerticesIndices,
+                                    const Standard_Integer       theNbSubDomainsU,
+                                    const Standard_Integer       theNbSubDomainsV,
+                                    const Message_ProgressRange& theRange = Message_ProgressRange());
+
   //! Modify mesh to use the edge.
   //! @return True if done
   Standard_EXPORT Standard_Boolean UseEdge (const Standard_Integer theEdge);
@@ -166,6 +181,12 @@ private:
 
   typedef NCollection_DataMap<Standard_Integer, IMeshData::MapOfInteger> DataMapOfMap;
 
+  //! Copy of the triangles of a sub-domain filled with vertices by a separate thread.
+  class SubDomain;
+
+  //! Functor processing the sub-domains in parallel threads.
+  class SubDomainFunctor;
+
   //! Performs initialization of circles cell filter tool.
   void initCirclesTool (const Bnd_Box2d&       theBox,
                         const Standard_Integer theCellsCountU,
@@ -292,8 +313,10 @@ private:
                                                 IMeshData::SequenceOfBndB2d&  thePolyBoxes);
   
   //! Creates the triangles on new nodes.
+  //! @param isToProcessConstraints if TRUE the mesh is adjusted to the constraint links afterwards.
   void createTrianglesOnNewVertices (IMeshData::VectorOfInteger&  theVertexIndices,
-                                     const Message_ProgressRange& theRange);
+                                     const Message_ProgressRange& theRange,
+                                     const Standard_Boolean       isToProcessConstraints = Standard_True);
 
   //! Cleanup mesh from the free triangles.
   void cleanupMesh();
@@ -359,6 +382,24 @@ private:
   //! Performs insertion of internal edges into mesh.
   void insertInternalEdges();
 
+  //! Inserts the vertices by sub-domains of the grid built on the given box.
+  //! The vertices left for the sequential insertion are kept in the given vector.
+  //! @param isShifted if TRUE the grid is shifted by half of the cell.
+  void addVerticesBySubDomains (IMeshData::VectorOfInteger& theVertices,
+                                const Bnd_B2d&              theBox,
+                                const Standard_Integer      theNbSubDomainsU,
+                                const Standard_Integer      theNbSubDomainsV,
+                                const Standard_Boolean      isShifted);
+
+  //! Replaces the triangles of the sub-domain modified by insertion of vertices by the new ones.
+  void mergeSubDomain (const SubDomain& theSubDomain);
+
+  //! Checks whether the cavity of a vertex formed by the given triangle containing it
+  //! and the connected triangles from the list of circles touches the seam links.
+  Standard_Boolean isCavityOnSeam (const Standard_Integer                  theTriangleId,
+                                   const IMeshData::ListOfInteger&         theCircles,
+                                   const Handle(NCollection_IncAllocator)& theAllocator) const;
+
   //! Checks whether the given vertex id relates to super contour.
   Standard_Boolean isSupVertex (const Standard_Integer theVertexIdx) const
   {
@@ -380,6 +421,7 @@ private:
   IMeshData::VectorOfInteger             mySupVert;
   Standard_Boolean                       myInitCircles;
   BRepMesh_Triangle                      mySupTrian;
+  Handle(IMeshData::MapOfInteger)        mySeamLinks;
 };
 
 #endif
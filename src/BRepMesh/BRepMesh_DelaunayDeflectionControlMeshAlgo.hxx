@@ -19,6 +19,7 @@
 #include <BRepMesh_DelaunayNodeInsertionMeshAlgo.hxx>
 #include <BRepMesh_GeomTool.hxx>
 #include <GeomLib.hxx>
+#include <NCollection_Vector.hxx>
 
 //! Extends node insertion Delaunay meshing algo in order to control 
 //! deflection of generated trianges. Splits triangles failing the check.
@@ -102,11 +103,18 @@ protected:
         break;
       }
       // Iterate on current triangles
-      IMeshData::IteratorOfMapOfInteger aTriangleIt(this->getStructure()->ElementsOfDomain());
-      for (; aTriangleIt.More(); aTriangleIt.Next())
+      if (this->isInParallelFace (this->getStructure()->ElementsOfDomain().Extent()))
       {
-        const BRepMesh_Triangle& aTriangle = this->getStructure()->GetElement(aTriangleIt.Key());
-        splitTriangleGeometry(aTriangle);
+        splitTrianglesGeometryInParallel();
+      }
+      else
+      {
+        IMeshData::IteratorOfMapOfInteger aTriangleIt(this->getStructure()->ElementsOfDomain());
+        for (; aTriangleIt.More(); aTriangleIt.Next())
+        {
+          const BRepMesh_Triangle& aTriangle = this->getStructure()->GetElement(aTriangleIt.Key());
+          splitTriangleGeometry(aTriangle);
+        }
       }
 
       isInserted = this->insertNodes(myControlNodes, theMesher, aPS.Next());
@@ -135,6 +143,70 @@ private:
     Standard_Boolean isFrontierLink;
   };
 
+  //! Point computed by a task of parallel check of triangles, which is still
+  //! to be checked against MinSize before caching it for insertion.
+  struct ControlCandidate
+  {
+    ControlCandidate()
+    : IsLink      (Standard_False),
+      IsDeflected (Standard_False),
+      IsAccepted  (Standard_False)
+    {
+    }
+
+    gp_XY                 Point2d;
+    gp_Pnt                Point3d;
+    BRepMesh_OrientedEdge Link;          //!< split link, undefined for the center of triangle
+    TriangleNodeInfo      LinkNodes[2];  //!< nodes of the split link
+    Standard_Boolean      IsLink;        //!< point is the middle of a link
+    Standard_Boolean      IsDeflected;   //!< deviation of the point exceeds the deflection
+    Standard_Boolean      IsAccepted;    //!< middle of the link to be inserted though it fits the deflection
+  };
+
+  //! Triangles of a cell of the parametric range of the face with the results of their check.
+  struct CellOfTriangles
+  {
+    CellOfTriangles()
+    : MaxSqDeflection  (-1.),
+      IsAllDegenerated (Standard_True)
+    {
+    }
+
+    NCollection_Vector<Standard_Integer>      Triangles;       //!< triangles with the center in the cell
+    NCollection_Vector<ControlCandidate>      Candidates;      //!< points to be inserted, in order of check
+    NCollection_Vector<BRepMesh_OrientedEdge> CheckedLinks;    //!< all links checked by the task
+    Standard_Real                             MaxSqDeflection; //!< maximum deviation of the checked points
+    Standard_Boolean                          IsAllDegenerated;
+  };
+
+  //! Functor checking the triangles of one cell.
+  class CellsChecker
+  {
+  public:
+    CellsChecker(
+      BRepMesh_DelaunayDeflectionControlMeshAlgo& theAlgo,
+      NCollection_Array1<CellOfTriangles>&        theCells)
+      : myAlgo (theAlgo),
+        myCells(theCells)
+    {
+    }
+
+    void operator() (const Standard_Integer theCellIndex) const
+    {
+      myAlgo.splitTrianglesOfCell (myCells.ChangeValue (theCellIndex));
+    }
+
+  private:
+
+    CellsChecker (const CellsChecker& theOther);
+
+    void operator= (const CellsChecker& theOther);
+
+  private:
+    BRepMesh_DelaunayDeflectionControlMeshAlgo& myAlgo;
+    NCollection_Array1<CellOfTriangles>&        myCells;
+  };
+
   //! Functor computing deflection of a point from surface.
   class NormalDeviation
   {
@@ -357,15 +429,196 @@ private:
     }
   }
 
+  //! Checks triangles of the domain in several threads.
+  //! The triangles are distributed among the cells of a regular grid on the
+  //! parametric range of the face, so that each task evaluates a compact part
+  //! of the surface. The number of cells does not depend on the number of threads
+  //! to keep the result reproducible. The points failing the deflection are
+  //! checked against MinSize and cached for insertion sequentially, cell by cell,
+  //! since this check uses the circles of triangulation and the map of links.
+  void splitTrianglesGeometryInParallel()
+  {
+    const IMeshData::MapOfInteger& aTriangles = this->getStructure()->ElementsOfDomain();
+    const Standard_Integer aNbCellsSide = Max (2, Min (16,
+      static_cast<Standard_Integer>(Sqrt (aTriangles.Extent() / 1024.))));
+
+    const std::pair<Standard_Real, Standard_Real>& aRangeU = this->getRangeSplitter().GetRangeU();
+    const std::pair<Standard_Real, Standard_Real>& aRangeV = this->getRangeSplitter().GetRangeV();
+    const Standard_Real aCellSizeU = Max ((aRangeU.second - aRangeU.first) / aNbCellsSide, Precision::PConfusion());
+    const Standard_Real aCellSizeV = Max ((aRangeV.second - aRangeV.first) / aNbCellsSide, Precision::PConfusion());
+
+    NCollection_Array1<CellOfTriangles> aCells (0, aNbCellsSide * aNbCellsSide - 1);
+    IMeshData::IteratorOfMapOfInteger aTriangleIt (aTriangles);
+    for (; aTriangleIt.More(); aTriangleIt.Next())
+    {
+      const BRepMesh_Triangle& aTriangle = this->getStructure()->GetElement (aTriangleIt.Key());
+      if (aTriangle.Movability() == BRepMesh_Deleted)
+      {
+        continue;
+      }
+
+      Standard_Integer aNodes[3];
+      this->getStructure()->ElementNodes (aTriangle, aNodes);
+
+      gp_XY aCenter2d (0., 0.);
+      for (Standard_Integer i = 0; i < 3; ++i)
+      {
+        aCenter2d += this->getRangeSplitter().Scale (this->getStructure()->GetNode (aNodes[i]).Coord(), Standard_False).XY();
+      }
+      aCenter2d /= 3.;
+
+      const Standard_Integer aCellU = Max (0, Min (aNbCellsSide - 1,
+        static_cast<Standard_Integer>((aCenter2d.X() - aRangeU.first) / aCellSizeU)));
+      const Standard_Integer aCellV = Max (0, Min (aNbCellsSide - 1,
+        static_cast<Standard_Integer>((aCenter2d.Y() - aRangeV.first) / aCellSizeV)));
+      aCells.ChangeValue (aCellV * aNbCellsSide + aCellU).Triangles.Append (aTriangleIt.Key());
+    }
+
+    OSD_Parallel::For (aCells.Lower(), aCells.Upper() + 1, CellsChecker (*this, aCells));
+
+    for (typename NCollection_Array1<CellOfTriangles>::Iterator aCellIt (aCells); aCellIt.More(); aCellIt.Next())
+    {
+      const CellOfTriangles& aCell = aCellIt.Value();
+      myMaxSqDeflection  = Max (myMaxSqDeflection, aCell.MaxSqDeflection);
+      myIsAllDegenerated = myIsAllDegenerated && aCell.IsAllDegenerated;
+
+      for (typename NCollection_Vector<ControlCandidate>::Iterator aCandidateIt (aCell.Candidates);
+           aCandidateIt.More(); aCandidateIt.Next())
+      {
+        const ControlCandidate& aCandidate = aCandidateIt.Value();
+        if (aCandidate.IsLink && !myCouplesMap->Add (aCandidate.Link))
+        {
+          // link on the border of cells is already processed by another task
+          continue;
+        }
+
+        if (aCandidate.IsDeflected)
+        {
+          if (!rejectByMinSize (aCandidate.Point2d, aCandidate.Point3d))
+          {
+            myControlNodes->Append (aCandidate.Point2d);
+          }
+          else if (aCandidate.IsLink &&
+                  !rejectSplitLinksForMinSize (aCandidate.LinkNodes[0], aCandidate.LinkNodes[1], aCandidate.Point3d) &&
+                  !checkLinkEndsForAngularDeviation (aCandidate.LinkNodes[0], aCandidate.LinkNodes[1], aCandidate.Point2d))
+          {
+            myControlNodes->Append (aCandidate.Point2d);
+          }
+        }
+        else if (aCandidate.IsAccepted)
+        {
+          myControlNodes->Append (aCandidate.Point2d);
+        }
+      }
+
+      for (NCollection_Vector<BRepMesh_OrientedEdge>::Iterator aLinkIt (aCell.CheckedLinks); aLinkIt.More(); aLinkIt.Next())
+      {
+        myCouplesMap->Add (aLinkIt.Value());
+      }
+    }
+  }
+
+  //! Checks geometry of the triangles of the given cell. Performs the same checks
+  //! as splitTriangleGeometry() except the ones using shared data, which are
+  //! postponed by recording the points in the list of candidates of the cell.
+  void splitTrianglesOfCell (CellOfTriangles& theCell)
+  {
+    // the adaptor caches the evaluated span of B-spline surface, so each task uses its own copy
+    const Handle(Adaptor3d_Surface) aSurface = this->getDFace()->GetSurface()->ShallowCopy();
+    const Standard_Real aSqDeflection = this->getDFace()->GetDeflection() * this->getDFace()->GetDeflection();
+
+    NCollection_Map<BRepMesh_OrientedEdge> aCheckedLinks (3 * theCell.Triangles.Size());
+    for (NCollection_Vector<Standard_Integer>::Iterator aTriangleIt (theCell.Triangles); aTriangleIt.More(); aTriangleIt.Next())
+    {
+      const BRepMesh_Triangle& aTriangle = this->getStructure()->GetElement (aTriangleIt.Value());
+
+      Standard_Integer aNodesIndices[3];
+      this->getStructure()->ElementNodes (aTriangle, aNodesIndices);
+
+      TriangleNodeInfo aNodesInfo[3];
+      getTriangleInfo (aTriangle, aNodesIndices, aNodesInfo);
+
+      gp_Vec aNormal;
+      gp_Vec aLinkVec[3];
+      if (!computeTriangleGeometry (aNodesInfo, aLinkVec, aNormal))
+      {
+        continue;
+      }
+      theCell.IsAllDegenerated = Standard_False;
+
+      ControlCandidate aCenter;
+      aCenter.Point2d = (aNodesInfo[0].Point2d + aNodesInfo[1].Point2d + aNodesInfo[2].Point2d) / 3.;
+      aCenter.Point3d = aSurface->Value (aCenter.Point2d.X(), aCenter.Point2d.Y());
+
+      const Standard_Real aSqCenterDeviation =
+        NormalDeviation (aNodesInfo[0].Point, aNormal).SquareDeviation (aCenter.Point3d);
+      theCell.MaxSqDeflection = Max (theCell.MaxSqDeflection, aSqCenterDeviation);
+      if (aSqCenterDeviation >= aSqDeflection)
+      {
+        aCenter.IsDeflected = Standard_True;
+        theCell.Candidates.Append (aCenter);
+      }
+
+      for (Standard_Integer i = 0; i < 3; ++i)
+      {
+        if (aNodesInfo[i].isFrontierLink)
+        {
+          continue;
+        }
+
+        const Standard_Integer j = (i + 1) % 3;
+        const BRepMesh_OrientedEdge aLink (Min (aNodesIndices[i], aNodesIndices[j]),
+                                           Max (aNodesIndices[i], aNodesIndices[j]));
+        // the map of links processed on the previous iterations is not modified by the tasks
+        if (myCouplesMap->Contains (aLink) || !aCheckedLinks.Add (aLink))
+        {
+          continue;
+        }
+        theCell.CheckedLinks.Append (aLink);
+
+        ControlCandidate aMiddle;
+        aMiddle.Point2d      = (aNodesInfo[i].Point2d + aNodesInfo[j].Point2d) / 2.;
+        aMiddle.Point3d      = aSurface->Value (aMiddle.Point2d.X(), aMiddle.Point2d.Y());
+        aMiddle.Link         = aLink;
+        aMiddle.LinkNodes[0] = aNodesInfo[i];
+        aMiddle.LinkNodes[1] = aNodesInfo[j];
+        aMiddle.IsLink       = Standard_True;
+
+        const Standard_Real aSqMiddleDeviation =
+          LineDeviation (aNodesInfo[i].Point, aNodesInfo[j].Point).SquareDeviation (aMiddle.Point3d);
+        theCell.MaxSqDeflection = Max (theCell.MaxSqDeflection, aSqMiddleDeviation);
+        if (aSqMiddleDeviation >= aSqDeflection)
+        {
+          aMiddle.IsDeflected = Standard_True;
+          theCell.Candidates.Append (aMiddle);
+        }
+        else if (!rejectSplitLinksForMinSize (aNodesInfo[i], aNodesInfo[j], aMiddle.Point3d) &&
+                 !checkLinkEndsForAngularDeviation (aNodesInfo[i], aNodesInfo[j], aMiddle.Point2d))
+        {
+          aMiddle.IsAccepted = Standard_True;
+          theCell.Candidates.Append (aMiddle);
+        }
+      }
+    }
+  }
+
   //! Checks that two links produced as the result of a split of 
   //! the given link by the middle point fit MinSize requirement.
   Standard_Boolean rejectSplitLinksForMinSize (const TriangleNodeInfo& theNodeInfo1,
                                                const TriangleNodeInfo& theNodeInfo2,
                                                const gp_XY&            theMidPoint)
   {
-    const gp_Pnt aPnt = getPoint3d (theMidPoint);
-    return ((theNodeInfo1.Point - aPnt.XYZ()).SquareModulus() < mySqMinSize ||
-            (theNodeInfo2.Point - aPnt.XYZ()).SquareModulus() < mySqMinSize);
+    return rejectSplitLinksForMinSize (theNodeInfo1, theNodeInfo2, getPoint3d (theMidPoint));
+  }
+
+  //! Checks that two links produced as the result of a split of
+  //! the given link by the middle point, already evaluated on surface, fit MinSize requirement.
+  Standard_Boolean rejectSplitLinksForMinSize (const TriangleNodeInfo& theNodeInfo1,
+                                               const TriangleNodeInfo& theNodeInfo2,
+                                               const gp_Pnt&           theMidPoint3d) const
+  {
+    return ((theNodeInfo1.Point - theMidPoint3d.XYZ()).SquareModulus() < mySqMinSize ||
+            (theNodeInfo2.Point - theMidPoint3d.XYZ()).SquareModulus() < mySqMinSize);
   }
 
   //! Checks the given point (located between the given nodes)
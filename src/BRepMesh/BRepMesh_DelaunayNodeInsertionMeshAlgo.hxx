@@ -18,6 +18,8 @@
 
 #include <BRepMesh_NodeInsertionMeshAlgo.hxx>
 #include <BRepMesh_GeomTool.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 
 //! Extends base Delaunay meshing algo in order to enable possibility 
 //! of addition of free vertices and internal nodes into the mesh.
@@ -103,6 +105,14 @@ protected:
     }
   }
 
+  //! Returns True if the items of the face (nodes or triangles) of the given number
+  //! should be processed in several threads (see IMeshTools_Parameters::InParallelFace).
+  Standard_Boolean isInParallelFace (const Standard_Integer theNbItems) const
+  {
+    return this->getParameters().InParallelFace
+        && theNbItems >= THE_MIN_NB_ITEMS_IN_PARALLEL;
+  }
+
   //! Inserts nodes into mesh.
   Standard_Boolean insertNodes(
     const Handle(IMeshData::ListOfPnt2d)& theNodes,
@@ -115,18 +125,66 @@ protected:
     }
 
     IMeshData::VectorOfInteger aVertexIndexes(theNodes->Size(), this->getAllocator());
-    IMeshData::ListOfPnt2d::Iterator aNodesIt(*theNodes);
-    for (Standard_Integer aNodeIt = 1; aNodesIt.More(); aNodesIt.Next(), ++aNodeIt)
+    if (isInParallelFace (theNodes->Size()))
     {
-      const gp_Pnt2d& aPnt2d = aNodesIt.Value();
-      if (this->getClassifier()->Perform(aPnt2d) == TopAbs_IN)
+      // classify the nodes and evaluate them on surface concurrently,
+      // then register them in the data structure in the initial order
+      NCollection_Array1<NodeInfo> aNodesInfo (0, theNodes->Size() - 1);
+      IMeshData::ListOfPnt2d::Iterator aNodesIt(*theNodes);
+      for (Standard_Integer aNodeIt = 0; aNodesIt.More(); aNodesIt.Next(), ++aNodeIt)
+      {
+        aNodesInfo.ChangeValue (aNodeIt).Point2d = aNodesIt.Value();
+      }
+
+      const Standard_Integer aNbChunks = (aNodesInfo.Size() + THE_NB_NODES_IN_CHUNK - 1) / THE_NB_NODES_IN_CHUNK;
+      OSD_Parallel::For (0, aNbChunks, NodesEvaluator (*this, aNodesInfo));
+
+      for (typename NCollection_Array1<NodeInfo>::Iterator aNodeIt (aNodesInfo); aNodeIt.More(); aNodeIt.Next())
       {
-        aVertexIndexes.Append(this->registerNode(this->getRangeSplitter().Point(aPnt2d),
-                                                 aPnt2d, BRepMesh_Free, Standard_False));
+        const NodeInfo& aNode = aNodeIt.Value();
+        if (aNode.IsIn)
+        {
+          aVertexIndexes.Append(this->registerNode(aNode.Point, aNode.Point2d, BRepMesh_Free, Standard_False));
+        }
       }
     }
+    else
+    {
+      IMeshData::ListOfPnt2d::Iterator aNodesIt(*theNodes);
+      for (Standard_Integer aNodeIt = 1; aNodesIt.More(); aNodesIt.Next(), ++aNodeIt)
+      {
+        const gp_Pnt2d& aPnt2d = aNodesIt.Value();
+        if (this->getClassifier()->Perform(aPnt2d) == TopAbs_IN)
+        {
+          aVertexIndexes.Append(this->registerNode(this->getRangeSplitter().Point(aPnt2d),
+                                                   aPnt2d, BRepMesh_Free, Standard_False));
+        }
+      }
+    }
+
+    if (isInParallelFace (aVertexIndexes.Size()))
+    {
+      // insert the nodes by sub-domains of a grid on the scaled parametric range,
+      // which does not depend on the number of threads to keep the result reproducible
+      const std::pair<Standard_Real, Standard_Real>& aRangeU = this->getRangeSplitter().GetRangeU();
+      const std::pair<Standard_Real, Standard_Real>& aRangeV = this->getRangeSplitter().GetRangeV();
+      const std::pair<Standard_Real, Standard_Real>& aDelta  = this->getRangeSplitter().GetDelta();
+      const Standard_Real aSizeU = (aRangeU.second - aRangeU.first) / aDelta.first;
+      const Standard_Real aSizeV = (aRangeV.second - aRangeV.first) / aDelta.second;
 
-    theMesher.AddVertices (aVertexIndexes, theRange);
+      const Standard_Integer aNbSubDomains = Min (THE_MAX_NB_SUB_DOMAINS, aVertexIndexes.Size() / THE_MIN_NB_NODES_IN_SUB_DOMAIN);
+      Standard_Integer aNbSubDomainsU = aNbSubDomains;
+      if (aSizeU < aNbSubDomains * aSizeV)
+      {
+        aNbSubDomainsU = Max (1, static_cast<Standard_Integer> (Sqrt (aNbSubDomains * aSizeU / aSizeV) + 0.5));
+      }
+      const Standard_Integer aNbSubDomainsV = Max (1, aNbSubDomains / aNbSubDomainsU);
+      theMesher.AddVertices (aVertexIndexes, aNbSubDomainsU, aNbSubDomainsV, theRange);
+    }
+    else
+    {
+      theMesher.AddVertices (aVertexIndexes, theRange);
+    }
     if (!theRange.More())
     {
       return Standard_False;
@@ -134,6 +192,69 @@ protected:
     return !aVertexIndexes.IsEmpty();
   }
 
+private:
+
+  //! Minimal number of nodes or triangles of a face worth to be processed in several threads.
+  static const Standard_Integer THE_MIN_NB_ITEMS_IN_PARALLEL = 4096;
+
+  //! Number of nodes classified and evaluated by a single task.
+  static const Standard_Integer THE_NB_NODES_IN_CHUNK = 1024;
+
+  //! Minimal number of nodes inserted into a sub-domain of the face (see BRepMesh_Delaun::AddVertices()).
+  static const Standard_Integer THE_MIN_NB_NODES_IN_SUB_DOMAIN = 1024;
+
+  //! Maximal number of sub-domains of the face.
+  static const Standard_Integer THE_MAX_NB_SUB_DOMAINS = 64;
+
+  //! Node to be inserted into mesh.
+  struct NodeInfo
+  {
+    NodeInfo() : IsIn (Standard_False) {}
+
+    gp_Pnt2d         Point2d; //!< point in parametric space of surface
+    gp_Pnt           Point;   //!< point on surface
+    Standard_Boolean IsIn;    //!< point is inside the face
+  };
+
+  //! Functor classifying the nodes of one chunk and evaluating them on surface.
+  class NodesEvaluator
+  {
+  public:
+    NodesEvaluator (const BRepMesh_DelaunayNodeInsertionMeshAlgo& theAlgo,
+                    NCollection_Array1<NodeInfo>&                 theNodes)
+    : myAlgo  (theAlgo),
+      myNodes (theNodes)
+    {
+    }
+
+    void operator() (const Standard_Integer theChunkIndex) const
+    {
+      // the adaptor caches the evaluated span of B-spline surface, so each task uses its own copy
+      const Handle(Adaptor3d_Surface) aSurface = myAlgo.getDFace()->GetSurface()->ShallowCopy();
+      const Standard_Integer aLower = theChunkIndex * THE_NB_NODES_IN_CHUNK;
+      const Standard_Integer anUpper = Min (aLower + THE_NB_NODES_IN_CHUNK, myNodes.Size()) - 1;
+      for (Standard_Integer aNodeIt = aLower; aNodeIt <= anUpper; ++aNodeIt)
+      {
+        NodeInfo& aNode = myNodes.ChangeValue (aNodeIt);
+        aNode.IsIn = (myAlgo.getClassifier()->Perform (aNode.Point2d) == TopAbs_IN);
+        if (aNode.IsIn)
+        {
+          aNode.Point = aSurface->Value (aNode.Point2d.X(), aNode.Point2d.Y());
+        }
+      }
+    }
+
+  private:
+
+    NodesEvaluator (const NodesEvaluator& theOther);
+
+    void operator= (const NodesEvaluator& theOther);
+
+  private:
+    const BRepMesh_DelaunayNodeInsertionMeshAlgo& myAlgo;
+    NCollection_Array1<NodeInfo>&                 myNodes;
+  };
+
 private:
   
   //! Registers surface nodes in data structure.
@@ -23,6 +23,7 @@
 #include <BRepMesh_EdgeTessellationExtractor.hxx>
 #include <IMeshData_ParametersListArrayAdaptor.hxx>
 #include <BRepMesh_CurveTessellator.hxx>
+#include <BRepMesh_PolygonTessellator.hxx>
 #include <OSD_Parallel.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_EdgeDiscret, IMeshTools_ModelAlgo)
@@ -148,10 +149,14 @@ void BRepMesh_EdgeDiscret::process (const Standard_Integer theEdgeIndex) const
       }
       else
       {
-        const IMeshData::IPCurveHandle& aPCurve = aDEdge->GetPCurve(0);
-        const IMeshData::IFaceHandle    aDFace  = aPCurve->GetFace();
-        aEdgeTessellator = BRepMesh_EdgeDiscret::CreateEdgeTessellator(
-          aDEdge, aPCurve->GetOrientation(), aDFace, myParameters);
+        aEdgeTessellator = createFinerPolygonTessellator (aDEdge);
+        if (aEdgeTessellator.IsNull())
+        {
+          const IMeshData::IPCurveHandle& aPCurve = aDEdge->GetPCurve(0);
+          const IMeshData::IFaceHandle    aDFace  = aPCurve->GetFace();
+          aEdgeTessellator = BRepMesh_EdgeDiscret::CreateEdgeTessellator(
+            aDEdge, aPCurve->GetOrientation(), aDFace, myParameters);
+        }
       }
     }
     else
@@ -175,7 +180,11 @@ void BRepMesh_EdgeDiscret::process (const Standard_Integer theEdgeIndex) const
         }
       }
   
-      aEdgeTessellator = CreateEdgeTessellator(aDEdge, myParameters);
+      aEdgeTessellator = createFinerPolygonTessellator (aDEdge);
+      if (aEdgeTessellator.IsNull())
+      {
+        aEdgeTessellator = CreateEdgeTessellator(aDEdge, myParameters);
+      }
     }
   
     Tessellate3d (aDEdge, aEdgeTessellator, Standard_True);
@@ -190,6 +199,27 @@ void BRepMesh_EdgeDiscret::process (const Standard_Integer theEdgeIndex) const
   }
 }
 
+//=======================================================================
+// Function: createFinerPolygonTessellator
+// Purpose : 
+//=======================================================================
+Handle(IMeshTools_CurveTessellator) BRepMesh_EdgeDiscret::createFinerPolygonTessellator (
+  const IMeshData::IEdgeHandle& theDEdge) const
+{
+  if (myFinerPolygons.IsNull())
+  {
+    return Handle(IMeshTools_CurveTessellator)();
+  }
+
+  const Handle(Poly_Polygon3D)* aPolygon = myFinerPolygons->Seek (theDEdge->GetEdge());
+  if (aPolygon == NULL || aPolygon->IsNull())
+  {
+    return Handle(IMeshTools_CurveTessellator)();
+  }
+
+  return new BRepMesh_PolygonTessellator (theDEdge, *aPolygon, myParameters);
+}
+
 //=======================================================================
 // Function: checkExistingPolygonAndUpdateStatus
 // Purpose : 
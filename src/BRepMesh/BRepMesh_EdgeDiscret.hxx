@@ -54,6 +54,20 @@ public:
     const IMeshData::IEdgeHandle& theDEdge,
     const IMeshData::IFaceHandle& theDFace);
 
+  //! Sets polygons of edges computed before with smaller deflection (see BRepMesh_MultiLODMesh).
+  //! An edge having such a polygon is discretized by a subset of its points
+  //! (see BRepMesh_PolygonTessellator) instead of tessellation of the curve.
+  void SetFinerPolygons (const Handle(IMeshData::DMapOfShapePolygon3D)& thePolygons)
+  {
+    myFinerPolygons = thePolygons;
+  }
+
+  //! Returns polygons of edges computed before with smaller deflection.
+  const Handle(IMeshData::DMapOfShapePolygon3D)& FinerPolygons() const
+  {
+    return myFinerPolygons;
+  }
+
   //! Functor API to discretize the given edge.
   void operator() (const Standard_Integer theEdgeIndex) const {
     process (theEdgeIndex);
@@ -85,6 +99,11 @@ private:
   //! Checks existing discretization of the edge and updates data model.
   void process (const Standard_Integer theEdgeIndex) const;
 
+  //! Creates tessellator taking points of the finer polygon of the edge.
+  //! @return null handle if the edge has no finer polygon.
+  Handle(IMeshTools_CurveTessellator) createFinerPolygonTessellator (
+    const IMeshData::IEdgeHandle& theDEdge) const;
+
   //! Checks existing polygon on triangulation does it fit edge deflection or not.
   //! @return deflection of polygon or RealLast () in case if edge has no polygon 
   //! or it was dropped.
@@ -94,8 +113,9 @@ private:
 
 private:
 
-  Handle (IMeshData_Model) myModel;
-  IMeshTools_Parameters    myParameters;
+  Handle (IMeshData_Model)                 myModel;
+  IMeshTools_Parameters                    myParameters;
+  Handle(IMeshData::DMapOfShapePolygon3D)  myFinerPolygons;
 };
 
 #endif
\ No newline at end of file
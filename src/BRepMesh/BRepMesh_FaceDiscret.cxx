@@ -14,11 +14,13 @@
 // commercial license or contractual agreement.
 
 #include <BRepMesh_FaceDiscret.hxx>
+#include <BRep_Tool.hxx>
 #include <IMeshData_Model.hxx>
 #include <IMeshData_Wire.hxx>
 #include <IMeshData_Edge.hxx>
 #include <IMeshTools_MeshAlgo.hxx>
 #include <OSD_Parallel.hxx>
+#include <OSD_Timer.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_FaceDiscret, IMeshTools_ModelAlgo)
 
@@ -113,28 +115,47 @@ void BRepMesh_FaceDiscret::process(const Standard_Integer theFaceIndex,
     return;
   }
 
+  OSD_Timer aTimer;
+  if (!myStatistics.IsNull())
+  {
+    aTimer.Start();
+  }
+
+  const GeomAbs_SurfaceType aSurfType = aDFace->GetSurface()->GetType();
   try
   {
     OCC_CATCH_SIGNALS
 
     Handle(IMeshTools_MeshAlgo) aMeshingAlgo = 
-      myAlgoFactory->GetAlgo(aDFace->GetSurface()->GetType(), myParameters);
+      myAlgoFactory->GetAlgo(aSurfType, myParameters);
   
     if (aMeshingAlgo.IsNull())
     {
       aDFace->SetStatus(IMeshData_Failure);
-      return;
     }
-  
-    if (!theRange.More())
+    else if (!theRange.More())
     {
       aDFace->SetStatus (IMeshData_UserBreak);
       return;
     }
-    aMeshingAlgo->Perform(aDFace, myParameters, theRange);
+    else
+    {
+      aMeshingAlgo->Perform(aDFace, myParameters, theRange);
+    }
   }
   catch (Standard_Failure const&)
   {
     aDFace->SetStatus (IMeshData_Failure);
   }
+
+  if (!myStatistics.IsNull())
+  {
+    aTimer.Stop();
+
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation (aDFace->GetFace(), aLoc);
+    myStatistics->AddFace (aSurfType, aTimer.ElapsedTime(),
+                           !aTriangulation.IsNull() ? aTriangulation->NbTriangles() : 0,
+                           aDFace->IsSet (IMeshData_Failure));
+  }
 }
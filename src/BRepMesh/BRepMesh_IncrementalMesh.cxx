@@ -15,11 +15,23 @@
 // commercial license or contractual agreement.
 
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
 #include <BRepMesh_Context.hxx>
+#include <BRepMesh_Deflection.hxx>
+#include <BRepMesh_ModelBuilder.hxx>
 #include <BRepMesh_PluginMacro.hxx>
 #include <IMeshData_Face.hxx>
 #include <IMeshData_Wire.hxx>
 #include <IMeshTools_MeshBuilder.hxx>
+#include <Poly_TriangulationParameters.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_DataMapOfShapeShape.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_IncrementalMesh, BRepMesh_DiscretRoot)
 
@@ -28,6 +40,32 @@ namespace
   //! Default flag to control parallelization for BRepMesh_IncrementalMesh
   //! tool returned for Mesh Factory
   static Standard_Boolean IS_IN_PARALLEL = Standard_False;
+
+  //! Returns TRUE if the triangulation of the face fits the meshing parameters,
+  //! as checked by BRepMesh_ModelPreProcessor for the reused triangulations.
+  static Standard_Boolean isConsistentMesh (const TopoDS_Face&                 theFace,
+                                            const Handle(Poly_Triangulation)& theTriangulation,
+                                            const IMeshTools_Parameters&      theParameters)
+  {
+    const Handle(Poly_TriangulationParameters)& aSourceParams = theTriangulation->Parameters();
+    if (!aSourceParams.IsNull() && aSourceParams->HasDeflection())
+    {
+      // parameters of the previous meshing are comparable with the current ones as is
+      if (!BRepMesh_Deflection::IsConsistent (aSourceParams->Deflection(), theParameters.Deflection,
+                                              theParameters.AllowQualityDecrease))
+      {
+        return Standard_False;
+      }
+      return !aSourceParams->HasAngle()
+          ||  BRepMesh_Deflection::IsConsistent (aSourceParams->Angle(), theParameters.Angle,
+                                                 theParameters.AllowQualityDecrease);
+    }
+
+    const Standard_Real aDeflection = !theParameters.Relative ? theParameters.Deflection :
+      BRepMesh_Deflection::ComputeAbsoluteDeflection (theFace, theParameters.Deflection, -1.0);
+    return BRepMesh_Deflection::IsConsistent (theTriangulation->Deflection(), aDeflection,
+                                              theParameters.AllowQualityDecrease);
+  }
 }
 
 //=======================================================================
@@ -75,6 +113,26 @@ BRepMesh_IncrementalMesh::BRepMesh_IncrementalMesh(
   Perform(theRange);
 }
 
+//=======================================================================
+//function : Constructor
+//purpose  : 
+//=======================================================================
+BRepMesh_IncrementalMesh::BRepMesh_IncrementalMesh(
+  const TopoDS_Shape&              theShape,
+  const TopoDS_Shape&              theInitialShape,
+  const Handle(BRepTools_History)& theHistory,
+  const IMeshTools_Parameters&     theParameters,
+  const Message_ProgressRange&     theRange)
+: myParameters  (theParameters),
+  myModified    (Standard_False),
+  myStatus      (IMeshData_NoError),
+  myInitialShape(theInitialShape),
+  myHistory     (theHistory)
+{
+  myShape = theShape;
+  Perform(theRange);
+}
+
 //=======================================================================
 //function : Destructor
 //purpose  : 
@@ -101,13 +159,38 @@ void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theCont
 {
   initParameters();
 
-  theContext->SetShape(Shape());
+  const TopoDS_Shape aPart = incrementalPart();
+  if (!aPart.IsNull() && aPart.NbChildren() == 0)
+  {
+    // nothing is modified, the mesh of the initial shape is reused entirely
+    myStatus = IMeshData_NoError;
+    setDone();
+    return;
+  }
+
+  // the entire shape is passed to the model builder when possible
+  // to keep relative deflection the same as for the initial shape
+  const Handle(BRepMesh_ModelBuilder) aModelBuilder =
+    Handle(BRepMesh_ModelBuilder)::DownCast(theContext->GetModelBuilder());
+  if (!aModelBuilder.IsNull())
+  {
+    theContext->SetShape(Shape());
+    aModelBuilder->SetProcessedPart(aPart);
+  }
+  else
+  {
+    theContext->SetShape(aPart.IsNull() ? Shape() : aPart);
+  }
   theContext->ChangeParameters()            = myParameters;
   theContext->ChangeParameters().CleanModel = Standard_False;
 
   Message_ProgressScope aPS(theRange, "Perform incmesh", 10);
   IMeshTools_MeshBuilder aIncMesh(theContext);
   aIncMesh.Perform(aPS.Next(9));
+  if (!aModelBuilder.IsNull())
+  {
+    aModelBuilder->SetProcessedPart(TopoDS_Shape());
+  }
   if (!aPS.More())
   {
     myStatus = IMeshData_UserBreak;
@@ -133,6 +216,101 @@ void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theCont
   setDone();
 }
 
+//=======================================================================
+//function : incrementalPart
+//purpose  : 
+//=======================================================================
+TopoDS_Shape BRepMesh_IncrementalMesh::incrementalPart() const
+{
+  if (myHistory.IsNull())
+  {
+    return TopoDS_Shape();
+  }
+
+  // triangulations are stored in TShapes, so the faces and edges
+  // of the initial shape are identified regardless of their location
+  const TopLoc_Location anEmptyLoc;
+  TopTools_DataMapOfShapeShape anInitialFaces;
+  for (TopExp_Explorer aFaceIt(myInitialShape, TopAbs_FACE); aFaceIt.More(); aFaceIt.Next())
+  {
+    const TopoDS_Shape aFaceNoLoc = aFaceIt.Current().Located(anEmptyLoc);
+    if (!anInitialFaces.IsBound(aFaceNoLoc))
+    {
+      anInitialFaces.Bind(aFaceNoLoc, aFaceIt.Current());
+    }
+  }
+  TopTools_IndexedMapOfShape anInitialEdges;
+  for (TopExp_Explorer aEdgeIt(myInitialShape, TopAbs_EDGE); aEdgeIt.More(); aEdgeIt.Next())
+  {
+    anInitialEdges.Add(aEdgeIt.Current().Located(anEmptyLoc));
+  }
+
+  TopTools_IndexedDataMapOfShapeListOfShape aEdgeFaces;
+  TopExp::MapShapesAndUniqueAncestors(Shape(), TopAbs_EDGE, TopAbs_FACE, aEdgeFaces);
+
+  BRep_Builder aBuilder;
+  TopoDS_Compound aPart;
+  aBuilder.MakeCompound(aPart);
+
+  // faces modified or generated by the operation, and the kept faces without mesh
+  TopTools_IndexedMapOfShape aResultFaces;
+  TopTools_IndexedMapOfShape aModifiedFaces;
+  TopExp::MapShapes(Shape(), TopAbs_FACE, aResultFaces);
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aResultFaces.Extent(); ++aFaceIt)
+  {
+    const TopoDS_Face& aFace = TopoDS::Face(aResultFaces(aFaceIt));
+    const TopoDS_Shape* anInitialFace = anInitialFaces.Seek(aFace.Located(anEmptyLoc));
+
+    // the mesh of a kept face is reused only if it fits the current parameters
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation(aFace, aLoc);
+    const Standard_Boolean isKept = anInitialFace != NULL
+                                 && !myHistory->IsRemoved(*anInitialFace)
+                                 &&  myHistory->Modified (*anInitialFace).IsEmpty()
+                                 && !aTriangulation.IsNull()
+                                 &&  isConsistentMesh (aFace, aTriangulation, myParameters);
+    if (!isKept)
+    {
+      aModifiedFaces.Add(aFace);
+    }
+  }
+
+  // kept faces adjacent to the modified ones provide the discretization of the shared edges
+  TopTools_IndexedMapOfShape aPartFaces = aModifiedFaces;
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aModifiedFaces.Extent(); ++aFaceIt)
+  {
+    for (TopExp_Explorer aEdgeIt(aModifiedFaces(aFaceIt), TopAbs_EDGE); aEdgeIt.More(); aEdgeIt.Next())
+    {
+      const TopTools_ListOfShape* anAdjacentFaces = aEdgeFaces.Seek(aEdgeIt.Current());
+      if (anAdjacentFaces == NULL)
+      {
+        continue;
+      }
+      for (TopTools_ListOfShape::Iterator aFaceIter(*anAdjacentFaces); aFaceIter.More(); aFaceIter.Next())
+      {
+        aPartFaces.Add(aFaceIter.Value());
+      }
+    }
+  }
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aPartFaces.Extent(); ++aFaceIt)
+  {
+    aBuilder.Add(aPart, aPartFaces(aFaceIt));
+  }
+
+  // new free edges
+  for (Standard_Integer aEdgeIt = 1; aEdgeIt <= aEdgeFaces.Extent(); ++aEdgeIt)
+  {
+    const TopoDS_Shape& aEdge = aEdgeFaces.FindKey(aEdgeIt);
+    if (aEdgeFaces(aEdgeIt).IsEmpty()
+    && !anInitialEdges.Contains(aEdge.Located(anEmptyLoc)))
+    {
+      aBuilder.Add(aPart, aEdge);
+    }
+  }
+
+  return aPart;
+}
+
 //=======================================================================
 //function : Discret
 //purpose  :
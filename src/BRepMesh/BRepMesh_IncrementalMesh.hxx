@@ -15,6 +15,7 @@
 #define _BRepMesh_IncrementalMesh_HeaderFile
 
 #include <BRepMesh_DiscretRoot.hxx>
+#include <BRepTools_History.hxx>
 #include <IMeshTools_Context.hxx>
 #include <Standard_NumericError.hxx>
 
@@ -53,6 +54,20 @@ public: //! @name mesher API
                                            const IMeshTools_Parameters& theParameters,
                                            const Message_ProgressRange& theRange = Message_ProgressRange());
 
+  //! Constructor for incremental meshing of the result of a modeling operation
+  //! applied to the shape meshed before.
+  //! Automatically calls method Perform.
+  //! @param theShape result of the modeling operation to be meshed.
+  //! @param theInitialShape meshed shape, argument of the modeling operation.
+  //! @param theHistory history of the modeling operation.
+  //! @param theParameters parameters of meshing, expected to be the same as used for the initial shape.
+  //! @sa SetHistory()
+  Standard_EXPORT BRepMesh_IncrementalMesh(const TopoDS_Shape&              theShape,
+                                           const TopoDS_Shape&              theInitialShape,
+                                           const Handle(BRepTools_History)& theHistory,
+                                           const IMeshTools_Parameters&     theParameters,
+                                           const Message_ProgressRange&     theRange = Message_ProgressRange());
+
   //! Performs meshing of the shape.
   Standard_EXPORT virtual void Perform(const Message_ProgressRange& theRange = Message_ProgressRange()) Standard_OVERRIDE;
 
@@ -74,6 +89,33 @@ public: //! @name accessing to parameters.
     return myParameters;
   }
 
+  //! Returns the meshed shape modified by the operation defined by the history.
+  const TopoDS_Shape& InitialShape() const
+  {
+    return myInitialShape;
+  }
+
+  //! Returns the history of the modeling operation used for incremental meshing.
+  const Handle(BRepTools_History)& History() const
+  {
+    return myHistory;
+  }
+
+  //! Sets the history of the modeling operation, which has produced the shape to be meshed
+  //! from the initial shape meshed before, and switches on incremental meshing.
+  //! The data model is then built only for the faces of the shape modified or generated
+  //! by the operation, and for the faces kept from the initial shape adjacent to them.
+  //! Triangulations of the kept faces are reused as is, and their polygons on the shared edges
+  //! define the discretization of the boundaries of the re-meshed faces, so the mesh stays conforming.
+  //! A kept face without triangulation is meshed as a modified one.
+  //! Null history switches off incremental meshing.
+  void SetHistory(const TopoDS_Shape&              theInitialShape,
+                  const Handle(BRepTools_History)& theHistory)
+  {
+    myInitialShape = theInitialShape;
+    myHistory      = theHistory;
+  }
+
   //! Returns modified flag.
   Standard_Boolean IsModified() const
   {
@@ -118,6 +160,11 @@ private:
     }
   }
 
+  //! Returns the part of the shape to be meshed incrementally according to the history:
+  //! a compound of the modified faces, the kept faces adjacent to them and the new free edges.
+  //! Returns null shape if the history is not defined.
+  TopoDS_Shape incrementalPart() const;
+
 public: //! @name plugin API
 
   //! Plugin interface for the Mesh Factories.
@@ -143,9 +190,11 @@ public: //! @name plugin API
 
 protected:
 
-  IMeshTools_Parameters myParameters;
-  Standard_Boolean      myModified;
-  Standard_Integer      myStatus;
+  IMeshTools_Parameters     myParameters;
+  Standard_Boolean          myModified;
+  Standard_Integer          myStatus;
+  TopoDS_Shape              myInitialShape;
+  Handle(BRepTools_History) myHistory;
 };
 
 #endif
@@ -73,7 +73,7 @@ Handle (IMeshData_Model) BRepMesh_ModelBuilder::performInternal (
     Handle (IMeshTools_ShapeVisitor) aVisitor =
       new BRepMesh_ShapeVisitor (aModel);
 
-    IMeshTools_ShapeExplorer aExplorer (theShape);
+    IMeshTools_ShapeExplorer aExplorer (myProcessedPart.IsNull() ? theShape : myProcessedPart);
     aExplorer.Accept (aVisitor);
     SetStatus (Message_Done1);
   }
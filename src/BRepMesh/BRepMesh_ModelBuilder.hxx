@@ -36,6 +36,21 @@ public:
   //! Destructor.
   Standard_EXPORT virtual ~BRepMesh_ModelBuilder ();
 
+  //! Returns the part of the shape to be added to the model.
+  //! Null shape (default) means the entire shape.
+  const TopoDS_Shape& GetProcessedPart () const
+  {
+    return myProcessedPart;
+  }
+
+  //! Restricts the model to the given part of the shape (e.g. a compound of some of its faces).
+  //! The size of the entire shape is still used for computation of relative deflection,
+  //! so that the mesh of the part is consistent with the mesh of the rest of the shape.
+  void SetProcessedPart (const TopoDS_Shape& thePart)
+  {
+    myProcessedPart = thePart;
+  }
+
   DEFINE_STANDARD_RTTIEXT(BRepMesh_ModelBuilder, IMeshTools_ModelBuilder)
 
 protected:
@@ -45,6 +60,10 @@ protected:
   Standard_EXPORT virtual Handle (IMeshData_Model) performInternal (
     const TopoDS_Shape&          theShape,
     const IMeshTools_Parameters& theParameters) Standard_OVERRIDE;
+
+private:
+
+  TopoDS_Shape myProcessedPart;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,282 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_MultiLODMesh.hxx>
+
+#include <BRep_TFace.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_Context.hxx>
+#include <BRepMesh_EdgeDiscret.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepMesh_ShapeTool.hxx>
+#include <BRepTools.hxx>
+#include <IMeshData_Curve.hxx>
+#include <IMeshData_Edge.hxx>
+#include <IMeshData_Model.hxx>
+#include <IMeshData_Status.hxx>
+#include <NCollection_Array2.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_MultiLODMesh, BRepMesh_DiscretRoot)
+
+//=======================================================================
+//function : Default constructor
+//purpose  :
+//=======================================================================
+BRepMesh_MultiLODMesh::BRepMesh_MultiLODMesh()
+: myStatus(IMeshData_NoError)
+{
+}
+
+//=======================================================================
+//function : Constructor
+//purpose  :
+//=======================================================================
+BRepMesh_MultiLODMesh::BRepMesh_MultiLODMesh(
+  const TopoDS_Shape&          theShape,
+  const IMeshTools_Parameters& theParameters,
+  const TColStd_Array1OfReal&  theDeflections,
+  const Message_ProgressRange& theRange)
+: myParameters(theParameters),
+  myStatus    (IMeshData_NoError)
+{
+  for (TColStd_Array1OfReal::Iterator aDeflIt(theDeflections); aDeflIt.More(); aDeflIt.Next())
+  {
+    AddLevel(aDeflIt.Value());
+  }
+
+  myShape = theShape;
+  Perform(theRange);
+}
+
+//=======================================================================
+//function : Destructor
+//purpose  :
+//=======================================================================
+BRepMesh_MultiLODMesh::~BRepMesh_MultiLODMesh()
+{
+}
+
+//=======================================================================
+//function : AddLevel
+//purpose  :
+//=======================================================================
+void BRepMesh_MultiLODMesh::AddLevel(const Standard_Real theDeflection,
+                                     const Standard_Real theAngle)
+{
+  for (Standard_Integer aLevelIt = 1; aLevelIt <= myLevels.Size(); ++aLevelIt)
+  {
+    if (theDeflection < myLevels.Value(aLevelIt).Deflection)
+    {
+      myLevels.InsertBefore(aLevelIt, Level(theDeflection, theAngle));
+      return;
+    }
+  }
+  myLevels.Append(Level(theDeflection, theAngle));
+}
+
+//=======================================================================
+//function : LevelParameters
+//purpose  :
+//=======================================================================
+IMeshTools_Parameters BRepMesh_MultiLODMesh::LevelParameters(const Standard_Integer theLevel) const
+{
+  IMeshTools_Parameters aParameters = myParameters;
+  if (myLevels.IsEmpty())
+  {
+    return aParameters;
+  }
+
+  // interior deflections keep their ratio to the deflections of edges given by common parameters
+  const Level& aLevel = myLevels.Value(theLevel + 1);
+  aParameters.Deflection = aLevel.Deflection;
+  aParameters.DeflectionInterior = aLevel.Deflection;
+  if (myParameters.Deflection         > Precision::Confusion()
+   && myParameters.DeflectionInterior > Precision::Confusion())
+  {
+    aParameters.DeflectionInterior *= myParameters.DeflectionInterior / myParameters.Deflection;
+  }
+
+  if (aLevel.Angle > Precision::Angular())
+  {
+    aParameters.Angle = aLevel.Angle;
+    aParameters.AngleInterior = 0.0;
+    if (myParameters.Angle         > Precision::Angular()
+     && myParameters.AngleInterior > Precision::Angular())
+    {
+      aParameters.AngleInterior = aLevel.Angle * myParameters.AngleInterior / myParameters.Angle;
+    }
+  }
+  return aParameters;
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BRepMesh_MultiLODMesh::Perform(const Message_ProgressRange& theRange)
+{
+  myStatus = IMeshData_NoError;
+  const Standard_Integer aNbLevels = Max(NbLevels(), 1);
+
+  BRepTools::Clean(Shape());
+
+  // triangulations are stored in TShapes, so the faces are identified regardless of their location
+  const TopLoc_Location anEmptyLoc;
+  TopTools_IndexedMapOfShape aFaces;
+  for (TopExp_Explorer aFaceIt(Shape(), TopAbs_FACE); aFaceIt.More(); aFaceIt.Next())
+  {
+    aFaces.Add(aFaceIt.Current().Located(anEmptyLoc));
+  }
+
+  NCollection_Array2<Handle(Poly_Triangulation)> aTriangulations(1, Max(aFaces.Extent(), 1), 0, aNbLevels - 1);
+  Handle(IMeshData::DMapOfShapePolygon3D) aFinerPolygons;
+  NCollection_DataMap<TopoDS_Shape, Handle(Poly_Polygon3D), TopTools_ShapeMapHasher> aFreePolygons;
+
+  Message_ProgressScope aPS(theRange, "Perform multi-LOD meshing", aNbLevels);
+  Standard_Integer aNbDoneLevels = 0;
+  for (; aNbDoneLevels < aNbLevels; ++aNbDoneLevels)
+  {
+    // the triangulations of the finer level are detached from faces to be not reused
+    if (aNbDoneLevels > 0)
+    {
+      for (Standard_Integer aFaceIt = 1; aFaceIt <= aFaces.Extent(); ++aFaceIt)
+      {
+        BRepMesh_ShapeTool::NullifyFace(TopoDS::Face(aFaces(aFaceIt)));
+      }
+    }
+
+    BRepMesh_IncrementalMesh aMesher;
+    aMesher.SetShape(Shape());
+    aMesher.ChangeParameters() = LevelParameters(aNbDoneLevels);
+
+    Handle(IMeshTools_Context) aContext = new BRepMesh_Context(aMesher.Parameters().MeshAlgo);
+    if (!aFinerPolygons.IsNull())
+    {
+      Handle(BRepMesh_EdgeDiscret) aEdgeDiscret = new BRepMesh_EdgeDiscret();
+      aEdgeDiscret->SetFinerPolygons(aFinerPolygons);
+      aContext->SetEdgeDiscret(aEdgeDiscret);
+    }
+
+    aMesher.Perform(aContext, aPS.Next());
+    myStatus |= aMesher.GetStatusFlags();
+    if ((myStatus & IMeshData_UserBreak) != 0)
+    {
+      break;
+    }
+
+    for (Standard_Integer aFaceIt = 1; aFaceIt <= aFaces.Extent(); ++aFaceIt)
+    {
+      TopLoc_Location aLoc;
+      aTriangulations(aFaceIt, aNbDoneLevels) = BRep_Tool::Triangulation(TopoDS::Face(aFaces(aFaceIt)), aLoc);
+    }
+
+    if (aFinerPolygons.IsNull())
+    {
+      const Handle(IMeshData_Model)& aModel = aContext->GetModel();
+      aFinerPolygons = collectPolygons(aModel);
+      for (Standard_Integer aEdgeIt = 0; !aModel.IsNull() && aEdgeIt < aModel->EdgesNb(); ++aEdgeIt)
+      {
+        const IMeshData::IEdgeHandle& aDEdge = aModel->GetEdge(aEdgeIt);
+        if (aDEdge->IsFree())
+        {
+          TopLoc_Location aLoc;
+          aFreePolygons.Bind(aDEdge->GetEdge(), BRep_Tool::Polygon3D(aDEdge->GetEdge(), aLoc));
+        }
+      }
+    }
+  }
+
+  // the triangulation of the nearest level is repeated for a face which has failed
+  // to be meshed for some level, so that the index of triangulation is always the index of level
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aFaces.Extent(); ++aFaceIt)
+  {
+    Handle(Poly_Triangulation) aNearest;
+    for (Standard_Integer aLevelIt = 0; aLevelIt < aNbDoneLevels && aNearest.IsNull(); ++aLevelIt)
+    {
+      aNearest = aTriangulations(aFaceIt, aLevelIt);
+    }
+    if (aNearest.IsNull())
+    {
+      continue;
+    }
+
+    Poly_ListOfTriangulation aList;
+    for (Standard_Integer aLevelIt = 0; aLevelIt < aNbDoneLevels; ++aLevelIt)
+    {
+      if (!aTriangulations(aFaceIt, aLevelIt).IsNull())
+      {
+        aNearest = aTriangulations(aFaceIt, aLevelIt);
+      }
+      aList.Append(aNearest);
+    }
+
+    const TopoDS_Face& aFace = TopoDS::Face(aFaces(aFaceIt));
+    const Handle(BRep_TFace)& aTFace = *((Handle(BRep_TFace)*) &aFace.TShape());
+    aTFace->Triangulations(aList, aList.First());
+    aFace.TShape()->Modified(Standard_True);
+  }
+
+  for (NCollection_DataMap<TopoDS_Shape, Handle(Poly_Polygon3D), TopTools_ShapeMapHasher>::Iterator
+       aPolygonIt(aFreePolygons); aPolygonIt.More(); aPolygonIt.Next())
+  {
+    if (!aPolygonIt.Value().IsNull())
+    {
+      BRepMesh_ShapeTool::UpdateEdge(TopoDS::Edge(aPolygonIt.Key()), aPolygonIt.Value());
+    }
+  }
+
+  if (aNbDoneLevels == aNbLevels)
+  {
+    setDone();
+  }
+}
+
+//=======================================================================
+//function : collectPolygons
+//purpose  :
+//=======================================================================
+Handle(IMeshData::DMapOfShapePolygon3D) BRepMesh_MultiLODMesh::collectPolygons(
+  const Handle(IMeshData_Model)& theModel)
+{
+  Handle(IMeshData::DMapOfShapePolygon3D) aPolygons = new IMeshData::DMapOfShapePolygon3D;
+  if (theModel.IsNull())
+  {
+    return aPolygons;
+  }
+
+  for (Standard_Integer aEdgeIt = 0; aEdgeIt < theModel->EdgesNb(); ++aEdgeIt)
+  {
+    const IMeshData::IEdgeHandle&  aDEdge = theModel->GetEdge(aEdgeIt);
+    const IMeshData::ICurveHandle& aCurve = aDEdge->GetCurve();
+    if (aDEdge->IsSet(IMeshData_Failure) || aCurve->ParametersNb() < 2)
+    {
+      continue;
+    }
+
+    TColgp_Array1OfPnt   aNodes (1, aCurve->ParametersNb());
+    TColStd_Array1OfReal aParams(1, aCurve->ParametersNb());
+    for (Standard_Integer aPointIt = 1; aPointIt <= aCurve->ParametersNb(); ++aPointIt)
+    {
+      aNodes (aPointIt) = aCurve->GetPoint    (aPointIt - 1);
+      aParams(aPointIt) = aCurve->GetParameter(aPointIt - 1);
+    }
+
+    Handle(Poly_Polygon3D) aPolygon = new Poly_Polygon3D(aNodes, aParams);
+    aPolygon->Deflection(aDEdge->GetDeflection());
+    aPolygons->Bind(aDEdge->GetEdge(), aPolygon);
+  }
+  return aPolygons;
+}
@@ -0,0 +1,135 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_MultiLODMesh_HeaderFile
+#define _BRepMesh_MultiLODMesh_HeaderFile
+
+#include <BRepMesh_DiscretRoot.hxx>
+#include <IMeshData_Types.hxx>
+#include <IMeshTools_Parameters.hxx>
+#include <NCollection_Sequence.hxx>
+#include <TColStd_Array1OfReal.hxx>
+
+class IMeshData_Model;
+
+//! Builds several levels of detail of the mesh of a shape in one pass.
+//! The triangulations of each face are stored in the list of triangulations
+//! of the face (see BRep_Tool::Triangulations()) ordered from the finest level
+//! to the coarsest one, so that the index of triangulation in the list is the
+//! index of level starting from 0 (see BRepTools::ActivateTriangulation()).
+//! The finest triangulation is made active.
+//!
+//! The shape is meshed by BRepMesh_IncrementalMesh for the finest level first.
+//! The polygons of edges computed for this level are then used to discretize
+//! the edges for the coarser levels: the points of the coarser polygon are chosen
+//! among the points of the finer one (see BRepMesh_PolygonTessellator), so the curves
+//! are not tessellated again and the boundary nodes of the levels are nested.
+//! The interior of faces is meshed for each level with its own deflection.
+//!
+//! Existing triangulations of the faces are removed before meshing.
+//! Free edges keep the 3D polygon of the finest level.
+class BRepMesh_MultiLODMesh : public BRepMesh_DiscretRoot
+{
+public: //! @name mesher API
+
+  //! Default constructor
+  Standard_EXPORT BRepMesh_MultiLODMesh();
+
+  //! Destructor
+  Standard_EXPORT virtual ~BRepMesh_MultiLODMesh();
+
+  //! Constructor.
+  //! Automatically calls method Perform.
+  //! @param theShape shape to be meshed.
+  //! @param theParameters parameters of meshing common for all levels.
+  //! @param theDeflections linear deflections of levels.
+  Standard_EXPORT BRepMesh_MultiLODMesh(const TopoDS_Shape&          theShape,
+                                        const IMeshTools_Parameters& theParameters,
+                                        const TColStd_Array1OfReal&  theDeflections,
+                                        const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Performs meshing of the shape for all levels.
+  Standard_EXPORT virtual void Perform(const Message_ProgressRange& theRange = Message_ProgressRange()) Standard_OVERRIDE;
+
+public: //! @name accessing to parameters.
+
+  //! Returns meshing parameters common for all levels.
+  const IMeshTools_Parameters& Parameters() const
+  {
+    return myParameters;
+  }
+
+  //! Returns modifiable meshing parameters common for all levels.
+  //! Linear deflection of the parameters is used as the single level if no levels are added.
+  IMeshTools_Parameters& ChangeParameters()
+  {
+    return myParameters;
+  }
+
+  //! Adds level of detail.
+  //! Levels are kept ordered by increasing linear deflection.
+  //! @param theDeflection linear deflection of the level.
+  //! @param theAngle angular deflection of the level;
+  //!        angular deflection of parameters is used if it is not positive.
+  Standard_EXPORT void AddLevel(const Standard_Real theDeflection,
+                                const Standard_Real theAngle = 0.0);
+
+  //! Removes all levels.
+  void ClearLevels()
+  {
+    myLevels.Clear();
+  }
+
+  //! Returns number of levels.
+  Standard_Integer NbLevels() const
+  {
+    return myLevels.Size();
+  }
+
+  //! Returns parameters of meshing of the level with the given index, starting from 0.
+  Standard_EXPORT IMeshTools_Parameters LevelParameters(const Standard_Integer theLevel) const;
+
+  //! Returns accumulated status flags faced during meshing of all levels.
+  Standard_Integer GetStatusFlags() const
+  {
+    return myStatus;
+  }
+
+  DEFINE_STANDARD_RTTIEXT(BRepMesh_MultiLODMesh, BRepMesh_DiscretRoot)
+
+private:
+
+  //! Deflections of level of detail.
+  struct Level
+  {
+    Standard_Real Deflection;
+    Standard_Real Angle;
+
+    Level() : Deflection (0.0), Angle (0.0) {}
+
+    Level(const Standard_Real theDeflection, const Standard_Real theAngle)
+    : Deflection (theDeflection), Angle (theAngle) {}
+  };
+
+  //! Collects the polygons of edges discretized in the model
+  //! to be used for discretization of the edges for coarser levels.
+  static Handle(IMeshData::DMapOfShapePolygon3D) collectPolygons(const Handle(IMeshData_Model)& theModel);
+
+private:
+
+  IMeshTools_Parameters       myParameters;
+  NCollection_Sequence<Level> myLevels;
+  Standard_Integer            myStatus;
+};
+
+#endif
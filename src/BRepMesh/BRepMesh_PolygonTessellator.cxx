@@ -0,0 +1,180 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_PolygonTessellator.hxx>
+
+#include <BRep_Tool.hxx>
+#include <gp_Pnt.hxx>
+#include <IMeshData_Edge.hxx>
+#include <IMeshTools_Parameters.hxx>
+#include <NCollection_Array1.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Iterator.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_PolygonTessellator, IMeshTools_CurveTessellator)
+
+//=======================================================================
+//function : Constructor
+//purpose  :
+//=======================================================================
+BRepMesh_PolygonTessellator::BRepMesh_PolygonTessellator(
+  const IMeshData::IEdgeHandle& theEdge,
+  const Handle(Poly_Polygon3D)& thePolygon,
+  const IMeshTools_Parameters&  theParameters)
+: myPolygon          (thePolygon),
+  mySquareDeflection (0.0),
+  myCosAngle         (Cos (0.5 * theEdge->GetAngularDeflection()))
+{
+  // the same precise deflection as in BRepMesh_CurveTessellator is used,
+  // reduced by the one of the finer polygon which approximates the curve
+  const Standard_Integer aNbNodes = myPolygon->NbNodes();
+  const Standard_Real aDeflection = 0.5 * (theEdge->GetDeflection() - myPolygon->Deflection());
+  if (aNbNodes <= 2 || aDeflection <= Precision::Confusion() || theEdge->GetDegenerated()
+  || !myPolygon->HasParameters())
+  {
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+    {
+      myIndices.Append (aNodeIt);
+    }
+    return;
+  }
+  mySquareDeflection = aDeflection * aDeflection;
+
+  // points at internal vertices of the edge are kept
+  const TColStd_Array1OfReal& aParams = myPolygon->Parameters();
+  NCollection_Array1<Standard_Boolean> isRequired (1, aNbNodes);
+  isRequired.Init (Standard_False);
+  if (theParameters.InternalVerticesMode)
+  {
+    const TopoDS_Edge& aEdge = theEdge->GetEdge();
+    for (TopoDS_Iterator aVertexIt (aEdge); aVertexIt.More(); aVertexIt.Next())
+    {
+      const TopoDS_Shape& aVertex = aVertexIt.Value();
+      if (aVertex.Orientation() != TopAbs_INTERNAL)
+      {
+        continue;
+      }
+
+      const Standard_Real aParam = BRep_Tool::Parameter (TopoDS::Vertex (aVertex), aEdge);
+      for (Standard_Integer aNodeIt = 2; aNodeIt < aNbNodes; ++aNodeIt)
+      {
+        if (Abs (aParams (aNodeIt) - aParam) < Precision::PConfusion())
+        {
+          isRequired (aNodeIt) = Standard_True;
+        }
+      }
+    }
+  }
+
+  // extend each chord while the points of the polygon it passes by can be skipped
+  // or while it is shorter than the minimal size
+  const TColgp_Array1OfPnt& aNodes = myPolygon->Nodes();
+  const Standard_Real aSqMinSize = theParameters.MinSize * theParameters.MinSize;
+  myIndices.Append (1);
+  Standard_Integer aFirst = 1;
+  while (aFirst < aNbNodes)
+  {
+    Standard_Integer aLast = aFirst + 1;
+    while (aLast < aNbNodes && !isRequired (aLast)
+        && (aNodes (aFirst).SquareDistance (aNodes (aLast)) < aSqMinSize || isSkippable (aFirst, aLast + 1)))
+    {
+      ++aLast;
+    }
+    myIndices.Append (aLast);
+    aFirst = aLast;
+  }
+}
+
+//=======================================================================
+//function : Destructor
+//purpose  :
+//=======================================================================
+BRepMesh_PolygonTessellator::~BRepMesh_PolygonTessellator ()
+{
+}
+
+//=======================================================================
+//function : isSkippable
+//purpose  :
+//=======================================================================
+Standard_Boolean BRepMesh_PolygonTessellator::isSkippable (
+  const Standard_Integer theFirst,
+  const Standard_Integer theLast) const
+{
+  const TColgp_Array1OfPnt& aNodes = myPolygon->Nodes();
+  const gp_XYZ& aP1 = aNodes (theFirst).XYZ();
+  const gp_XYZ& aP2 = aNodes (theLast) .XYZ();
+  const gp_XYZ aChord = aP2 - aP1;
+  const Standard_Real aSqLength = aChord.SquareModulus();
+  if (aSqLength < gp::Resolution())
+  {
+    return Standard_False;
+  }
+
+  // segments of the polygon approximate tangents of the curve, which should
+  // deviate from the chord by less than the angular deflection
+  for (Standard_Integer aNodeIt = theFirst; aNodeIt < theLast; ++aNodeIt)
+  {
+    const gp_XYZ aSegment = aNodes (aNodeIt + 1).XYZ() - aNodes (aNodeIt).XYZ();
+    const Standard_Real aSqMod = aSegment.SquareModulus() * aSqLength;
+    if (aSqMod > gp::Resolution() && aSegment.Dot (aChord) < myCosAngle * Sqrt (aSqMod))
+    {
+      return Standard_False;
+    }
+  }
+
+  for (Standard_Integer aNodeIt = theFirst + 1; aNodeIt < theLast; ++aNodeIt)
+  {
+    const gp_XYZ aVec = aNodes (aNodeIt).XYZ() - aP1;
+    const Standard_Real aT = aVec.Dot (aChord) / aSqLength;
+    Standard_Real aSqDist = aVec.SquareModulus();
+    if (aT >= 1.0)
+    {
+      aSqDist = (aNodes (aNodeIt).XYZ() - aP2).SquareModulus();
+    }
+    else if (aT > 0.0)
+    {
+      aSqDist = (aVec - aChord * aT).SquareModulus();
+    }
+
+    if (aSqDist > mySquareDeflection)
+    {
+      return Standard_False;
+    }
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : PointsNb
+//purpose  :
+//=======================================================================
+Standard_Integer BRepMesh_PolygonTessellator::PointsNb () const
+{
+  return myIndices.Length();
+}
+
+//=======================================================================
+//function : Value
+//purpose  :
+//=======================================================================
+Standard_Boolean BRepMesh_PolygonTessellator::Value (
+  const Standard_Integer theIndex,
+  gp_Pnt&                thePoint,
+  Standard_Real&         theParameter) const
+{
+  const Standard_Integer aNodeIndex = myIndices (theIndex - 1);
+  thePoint     = myPolygon->Nodes().Value (aNodeIndex);
+  theParameter = myPolygon->Parameters().Value (aNodeIndex);
+  return Standard_True;
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_PolygonTessellator_HeaderFile
+#define _BRepMesh_PolygonTessellator_HeaderFile
+
+#include <IMeshTools_CurveTessellator.hxx>
+#include <IMeshData_Types.hxx>
+#include <NCollection_Vector.hxx>
+
+struct IMeshTools_Parameters;
+
+//! Auxiliary class performing tessellation of the edge by a subset of points
+//! of its polygon computed before with smaller deflection (see BRepMesh_MultiLODMesh).
+//! Points of the finer polygon are skipped while the chord joining the kept ones
+//! deviates from the skipped points by less than the difference of deflections
+//! of the edge and of the polygon, and turns by less than the angular deflection,
+//! or while the chord is shorter than the minimal size.
+//! Thus the curve is not evaluated at all, and the discretizations of the edge
+//! for different deflections are nested.
+class BRepMesh_PolygonTessellator : public IMeshTools_CurveTessellator
+{
+public:
+
+  //! Constructor.
+  //! @param theEdge discrete edge with computed deflection.
+  //! @param thePolygon polygon of the edge computed with smaller deflection.
+  //! @param theParameters parameters of meshing.
+  Standard_EXPORT BRepMesh_PolygonTessellator(
+    const IMeshData::IEdgeHandle&  theEdge,
+    const Handle(Poly_Polygon3D)&  thePolygon,
+    const IMeshTools_Parameters&   theParameters);
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BRepMesh_PolygonTessellator ();
+
+  //! Returns number of tessellation points.
+  Standard_EXPORT virtual Standard_Integer PointsNb () const Standard_OVERRIDE;
+
+  //! Returns parameters of solution with the given index.
+  //! @param theIndex index of tessellation point.
+  //! @param thePoint tessellation point.
+  //! @param theParameter parameter on curve corresponded to the solution.
+  //! @return True in case of valid result, false elewhere.
+  Standard_EXPORT virtual Standard_Boolean Value (
+    const Standard_Integer theIndex,
+    gp_Pnt&                thePoint,
+    Standard_Real&         theParameter) const Standard_OVERRIDE;
+
+  DEFINE_STANDARD_RTTIEXT(BRepMesh_PolygonTessellator, IMeshTools_CurveTessellator)
+
+private:
+
+  //! Checks whether the points of the polygon between the given ones can be skipped.
+  Standard_Boolean isSkippable (const Standard_Integer theFirst,
+                                const Standard_Integer theLast) const;
+
+private:
+
+  BRepMesh_PolygonTessellator (const BRepMesh_PolygonTessellator& theOther);
+
+  void operator=(const BRepMesh_PolygonTessellator& theOther);
+
+private:
+
+  Handle(Poly_Polygon3D)               myPolygon;
+  NCollection_Vector<Standard_Integer> myIndices;
+  Standard_Real                        mySquareDeflection;
+  Standard_Real                        myCosAngle;
+};
+
+#endif
@@ -0,0 +1,224 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_ShapeDecimator.hxx>
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_ShapeTool.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Map.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <Poly_MeshDecimator.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+namespace
+{
+  //! Face to be decimated.
+  struct FaceDecimation
+  {
+    TopoDS_Face                Face;
+    TopLoc_Location            Location;
+    Handle(Poly_Triangulation) Triangulation;
+    Handle(Poly_MeshDecimator) Decimator;
+  };
+
+  //! Return polygons on triangulation of the edge; the second one is defined for the closed edge.
+  static void edgePolygons (const TopoDS_Edge& theEdge,
+                            const FaceDecimation& theFace,
+                            Handle(Poly_PolygonOnTriangulation)& thePolygon1,
+                            Handle(Poly_PolygonOnTriangulation)& thePolygon2)
+  {
+    const TopoDS_Edge anEdge = TopoDS::Edge (theEdge.Oriented (TopAbs_FORWARD));
+    thePolygon1 = BRep_Tool::PolygonOnTriangulation (anEdge, theFace.Triangulation, theFace.Location);
+    thePolygon2.Nullify();
+    if (!thePolygon1.IsNull()
+      && BRep_Tool::IsClosed (anEdge, theFace.Triangulation, theFace.Location))
+    {
+      thePolygon2 = BRep_Tool::PolygonOnTriangulation (TopoDS::Edge (anEdge.Reversed()), theFace.Triangulation, theFace.Location);
+    }
+  }
+
+  //! Return copy of polygon referring to the nodes of decimated triangulation.
+  static Handle(Poly_PolygonOnTriangulation) remapPolygon (const Handle(Poly_PolygonOnTriangulation)& thePolygon,
+                                                          const Poly_MeshDecimator& theDecimator)
+  {
+    if (thePolygon.IsNull())
+    {
+      return Handle(Poly_PolygonOnTriangulation)();
+    }
+
+    Handle(Poly_PolygonOnTriangulation) aPolygon = thePolygon->Copy();
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aPolygon->NbNodes(); ++aNodeIter)
+    {
+      aPolygon->SetNode (aNodeIter, theDecimator.ResultNode (aPolygon->Node (aNodeIter)));
+    }
+    return aPolygon;
+  }
+}
+
+//=======================================================================
+//function : BRepMesh_ShapeDecimator
+//purpose  :
+//=======================================================================
+BRepMesh_ShapeDecimator::BRepMesh_ShapeDecimator()
+: myTargetRatio (1.0),
+  myMaxError (Precision::Infinite()),
+  myToRunParallel (false),
+  myNbSrcTris (0),
+  myNbResTris (0),
+  myError (0.0)
+{
+  //
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BRepMesh_ShapeDecimator::Perform (const TopoDS_Shape& theShape,
+                                       const Message_ProgressRange& theRange)
+{
+  myNbSrcTris = 0;
+  myNbResTris = 0;
+  myError = 0.0;
+
+  // faces sharing triangulation (with the same TShape) are decimated once
+  NCollection_Vector<FaceDecimation> aFaces;
+  NCollection_Map<Handle(Poly_Triangulation)> aTriangulations;
+  for (TopExp_Explorer aFaceIter (theShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    FaceDecimation aFace;
+    aFace.Face = TopoDS::Face (aFaceIter.Current());
+    aFace.Triangulation = BRep_Tool::Triangulation (aFace.Face, aFace.Location);
+    if (!aFace.Triangulation.IsNull()
+      && aFace.Triangulation->NbTriangles() > 0
+      && aTriangulations.Add (aFace.Triangulation))
+    {
+      aFaces.Append (aFace);
+    }
+  }
+  if (aFaces.IsEmpty())
+  {
+    return;
+  }
+
+  Message_ProgressScope aPS (theRange, "Decimating faces", aFaces.Size());
+  NCollection_Array1<Message_ProgressRange> aRanges (0, aFaces.Size() - 1);
+  for (Standard_Integer aFaceIter = 0; aFaceIter < aFaces.Size(); ++aFaceIter)
+  {
+    aRanges.SetValue (aFaceIter, aPS.Next());
+  }
+
+  OSD_Parallel::For (0, aFaces.Size(), [&](int theFaceIndex)
+  {
+    Message_ProgressScope aFacePS (aRanges (theFaceIndex), NULL, 1);
+    if (!aFacePS.More())
+    {
+      return;
+    }
+
+    // nodes of the boundaries of face are kept
+    FaceDecimation& aFace = aFaces.ChangeValue (theFaceIndex);
+    TColStd_PackedMapOfInteger aFixedNodes;
+    TopTools_IndexedMapOfShape anEdges;
+    TopExp::MapShapes (aFace.Face, TopAbs_EDGE, anEdges);
+    for (TopTools_IndexedMapOfShape::Iterator anEdgeIter (anEdges); anEdgeIter.More(); anEdgeIter.Next())
+    {
+      Handle(Poly_PolygonOnTriangulation) aPolygons[2];
+      edgePolygons (TopoDS::Edge (anEdgeIter.Value()), aFace, aPolygons[0], aPolygons[1]);
+      for (int aPolyIter = 0; aPolyIter < 2; ++aPolyIter)
+      {
+        if (aPolygons[aPolyIter].IsNull())
+        {
+          continue;
+        }
+        for (Standard_Integer aNodeIter = 1; aNodeIter <= aPolygons[aPolyIter]->NbNodes(); ++aNodeIter)
+        {
+          aFixedNodes.Add (aPolygons[aPolyIter]->Node (aNodeIter));
+        }
+      }
+    }
+
+    const int aNbTris = aFace.Triangulation->NbTriangles();
+    aFace.Decimator = new Poly_MeshDecimator();
+    aFace.Decimator->SetTargetNbTriangles (myTargetRatio < 1.0 ? int(myTargetRatio * aNbTris) : 0);
+    aFace.Decimator->SetMaxError (myMaxError);
+    if (!aFace.Decimator->Perform (aFace.Triangulation, aFixedNodes)
+      || aFace.Decimator->Result()->NbTriangles() == aNbTris)
+    {
+      aFace.Decimator.Nullify();
+    }
+    aFacePS.Next();
+  }, !myToRunParallel);
+
+  if (!aPS.More())
+  {
+    return;
+  }
+
+  // shapes are modified sequentially, as edges are shared by faces
+  BRep_Builder aBuilder;
+  for (NCollection_Vector<FaceDecimation>::Iterator aFaceIter (aFaces); aFaceIter.More(); aFaceIter.Next())
+  {
+    const FaceDecimation& aFace = aFaceIter.Value();
+    if (aFace.Decimator.IsNull())
+    {
+      continue;
+    }
+
+    const Handle(Poly_Triangulation)& aResult = aFace.Decimator->Result();
+    if (aFace.Triangulation->IsCompact())
+    {
+      aResult->SetCompact (true);
+    }
+
+    TopTools_IndexedMapOfShape anEdges;
+    TopExp::MapShapes (aFace.Face, TopAbs_EDGE, anEdges);
+    for (TopTools_IndexedMapOfShape::Iterator anEdgeIter (anEdges); anEdgeIter.More(); anEdgeIter.Next())
+    {
+      const TopoDS_Edge& anEdge = TopoDS::Edge (anEdgeIter.Value());
+      Handle(Poly_PolygonOnTriangulation) aPolygon1, aPolygon2;
+      edgePolygons (anEdge, aFace, aPolygon1, aPolygon2);
+      if (aPolygon1.IsNull())
+      {
+        continue;
+      }
+
+      BRepMesh_ShapeTool::NullifyEdge (anEdge, aFace.Triangulation, aFace.Location);
+      if (aPolygon2.IsNull())
+      {
+        BRepMesh_ShapeTool::UpdateEdge (anEdge, remapPolygon (aPolygon1, *aFace.Decimator),
+                                        aResult, aFace.Location);
+      }
+      else
+      {
+        BRepMesh_ShapeTool::UpdateEdge (anEdge, remapPolygon (aPolygon1, *aFace.Decimator),
+                                        remapPolygon (aPolygon2, *aFace.Decimator),
+                                        aResult, aFace.Location);
+      }
+    }
+    aBuilder.UpdateFace (aFace.Face, aResult, Standard_False);
+
+    myNbSrcTris += aFace.Triangulation->NbTriangles();
+    myNbResTris += aResult->NbTriangles();
+    myError = Max (myError, aFace.Decimator->Error());
+  }
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_ShapeDecimator_HeaderFile
+#define _BRepMesh_ShapeDecimator_HeaderFile
+
+#include <Message_ProgressRange.hxx>
+#include <Precision.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! Decimates the active triangulations of faces of a meshed shape (see Poly_MeshDecimator).
+//!
+//! Nodes of polygons on triangulation of edges of the face are kept,
+//! so that the boundaries of adjacent faces remain matching and the mesh of the shape watertight;
+//! the polygons are rebuilt for the new triangulation with the same nodes and parameters.
+//! The decimated triangulation replaces the active one of the face keeping other triangulations
+//! of the face; its deflection is increased by the error of decimation.
+//! Faces are processed in parallel, if requested.
+class BRepMesh_ShapeDecimator
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Empty constructor.
+  Standard_EXPORT BRepMesh_ShapeDecimator();
+
+  //! Return ratio of the target number of triangles of each face to the current one; 1 by default,
+  //! meaning that decimation is limited only by error.
+  double TargetRatio() const { return myTargetRatio; }
+
+  //! Set ratio of the target number of triangles of each face to the current one.
+  void SetTargetRatio (double theRatio) { myTargetRatio = theRatio; }
+
+  //! Return maximum error of decimation; infinite by default.
+  double MaxError() const { return myMaxError; }
+
+  //! Set maximum error of decimation.
+  void SetMaxError (double theError) { myMaxError = theError; }
+
+  //! Return TRUE if faces should be processed in parallel; FALSE by default.
+  bool ToRunParallel() const { return myToRunParallel; }
+
+  //! Set if faces should be processed in parallel.
+  void SetRunParallel (bool theToRunParallel) { myToRunParallel = theToRunParallel; }
+
+  //! Decimate triangulations of the faces of shape.
+  Standard_EXPORT void Perform (const TopoDS_Shape& theShape,
+                                const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Return number of triangles of decimated faces before decimation.
+  int NbSourceTriangles() const { return myNbSrcTris; }
+
+  //! Return number of triangles of decimated faces after decimation.
+  int NbResultTriangles() const { return myNbResTris; }
+
+  //! Return maximum error of decimation of faces.
+  double Error() const { return myError; }
+
+private:
+
+  double myTargetRatio;
+  double myMaxError;
+  bool   myToRunParallel;
+  int    myNbSrcTris;
+  int    myNbResTris;
+  double myError;
+
+};
+
+#endif // _BRepMesh_ShapeDecimator_HeaderFile
@@ -735,14 +735,35 @@ Standard_Boolean BRepTools::Read(TopoDS_Shape& Sh,
                                  const Standard_CString File,
                                  const BRep_Builder& B,
                                  const Message_ProgressRange& theProgress)
+{
+  return Read (Sh, File, B, Standard_False, Standard_True, theProgress);
+}
+
+//=======================================================================
+//function : Read
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepTools::Read(TopoDS_Shape& Sh, 
+                                 const Standard_CString File,
+                                 const BRep_Builder& B,
+                                 const Standard_Boolean theToDeferTriangulations,
+                                 const Standard_Boolean theToLoadOnAccess,
+                                 const Message_ProgressRange& theProgress)
 {
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
-  std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (File, std::ios::in);
+  // positions of deferred data are kept in binary mode to not depend on line endings
+  std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (File, theToDeferTriangulations
+                                                                        ? std::ios::in | std::ios::binary
+                                                                        : std::ios::in);
   if (aStream.get() == NULL)
   {
     return Standard_False;
   }
   BRepTools_ShapeSet SS(B);
+  if (theToDeferTriangulations)
+  {
+    SS.SetDeferredTriangulations (File, theToLoadOnAccess);
+  }
   SS.Read (*aStream, theProgress);
   if(!SS.NbShapes()) return Standard_False;
   SS.Read (Sh,*aStream);
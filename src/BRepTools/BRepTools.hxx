@@ -322,6 +322,19 @@ public:
                                                 const BRep_Builder& B,
                                                 const Message_ProgressRange& theProgress = Message_ProgressRange());
 
+  //! Reads a Shape from <File>, returns it in <Sh>.
+  //! <B> is used to build the shape.
+  //! @param theToDeferTriangulations [in] flag to leave data of triangulations in the file to be loaded later
+  //!                                      (see BRepTools_ShapeSet::SetDeferredTriangulations())
+  //! @param theToLoadOnAccess        [in] flag to load deferred triangulations on access to them;
+  //!                                      if FALSE, they stay unloaded until explicit loading (see LoadTriangulation())
+  //! @param theProgress the range of progress indicator to fill in
+  Standard_EXPORT static Standard_Boolean Read (TopoDS_Shape& Sh, const Standard_CString File,
+                                                const BRep_Builder& B,
+                                                const Standard_Boolean theToDeferTriangulations,
+                                                const Standard_Boolean theToLoadOnAccess = Standard_True,
+                                                const Message_ProgressRange& theProgress = Message_ProgressRange());
+
   //! Evals real tolerance of edge  <theE>.
   //! <theC3d>, <theC2d>, <theS>, <theF>, <theL> are
   //! correspondently 3d curve of edge, 2d curve on surface <theS> and
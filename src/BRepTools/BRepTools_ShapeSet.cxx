@@ -31,6 +31,7 @@
 #include <BRep_TVertex.hxx>
 #include <BRepTools.hxx>
 #include <BRepTools_ShapeSet.hxx>
+#include <BRepTools_TriangulationSource.hxx>
 #include <GeomTools.hxx>
 #include <Message_ProgressScope.hxx>
 #include <Poly_Polygon3D.hxx>
@@ -43,6 +44,8 @@
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 
+#include <cctype>
+
 // Modified:    02 Nov 2000: BUC60769. JMB, PTV.  In order to be able to read BRep 
 //              files that came from a platform different from where CasCade 
 //              is run, we need the following modifications.
@@ -59,6 +62,33 @@
 //                We simple check the next string if there are value that equal 2 
 //               (It means a parameter for triangulation).
 
+namespace
+{
+  //! Skips the given number of tokens separated by spaces.
+  static void skipTokens (Standard_IStream& theStream, Standard_Size theNbTokens)
+  {
+    typedef std::char_traits<char> Traits;
+    std::streambuf* aBuffer = theStream.rdbuf();
+    Traits::int_type aChar = aBuffer->sgetc();
+    for (; theNbTokens > 0; --theNbTokens)
+    {
+      while (!Traits::eq_int_type (aChar, Traits::eof()) && std::isspace (aChar))
+      {
+        aChar = aBuffer->snextc();
+      }
+      if (Traits::eq_int_type (aChar, Traits::eof()))
+      {
+        theStream.setstate (std::ios::eofbit | std::ios::failbit);
+        return;
+      }
+      while (!Traits::eq_int_type (aChar, Traits::eof()) && !std::isspace (aChar))
+      {
+        aChar = aBuffer->snextc();
+      }
+    }
+  }
+}
+
 
 //=======================================================================
 //function : BRepTools_ShapeSet
@@ -80,7 +110,8 @@ BRepTools_ShapeSet::BRepTools_ShapeSet (const BRep_Builder& theBuilder,
                                         const Standard_Boolean theWithNormals)
 : myBuilder (theBuilder),
   myWithTriangles (theWithTriangles),
-  myWithNormals(theWithNormals)
+  myWithNormals(theWithNormals),
+  myToLoadOnAccess (Standard_True)
 {
 }
 
@@ -1418,6 +1449,16 @@ void BRepTools_ShapeSet::WriteTriangulation(Standard_OStream&      OS,
   for (i = 1; i <= nbtri && aPS.More(); i++, aPS.Next()) {
 
     T = myTriangulations.FindKey(i);
+    if (T->HasDeferredData() && !T->HasGeometry())
+    {
+      // the unloaded data is read from deferred storage without loading it into the shape
+      Handle(Poly_Triangulation) aLoaded = T->DetachedLoadDeferredData();
+      if (!aLoaded.IsNull())
+      {
+        aLoaded->Deflection (T->Deflection());
+        T = aLoaded;
+      }
+    }
     const Standard_Boolean toWriteNormals = myTriangulations(i);
     if (Compact) {
       OS << T->NbNodes() << " " << T->NbTriangles() << " ";
@@ -1537,8 +1578,8 @@ void BRepTools_ShapeSet::DumpTriangulation(Standard_OStream& OS)const
 void BRepTools_ShapeSet::ReadTriangulation(Standard_IStream& IS, const Message_ProgressRange& theProgress)
 {
   char buffer[255];
-  Standard_Integer i, j, nbtri =0;
-  Standard_Real d, x, y, z;
+  Standard_Integer i, nbtri =0;
+  Standard_Real d;
   Standard_Integer nbNodes =0, nbTriangles=0;
   Standard_Boolean hasUV= Standard_False;
   Standard_Boolean hasNormals= Standard_False;
@@ -1560,40 +1601,19 @@ void BRepTools_ShapeSet::ReadTriangulation(Standard_IStream& IS, const Message_P
     }
     GeomTools::GetReal(IS, d);
 
-    T = new Poly_Triangulation (nbNodes, nbTriangles, hasUV, hasNormals);
-
-    for (j = 1; j <= nbNodes; j++) {
-      GeomTools::GetReal(IS, x);
-      GeomTools::GetReal(IS, y);
-      GeomTools::GetReal(IS, z);
-      T->SetNode (j, gp_Pnt (x, y, z));
-    }
-
-    if (hasUV) {
-      for (j = 1; j <= nbNodes; j++) {
-        GeomTools::GetReal(IS, x);
-        GeomTools::GetReal(IS, y);
-        T->SetUVNode (j, gp_Pnt2d (x,y));
-      }
-    }
-      
-    // read the triangles
-    Standard_Integer n1,n2,n3;
-    for (j = 1; j <= nbTriangles; j++) {
-      IS >> n1 >> n2 >> n3;
-      T->SetTriangle (j, Poly_Triangle (n1, n2, n3));
+    // the data of deferred triangulation is skipped to be read later from the same position
+    const std::streamoff aPos = !myDeferredFile.IsEmpty() && nbTriangles > 0 ? std::streamoff (IS.tellg()) : -1;
+    if (aPos >= 0)
+    {
+      T = new BRepTools_TriangulationSource (myDeferredFile, aPos, nbNodes, nbTriangles,
+                                             hasUV, hasNormals, myToLoadOnAccess);
+      skipTokens (IS, Standard_Size(nbNodes) * (3 + (hasUV ? 2 : 0) + (hasNormals ? 3 : 0))
+                    + Standard_Size(nbTriangles) * 3);
     }
-
-    if (hasNormals)
+    else
     {
-      NCollection_Vec3<Standard_Real> aNorm;
-      for (j = 1; j <= nbNodes; j++)
-      {
-        GeomTools::GetReal (IS, aNorm.x());
-        GeomTools::GetReal (IS, aNorm.y());
-        GeomTools::GetReal (IS, aNorm.z());
-        T->SetNormal (j, gp_Vec3f (aNorm));
-      }
+      T = new Poly_Triangulation (nbNodes, nbTriangles, hasUV, hasNormals);
+      BRepTools_TriangulationSource::ReadData (IS, T);
     }
 
     T->Deflection(d);
@@ -26,6 +26,7 @@
 #include <GeomTools_CurveSet.hxx>
 #include <GeomTools_Curve2dSet.hxx>
 #include <TColStd_IndexedMapOfTransient.hxx>
+#include <TCollection_AsciiString.hxx>
 #include <TopTools_ShapeSet.hxx>
 #include <Standard_OStream.hxx>
 #include <Standard_IStream.hxx>
@@ -69,6 +70,21 @@ public:
   //! Ignored (always written) if face defines only triangulation (no surface).
   void SetWithNormals (const Standard_Boolean theWithNormals) { myWithNormals = theWithNormals; }
 
+  //! Defines the file read by this set to defer loading of triangulations.
+  //! Triangulations are read as BRepTools_TriangulationSource objects keeping the position of their data
+  //! in the file, so that the data is skipped while reading and loaded later on the first access
+  //! to the triangulation (see BRep_Tool::Triangulation()) or explicitly (see BRepTools::LoadTriangulation()).
+  //! The stream passed to Read() should be opened from this file in binary mode.
+  //! @param theFile [in] path to the file; empty path disables deferred loading
+  //! @param theToLoadOnAccess [in] flag to load triangulations on access;
+  //!        if FALSE, triangulations stay unloaded until explicit loading
+  void SetDeferredTriangulations (const TCollection_AsciiString& theFile,
+                                  const Standard_Boolean theToLoadOnAccess = Standard_True)
+  {
+    myDeferredFile = theFile;
+    myToLoadOnAccess = theToLoadOnAccess;
+  }
+
   //! Clears the content of the set.
   Standard_EXPORT virtual void Clear() Standard_OVERRIDE;
   
@@ -178,6 +194,8 @@ private:
   TColStd_IndexedMapOfTransient myNodes;
   Standard_Boolean myWithTriangles;
   Standard_Boolean myWithNormals;
+  TCollection_AsciiString myDeferredFile;
+  Standard_Boolean myToLoadOnAccess;
 
 };
 
@@ -0,0 +1,217 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepTools_TriangulationSource.hxx>
+
+#include <GeomTools.hxx>
+#include <Message.hxx>
+#include <OSD_FileSystem.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepTools_TriangulationSource, Poly_Triangulation)
+
+// =======================================================================
+// function : BRepTools_TriangulationSource
+// purpose  :
+// =======================================================================
+BRepTools_TriangulationSource::BRepTools_TriangulationSource (const TCollection_AsciiString& theFile,
+                                                              const int64_t theOffset,
+                                                              const Standard_Integer theNbNodes,
+                                                              const Standard_Integer theNbTriangles,
+                                                              const Standard_Boolean theHasUVNodes,
+                                                              const Standard_Boolean theHasNormals,
+                                                              const Standard_Boolean theToLoadOnAccess)
+: myFile (theFile),
+  myOffset (theOffset),
+  myNbDefNodes (theNbNodes),
+  myNbDefTriangles (theNbTriangles),
+  myHasUVNodes (theHasUVNodes),
+  myHasNormals (theHasNormals),
+  myToLoadOnAccess (theToLoadOnAccess),
+  myIsLoaded (false)
+{
+}
+
+// =======================================================================
+// function : ~BRepTools_TriangulationSource
+// purpose  :
+// =======================================================================
+BRepTools_TriangulationSource::~BRepTools_TriangulationSource()
+{
+  //
+}
+
+// =======================================================================
+// function : Copy
+// purpose  :
+// =======================================================================
+Handle(Poly_Triangulation) BRepTools_TriangulationSource::Copy() const
+{
+  if (!myIsLoaded.load (std::memory_order_acquire))
+  {
+    Handle(Poly_Triangulation) aCopy = DetachedLoadDeferredData();
+    if (!aCopy.IsNull())
+    {
+      return aCopy;
+    }
+  }
+  return Poly_Triangulation::Copy();
+}
+
+// =======================================================================
+// function : LoadDeferredData
+// purpose  :
+// =======================================================================
+Standard_Boolean BRepTools_TriangulationSource::LoadDeferredData (const Handle(OSD_FileSystem)& theFileSystem)
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  if (myIsLoaded.load (std::memory_order_relaxed))
+  {
+    return Standard_True;
+  }
+  // the flag is published only once the data is completely loaded,
+  // to be read with acquire order by LoadOnAccess() without lock
+  const Standard_Boolean isLoaded = Poly_Triangulation::LoadDeferredData (theFileSystem);
+  myIsLoaded.store (isLoaded != Standard_False, std::memory_order_release);
+  return isLoaded;
+}
+
+// =======================================================================
+// function : UnloadDeferredData
+// purpose  :
+// =======================================================================
+Standard_Boolean BRepTools_TriangulationSource::UnloadDeferredData()
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  if (!Poly_Triangulation::UnloadDeferredData())
+  {
+    return Standard_False;
+  }
+  myIsLoaded.store (false, std::memory_order_release);
+  return Standard_True;
+}
+
+// =======================================================================
+// function : LoadOnAccess
+// purpose  :
+// =======================================================================
+void BRepTools_TriangulationSource::LoadOnAccess()
+{
+  if (myIsLoaded.load (std::memory_order_acquire)
+  || !myToLoadOnAccess.load (std::memory_order_acquire))
+  {
+    return;
+  }
+
+  Standard_Mutex::Sentry aLock (myMutex);
+  if (!myIsLoaded.load (std::memory_order_relaxed)
+    && myToLoadOnAccess.load (std::memory_order_relaxed)
+    && !LoadDeferredData())
+  {
+    myToLoadOnAccess.store (false, std::memory_order_release);
+    Message::SendFail (TCollection_AsciiString ("Error: unable to load triangulation from the file '") + myFile + "'");
+  }
+}
+
+// =======================================================================
+// function : loadDeferredData
+// purpose  :
+// =======================================================================
+Standard_Boolean BRepTools_TriangulationSource::loadDeferredData (const Handle(OSD_FileSystem)& theFileSystem,
+                                                                  const Handle(Poly_Triangulation)& theDestTriangulation) const
+{
+  const Handle(OSD_FileSystem)& aFileSystem = !theFileSystem.IsNull() ? theFileSystem : OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (myFile, std::ios::in | std::ios::binary, myOffset);
+  if (aStream.get() == NULL || !aStream->good())
+  {
+    return Standard_False;
+  }
+
+  theDestTriangulation->ResizeNodes (myNbDefNodes, Standard_False);
+  theDestTriangulation->ResizeTriangles (myNbDefTriangles, Standard_False);
+  if (myHasUVNodes)
+  {
+    theDestTriangulation->AddUVNodes();
+  }
+  if (myHasNormals)
+  {
+    theDestTriangulation->AddNormals();
+  }
+  theDestTriangulation->Deflection (Deflection());
+
+  try
+  {
+    OCC_CATCH_SIGNALS
+    readData (*aStream, theDestTriangulation);
+  }
+  catch (Standard_Failure const&)
+  {
+    theDestTriangulation->Clear();
+    return Standard_False;
+  }
+  if (aStream->fail())
+  {
+    theDestTriangulation->Clear();
+    return Standard_False;
+  }
+  return Standard_True;
+}
+
+// =======================================================================
+// function : ReadData
+// purpose  :
+// =======================================================================
+void BRepTools_TriangulationSource::ReadData (Standard_IStream& theStream,
+                                              const Handle(Poly_Triangulation)& theTriangulation)
+{
+  const Standard_Integer aNbNodes = theTriangulation->NbNodes();
+  Standard_Real x, y, z;
+  for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+  {
+    GeomTools::GetReal (theStream, x);
+    GeomTools::GetReal (theStream, y);
+    GeomTools::GetReal (theStream, z);
+    theTriangulation->SetNode (aNodeIter, gp_Pnt (x, y, z));
+  }
+
+  if (theTriangulation->HasUVNodes())
+  {
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      GeomTools::GetReal (theStream, x);
+      GeomTools::GetReal (theStream, y);
+      theTriangulation->SetUVNode (aNodeIter, gp_Pnt2d (x, y));
+    }
+  }
+
+  // read the triangles
+  Standard_Integer n1, n2, n3;
+  for (Standard_Integer aTriIter = 1; aTriIter <= theTriangulation->NbTriangles(); ++aTriIter)
+  {
+    theStream >> n1 >> n2 >> n3;
+    theTriangulation->SetTriangle (aTriIter, Poly_Triangle (n1, n2, n3));
+  }
+
+  if (theTriangulation->HasNormals())
+  {
+    NCollection_Vec3<Standard_Real> aNorm;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      GeomTools::GetReal (theStream, aNorm.x());
+      GeomTools::GetReal (theStream, aNorm.y());
+      GeomTools::GetReal (theStream, aNorm.z());
+      theTriangulation->SetNormal (aNodeIter, gp_Vec3f (aNorm));
+    }
+  }
+}
@@ -0,0 +1,131 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepTools_TriangulationSource_HeaderFile
+#define _BRepTools_TriangulationSource_HeaderFile
+
+#include <Poly_Triangulation.hxx>
+#include <Standard_IStream.hxx>
+#include <Standard_Mutex.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <atomic>
+
+//! Triangulation read from the file in ASCII BRep format (see BRepTools_ShapeSet)
+//! with the data left in the file to be loaded later.
+//! Class inherits Poly_Triangulation so that it can be put into TopoDS_Face instead of the loaded triangulation.
+//!
+//! The data is loaded on the first access to the triangulation of the face (see BRep_Tool::Triangulation())
+//! if loading on access is enabled, or explicitly by LoadDeferredData() (see BRepTools::LoadTriangulation()).
+//! The data can be released by UnloadDeferredData() and loaded again from the file.
+//! The file is opened in binary mode, so that the position of the data does not depend on the platform.
+//! Loading on access is protected by mutex, so that the face can be accessed from several threads.
+class BRepTools_TriangulationSource : public Poly_Triangulation
+{
+  DEFINE_STANDARD_RTTIEXT(BRepTools_TriangulationSource, Poly_Triangulation)
+public:
+
+  //! Constructor.
+  //! @param theFile        [in] path to the file
+  //! @param theOffset      [in] position of the triangulation data (nodes) in the file
+  //! @param theNbNodes     [in] number of nodes
+  //! @param theNbTriangles [in] number of triangles
+  //! @param theHasUVNodes  [in] flag indicating that the data contains UV nodes
+  //! @param theHasNormals  [in] flag indicating that the data contains normals
+  //! @param theToLoadOnAccess [in] flag to load the data on the first access to the triangulation
+  Standard_EXPORT BRepTools_TriangulationSource (const TCollection_AsciiString& theFile,
+                                                 const int64_t theOffset,
+                                                 const Standard_Integer theNbNodes,
+                                                 const Standard_Integer theNbTriangles,
+                                                 const Standard_Boolean theHasUVNodes,
+                                                 const Standard_Boolean theHasNormals,
+                                                 const Standard_Boolean theToLoadOnAccess = Standard_True);
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BRepTools_TriangulationSource();
+
+  //! Returns path to the file.
+  const TCollection_AsciiString& File() const { return myFile; }
+
+  //! Returns position of the triangulation data in the file.
+  int64_t Offset() const { return myOffset; }
+
+  //! Returns TRUE if the data contains UV nodes.
+  Standard_Boolean HasDeferredUVNodes() const { return myHasUVNodes; }
+
+  //! Returns TRUE if the data contains normals.
+  Standard_Boolean HasDeferredNormals() const { return myHasNormals; }
+
+  //! Returns TRUE if the data is loaded on the first access to the triangulation.
+  Standard_Boolean ToLoadOnAccess() const { return myToLoadOnAccess.load (std::memory_order_acquire); }
+
+  //! Sets flag to load the data on the first access to the triangulation.
+  void SetLoadOnAccess (const Standard_Boolean theToLoad) { myToLoadOnAccess.store (theToLoad != Standard_False, std::memory_order_release); }
+
+  //! Returns TRUE if the data is loaded into this triangulation.
+  Standard_Boolean IsLoaded() const { return myIsLoaded.load (std::memory_order_acquire); }
+
+  //! Returns copy of the triangulation with the data loaded from the file, if it is not loaded yet.
+  Standard_EXPORT virtual Handle(Poly_Triangulation) Copy() const Standard_OVERRIDE;
+
+  //! Reads nodes, UV nodes, triangles and normals written by BRepTools_ShapeSet into the triangulation,
+  //! which should be allocated for the data of the expected size.
+  Standard_EXPORT static void ReadData (Standard_IStream& theStream,
+                                        const Handle(Poly_Triangulation)& theTriangulation);
+
+public: //! @name late-load deferred data interface
+
+  //! Returns number of nodes for deferred loading.
+  virtual Standard_Integer NbDeferredNodes() const Standard_OVERRIDE { return myNbDefNodes; }
+
+  //! Returns number of triangles for deferred loading.
+  virtual Standard_Integer NbDeferredTriangles() const Standard_OVERRIDE { return myNbDefTriangles; }
+
+  //! Loads the data from the file into this triangulation, if it is not loaded yet.
+  Standard_EXPORT virtual Standard_Boolean LoadDeferredData (const Handle(OSD_FileSystem)& theFileSystem = Handle(OSD_FileSystem)()) Standard_OVERRIDE;
+
+  //! Releases the data, which can be loaded from the file again.
+  Standard_EXPORT virtual Standard_Boolean UnloadDeferredData() Standard_OVERRIDE;
+
+  //! Loads the data from the file if loading on access is enabled.
+  //! Loading is not attempted again after failure.
+  Standard_EXPORT virtual void LoadOnAccess() Standard_OVERRIDE;
+
+protected:
+
+  //! Loads triangulation data from the file using specified shared input file system.
+  Standard_EXPORT virtual Standard_Boolean loadDeferredData (const Handle(OSD_FileSystem)& theFileSystem,
+                                                             const Handle(Poly_Triangulation)& theDestTriangulation) const Standard_OVERRIDE;
+
+  //! Reads the data from the stream positioned at its beginning into allocated triangulation.
+  virtual void readData (Standard_IStream& theStream,
+                         const Handle(Poly_Triangulation)& theDestTriangulation) const
+  {
+    ReadData (theStream, theDestTriangulation);
+  }
+
+protected:
+
+  TCollection_AsciiString myFile;
+  int64_t                 myOffset;
+  Standard_Integer        myNbDefNodes;
+  Standard_Integer        myNbDefTriangles;
+  Standard_Boolean        myHasUVNodes;
+  Standard_Boolean        myHasNormals;
+  std::atomic<bool>       myToLoadOnAccess; //!< flag to load the data on access, reset after failure
+  std::atomic<bool>       myIsLoaded;       //!< flag set (with release order) once the data is completely loaded
+  Standard_Mutex          myMutex;          //!< lock for loading and unloading the data
+
+};
+
+#endif // _BRepTools_TriangulationSource_HeaderFile
@@ -327,9 +327,13 @@ public: //! @name Selection
 
   //! Performs selection of the elements from two BVH trees by the
   //! rules defined in Accept/Reject methods.
+  //! The traversal starts from the given pair of nodes (the root nodes by default),
+  //! which allows selecting the elements from the sub-trees independently.
   //! Returns the number of accepted pairs of elements.
   Standard_Integer Select (const opencascade::handle<BVH_Tree <NumType, Dimension>>& theBVH1,
-                           const opencascade::handle<BVH_Tree <NumType, Dimension>>& theBVH2);
+                           const opencascade::handle<BVH_Tree <NumType, Dimension>>& theBVH2,
+                           const Standard_Integer theNodeID1 = 0,
+                           const Standard_Integer theNodeID2 = 0);
 
 protected: //! @name Fields
 
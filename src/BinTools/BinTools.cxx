@@ -232,6 +232,18 @@ Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape,
 
 Standard_Boolean BinTools::Read (TopoDS_Shape& theShape, const Standard_CString theFile,
                                  const Message_ProgressRange& theRange)
+{
+  return Read (theShape, theFile, Standard_False, Standard_True, theRange);
+}
+
+//=======================================================================
+//function : Read
+//purpose  : 
+//=======================================================================
+Standard_Boolean BinTools::Read (TopoDS_Shape& theShape, const Standard_CString theFile,
+                                 const Standard_Boolean theToDeferTriangulations,
+                                 const Standard_Boolean theToLoadOnAccess,
+                                 const Message_ProgressRange& theRange)
 {
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (theFile, std::ios::in | std::ios::binary);
@@ -240,6 +252,13 @@ Standard_Boolean BinTools::Read (TopoDS_Shape& theShape, const Standard_CString
     return Standard_False;
   }
 
-  Read (theShape, *aStream, theRange);
+  BinTools_ShapeSet aShapeSet;
+  aShapeSet.SetWithTriangles (Standard_True);
+  if (theToDeferTriangulations)
+  {
+    aShapeSet.SetDeferredTriangulations (theFile, theToLoadOnAccess);
+  }
+  aShapeSet.Read (*aStream, theRange);
+  aShapeSet.ReadSubs (theShape, *aStream, aShapeSet.NbShapes());
   return aStream->good();
 }
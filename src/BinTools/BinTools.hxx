@@ -119,6 +119,19 @@ public:
     (TopoDS_Shape& theShape, const Standard_CString theFile,
      const Message_ProgressRange& theRange = Message_ProgressRange());
 
+  //! Reads a shape from <theFile> and returns it in <theShape>.
+  //! @param theToDeferTriangulations [in] flag to leave data of triangulations in the file to be loaded later
+  //!                                      (see BinTools_ShapeSet::SetDeferredTriangulations())
+  //! @param theToLoadOnAccess        [in] flag to load deferred triangulations on access to them;
+  //!                                      if FALSE, they stay unloaded until explicit loading
+  //!                                      (see BRepTools::LoadTriangulation())
+  //! @param theRange the range of progress indicator to fill in
+  Standard_EXPORT static Standard_Boolean Read
+    (TopoDS_Shape& theShape, const Standard_CString theFile,
+     const Standard_Boolean theToDeferTriangulations,
+     const Standard_Boolean theToLoadOnAccess = Standard_True,
+     const Message_ProgressRange& theRange = Message_ProgressRange());
+
 };
 
 #endif // _BinTools_HeaderFile
@@ -18,6 +18,7 @@
 #include <BinTools_Curve2dSet.hxx>
 #include <BinTools_ShapeSet.hxx>
 #include <BinTools_SurfaceSet.hxx>
+#include <BinTools_TriangulationSource.hxx>
 #include <BRep_CurveOnClosedSurface.hxx>
 #include <BRep_CurveOnSurface.hxx>
 #include <BRep_CurveRepresentation.hxx>
@@ -53,7 +54,8 @@
 //purpose  :
 //=======================================================================
 BinTools_ShapeSet::BinTools_ShapeSet ()
-  : BinTools_ShapeSetBase ()
+  : BinTools_ShapeSetBase (),
+    myToLoadOnAccess (Standard_True)
 {}
 
 //=======================================================================
@@ -1433,7 +1435,17 @@ void BinTools_ShapeSet::WriteTriangulation (Standard_OStream& OS,
     Message_ProgressScope aPS(theRange, "Writing triangulation", aNbTriangulations);
     for (Standard_Integer aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More(); ++aTriangulationIter, aPS.Next())
     {
-      const Handle(Poly_Triangulation)& aTriangulation = myTriangulations.FindKey (aTriangulationIter);
+      Handle(Poly_Triangulation) aTriangulation = myTriangulations.FindKey (aTriangulationIter);
+      if (aTriangulation->HasDeferredData() && !aTriangulation->HasGeometry())
+      {
+        // the unloaded data is read from deferred storage without loading it into the shape
+        Handle(Poly_Triangulation) aLoaded = aTriangulation->DetachedLoadDeferredData();
+        if (!aLoaded.IsNull())
+        {
+          aLoaded->Deflection (aTriangulation->Deflection());
+          aTriangulation = aLoaded;
+        }
+      }
       Standard_Boolean NeedToWriteNormals = myTriangulations.FindFromIndex(aTriangulationIter);
       const Standard_Integer aNbNodes     = aTriangulation->NbNodes();
       const Standard_Integer aNbTriangles = aTriangulation->NbTriangles();
@@ -1534,51 +1546,22 @@ void BinTools_ShapeSet::ReadTriangulation (Standard_IStream& IS,
         BinTools::GetBool(IS, hasNormals);
       }
       BinTools::GetReal(IS, aDefl); //deflection
-      Handle(Poly_Triangulation) aTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, hasNormals);
-      aTriangulation->Deflection (aDefl);
 
-      gp_Pnt aNode;
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      // the data of deferred triangulation is skipped to be read later from the same position
+      const std::streamoff aPos = !myDeferredFile.IsEmpty() && aNbTriangles > 0 ? std::streamoff (IS.tellg()) : -1;
+      Handle(Poly_Triangulation) aTriangulation;
+      if (aPos >= 0)
       {
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (1));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (2));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (3));
-        aTriangulation->SetNode (aNodeIter, aNode);
+        aTriangulation = new BinTools_TriangulationSource (myDeferredFile, aPos, aNbNodes, aNbTriangles,
+                                                           hasUV, hasNormals, myToLoadOnAccess);
+        IS.seekg (BinTools_TriangulationSource::DataSize (aNbNodes, aNbTriangles, hasUV, hasNormals), std::ios::cur);
       }
-
-      if (hasUV)
-      {
-        gp_Pnt2d aNode2d;
-        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (1));
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (2));
-          aTriangulation->SetUVNode (aNodeIter, aNode2d);
-        }
-      }
-
-      // read the triangles
-      Standard_Integer aTriNodes[3] = {};
-      for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
-      {
-        BinTools::GetInteger(IS, aTriNodes[0]);
-        BinTools::GetInteger(IS, aTriNodes[1]);
-        BinTools::GetInteger(IS, aTriNodes[2]);
-        aTriangulation->SetTriangle (aTriIter, Poly_Triangle (aTriNodes[0], aTriNodes[1], aTriNodes[2]));
-      }
-      //IS.ignore(sizeof(Standard_Real) * (hasUV ? 5 : 3) * aNbNodes + sizeof(Standard_Integer) * 3 * aNbTriangles);
-
-      if (hasNormals)
+      else
       {
-        gp_Vec3f aNormal;
-        for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
-        {
-          BinTools::GetShortReal(IS, aNormal.x());
-          BinTools::GetShortReal(IS, aNormal.y());
-          BinTools::GetShortReal(IS, aNormal.z());
-          aTriangulation->SetNormal (aNormalIter, aNormal);
-        }
+        aTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, hasNormals);
+        BinTools_TriangulationSource::ReadData (IS, aTriangulation);
       }
+      aTriangulation->Deflection (aDefl);
 
       myTriangulations.Add (aTriangulation, hasNormals);
     }
@@ -25,6 +25,7 @@
 #include <BinTools_CurveSet.hxx>
 #include <BinTools_Curve2dSet.hxx>
 #include <TColStd_IndexedMapOfTransient.hxx>
+#include <TCollection_AsciiString.hxx>
 #include <Standard_OStream.hxx>
 #include <Standard_IStream.hxx>
 
@@ -42,6 +43,21 @@ public:
 
   Standard_EXPORT virtual ~BinTools_ShapeSet();
 
+  //! Defines the file read by this set to defer loading of triangulations.
+  //! Triangulations are read as BinTools_TriangulationSource objects keeping the position of their data
+  //! in the file, so that the data is skipped while reading and loaded later on the first access
+  //! to the triangulation (see BRep_Tool::Triangulation()) or explicitly (see BRepTools::LoadTriangulation()).
+  //! The stream passed to Read() should be opened from this file.
+  //! @param theFile [in] path to the file; empty path disables deferred loading
+  //! @param theToLoadOnAccess [in] flag to load triangulations on access;
+  //!        if FALSE, triangulations stay unloaded until explicit loading
+  void SetDeferredTriangulations (const TCollection_AsciiString& theFile,
+                                  const Standard_Boolean theToLoadOnAccess = Standard_True)
+  {
+    myDeferredFile = theFile;
+    myToLoadOnAccess = theToLoadOnAccess;
+  }
+
   //! Clears the content of the set.
   Standard_EXPORT virtual void Clear();
   
@@ -189,6 +205,8 @@ private:
                              Standard_Boolean> myTriangulations; //!< Contains a boolean flag with information
                                                                  //!  to save normals for triangulation
   NCollection_IndexedMap<Handle(Poly_PolygonOnTriangulation)> myNodes;
+  TCollection_AsciiString myDeferredFile;
+  Standard_Boolean myToLoadOnAccess;
 };
 
 #endif // _BinTools_ShapeSet_HeaderFile
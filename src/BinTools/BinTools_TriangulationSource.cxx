@@ -0,0 +1,85 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_TriangulationSource.hxx>
+
+#include <BinTools.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BinTools_TriangulationSource, BRepTools_TriangulationSource)
+
+// =======================================================================
+// function : BinTools_TriangulationSource
+// purpose  :
+// =======================================================================
+BinTools_TriangulationSource::BinTools_TriangulationSource (const TCollection_AsciiString& theFile,
+                                                            const int64_t theOffset,
+                                                            const Standard_Integer theNbNodes,
+                                                            const Standard_Integer theNbTriangles,
+                                                            const Standard_Boolean theHasUVNodes,
+                                                            const Standard_Boolean theHasNormals,
+                                                            const Standard_Boolean theToLoadOnAccess)
+: BRepTools_TriangulationSource (theFile, theOffset, theNbNodes, theNbTriangles,
+                                 theHasUVNodes, theHasNormals, theToLoadOnAccess)
+{
+}
+
+// =======================================================================
+// function : ReadData
+// purpose  :
+// =======================================================================
+void BinTools_TriangulationSource::ReadData (Standard_IStream& theStream,
+                                             const Handle(Poly_Triangulation)& theTriangulation)
+{
+  const Standard_Integer aNbNodes = theTriangulation->NbNodes();
+  gp_Pnt aNode;
+  for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+  {
+    BinTools::GetReal (theStream, aNode.ChangeCoord().ChangeCoord (1));
+    BinTools::GetReal (theStream, aNode.ChangeCoord().ChangeCoord (2));
+    BinTools::GetReal (theStream, aNode.ChangeCoord().ChangeCoord (3));
+    theTriangulation->SetNode (aNodeIter, aNode);
+  }
+
+  if (theTriangulation->HasUVNodes())
+  {
+    gp_Pnt2d aNode2d;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      BinTools::GetReal (theStream, aNode2d.ChangeCoord().ChangeCoord (1));
+      BinTools::GetReal (theStream, aNode2d.ChangeCoord().ChangeCoord (2));
+      theTriangulation->SetUVNode (aNodeIter, aNode2d);
+    }
+  }
+
+  // read the triangles
+  Standard_Integer aTriNodes[3] = {};
+  for (Standard_Integer aTriIter = 1; aTriIter <= theTriangulation->NbTriangles(); ++aTriIter)
+  {
+    BinTools::GetInteger (theStream, aTriNodes[0]);
+    BinTools::GetInteger (theStream, aTriNodes[1]);
+    BinTools::GetInteger (theStream, aTriNodes[2]);
+    theTriangulation->SetTriangle (aTriIter, Poly_Triangle (aTriNodes[0], aTriNodes[1], aTriNodes[2]));
+  }
+
+  if (theTriangulation->HasNormals())
+  {
+    gp_Vec3f aNormal;
+    for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+    {
+      BinTools::GetShortReal (theStream, aNormal.x());
+      BinTools::GetShortReal (theStream, aNormal.y());
+      BinTools::GetShortReal (theStream, aNormal.z());
+      theTriangulation->SetNormal (aNormalIter, aNormal);
+    }
+  }
+}
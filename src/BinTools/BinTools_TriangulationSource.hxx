@@ -0,0 +1,76 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_TriangulationSource_HeaderFile
+#define _BinTools_TriangulationSource_HeaderFile
+
+#include <BRepTools_TriangulationSource.hxx>
+
+//! Triangulation read from the file in binary BRep format (see BinTools_ShapeSet)
+//! with the data left in the file to be loaded later (see BRepTools_TriangulationSource).
+class BinTools_TriangulationSource : public BRepTools_TriangulationSource
+{
+  DEFINE_STANDARD_RTTIEXT(BinTools_TriangulationSource, BRepTools_TriangulationSource)
+public:
+
+  //! Constructor.
+  //! @param theFile        [in] path to the file
+  //! @param theOffset      [in] position of the triangulation data (nodes) in the file
+  //! @param theNbNodes     [in] number of nodes
+  //! @param theNbTriangles [in] number of triangles
+  //! @param theHasUVNodes  [in] flag indicating that the data contains UV nodes
+  //! @param theHasNormals  [in] flag indicating that the data contains normals
+  //! @param theToLoadOnAccess [in] flag to load the data on the first access to the triangulation
+  Standard_EXPORT BinTools_TriangulationSource (const TCollection_AsciiString& theFile,
+                                                const int64_t theOffset,
+                                                const Standard_Integer theNbNodes,
+                                                const Standard_Integer theNbTriangles,
+                                                const Standard_Boolean theHasUVNodes,
+                                                const Standard_Boolean theHasNormals,
+                                                const Standard_Boolean theToLoadOnAccess = Standard_True);
+
+  //! Reads nodes, UV nodes, triangles and normals written by BinTools_ShapeSet into the triangulation,
+  //! which should be allocated for the data of the expected size.
+  Standard_EXPORT static void ReadData (Standard_IStream& theStream,
+                                        const Handle(Poly_Triangulation)& theTriangulation);
+
+  //! Returns size of the data in bytes.
+  static int64_t DataSize (const Standard_Integer theNbNodes,
+                           const Standard_Integer theNbTriangles,
+                           const Standard_Boolean theHasUVNodes,
+                           const Standard_Boolean theHasNormals)
+  {
+    int64_t aNodeSize = 3 * sizeof(Standard_Real);
+    if (theHasUVNodes)
+    {
+      aNodeSize += 2 * sizeof(Standard_Real);
+    }
+    if (theHasNormals)
+    {
+      aNodeSize += 3 * sizeof(Standard_ShortReal);
+    }
+    return aNodeSize * theNbNodes + int64_t(3 * sizeof(Standard_Integer)) * theNbTriangles;
+  }
+
+protected:
+
+  //! Reads the data from the stream positioned at its beginning into allocated triangulation.
+  virtual void readData (Standard_IStream& theStream,
+                         const Handle(Poly_Triangulation)& theDestTriangulation) const Standard_OVERRIDE
+  {
+    ReadData (theStream, theDestTriangulation);
+  }
+
+};
+
+#endif // _BinTools_TriangulationSource_HeaderFile
@@ -1563,7 +1563,7 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
                                   Standard_Integer theNbArgs,
                                   const char** theArgVec)
 {
-  if (theNbArgs != 3)
+  if (theNbArgs < 3)
   {
     theDI << "Syntax error: wrong number of arguments";
     return 1;
@@ -1571,6 +1571,27 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
 
   Standard_CString aFileName  = theArgVec[1];
   Standard_CString aShapeName = theArgVec[2];
+  bool toDeferTriangulations = false;
+  bool toLoadOnAccess = true;
+  for (Standard_Integer anArgIter = 3; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString aParam (theArgVec[anArgIter]);
+    aParam.LowerCase();
+    if (aParam == "-deferred")
+    {
+      toDeferTriangulations = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aParam == "-loadonaccess")
+    {
+      toLoadOnAccess = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else
+    {
+      theDI << "Syntax error: unknown argument '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+
   bool isBinaryFormat = true;
   {
     // probe file header to recognize format
@@ -1596,7 +1617,7 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
   TopoDS_Shape aShape;
   if (isBinaryFormat)
   {
-    if (!BinTools::Read (aShape, aFileName, aProgress->Start()))
+    if (!BinTools::Read (aShape, aFileName, toDeferTriangulations, toLoadOnAccess, aProgress->Start()))
     {
       theDI << "Error: cannot read from the file '" << aFileName << "'";
       return 1;
@@ -1604,7 +1625,7 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
   }
   else
   {
-    if (!BRepTools::Read (aShape, aFileName, BRep_Builder(), aProgress->Start()))
+    if (!BRepTools::Read (aShape, aFileName, BRep_Builder(), toDeferTriangulations, toLoadOnAccess, aProgress->Start()))
     {
       theDI << "Error: cannot read from the file '" << aFileName << "'";
       return 1;
@@ -1729,8 +1750,11 @@ void  DBRep::BasicCommands(Draw_Interpretor& theCommands)
                   "\n\t\t:  -normals include vertex normals while writing triangulation data (FALSE when unspecified).",
                   __FILE__, writebrep, g);
   theCommands.Add("readbrep",
-                  "readbrep filename shape"
-                  "\n\t\t: Restore the shape from the binary or ASCII format file.",
+                  "readbrep filename shape [-deferred {0|1}]=0 [-loadOnAccess {0|1}]=1"
+                  "\n\t\t: Restore the shape from the binary or ASCII format file."
+                  "\n\t\t:  -deferred leave triangulation data in the file to be loaded later (FALSE when unspecified)."
+                  "\n\t\t:  -loadOnAccess load deferred triangulation on the first access to it (TRUE when unspecified);"
+                  "\n\t\t:           otherwise it stays unloaded until explicit loading by trlateload command.",
                   __FILE__, readbrep, g);
   theCommands.Add("binsave", "binsave shape filename", __FILE__, writebrep, g);
   theCommands.Add("binrestore",
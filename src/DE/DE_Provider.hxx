@@ -145,6 +145,23 @@ public:
   //! @return provider's vendor name
   Standard_EXPORT virtual TCollection_AsciiString GetVendor() const = 0;
 
+  //! Returns true if Read methods of this provider do not modify any global state
+  //! (static parameters, units), so that several providers can read files
+  //! concurrently in different threads, each one into its own document or shape.
+  //! Used by the batch import of DE_Wrapper, false by default
+  //! @return true if the provider can read concurrently with other providers
+  virtual Standard_Boolean CanReadConcurrently() const
+  {
+    return Standard_False;
+  }
+
+  //! Initializes in the calling thread the global data shared by Read methods
+  //! (e.g. registration of controllers and their static parameters),
+  //! which should not be initialized concurrently by the first reading threads.
+  //! Called by the batch import of DE_Wrapper before starting the threads,
+  //! does nothing by default
+  virtual void InitConcurrentReading() {}
+
   //! Gets internal configuration node
   //! @return configuration node object
   Handle(DE_ConfigurationNode) GetNode() const
@@ -16,12 +16,15 @@
 #include <DE_ConfigurationContext.hxx>
 #include <DE_ConfigurationNode.hxx>
 #include <DE_Provider.hxx>
-#include <Message_ProgressRange.hxx>
+#include <Message.hxx>
+#include <Message_ProgressScope.hxx>
 #include <NCollection_Buffer.hxx>
 #include <OSD_File.hxx>
 #include <OSD_Path.hxx>
 #include <OSD_FileSystem.hxx>
 #include <OSD_Protection.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_Condition.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <TopoDS_Shape.hxx>
 
@@ -40,6 +43,138 @@ namespace
     static Handle(DE_Wrapper) aConf = new DE_Wrapper();
     return aConf;
   }
+
+  //! Returns the size of the file in bytes, 0 if the file cannot be opened
+  static Standard_Size fileSize(const TCollection_AsciiString& thePath)
+  {
+    const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+    std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream(thePath, std::ios::in | std::ios::binary);
+    if (aStream.get() == nullptr)
+    {
+      return 0;
+    }
+    aStream->seekg(0, std::ios::end);
+    const std::streamoff aSize = aStream->tellg();
+    return aSize > 0 ? static_cast<Standard_Size>(aSize) : 0;
+  }
+
+  //! Admits the files of a batch to be read: limits the total size of the files
+  //! being read at once and gives exclusive access to the providers
+  //! which cannot read concurrently with others
+  class DE_Wrapper_ReadLimiter
+  {
+  public:
+
+    //! Creates the limiter, 0 budget means no limit on size
+    DE_Wrapper_ReadLimiter(const Standard_Size theBudget)
+      : myReleased(false),
+        myBudget(theBudget),
+        myInUse(0),
+        myNbActive(0),
+        myIsExclusive(false)
+    {}
+
+    //! Waits until the file of the given size can be read;
+    //! a file is always accepted when no other one is being read
+    void Acquire(const Standard_Size theSize,
+                 const bool theIsExclusive)
+    {
+      for (;;)
+      {
+        {
+          Standard_Mutex::Sentry aSentry(myMutex);
+          if (myNbActive == 0
+           || (!myIsExclusive
+            && !theIsExclusive
+            && (myBudget == 0 || myInUse + theSize <= myBudget)))
+          {
+            myInUse += theSize;
+            ++myNbActive;
+            myIsExclusive = theIsExclusive;
+            return;
+          }
+          myReleased.Reset();
+        }
+        myReleased.Wait();
+      }
+    }
+
+    //! Notifies that the file of the given size has been read
+    void Release(const Standard_Size theSize)
+    {
+      Standard_Mutex::Sentry aSentry(myMutex);
+      myInUse -= theSize;
+      if (--myNbActive == 0)
+      {
+        myIsExclusive = false;
+      }
+      myReleased.Set();
+    }
+
+  private:
+
+    Standard_Mutex     myMutex;       //!< lock of the counters
+    Standard_Condition myReleased;    //!< signaled when some file has been read
+    Standard_Size      myBudget;      //!< maximum total size
+    Standard_Size      myInUse;       //!< total size of the files being read
+    Standard_Integer   myNbActive;    //!< number of the files being read
+    bool               myIsExclusive; //!< the file being read requires exclusive access
+  };
+
+  //! Functor reading the files of a batch in parallel;
+  //! TheReader reads one file by the provider: bool (const Handle(DE_Provider)&, int theIndex, const Message_ProgressRange&)
+  template<class TheReader>
+  class DE_Wrapper_BatchReader
+  {
+  public:
+
+    DE_Wrapper_BatchReader(const TheReader& theReader,
+                           const NCollection_Array1<Handle(DE_Provider)>& theProviders,
+                           const NCollection_Array1<Standard_Size>& theSizes,
+                           const NCollection_Array1<Message_ProgressRange>& theRanges,
+                           NCollection_Array1<Standard_Boolean>& theStatuses,
+                           DE_Wrapper_ReadLimiter& theLimiter)
+      : myReader(theReader),
+        myProviders(theProviders),
+        mySizes(theSizes),
+        myRanges(theRanges),
+        myStatuses(theStatuses),
+        myLimiter(theLimiter)
+    {}
+
+    void operator()(int theThreadIndex, int theIndex) const
+    {
+      (void)theThreadIndex;
+      const Handle(DE_Provider)& aProvider = myProviders.Value(theIndex);
+      if (aProvider.IsNull())
+      {
+        return;
+      }
+
+      myLimiter.Acquire(mySizes.Value(theIndex), !aProvider->CanReadConcurrently());
+      Standard_Boolean isDone = Standard_False;
+      try
+      {
+        OCC_CATCH_SIGNALS
+        isDone = myReader(aProvider, theIndex, myRanges.Value(theIndex));
+      }
+      catch (Standard_Failure const& anException)
+      {
+        Message::SendFail() << "Error in the DE_Wrapper during batch reading: " << anException;
+      }
+      myLimiter.Release(mySizes.Value(theIndex));
+      myStatuses.SetValue(theIndex, isDone);
+    }
+
+  private:
+
+    const TheReader& myReader;
+    const NCollection_Array1<Handle(DE_Provider)>& myProviders;
+    const NCollection_Array1<Standard_Size>& mySizes;
+    const NCollection_Array1<Message_ProgressRange>& myRanges;
+    NCollection_Array1<Standard_Boolean>& myStatuses;
+    DE_Wrapper_ReadLimiter& myLimiter;
+  };
 }
 
 //=======================================================================
@@ -270,6 +405,131 @@ Standard_Boolean DE_Wrapper::Write(const TCollection_AsciiString& thePath,
   return aProvider->Write(thePath, theShape, theProgress);
 }
 
+//=======================================================================
+// function : Read
+// purpose  :
+//=======================================================================
+Standard_Boolean DE_Wrapper::Read(const TColStd_Array1OfAsciiString& thePaths,
+                                  const NCollection_Array1<Handle(TDocStd_Document)>& theDocuments,
+                                  TColStd_Array1OfBoolean& theStatuses,
+                                  const Standard_Size theMemoryBudget,
+                                  const Standard_Integer theNbThreads,
+                                  const Message_ProgressRange& theProgress)
+{
+  if (theDocuments.Length() != thePaths.Length()
+   || theStatuses.Length() != thePaths.Length())
+  {
+    Message::SendFail() << "Error in the DE_Wrapper during batch reading: inconsistent sizes of arrays";
+    return Standard_False;
+  }
+  for (Standard_Integer anIndex = theDocuments.Lower(); anIndex <= theDocuments.Upper(); ++anIndex)
+  {
+    if (theDocuments.Value(anIndex).IsNull())
+    {
+      Message::SendFail() << "Error in the DE_Wrapper during batch reading: document "
+                          << (anIndex - theDocuments.Lower() + 1) << " is null";
+      return Standard_False;
+    }
+  }
+  auto aReader = [&](const Handle(DE_Provider)& theProvider,
+                     const Standard_Integer theIndex,
+                     const Message_ProgressRange& theRange)
+  {
+    return theProvider->Read(thePaths.Value(thePaths.Lower() + theIndex),
+                             theDocuments.Value(theDocuments.Lower() + theIndex),
+                             theRange);
+  };
+  return readBatch(thePaths, aReader, theStatuses, theMemoryBudget, theNbThreads, theProgress);
+}
+
+//=======================================================================
+// function : Read
+// purpose  :
+//=======================================================================
+Standard_Boolean DE_Wrapper::Read(const TColStd_Array1OfAsciiString& thePaths,
+                                  NCollection_Array1<TopoDS_Shape>& theShapes,
+                                  TColStd_Array1OfBoolean& theStatuses,
+                                  const Standard_Size theMemoryBudget,
+                                  const Standard_Integer theNbThreads,
+                                  const Message_ProgressRange& theProgress)
+{
+  if (theShapes.Length() != thePaths.Length()
+   || theStatuses.Length() != thePaths.Length())
+  {
+    Message::SendFail() << "Error in the DE_Wrapper during batch reading: inconsistent sizes of arrays";
+    return Standard_False;
+  }
+  auto aReader = [&](const Handle(DE_Provider)& theProvider,
+                     const Standard_Integer theIndex,
+                     const Message_ProgressRange& theRange)
+  {
+    return theProvider->Read(thePaths.Value(thePaths.Lower() + theIndex),
+                             theShapes.ChangeValue(theShapes.Lower() + theIndex),
+                             theRange);
+  };
+  return readBatch(thePaths, aReader, theStatuses, theMemoryBudget, theNbThreads, theProgress);
+}
+
+//=======================================================================
+// function : readBatch
+// purpose  :
+//=======================================================================
+template<class TheReader>
+Standard_Boolean DE_Wrapper::readBatch(const TColStd_Array1OfAsciiString& thePaths,
+                                       const TheReader& theReader,
+                                       TColStd_Array1OfBoolean& theStatuses,
+                                       const Standard_Size theMemoryBudget,
+                                       const Standard_Integer theNbThreads,
+                                       const Message_ProgressRange& theProgress) const
+{
+  theStatuses.Init(Standard_False);
+  if (thePaths.IsEmpty())
+  {
+    return Standard_True;
+  }
+
+  // providers are found and initialized in this thread, so that the nodes
+  // and the global data are not modified concurrently
+  const Standard_Integer aNbFiles = thePaths.Length();
+  NCollection_Array1<Handle(DE_Provider)> aProviders(0, aNbFiles - 1);
+  NCollection_Array1<Standard_Size> aSizes(0, aNbFiles - 1);
+  NCollection_Array1<Message_ProgressRange> aRanges(0, aNbFiles - 1);
+  NCollection_Array1<Standard_Boolean> aStatuses(0, aNbFiles - 1);
+  aStatuses.Init(Standard_False);
+  Message_ProgressScope aPS(theProgress, "Reading files", aNbFiles);
+  for (Standard_Integer anIndex = 0; anIndex < aNbFiles; ++anIndex)
+  {
+    const TCollection_AsciiString& aPath = thePaths.Value(thePaths.Lower() + anIndex);
+    if (!FindProvider(aPath, Standard_True, aProviders.ChangeValue(anIndex)))
+    {
+      Message::SendFail() << "Error in the DE_Wrapper during batch reading: cannot find provider for the file "
+                          << aPath;
+    }
+    else
+    {
+      // controllers are registered before the first reading thread would do it
+      aProviders.ChangeValue(anIndex)->InitConcurrentReading();
+    }
+    aSizes.SetValue(anIndex, fileSize(aPath));
+    aRanges.ChangeValue(anIndex) = aPS.Next();
+  }
+
+  DE_Wrapper_ReadLimiter aLimiter(theMemoryBudget);
+  DE_Wrapper_BatchReader<TheReader> aFunctor(theReader, aProviders, aSizes, aRanges, aStatuses, aLimiter);
+  const Handle(OSD_ThreadPool)& aPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = theNbThreads > 0 ? theNbThreads : aPool->NbDefaultThreadsToLaunch();
+  OSD_ThreadPool::Launcher aLauncher(*aPool, Min(aNbThreads, aNbFiles));
+  aLauncher.Perform(0, aNbFiles, aFunctor);
+
+  Standard_Boolean isAllDone = Standard_True;
+  for (Standard_Integer anIndex = 0; anIndex < aNbFiles; ++anIndex)
+  {
+    theStatuses.SetValue(theStatuses.Lower() + anIndex, aStatuses.Value(anIndex));
+    isAllDone = isAllDone && aStatuses.Value(anIndex);
+  }
+  return isAllDone;
+}
+
 //=======================================================================
 // function : Load
 // purpose  :
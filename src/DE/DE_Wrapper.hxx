@@ -18,7 +18,10 @@
 #include <Message_ProgressRange.hxx>
 #include <NCollection_DataMap.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_Array1.hxx>
 #include <Standard_Mutex.hxx>
+#include <TColStd_Array1OfAsciiString.hxx>
+#include <TColStd_Array1OfBoolean.hxx>
 #include <TColStd_ListOfAsciiString.hxx>
 
 class TopoDS_Shape;
@@ -155,6 +158,51 @@ public:
                                          const TopoDS_Shape& theShape,
                                          const Message_ProgressRange& theProgress = Message_ProgressRange());
 
+public:
+
+  //! Reads a list of CAD files concurrently, according internal configuration.
+  //! Each file is read by its own provider and work session into the document
+  //! of the same position in <theDocuments>, which should be created beforehand.
+  //! The files are taken in the given order by the threads of the default thread pool;
+  //! the providers which cannot read concurrently (see DE_Provider::CanReadConcurrently())
+  //! read their files while no other file is being read.
+  //! To bound the memory consumption, reading of a file is started only if the total size
+  //! of the files being read does not exceed the memory budget
+  //! (a file bigger than the budget is read alone).
+  //! @param[in] thePaths paths to the import CAD files
+  //! @param[in] theDocuments documents to save results, one per file
+  //! @param[out] theStatuses flags of successful reading, one per file
+  //! @param[in] theMemoryBudget maximum total size of files (in bytes) being read at once,
+  //!                            0 means no limit
+  //! @param[in] theNbThreads maximum number of threads,
+  //!                         0 or negative means the default number of threads of the pool
+  //! @param theProgress[in] progress indicator
+  //! @return true if all files have been read correctly
+  Standard_EXPORT Standard_Boolean Read(const TColStd_Array1OfAsciiString& thePaths,
+                                        const NCollection_Array1<Handle(TDocStd_Document)>& theDocuments,
+                                        TColStd_Array1OfBoolean& theStatuses,
+                                        const Standard_Size theMemoryBudget = 0,
+                                        const Standard_Integer theNbThreads = 0,
+                                        const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Reads a list of CAD files concurrently into shapes, according internal configuration.
+  //! The files are processed as by the method reading into documents above.
+  //! @param[in] thePaths paths to the import CAD files
+  //! @param[out] theShapes shapes to save results, one per file
+  //! @param[out] theStatuses flags of successful reading, one per file
+  //! @param[in] theMemoryBudget maximum total size of files (in bytes) being read at once,
+  //!                            0 means no limit
+  //! @param[in] theNbThreads maximum number of threads,
+  //!                         0 or negative means the default number of threads of the pool
+  //! @param theProgress[in] progress indicator
+  //! @return true if all files have been read correctly
+  Standard_EXPORT Standard_Boolean Read(const TColStd_Array1OfAsciiString& thePaths,
+                                        NCollection_Array1<TopoDS_Shape>& theShapes,
+                                        TColStd_Array1OfBoolean& theStatuses,
+                                        const Standard_Size theMemoryBudget = 0,
+                                        const Standard_Integer theNbThreads = 0,
+                                        const Message_ProgressRange& theProgress = Message_ProgressRange());
+
 public:
 
   //! Updates values according the resource file
@@ -254,6 +302,15 @@ public:
 
 protected:
 
+  //! Reads the files of a batch in parallel by the functor reading one file
+  template<class TheReader>
+  Standard_Boolean readBatch(const TColStd_Array1OfAsciiString& thePaths,
+                             const TheReader& theReader,
+                             TColStd_Array1OfBoolean& theStatuses,
+                             const Standard_Size theMemoryBudget,
+                             const Standard_Integer theNbThreads,
+                             const Message_ProgressRange& theProgress) const;
+
   //! Sorts the vendors according to the priority to work
   //! Formats omitted from the resource are not modified
   //! Vendors omitted from the format scope are disabled
@@ -397,7 +397,7 @@ void IGESData_IGESWriter::SendStartLine (const Standard_CString startline)
     void IGESData_IGESWriter::Send (const Standard_Real val)
 {
 //    Valeur flottante, expurgee de "0000" qui trainent et de "E+00"
-  char lval[24];
+  char lval[32];
   AddChar(thesep);
   Standard_Integer lng = thefloatw.Write (val,lval);
   AddString(lval,lng);
@@ -19,6 +19,8 @@
 #include <IGESData_IGESReaderTool.hxx>
 #include <IGESData_GeneralModule.hxx>
 #include <Interface_Check.hxx>
+#include <NCollection_Buffer.hxx>
+#include <OSD_FileSystem.hxx>
 
 //  Pour traiter les exceptions :
 #include <Standard_ErrorHandler.hxx>
@@ -95,7 +97,14 @@ Standard_Integer IGESFile_Read
   IGESFile_Check(2, Msg1);
 
   checkread()->Clear();
-  int result = igesread(ficnom,lesect,modefnes);
+  // the file content is read in place when the file can be mapped into memory
+  Handle(NCollection_Buffer) aFileBuffer;
+  if (ficnom[0] != '\0')
+    aFileBuffer = OSD_FileSystem::DefaultFileSystem()->OpenMemoryBuffer (ficnom);
+  int result = !aFileBuffer.IsNull()
+             ? igesreadbuffer ((const char* )aFileBuffer->Data(), aFileBuffer->Size(), lesect, modefnes)
+             : igesread (ficnom, lesect, modefnes);
+  aFileBuffer.Nullify();
 
   if (result != 0) return result;
 
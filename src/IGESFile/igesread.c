@@ -26,7 +26,7 @@ void IGESFile_Check2 (int mode,char * code, int num, char * str);
 
 /*  #include "structiges.c"    ...  fait par analiges qui en a l'usage  ...  */
 void iges_initfile();
-int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes);
+int  iges_lire (struct igesfile* lefic, int *numsec, char ligne[100], int modefnes);
 void iges_newparam(int typarg,int longval, char *parval);
 void iges_param(int *Pstat,char *ligne,char c_separ,char c_fin,int lonlin);
 void iges_Dsect (int *Dstat,int numsec,char* ligne);
@@ -52,19 +52,16 @@ void iges_Psect(int numsec,char ligne[80]);
 static  char sects [] = " SGDPT ";
 
 
-int igesread (char* nomfic, int lesect[6], int modefnes)
+static int igesreadsource (struct igesfile* lefic, int lesect[6], int modefnes)
 {
   /* MGE 16/06/98 */
 
-  FILE* lefic; char ligne[100]; int numsec, numl;  int i; int i0;int j;
+  char ligne[100]; int numsec, numl;  int i; int i0;int j;
   char str[2];
 
   int Dstat = 0; int Pstat = 0; char c_separ = ','; char c_fin = ';';
   iges_initfile();
-  lefic = stdin; i0 = numsec = 0;  numl = 0;
-  if (nomfic[0] != '\0') 
-    lefic = OSD_OpenFile(nomfic,"r");
-  if (lefic == NULL) return -1;    /*  fichier pas pu etre ouvert  */
+  i0 = numsec = 0;  numl = 0;
   for (i = 1; i < 6; i++) lesect[i] = 0;
   for (j = 0; j < 100; j++) ligne[j] = 0;
   for(;;) {
@@ -122,9 +119,29 @@ int igesread (char* nomfic, int lesect[6], int modefnes)
     IGESFile_Check3 (1, "XSTEP_20");
     //return -1;
   }
-  
-
-  fclose (lefic);
 
   return 0;
 }
+
+int igesread (char* nomfic, int lesect[6], int modefnes)
+{
+  struct igesfile lefic; int result;
+  lefic.file = stdin; lefic.cur = lefic.end = NULL; lefic.eof = 0;
+  if (nomfic[0] != '\0') 
+    lefic.file = OSD_OpenFile(nomfic,"r");
+  if (lefic.file == NULL) return -1;    /*  fichier pas pu etre ouvert  */
+
+  result = igesreadsource (&lefic,lesect,modefnes);
+  if (lefic.file != stdin) fclose (lefic.file);
+  return result;
+}
+
+/*  Lecture d'un fichier IGES dont le contenu est deja en memoire
+    (fichier projete en memoire) : lignes lues directement dans le contenu  */
+int igesreadbuffer (const char* buffer, size_t length, int lesect[6], int modefnes)
+{
+  struct igesfile lefic;
+  if (buffer == NULL) return -1;
+  lefic.file = NULL; lefic.cur = buffer; lefic.end = buffer + length; lefic.eof = 0;
+  return igesreadsource (&lefic,lesect,modefnes);
+}
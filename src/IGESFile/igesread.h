@@ -30,11 +30,21 @@ struct dirpart {
   int numpart;                                           /* n0 en Dsect */
 };
 
+/*  Source des lignes lues : fichier ouvert, ou contenu du fichier en memoire
+    (fichier projete en memoire), lu alors sans passer par stdio  */
+struct igesfile {
+  FILE* file;                                            /* fichier, ou NULL */
+  const char* cur;                                       /* position courante */
+  const char* end;                                       /* fin du contenu */
+  int eof;                                               /* fin du contenu atteinte */
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
   int  igesread   (char* nomfic,int lesect[6],int modefnes);
+  int  igesreadbuffer (const char* buffer,size_t length,int lesect[6],int modefnes);
 
   /*  structiges : */
   int  iges_lirpart
@@ -47,7 +57,7 @@ extern "C" {
   struct dirpart *iges_get_curp (void);
 
   void iges_initfile();
-  int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes);
+  int  iges_lire (struct igesfile* lefic, int *numsec, char ligne[100], int modefnes);
   void iges_newparam(int typarg,int longval, char *parval);
   void iges_param(int *Pstat,char *ligne,char c_separ,char c_fin,int lonlin);
   void iges_Dsect (int *Dstat,int numsec,char* ligne);
@@ -30,10 +30,40 @@
   Cas d erreur : ligne fausse des le debut -> abandon. Sinon tacher d enjamber
 */
 
+/*  Equivalents de fgets et feof, pour un fichier ouvert ou pour un contenu
+    en memoire (memes conventions : arret apres n-1 caracteres ou apres la
+    fin de ligne, NULL si plus rien a lire, fin atteinte si on a tente de
+    lire au-dela du contenu)
+*/
+static char* iges_fgets (char* ligne, int n, struct igesfile* lefic)
+{
+  int nb = 0;
+  if (lefic->file != NULL)
+    return fgets(ligne,n,lefic->file);
+
+  while (nb < n - 1) {
+    char c;
+    if (lefic->cur >= lefic->end) {
+      lefic->eof = 1;
+      break;
+    }
+    c = *(lefic->cur ++);
+    ligne[nb ++] = c;
+    if (c == '\n') break;
+  }
+  if (nb == 0 && lefic->eof)
+    return NULL;
+  ligne[nb] = '\0';
+  return ligne;
+}
+
+static int iges_feof (struct igesfile* lefic)
+{
+  return lefic->file != NULL ? feof(lefic->file) : lefic->eof;
+}
+
 static int iges_fautrelire = 0;
-int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes)
-/*int iges_lire (lefic,numsec,ligne,modefnes)*/
-/*FILE* lefic; int *numsec; char ligne[100]; int modefnes;*/
+int  iges_lire (struct igesfile* lefic, int *numsec, char ligne[100], int modefnes)
 {
   int i,result; char typesec;
 /*  int length;*/
@@ -45,18 +75,18 @@ int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes)
     ligne[0] = '\0'; 
     if(modefnes)
     {
-      if (fgets(ligne,99,lefic) == NULL) /*for kept compatibility with fnes*/
+      if (iges_fgets(ligne,99,lefic) == NULL) /*for kept compatibility with fnes*/
         return 0;
     }
     else
     {
       /* PTV: 21.03.2002 it is necessary for files that have only `\r` but no `\n`
               examle file is 919-001-T02-04-CP-VL.iges */
-      while ( fgets ( ligne, 2, lefic ) && ( ligne[0] == '\r' || ligne[0] == '\n' ) )
+      while ( iges_fgets ( ligne, 2, lefic ) && ( ligne[0] == '\r' || ligne[0] == '\n' ) )
       {
       }
       
-      if (fgets(&ligne[1],80,lefic) == NULL)
+      if (iges_fgets(&ligne[1],80,lefic) == NULL)
         return 0;
     }
     
@@ -66,15 +96,15 @@ int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes)
       
       if(modefnes)
       {
-        if (fgets(ligne,99,lefic) == NULL) /*for kept compatibility with fnes*/
+        if (iges_fgets(ligne,99,lefic) == NULL) /*for kept compatibility with fnes*/
           return 0;
       }
       else
       {
-        while ( fgets ( ligne, 2, lefic ) && ( ligne[0] == '\r' || ligne[0] == '\n' ) )
+        while ( iges_fgets ( ligne, 2, lefic ) && ( ligne[0] == '\r' || ligne[0] == '\n' ) )
         {
         }
-        if (fgets(&ligne[1],80,lefic) == NULL)
+        if (iges_fgets(&ligne[1],80,lefic) == NULL)
           return 0;
       }
     }
@@ -86,7 +116,7 @@ int  iges_lire (FILE* lefic, int *numsec, char ligne[100], int modefnes)
     }
   }
 
-  if (feof(lefic))
+  if (iges_feof(lefic))
     return 0;
 
   {//0x1A is END_OF_FILE for OS DOS and WINDOWS. For other OS we set this rule forcefully.
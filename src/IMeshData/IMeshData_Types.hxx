@@ -37,6 +37,7 @@
 #include <BRepMesh_Triangle.hxx>
 #include <BRepMesh_PairOfIndex.hxx>
 #include <BRepMesh_Edge.hxx>
+#include <Poly_Polygon3D.hxx>
 
 #include <memory>
 #include <queue>
@@ -97,6 +98,8 @@ namespace IMeshData
   typedef NCollection_Shared<NCollection_Vector<TopAbs_Orientation> >   VectorOfOrientation;
   typedef NCollection_Shared<NCollection_Vector<BRepMesh_Triangle> >    VectorOfElements;
   typedef NCollection_Shared<NCollection_Vector<BRepMesh_Circle> >      VectorOfCircle;
+  typedef NCollection_Shared<NCollection_Vector<BRepMesh_Edge> >        VectorOfLinks;
+  typedef NCollection_Shared<NCollection_Vector<BRepMesh_PairOfIndex> > VectorOfPairOfIndex;
 
   typedef NCollection_Shared<NCollection_Array1<BRepMesh_Vertex> > Array1OfVertexOfDelaun;
   typedef NCollection_Shared<NCollection_Vector<BRepMesh_Vertex> > VectorOfVertex;
@@ -119,6 +122,8 @@ namespace IMeshData
   typedef NCollection_Shared<NCollection_List<gp_Pnt2d> >         ListOfPnt2d;
   typedef NCollection_Shared<NCollection_List<IPCurveHandle> >    ListOfIPCurves;
 
+  typedef NCollection_Shared<NCollection_Vector<ListOfInteger> > VectorOfListOfInteger;
+
   typedef NCollection_Shared<TColStd_PackedMapOfInteger> MapOfInteger;
   typedef TColStd_MapIteratorOfPackedMapOfInteger        IteratorOfMapOfInteger;
 
@@ -126,6 +131,7 @@ namespace IMeshData
   typedef NCollection_CellFilter<BRepMesh_VertexInspector> VertexCellFilter;
 
   typedef NCollection_Shared<NCollection_DataMap<TopoDS_Shape, Standard_Integer,TopTools_ShapeMapHasher> > DMapOfShapeInteger;
+  typedef NCollection_Shared<NCollection_DataMap<TopoDS_Shape, Handle(Poly_Polygon3D), TopTools_ShapeMapHasher> > DMapOfShapePolygon3D;
   typedef NCollection_Shared<NCollection_DataMap<IFacePtr, ListOfInteger> >                                DMapOfIFacePtrsListOfInteger;
   typedef NCollection_Shared<NCollection_Map<IEdgePtr> >                                                   MapOfIEdgePtr;
   typedef NCollection_Shared<NCollection_Map<IFacePtr> >                                                   MapOfIFacePtr;
@@ -107,6 +107,7 @@ public:
     }
 
     // Discretize faces of a model.
+    myFaceDiscret->SetStatistics (myStatistics);
     return myFaceDiscret->Perform (myModel, myParameters, theRange);
   }
 
@@ -217,6 +218,19 @@ public:
     return myParameters;
   }
 
+  //! Returns statistics of meshing, NULL by default.
+  const Handle(IMeshTools_MeshStatistics)& GetStatistics () const
+  {
+    return myStatistics;
+  }
+
+  //! Sets statistics to be filled by meshing: time of stages (see IMeshTools_MeshBuilder)
+  //! and counters of discretized faces; NULL to skip collecting of statistics.
+  void SetStatistics (const Handle(IMeshTools_MeshStatistics)& theStatistics)
+  {
+    myStatistics = theStatistics;
+  }
+
   //! Returns discrete model of a shape.
   const Handle (IMeshData_Model)& GetModel () const
   {
@@ -235,6 +249,7 @@ private:
   Handle (IMeshTools_ModelAlgo)    myFaceDiscret;
   Handle (IMeshTools_ModelAlgo)    myPostProcessor;
   IMeshTools_Parameters            myParameters;
+  Handle (IMeshTools_MeshStatistics) myStatistics;
 };
 
 #endif
\ No newline at end of file
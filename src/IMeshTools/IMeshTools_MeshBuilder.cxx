@@ -16,9 +16,32 @@
 #include <IMeshTools_MeshBuilder.hxx>
 #include <IMeshData_Face.hxx>
 #include <OSD_Parallel.hxx>
+#include <OSD_Timer.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(IMeshTools_MeshBuilder, Message_Algorithm)
 
+namespace
+{
+  //! Performs the stage of meshing adding its elapsed time to statistics, if defined.
+  template<typename TheStageFunctor>
+  static Standard_Boolean performStage (const Handle(IMeshTools_MeshStatistics)& theStatistics,
+                                        const IMeshTools_MeshStage theStage,
+                                        const TheStageFunctor& theFunctor)
+  {
+    if (theStatistics.IsNull())
+    {
+      return theFunctor();
+    }
+
+    OSD_Timer aTimer;
+    aTimer.Start();
+    const Standard_Boolean isDone = theFunctor();
+    aTimer.Stop();
+    theStatistics->AddStageTime (theStage, aTimer.ElapsedTime());
+    return isDone;
+  }
+}
+
 //=======================================================================
 // Function: Constructor
 // Purpose : 
@@ -62,17 +85,19 @@ void IMeshTools_MeshBuilder::Perform (const Message_ProgressRange& theRange)
 
   Message_ProgressScope aPS(theRange, "Mesh Perform", 10);
 
-  if (aContext->BuildModel ())
+  const Handle(IMeshTools_MeshStatistics)& aStats = aContext->GetStatistics();
+  if (performStage (aStats, IMeshTools_MeshStage_BuildModel, [&]() { return aContext->BuildModel(); }))
   {
-    if (aContext->DiscretizeEdges ())
+    if (performStage (aStats, IMeshTools_MeshStage_DiscretizeEdges, [&]() { return aContext->DiscretizeEdges(); }))
     {
-      if (aContext->HealModel ())
+      if (performStage (aStats, IMeshTools_MeshStage_HealModel, [&]() { return aContext->HealModel(); }))
       {
-        if (aContext->PreProcessModel())
+        if (performStage (aStats, IMeshTools_MeshStage_PreProcessModel, [&]() { return aContext->PreProcessModel(); }))
         {
-          if (aContext->DiscretizeFaces(aPS.Next(9)))
+          const Message_ProgressRange aFacesRange = aPS.Next(9);
+          if (performStage (aStats, IMeshTools_MeshStage_DiscretizeFaces, [&]() { return aContext->DiscretizeFaces (aFacesRange); }))
           {
-            if (aContext->PostProcessModel())
+            if (performStage (aStats, IMeshTools_MeshStage_PostProcessModel, [&]() { return aContext->PostProcessModel(); }))
             {
               SetStatus(Message_Done1);
             }
@@ -36,6 +36,9 @@
 //! Message_Fail6 - fail to discretize faces.
 //! Message_Fail7 - fail to post-process model.
 //! Message_Warn1 - shape contains no objects to mesh.
+//!
+//! Elapsed time of each stage is added to the statistics of the context, if defined
+//! (see IMeshTools_Context::SetStatistics()).
 class IMeshTools_MeshBuilder : public Message_Algorithm
 {
 public:
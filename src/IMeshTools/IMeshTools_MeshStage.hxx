@@ -0,0 +1,30 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _IMeshTools_MeshStage_HeaderFile
+#define _IMeshTools_MeshStage_HeaderFile
+
+//! Enumerates stages of meshing pipeline performed by IMeshTools_MeshBuilder.
+enum IMeshTools_MeshStage
+{
+  IMeshTools_MeshStage_BuildModel = 0,  //!< building of discrete model
+  IMeshTools_MeshStage_DiscretizeEdges, //!< discretization of edges
+  IMeshTools_MeshStage_HealModel,       //!< healing of discrete model
+  IMeshTools_MeshStage_PreProcessModel, //!< pre-processing of discrete model
+  IMeshTools_MeshStage_DiscretizeFaces, //!< discretization of faces
+  IMeshTools_MeshStage_PostProcessModel //!< post-processing of discrete model
+};
+
+enum { IMeshTools_MeshStage_NB = IMeshTools_MeshStage_PostProcessModel + 1 };
+
+#endif
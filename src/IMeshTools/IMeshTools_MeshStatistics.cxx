@@ -0,0 +1,191 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <IMeshTools_MeshStatistics.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(IMeshTools_MeshStatistics, Standard_Transient)
+
+//=======================================================================
+// Function: StageName
+// Purpose :
+//=======================================================================
+const char* IMeshTools_MeshStatistics::StageName (IMeshTools_MeshStage theStage)
+{
+  switch (theStage)
+  {
+    case IMeshTools_MeshStage_BuildModel:       return "BuildModel";
+    case IMeshTools_MeshStage_DiscretizeEdges:  return "DiscretizeEdges";
+    case IMeshTools_MeshStage_HealModel:        return "HealModel";
+    case IMeshTools_MeshStage_PreProcessModel:  return "PreProcessModel";
+    case IMeshTools_MeshStage_DiscretizeFaces:  return "DiscretizeFaces";
+    case IMeshTools_MeshStage_PostProcessModel: return "PostProcessModel";
+  }
+  return "";
+}
+
+//=======================================================================
+// Function: SurfaceTypeName
+// Purpose :
+//=======================================================================
+const char* IMeshTools_MeshStatistics::SurfaceTypeName (GeomAbs_SurfaceType theType)
+{
+  switch (theType)
+  {
+    case GeomAbs_Plane:               return "Plane";
+    case GeomAbs_Cylinder:            return "Cylinder";
+    case GeomAbs_Cone:                return "Cone";
+    case GeomAbs_Sphere:              return "Sphere";
+    case GeomAbs_Torus:               return "Torus";
+    case GeomAbs_BezierSurface:       return "BezierSurface";
+    case GeomAbs_BSplineSurface:      return "BSplineSurface";
+    case GeomAbs_SurfaceOfRevolution: return "SurfaceOfRevolution";
+    case GeomAbs_SurfaceOfExtrusion:  return "SurfaceOfExtrusion";
+    case GeomAbs_OffsetSurface:       return "OffsetSurface";
+    case GeomAbs_OtherSurface:        return "OtherSurface";
+  }
+  return "";
+}
+
+//=======================================================================
+// Function: Constructor
+// Purpose :
+//=======================================================================
+IMeshTools_MeshStatistics::IMeshTools_MeshStatistics()
+{
+  Reset();
+}
+
+//=======================================================================
+// Function: Reset
+// Purpose :
+//=======================================================================
+void IMeshTools_MeshStatistics::Reset()
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  for (int aStageIter = 0; aStageIter < IMeshTools_MeshStage_NB; ++aStageIter)
+  {
+    myStageTimes[aStageIter] = 0.0;
+  }
+  for (int aTypeIter = 0; aTypeIter < SurfaceType_NB; ++aTypeIter)
+  {
+    myFaces[aTypeIter] = FaceCounters();
+  }
+}
+
+//=======================================================================
+// Function: TotalTime
+// Purpose :
+//=======================================================================
+double IMeshTools_MeshStatistics::TotalTime() const
+{
+  double aTime = 0.0;
+  for (int aStageIter = 0; aStageIter < IMeshTools_MeshStage_NB; ++aStageIter)
+  {
+    aTime += myStageTimes[aStageIter];
+  }
+  return aTime;
+}
+
+//=======================================================================
+// Function: AddFace
+// Purpose :
+//=======================================================================
+void IMeshTools_MeshStatistics::AddFace (GeomAbs_SurfaceType theType,
+                                         double theTime,
+                                         int    theNbTris,
+                                         bool   theIsFailed)
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  FaceCounters& aCounters = myFaces[theType];
+  ++aCounters.NbFaces;
+  if (theIsFailed)
+  {
+    ++aCounters.NbFailed;
+  }
+  aCounters.NbTriangles += theNbTris;
+  aCounters.Time += theTime;
+}
+
+//=======================================================================
+// Function: NbFaces
+// Purpose :
+//=======================================================================
+int IMeshTools_MeshStatistics::NbFaces() const
+{
+  int aNbFaces = 0;
+  for (int aTypeIter = 0; aTypeIter < SurfaceType_NB; ++aTypeIter)
+  {
+    aNbFaces += myFaces[aTypeIter].NbFaces;
+  }
+  return aNbFaces;
+}
+
+//=======================================================================
+// Function: NbFailedFaces
+// Purpose :
+//=======================================================================
+int IMeshTools_MeshStatistics::NbFailedFaces() const
+{
+  int aNbFailed = 0;
+  for (int aTypeIter = 0; aTypeIter < SurfaceType_NB; ++aTypeIter)
+  {
+    aNbFailed += myFaces[aTypeIter].NbFailed;
+  }
+  return aNbFailed;
+}
+
+//=======================================================================
+// Function: NbTriangles
+// Purpose :
+//=======================================================================
+Standard_Size IMeshTools_MeshStatistics::NbTriangles() const
+{
+  Standard_Size aNbTris = 0;
+  for (int aTypeIter = 0; aTypeIter < SurfaceType_NB; ++aTypeIter)
+  {
+    aNbTris += myFaces[aTypeIter].NbTriangles;
+  }
+  return aNbTris;
+}
+
+//=======================================================================
+// Function: Dump
+// Purpose :
+//=======================================================================
+void IMeshTools_MeshStatistics::Dump (Standard_OStream& theStream) const
+{
+  theStream << "Stages:\n";
+  for (int aStageIter = 0; aStageIter < IMeshTools_MeshStage_NB; ++aStageIter)
+  {
+    theStream << "  " << StageName ((IMeshTools_MeshStage )aStageIter) << ": "
+              << myStageTimes[aStageIter] << " s\n";
+  }
+  theStream << "  Total: " << TotalTime() << " s\n";
+
+  theStream << "Faces:\n";
+  double aFaceTime = 0.0;
+  for (int aTypeIter = 0; aTypeIter < SurfaceType_NB; ++aTypeIter)
+  {
+    const FaceCounters& aCounters = myFaces[aTypeIter];
+    if (aCounters.NbFaces == 0)
+    {
+      continue;
+    }
+    theStream << "  " << SurfaceTypeName ((GeomAbs_SurfaceType )aTypeIter) << ": faces " << aCounters.NbFaces
+              << ", failed " << aCounters.NbFailed << ", triangles " << aCounters.NbTriangles
+              << ", time " << aCounters.Time << " s\n";
+    aFaceTime += aCounters.Time;
+  }
+  theStream << "  Total: faces " << NbFaces() << ", failed " << NbFailedFaces()
+            << ", triangles " << NbTriangles() << ", time " << aFaceTime << " s\n";
+}
@@ -0,0 +1,120 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _IMeshTools_MeshStatistics_HeaderFile
+#define _IMeshTools_MeshStatistics_HeaderFile
+
+#include <GeomAbs_SurfaceType.hxx>
+#include <IMeshTools_MeshStage.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_OStream.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+//! Timers and counters of meshing pipeline.
+//!
+//! Being assigned to IMeshTools_Context, the statistics is filled by IMeshTools_MeshBuilder
+//! with elapsed (wall clock) time of each stage of the pipeline and by the algorithm
+//! discretizing faces (see BRepMesh_FaceDiscret) with number of faces, time spent on them
+//! and number of built triangles per type of surface, which defines the meshing algorithm
+//! applied to the face (see IMeshTools_MeshAlgoFactory).
+//! Time of faces is cumulative over all threads, thus it may exceed elapsed time
+//! of discretization of faces in parallel mode.
+//! Values are accumulated over subsequent runs until Reset().
+//! Faces may be added concurrently.
+class IMeshTools_MeshStatistics : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(IMeshTools_MeshStatistics, Standard_Transient)
+public:
+
+  //! Return name of the stage.
+  Standard_EXPORT static const char* StageName (IMeshTools_MeshStage theStage);
+
+  //! Return name of the surface type.
+  Standard_EXPORT static const char* SurfaceTypeName (GeomAbs_SurfaceType theType);
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT IMeshTools_MeshStatistics();
+
+  //! Reset all values.
+  Standard_EXPORT void Reset();
+
+  //! Add elapsed time in seconds to the stage.
+  void AddStageTime (IMeshTools_MeshStage theStage, double theTime) { myStageTimes[theStage] += theTime; }
+
+  //! Return elapsed time of the stage in seconds.
+  double StageTime (IMeshTools_MeshStage theStage) const { return myStageTimes[theStage]; }
+
+  //! Return elapsed time of all stages in seconds.
+  Standard_EXPORT double TotalTime() const;
+
+  //! Add discretized face.
+  //! @param[in] theType     type of surface of the face
+  //! @param[in] theTime     time spent on the face in seconds
+  //! @param[in] theNbTris   number of triangles of built triangulation
+  //! @param[in] theIsFailed flag indicating failure of discretization of the face
+  Standard_EXPORT void AddFace (GeomAbs_SurfaceType theType,
+                                double theTime,
+                                int    theNbTris,
+                                bool   theIsFailed);
+
+  //! Return number of discretized faces with surface of given type.
+  int NbFaces (GeomAbs_SurfaceType theType) const { return myFaces[theType].NbFaces; }
+
+  //! Return number of faces with surface of given type failed to be discretized.
+  int NbFailedFaces (GeomAbs_SurfaceType theType) const { return myFaces[theType].NbFailed; }
+
+  //! Return number of triangles built on faces with surface of given type.
+  Standard_Size NbTriangles (GeomAbs_SurfaceType theType) const { return myFaces[theType].NbTriangles; }
+
+  //! Return time in seconds spent on faces with surface of given type.
+  double FaceTime (GeomAbs_SurfaceType theType) const { return myFaces[theType].Time; }
+
+  //! Return number of discretized faces.
+  Standard_EXPORT int NbFaces() const;
+
+  //! Return number of faces failed to be discretized.
+  Standard_EXPORT int NbFailedFaces() const;
+
+  //! Return number of built triangles.
+  Standard_EXPORT Standard_Size NbTriangles() const;
+
+  //! Print statistics into the stream: time of stages and counters of faces per type of surface.
+  Standard_EXPORT void Dump (Standard_OStream& theStream) const;
+
+private:
+
+  //! Counters of faces with surface of the same type.
+  struct FaceCounters
+  {
+    int           NbFaces;
+    int           NbFailed;
+    Standard_Size NbTriangles;
+    double        Time;
+
+    FaceCounters() : NbFaces (0), NbFailed (0), NbTriangles (0), Time (0.0) {}
+  };
+
+  enum { SurfaceType_NB = GeomAbs_OtherSurface + 1 };
+
+private:
+
+  Standard_Mutex myMutex;                              //!< mutex for adding faces
+  double         myStageTimes[IMeshTools_MeshStage_NB]; //!< elapsed time of stages
+  FaceCounters   myFaces[SurfaceType_NB];               //!< counters of faces per surface type
+
+};
+
+#endif // _IMeshTools_MeshStatistics_HeaderFile
@@ -16,6 +16,7 @@
 #ifndef _IMeshTools_ModelAlgo_HeaderFile
 #define _IMeshTools_ModelAlgo_HeaderFile
 
+#include <IMeshTools_MeshStatistics.hxx>
 #include <Standard_Transient.hxx>
 #include <Message_ProgressRange.hxx>
 
@@ -50,6 +51,18 @@ public:
     }
   }
 
+  //! Returns statistics to be filled by algorithm, NULL by default.
+  const Handle(IMeshTools_MeshStatistics)& Statistics() const
+  {
+    return myStatistics;
+  }
+
+  //! Sets statistics to be filled by algorithm; NULL to skip collecting of statistics.
+  void SetStatistics (const Handle(IMeshTools_MeshStatistics)& theStatistics)
+  {
+    myStatistics = theStatistics;
+  }
+
   DEFINE_STANDARD_RTTIEXT(IMeshTools_ModelAlgo, Standard_Transient)
 
 protected:
@@ -64,6 +77,10 @@ protected:
     const Handle (IMeshData_Model)& theModel,
     const IMeshTools_Parameters&    theParameters,
     const Message_ProgressRange&    theRange) = 0;
+
+protected:
+
+  Handle(IMeshTools_MeshStatistics) myStatistics;
 };
 
 #endif
\ No newline at end of file
@@ -32,6 +32,7 @@ struct IMeshTools_Parameters {
     DeflectionInterior(-1.0),
     MinSize (-1.0),
     InParallel (Standard_False),
+    InParallelFace (Standard_False),
     Relative (Standard_False),
     InternalVerticesMode (Standard_True),
     ControlSurfaceDeflection (Standard_True),
@@ -39,7 +40,8 @@ struct IMeshTools_Parameters {
     CleanModel (Standard_True),
     AdjustMinSize (Standard_False),
     ForceFaceDeflection (Standard_False),
-    AllowQualityDecrease (Standard_False)
+    AllowQualityDecrease (Standard_False),
+    FlatDataStructure (Standard_False)
   {
   }
 
@@ -72,6 +74,13 @@ struct IMeshTools_Parameters {
   //! Switches on/off multi-thread computation
   Standard_Boolean                                 InParallel;
 
+  //! Switches on/off multi-thread meshing of a single face.
+  //! The parametric domain of a large face is split into a grid of sub-domains,
+  //! where the nodes are inserted concurrently unless their cavities reach the neighbor sub-domains;
+  //! the surface is evaluated and the deflection of triangles is checked concurrently as well.
+  //! Useful for the huge faces, which are processed by a single thread even if InParallel is on.
+  Standard_Boolean                                 InParallelFace;
+
   //! Switches on/off relative computation of edge tolerance<br>
   //! If true, deflection used for the polygonalisation of each edge will be 
   //! <defle> * Size of Edge. The deflection used for the faces will be the 
@@ -104,6 +113,11 @@ struct IMeshTools_Parameters {
   //! Allows/forbids the decrease of the quality of the generated mesh
   //! over the existing one.
   Standard_Boolean                                 AllowQualityDecrease;
+
+  //! Enables/disables usage of the flat storage of links in the data structure
+  //! of the 2D triangulation (see BRepMesh_DataStructureOfDelaun::Storage_Flat).
+  //! Disabled by default.
+  Standard_Boolean                                 FlatDataStructure;
 };
 
 #endif
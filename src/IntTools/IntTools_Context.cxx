@@ -65,6 +65,7 @@ IntTools_Context::IntTools_Context()
   myBndBoxDataMap(100, myAllocator),
   mySurfAdaptorMap(100, myAllocator),
   myOBBMap(100, myAllocator),
+  mySharedContext(new IntTools_SharedContext()),
   myCreateFlag(0),
   myPOnSTolerance(1.e-12)
 {
@@ -87,6 +88,7 @@ IntTools_Context::IntTools_Context
   myBndBoxDataMap(100, myAllocator),
   mySurfAdaptorMap(100, myAllocator),
   myOBBMap(100, myAllocator),
+  mySharedContext(new IntTools_SharedContext()),
   myCreateFlag(1),
   myPOnSTolerance(1.e-12)
 {
@@ -97,15 +99,6 @@ IntTools_Context::IntTools_Context
 //=======================================================================
 IntTools_Context::~IntTools_Context()
 {
-  for (NCollection_DataMap<TopoDS_Shape, IntTools_FClass2d*, TopTools_ShapeMapHasher>::Iterator anIt (myFClass2dMap);
-       anIt.More(); anIt.Next())
-  {
-    IntTools_FClass2d* pFClass2d = anIt.Value();;
-    (*pFClass2d).~IntTools_FClass2d();
-    myAllocator->Free (pFClass2d);
-  }
-  myFClass2dMap.Clear();
-
   clearCachedPOnSProjectors();
   for (NCollection_DataMap<TopoDS_Shape, GeomAPI_ProjectPointOnCurve*, TopTools_ShapeMapHasher>::Iterator anIt (myProjPCMap);
        anIt.More(); anIt.Next())
@@ -152,15 +145,6 @@ IntTools_Context::~IntTools_Context()
   }
   myProjSDataMap.Clear();
 
-  for (NCollection_DataMap<TopoDS_Shape, Bnd_Box*, TopTools_ShapeMapHasher>::Iterator anIt (myBndBoxDataMap);
-       anIt.More(); anIt.Next())
-  {
-    Bnd_Box* pBox = anIt.Value();
-    (*pBox).~Bnd_Box();
-    myAllocator->Free (pBox);
-  }
-  myBndBoxDataMap.Clear();
-
   for (NCollection_DataMap<TopoDS_Shape, BRepAdaptor_Surface*, TopTools_ShapeMapHasher>::Iterator anIt (mySurfAdaptorMap);
        anIt.More(); anIt.Next())
   {
@@ -169,15 +153,6 @@ IntTools_Context::~IntTools_Context()
     myAllocator->Free (pSurfAdaptor);
   }
   mySurfAdaptorMap.Clear();
-
-  for (NCollection_DataMap<TopoDS_Shape, Bnd_OBB*, TopTools_ShapeMapHasher>::Iterator anIt (myOBBMap);
-       anIt.More(); anIt.Next())
-  {
-    Bnd_OBB* pOBB = anIt.Value();
-    (*pOBB).~Bnd_OBB();
-    myAllocator->Free (pOBB);
-  }
-  myOBBMap.Clear();
 }
 
 //=======================================================================
@@ -189,13 +164,8 @@ Bnd_Box& IntTools_Context::BndBox(const TopoDS_Shape& aS)
   Bnd_Box* pBox = NULL;
   if (!myBndBoxDataMap.Find (aS, pBox))
   {
-    //
-    pBox=(Bnd_Box*)myAllocator->Allocate(sizeof(Bnd_Box));
-    new (pBox) Bnd_Box();
-    //
-    Bnd_Box &aBox=*pBox;
-    BRepBndLib::Add(aS, aBox);
-    //
+    // The box is owned by the shared storage
+    pBox = &mySharedContext->BndBox(aS);
     myBndBoxDataMap.Bind (aS, pBox);
   }
   return *pBox;
@@ -217,6 +187,22 @@ Standard_Boolean IntTools_Context::IsInfiniteFace
          aBox.IsOpenZmin();
 }
 //=======================================================================
+//function : SetSharedContext
+//purpose  : 
+//=======================================================================
+void IntTools_Context::SetSharedContext
+  (const Handle(IntTools_SharedContext)& theSharedContext)
+{
+  if (theSharedContext.IsNull() || theSharedContext == mySharedContext)
+    return;
+  //
+  // Forget the tools of the previous storage
+  myFClass2dMap.Clear();
+  myBndBoxDataMap.Clear();
+  myOBBMap.Clear();
+  mySharedContext = theSharedContext;
+}
+//=======================================================================
 //function : FClass2d
 //purpose  : 
 //=======================================================================
@@ -225,17 +211,9 @@ IntTools_FClass2d& IntTools_Context::FClass2d(const TopoDS_Face& aF)
   IntTools_FClass2d* pFClass2d = NULL;
   if (!myFClass2dMap.Find (aF, pFClass2d))
   {
-    Standard_Real aTolF;
-    TopoDS_Face aFF;
-    //
-    aFF=aF;
-    aFF.Orientation(TopAbs_FORWARD);
-    aTolF=BRep_Tool::Tolerance(aFF);
-    //
-    pFClass2d=(IntTools_FClass2d*)myAllocator->Allocate(sizeof(IntTools_FClass2d));
-    new (pFClass2d) IntTools_FClass2d(aFF, aTolF);
-    //
-    myFClass2dMap.Bind(aFF, pFClass2d);
+    // The classifier is owned by the shared storage
+    pFClass2d = &mySharedContext->FClass2d(aF);
+    myFClass2dMap.Bind(aF, pFClass2d);
   }
   return *pFClass2d;
 }
@@ -413,13 +391,8 @@ Bnd_OBB& IntTools_Context::OBB(const TopoDS_Shape& aS,
   Bnd_OBB* pBox = NULL;
   if (!myOBBMap.Find (aS, pBox))
   {
-    pBox = (Bnd_OBB*)myAllocator->Allocate(sizeof(Bnd_OBB));
-    new (pBox) Bnd_OBB();
-    //
-    Bnd_OBB &aBox = *pBox;
-    BRepBndLib::AddOBB(aS, aBox);
-    aBox.Enlarge(theGap);
-    //
+    // The box is owned by the shared storage
+    pBox = &mySharedContext->OBB(aS, theGap);
     myOBBMap.Bind(aS, pBox);
   }
   return *pBox;
@@ -26,6 +26,7 @@
 #include <Standard_Transient.hxx>
 #include <TopAbs_State.hxx>
 #include <BRepAdaptor_Surface.hxx>
+#include <IntTools_SharedContext.hxx>
 class IntTools_FClass2d;
 class TopoDS_Face;
 class GeomAPI_ProjectPointOnSurf;
@@ -47,6 +48,10 @@ class Bnd_OBB;
 //! and topological toolkit (classifiers, projectors, etc).
 //! The intersection Context is for caching the tools
 //! to increase the performance.
+//! The tools which are not modified by their usage (2D point classifiers
+//! of faces and bounding boxes) are kept in the thread-safe storage
+//! IntTools_SharedContext, which may be shared with the Contexts of
+//! other threads performing the same algorithm.
 class IntTools_Context : public Standard_Transient
 {
 public:
@@ -56,6 +61,16 @@ public:
 Standard_EXPORT virtual  ~IntTools_Context();
   
   Standard_EXPORT IntTools_Context(const Handle(NCollection_BaseAllocator)& theAllocator);
+
+  //! Returns the storage of the tools shared with the Contexts of other threads.
+  const Handle(IntTools_SharedContext)& SharedContext() const
+  {
+    return mySharedContext;
+  }
+
+  //! Sets the storage of the tools shared with the Contexts of other threads.
+  //! The tools taken from the previous storage are forgotten.
+  Standard_EXPORT void SetSharedContext (const Handle(IntTools_SharedContext)& theSharedContext);
   
 
   //! Returns a reference to point classifier
@@ -252,6 +267,7 @@ protected:
   NCollection_DataMap<TopoDS_Shape, Bnd_Box*, TopTools_ShapeMapHasher> myBndBoxDataMap;
   NCollection_DataMap<TopoDS_Shape, BRepAdaptor_Surface*, TopTools_ShapeMapHasher> mySurfAdaptorMap;
   NCollection_DataMap<TopoDS_Shape, Bnd_OBB*, TopTools_ShapeMapHasher> myOBBMap; // Map of oriented bounding boxes
+  Handle(IntTools_SharedContext) mySharedContext; // Storage of the classifiers and boxes
   Standard_Integer myCreateFlag;
   Standard_Real myPOnSTolerance;
 
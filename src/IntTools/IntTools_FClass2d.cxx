@@ -661,12 +661,7 @@ TopAbs_State IntTools_FClass2d::Perform
       }
       //
 
-      if (myFExplorer.get() == NULL)
-        myFExplorer.reset (new BRepClass_FaceExplorer (Face));
-
-      BRepClass_FClassifier aClassifier;
-      aClassifier.Perform(*myFExplorer, Puv, aFCTol);
-      aStatus = aClassifier.State();
+      aStatus = classifyByExplorer (Puv, aFCTol);
     }
     
     if (!RecadreOnPeriodic || (!IsUPer && !IsVPer))
@@ -782,12 +777,7 @@ TopAbs_State IntTools_FClass2d::TestOnRestriction
     }
     else {  //-- TabOrien(1)=-1  Wrong  Wire 
 
-      if (myFExplorer.get() == NULL)
-        myFExplorer.reset (new BRepClass_FaceExplorer (Face));
-
-      BRepClass_FClassifier aClassifier;
-      aClassifier.Perform(*myFExplorer, Puv, Tol);
-      aStatus = aClassifier.State();
+      aStatus = classifyByExplorer (Puv, Tol);
     }
     
     if (!RecadreOnPeriodic || (!IsUPer && !IsVPer))
@@ -822,6 +812,33 @@ TopAbs_State IntTools_FClass2d::TestOnRestriction
   } //for (;;)
 }
 
+//=======================================================================
+//function : classifyByExplorer
+//purpose  : The cached explorer keeps the state of exploration, thus it
+//           is used by one classification at a time; concurrent ones
+//           use their own explorers instead of waiting for it
+//=======================================================================
+TopAbs_State IntTools_FClass2d::classifyByExplorer (const gp_Pnt2d&     thePnt,
+                                                    const Standard_Real theTol) const
+{
+  BRepClass_FClassifier aClassifier;
+  if (!myFExplorerMutex.TryLock())
+  {
+    BRepClass_FaceExplorer anExplorer (Face);
+    aClassifier.Perform (anExplorer, thePnt, theTol);
+    return aClassifier.State();
+  }
+
+  // the mutex is unlocked by the sentry, locking it recursively
+  Standard_Mutex::Sentry aLock (myFExplorerMutex);
+  myFExplorerMutex.Unlock();
+  if (myFExplorer.get() == NULL)
+    myFExplorer.reset (new BRepClass_FaceExplorer (Face));
+
+  aClassifier.Perform (*myFExplorer, thePnt, theTol);
+  return aClassifier.State();
+}
+
 //=======================================================================
 //function : ~IntTools_FClass2d
 //purpose  :
@@ -23,6 +23,7 @@
 
 #include <BRepClass_FaceExplorer.hxx>
 #include <BRepTopAdaptor_SeqOfPtr.hxx>
+#include <Standard_Mutex.hxx>
 #include <TColStd_SequenceOfInteger.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopAbs_State.hxx>
@@ -32,6 +33,8 @@ class gp_Pnt2d;
 
 //! Class provides an algorithm to classify a 2d Point
 //! in 2d space of face using boundaries of the face.
+//! The classification methods may be called concurrently
+//! from several threads.
 class IntTools_FClass2d 
 {
 public:
@@ -68,6 +71,16 @@ public:
 
   Standard_EXPORT Standard_Boolean IsHole() const;
 
+private:
+
+  //! Classifies the point by BRepClass_FClassifier.
+  //! The face explorer is created once and reused by classifications,
+  //! but only by one at a time: a classification running concurrently
+  //! with another one builds its own temporary explorer instead of
+  //! waiting, so that threads sharing the classifier are not serialized.
+  TopAbs_State classifyByExplorer (const gp_Pnt2d&     thePnt,
+                                   const Standard_Real theTol) const;
+
 private:
 
   BRepTopAdaptor_SeqOfPtr TabClass;
@@ -85,6 +98,7 @@ private:
   Standard_Boolean myIsHole;
 
   mutable std::unique_ptr<BRepClass_FaceExplorer> myFExplorer;
+  mutable Standard_Mutex myFExplorerMutex; //!< Marks the cached face explorer as busy (see classifyByExplorer())
 
 };
 
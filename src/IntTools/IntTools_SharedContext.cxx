@@ -0,0 +1,160 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <IntTools_SharedContext.hxx>
+
+#include <Bnd_Box.hxx>
+#include <Bnd_OBB.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <IntTools_FClass2d.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(IntTools_SharedContext, Standard_Transient)
+
+namespace
+{
+  //! Builder of the 2D point classifier of the face.
+  struct FClass2dBuilder
+  {
+    IntTools_FClass2d* operator() (const TopoDS_Shape& theShape) const
+    {
+      TopoDS_Face aF = TopoDS::Face (theShape);
+      aF.Orientation (TopAbs_FORWARD);
+      return new IntTools_FClass2d (aF, BRep_Tool::Tolerance (aF));
+    }
+  };
+
+  //! Builder of the bounding box of the shape.
+  struct BndBoxBuilder
+  {
+    Bnd_Box* operator() (const TopoDS_Shape& theShape) const
+    {
+      Bnd_Box* aBox = new Bnd_Box();
+      BRepBndLib::Add (theShape, *aBox);
+      return aBox;
+    }
+  };
+
+  //! Builder of the oriented bounding box of the shape.
+  struct OBBBuilder
+  {
+    OBBBuilder (const Standard_Real theGap) : myGap (theGap) {}
+
+    Bnd_OBB* operator() (const TopoDS_Shape& theShape) const
+    {
+      Bnd_OBB* aBox = new Bnd_OBB();
+      BRepBndLib::AddOBB (theShape, *aBox);
+      aBox->Enlarge (myGap);
+      return aBox;
+    }
+
+    Standard_Real myGap;
+  };
+}
+
+//=======================================================================
+//function : ~ConcurrentMap
+//purpose  :
+//=======================================================================
+template<class TheTool>
+IntTools_SharedContext::ConcurrentMap<TheTool>::~ConcurrentMap()
+{
+  for (Standard_Integer i = 0; i < NbShards; ++i)
+  {
+    typename NCollection_DataMap<TopoDS_Shape, Entry*, TopTools_ShapeMapHasher>::Iterator anIt (myShards[i].Map);
+    for (; anIt.More(); anIt.Next())
+    {
+      Entry* anEntry = anIt.Value();
+      delete anEntry->Tool;
+      delete anEntry;
+    }
+  }
+}
+
+//=======================================================================
+//function : FindOrBuild
+//purpose  :
+//=======================================================================
+template<class TheTool>
+template<class TheBuilder>
+TheTool& IntTools_SharedContext::ConcurrentMap<TheTool>::FindOrBuild
+  (const TopoDS_Shape& theShape, const TheBuilder& theBuilder)
+{
+  Shard& aShard = myShards[TopTools_ShapeMapHasher()(theShape) % NbShards];
+
+  // Find or add the entry for the shape under the lock of the shard
+  Entry* anEntry = NULL;
+  {
+    Standard_Mutex::Sentry aShardLock (aShard.Mutex);
+    if (!aShard.Map.Find (theShape, anEntry))
+    {
+      anEntry = new Entry();
+      aShard.Map.Bind (theShape, anEntry);
+    }
+  }
+
+  // Build the tool under the lock of the entry, so that the other
+  // threads requesting the same tool wait for its construction
+  Standard_Mutex::Sentry anEntryLock (anEntry->Mutex);
+  if (anEntry->Tool == NULL)
+  {
+    anEntry->Tool = theBuilder (theShape);
+  }
+  return *anEntry->Tool;
+}
+
+//=======================================================================
+//function : IntTools_SharedContext
+//purpose  :
+//=======================================================================
+IntTools_SharedContext::IntTools_SharedContext()
+{
+}
+
+//=======================================================================
+//function : ~IntTools_SharedContext
+//purpose  :
+//=======================================================================
+IntTools_SharedContext::~IntTools_SharedContext()
+{
+}
+
+//=======================================================================
+//function : FClass2d
+//purpose  :
+//=======================================================================
+IntTools_FClass2d& IntTools_SharedContext::FClass2d (const TopoDS_Face& theFace)
+{
+  return myFClass2dMap.FindOrBuild (theFace, FClass2dBuilder());
+}
+
+//=======================================================================
+//function : BndBox
+//purpose  :
+//=======================================================================
+Bnd_Box& IntTools_SharedContext::BndBox (const TopoDS_Shape& theShape)
+{
+  return myBndBoxMap.FindOrBuild (theShape, BndBoxBuilder());
+}
+
+//=======================================================================
+//function : OBB
+//purpose  :
+//=======================================================================
+Bnd_OBB& IntTools_SharedContext::OBB (const TopoDS_Shape& theShape,
+                                      const Standard_Real theGap)
+{
+  return myOBBMap.FindOrBuild (theShape, OBBBuilder (theGap));
+}
@@ -0,0 +1,121 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _IntTools_SharedContext_HeaderFile
+#define _IntTools_SharedContext_HeaderFile
+
+#include <NCollection_DataMap.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_Transient.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+class Bnd_Box;
+class Bnd_OBB;
+class IntTools_FClass2d;
+class TopoDS_Face;
+
+DEFINE_STANDARD_HANDLE(IntTools_SharedContext, Standard_Transient)
+
+//! Thread-safe storage of the tools of the intersection Context (IntTools_Context),
+//! which are not modified by their usage and thus may be shared between the Contexts
+//! of all threads performing the same algorithm:
+//! - 2D point classifiers of the faces (IntTools_FClass2d);
+//! - Bounding boxes of the shapes (Bnd_Box);
+//! - Oriented bounding boxes of the shapes (Bnd_OBB).
+//!
+//! Each tool is built only once, by the first thread requesting it, while the other threads
+//! requesting the same tool wait for its construction. The tools for different shapes are built
+//! concurrently. The maps of the tools are split on several independently locked shards
+//! to reduce the contention of the threads.
+//!
+//! The tools keeping the state of the last query (projectors, solid classifiers, hatchers
+//! and surface adaptors) remain separate for each Context.
+class IntTools_SharedContext : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(IntTools_SharedContext, Standard_Transient)
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT IntTools_SharedContext();
+
+  //! Destructor.
+  Standard_EXPORT virtual ~IntTools_SharedContext();
+
+  //! Returns the 2D point classifier for the face built with the tolerance of the face.
+  Standard_EXPORT IntTools_FClass2d& FClass2d (const TopoDS_Face& theFace);
+
+  //! Returns the bounding box of the shape.
+  Standard_EXPORT Bnd_Box& BndBox (const TopoDS_Shape& theShape);
+
+  //! Returns the oriented bounding box of the shape enlarged by the given gap.
+  //! The gap is taken into account on the first request for the shape only.
+  Standard_EXPORT Bnd_OBB& OBB (const TopoDS_Shape& theShape,
+                                const Standard_Real theGap);
+
+private:
+
+  //! Concurrent map of the tools built for the shapes.
+  template<class TheTool>
+  class ConcurrentMap
+  {
+  public:
+
+    //! Number of independently locked shards of the map.
+    static const Standard_Integer NbShards = 64;
+
+    //! Constructor.
+    ConcurrentMap() {}
+
+    //! Destructor, removes all tools.
+    ~ConcurrentMap();
+
+    //! Returns the tool for the shape building it by the given builder
+    //! if it has not been built yet.
+    template<class TheBuilder>
+    TheTool& FindOrBuild (const TopoDS_Shape& theShape, const TheBuilder& theBuilder);
+
+  private:
+
+    ConcurrentMap (const ConcurrentMap&);
+    ConcurrentMap& operator= (const ConcurrentMap&);
+
+  private:
+
+    //! Entry of the map, locked during the construction of the tool.
+    struct Entry
+    {
+      Standard_Mutex Mutex;
+      TheTool*       Tool;
+
+      Entry() : Tool (NULL) {}
+    };
+
+    //! Shard of the map.
+    struct Shard
+    {
+      Standard_Mutex Mutex;
+      NCollection_DataMap<TopoDS_Shape, Entry*, TopTools_ShapeMapHasher> Map;
+    };
+
+    Shard myShards[NbShards];
+  };
+
+private:
+
+  ConcurrentMap<IntTools_FClass2d> myFClass2dMap; //!< 2D point classifiers of the faces
+  ConcurrentMap<Bnd_Box>           myBndBoxMap;   //!< Bounding boxes of the shapes
+  ConcurrentMap<Bnd_OBB>           myOBBMap;      //!< Oriented bounding boxes of the shapes
+
+};
+
+#endif // _IntTools_SharedContext_HeaderFile
@@ -18,6 +18,7 @@
 
 #include <Interface_FileParameter.hxx>
 #include <Interface_FileReaderData.hxx>
+#include <Interface_FloatConverter.hxx>
 #include <Interface_ParamList.hxx>
 #include <Interface_ParamSet.hxx>
 #include <Standard_ErrorHandler.hxx>
@@ -31,12 +32,9 @@ IMPLEMENT_STANDARD_RTTIEXT(Interface_FileReaderData,Standard_Transient)
 //  Chaque norme peut s en servir comme base (listes de parametres litteraux,
 //  entites associees) et y ajoute ses donnees propres.
 //  Travaille sous le controle de FileReaderTool
-//  Optimisation : Champs pas possibles, car Param est const. Dommage
-//  Donc, on suppose qu on lit un fichier a la fois (hypothese raisonnable)
-//  On note en champ un numero de fichier, par rapport auquel on optimise
-static Standard_Integer thefic = 0;
-static Standard_Integer thenm0 = -1;
-static Standard_Integer thenp0 = -1;
+//  Param() and ChangeParam() do not cache anything (not even in static
+//  variables), so that several files or several records of one file
+//  can be read concurrently from different threads
 
 
 Interface_FileReaderData::Interface_FileReaderData (const Standard_Integer nbr,
@@ -45,8 +43,6 @@ Interface_FileReaderData::Interface_FileReaderData (const Standard_Integer nbr,
 {
   theparams = new Interface_ParamSet (npar);
   thenumpar.Init(0);
-  thenm0 = -1;
-  thenum0 = ++thefic;
 }
 
     Standard_Integer Interface_FileReaderData::NbRecords () const
@@ -117,17 +113,13 @@ Interface_FileReaderData::Interface_FileReaderData (const Standard_Integer nbr,
     const Interface_FileParameter& Interface_FileReaderData::Param
   (const Standard_Integer num, const Standard_Integer nump) const
 {
-  if (thefic != thenum0) return theparams->Param(thenumpar(num-1)+nump);
-  if (thenm0 != num) {  thenp0 = thenumpar(num-1);  thenm0 = num;  }
-  return theparams->Param (thenp0+nump);
+  return theparams->Param (thenumpar(num-1)+nump);
 }
 
     Interface_FileParameter& Interface_FileReaderData::ChangeParam
   (const Standard_Integer num, const Standard_Integer nump)
 {
-  if (thefic != thenum0) return theparams->ChangeParam(thenumpar(num-1)+nump);
-  if (thenm0 != num) {  thenp0 = thenumpar(num-1);  thenm0 = num;  }
-  return theparams->ChangeParam (thenp0+nump);
+  return theparams->ChangeParam (thenumpar(num-1)+nump);
 }
 
     Interface_ParamType Interface_FileReaderData::ParamType
@@ -241,5 +233,5 @@ void Interface_FileReaderData::Destroy ()
 
 Standard_Real Interface_FileReaderData::Fastof (const Standard_CString ligne)
 {
-  return Strtod (ligne, 0);
+  return Interface_FloatConverter::Read (ligne);
 }
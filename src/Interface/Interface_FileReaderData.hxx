@@ -206,7 +206,6 @@ protected:
 private:
 
 
-  Standard_Integer thenum0;
   Standard_Integer therrload;
   Handle(Interface_ParamSet) theparams;
   TColStd_Array1OfInteger thenumpar;
@@ -0,0 +1,715 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Interface_FloatConverter.hxx>
+
+#include <Standard_CString.hxx>
+
+#include <cfloat>
+#include <cstring>
+#include <vector>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+  #include <intrin.h>
+#endif
+
+namespace
+{
+  typedef unsigned long long Interface_UInt64;
+
+  //! Range of decimal exponents of the table of powers of five.
+  //! The negative bound covers the smallest subnormal numbers,
+  //! the positive one covers the needs of the shortest digits algorithm.
+  static const int THE_POW5_MIN = -342;
+  static const int THE_POW5_MAX = 325;
+
+  //! Greatest decimal exponent which can give a finite value.
+  static const int THE_POW10_MAX = 308;
+
+  //! Computes the 128-bit product of two 64-bit integers.
+  inline Interface_UInt64 multiply128 (const Interface_UInt64 theA,
+                                       const Interface_UInt64 theB,
+                                       Interface_UInt64& theHigh)
+  {
+  #if defined(__SIZEOF_INT128__)
+    const unsigned __int128 aProd = (unsigned __int128 )theA * theB;
+    theHigh = (Interface_UInt64 )(aProd >> 64);
+    return (Interface_UInt64 )aProd;
+  #elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128 (theA, theB, &theHigh);
+  #else
+    const Interface_UInt64 aALo = theA & 0xFFFFFFFFull, aAHi = theA >> 32;
+    const Interface_UInt64 aBLo = theB & 0xFFFFFFFFull, aBHi = theB >> 32;
+    const Interface_UInt64 aLL = aALo * aBLo, aLH = aALo * aBHi;
+    const Interface_UInt64 aHL = aAHi * aBLo, aHH = aAHi * aBHi;
+    const Interface_UInt64 aMid = (aLL >> 32) + (aLH & 0xFFFFFFFFull) + (aHL & 0xFFFFFFFFull);
+    theHigh = aHH + (aLH >> 32) + (aHL >> 32) + (aMid >> 32);
+    return (aMid << 32) | (aLL & 0xFFFFFFFFull);
+  #endif
+  }
+
+  //! Returns the number of leading zero bits of a non-zero 64-bit integer.
+  inline int leadingZeros (Interface_UInt64 theValue)
+  {
+    int aNb = 0;
+    if ((theValue >> 32) == 0) { aNb += 32; theValue <<= 32; }
+    if ((theValue >> 48) == 0) { aNb += 16; theValue <<= 16; }
+    if ((theValue >> 56) == 0) { aNb +=  8; theValue <<=  8; }
+    if ((theValue >> 60) == 0) { aNb +=  4; theValue <<=  4; }
+    if ((theValue >> 62) == 0) { aNb +=  2; theValue <<=  2; }
+    if ((theValue >> 63) == 0) { aNb +=  1; }
+    return aNb;
+  }
+
+  //! Returns the double having given bit representation.
+  inline double bitsToDouble (const Interface_UInt64 theBits)
+  {
+    double aValue = 0.0;
+    memcpy (&aValue, &theBits, sizeof(aValue));
+    return aValue;
+  }
+
+  //! Returns the bit representation of a double.
+  inline Interface_UInt64 doubleToBits (const double theValue)
+  {
+    Interface_UInt64 aBits = 0;
+    memcpy (&aBits, &theValue, sizeof(aBits));
+    return aBits;
+  }
+
+  //! Simple unsigned big integer (32-bit words, least significant first),
+  //! enough to compute the table of powers of five once.
+  class Interface_BigNum
+  {
+  public:
+    Interface_BigNum (const unsigned int theValue) : myWords (1, theValue) {}
+
+    //! Multiplies by a small factor.
+    void Multiply (const unsigned int theFactor)
+    {
+      Interface_UInt64 aCarry = 0;
+      for (size_t i = 0; i < myWords.size(); ++i)
+      {
+        const Interface_UInt64 aProd = (Interface_UInt64 )myWords[i] * theFactor + aCarry;
+        myWords[i] = (unsigned int )aProd;
+        aCarry = aProd >> 32;
+      }
+      if (aCarry != 0)
+      {
+        myWords.push_back ((unsigned int )aCarry);
+      }
+    }
+
+    //! Returns the number of significant bits.
+    int NbBits() const
+    {
+      int aNb = 0;
+      for (unsigned int aTop = myWords.back(); aTop != 0; aTop >>= 1)
+      {
+        ++aNb;
+      }
+      return int(myWords.size() - 1) * 32 + aNb;
+    }
+
+    //! Returns the bit at given position.
+    bool Bit (const int theIndex) const
+    {
+      const size_t aWord = size_t(theIndex / 32);
+      return aWord < myWords.size() && ((myWords[aWord] >> (theIndex % 32)) & 1u) != 0;
+    }
+
+    //! Sets the bit at given position (the number must be long enough).
+    void SetBit (const int theIndex)
+    {
+      const size_t aWord = size_t(theIndex / 32);
+      if (aWord >= myWords.size())
+      {
+        myWords.resize (aWord + 1, 0u);
+      }
+      myWords[aWord] |= 1u << (theIndex % 32);
+    }
+
+    //! Multiplies by two.
+    void Double()
+    {
+      unsigned int aCarry = 0;
+      for (size_t i = 0; i < myWords.size(); ++i)
+      {
+        const unsigned int aNext = myWords[i] >> 31;
+        myWords[i] = (myWords[i] << 1) | aCarry;
+        aCarry = aNext;
+      }
+      if (aCarry != 0)
+      {
+        myWords.push_back (aCarry);
+      }
+    }
+
+    //! Compares with another number.
+    bool IsLess (const Interface_BigNum& theOther) const
+    {
+      const size_t aNb = myWords.size() > theOther.myWords.size() ? myWords.size() : theOther.myWords.size();
+      for (size_t i = aNb; i > 0; --i)
+      {
+        const unsigned int aWord1 = i <= myWords.size() ? myWords[i - 1] : 0u;
+        const unsigned int aWord2 = i <= theOther.myWords.size() ? theOther.myWords[i - 1] : 0u;
+        if (aWord1 != aWord2)
+        {
+          return aWord1 < aWord2;
+        }
+      }
+      return false;
+    }
+
+    //! Subtracts a number which is not greater than this one.
+    void Subtract (const Interface_BigNum& theOther)
+    {
+      long long aBorrow = 0;
+      for (size_t i = 0; i < myWords.size(); ++i)
+      {
+        long long aDiff = (long long )myWords[i] - aBorrow
+                        - (i < theOther.myWords.size() ? (long long )theOther.myWords[i] : 0);
+        aBorrow = 0;
+        if (aDiff < 0)
+        {
+          aDiff += 0x100000000ll;
+          aBorrow = 1;
+        }
+        myWords[i] = (unsigned int )aDiff;
+      }
+      while (myWords.size() > 1 && myWords.back() == 0)
+      {
+        myWords.pop_back();
+      }
+    }
+
+  private:
+    std::vector<unsigned int> myWords;
+  };
+
+  //! Table of 128-bit approximations of powers of five.
+  //! For each exponent Q the value 5^Q * 2^(-Shift) lies in [Value, Value + 1),
+  //! the Value being normalized within [2^127, 2^128).
+  class Interface_PowersOfFive
+  {
+  public:
+
+    //! Returns the table, computed on first call.
+    static const Interface_PowersOfFive& Get()
+    {
+      static const Interface_PowersOfFive THE_TABLE;
+      return THE_TABLE;
+    }
+
+    Interface_UInt64 High  (const int theExp) const { return myHigh [theExp - THE_POW5_MIN]; }
+    Interface_UInt64 Low   (const int theExp) const { return myLow  [theExp - THE_POW5_MIN]; }
+    int              Shift (const int theExp) const { return myShift[theExp - THE_POW5_MIN]; }
+
+  private:
+
+    Interface_PowersOfFive()
+    {
+      Interface_BigNum aPow5 (1u);
+      for (int aN = 0; aN <= -THE_POW5_MIN; ++aN)
+      {
+        if (aN > 0)
+        {
+          aPow5.Multiply (5u);
+        }
+        const int aNbBits = aPow5.NbBits();
+        if (aN <= THE_POW5_MAX)
+        {
+          // 5^N truncated to its 128 most significant bits
+          Interface_UInt64 aBits[2] = { 0, 0 };
+          for (int aBit = 0; aBit < 128; ++aBit)
+          {
+            const int aSrc = aNbBits - 128 + aBit;
+            if (aSrc >= 0 && aPow5.Bit (aSrc))
+            {
+              aBits[aBit / 64] |= 1ull << (aBit % 64);
+            }
+          }
+          set (aN, aBits[1], aBits[0], aNbBits - 128);
+        }
+        if (aN > 0)
+        {
+          // floor (2^(NbBits + 127) / 5^N) by binary long division
+          Interface_BigNum aRem (0u);
+          aRem.SetBit (aNbBits - 1);
+          Interface_UInt64 aHigh = 0, aLow = 0;
+          for (int aBit = 0; aBit < 128; ++aBit)
+          {
+            aRem.Double();
+            aHigh = (aHigh << 1) | (aLow >> 63);
+            aLow <<= 1;
+            if (!aRem.IsLess (aPow5))
+            {
+              aRem.Subtract (aPow5);
+              aLow |= 1;
+            }
+          }
+          set (-aN, aHigh, aLow, -(aNbBits + 127));
+        }
+      }
+    }
+
+    void set (const int theExp, const Interface_UInt64 theHigh, const Interface_UInt64 theLow, const int theShift)
+    {
+      myHigh [theExp - THE_POW5_MIN] = theHigh;
+      myLow  [theExp - THE_POW5_MIN] = theLow;
+      myShift[theExp - THE_POW5_MIN] = theShift;
+    }
+
+  private:
+    Interface_UInt64 myHigh [THE_POW5_MAX - THE_POW5_MIN + 1];
+    Interface_UInt64 myLow  [THE_POW5_MAX - THE_POW5_MIN + 1];
+    int              myShift[THE_POW5_MAX - THE_POW5_MIN + 1];
+  };
+
+  //! Exact powers of ten representable by double.
+  static const double THE_POW10[23] =
+  {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+  //! Computes the double nearest to theDigits * 10^theExp10.
+  //! Returns false if it cannot be decided without big number arithmetic.
+  static bool computeReal (const Interface_UInt64 theDigits,
+                           const int              theExp10,
+                           const bool             theIsNegative,
+                           double&                theValue)
+  {
+    if (theDigits == 0)
+    {
+      theValue = theIsNegative ? -0.0 : 0.0;
+      return true;
+    }
+
+  #if !defined(FLT_EVAL_METHOD) || (FLT_EVAL_METHOD == 0)
+    // both operands are exact, so the single rounding gives the correct result
+    if (theDigits <= (1ull << 53) && theExp10 >= -22 && theExp10 <= 22)
+    {
+      const double aDigits = double(theDigits);
+      theValue = theExp10 < 0 ? aDigits / THE_POW10[-theExp10] : aDigits * THE_POW10[theExp10];
+      if (theIsNegative)
+      {
+        theValue = -theValue;
+      }
+      return true;
+    }
+  #endif
+
+    if (theExp10 < THE_POW5_MIN || theExp10 > THE_POW10_MAX)
+    {
+      return false;
+    }
+
+    // multiply normalized digits by approximation of 5^Exp10 (which is smaller by less than 1 unit
+    // of its lowest bit), so the 192-bit product underestimates the exact one by less than 2^64;
+    // the lowest word of the product is not needed for deciding the rounding
+    const Interface_PowersOfFive& aTable = Interface_PowersOfFive::Get();
+    const int aLeadZeros = leadingZeros (theDigits);
+    const Interface_UInt64 aDigits = theDigits << aLeadZeros;
+    Interface_UInt64 aHighHigh = 0, aLowHigh = 0;
+    const Interface_UInt64 aHighLow = multiply128 (aDigits, aTable.High (theExp10), aHighHigh);
+    multiply128 (aDigits, aTable.Low (theExp10), aLowHigh);
+    const Interface_UInt64 aProd1 = aHighLow + aLowHigh;
+    const Interface_UInt64 aProd2 = aHighHigh + (aProd1 < aHighLow ? 1 : 0);
+
+    // the product is within [2^190, 2^192); keep 53 bits of mantissa from its highest word
+    const int aShift = int(aProd2 >> 63) + 10;
+    Interface_UInt64 aMantissa = aProd2 >> aShift;
+    const Interface_UInt64 aRest = aProd2 & ((1ull << aShift) - 1);
+    const Interface_UInt64 aHalf = 1ull << (aShift - 1);
+    if (aRest < aHalf)
+    {
+      // the exact remainder may reach the half only when adding the error carries into the rest
+      if (aRest == aHalf - 1 && aProd1 == ~0ull)
+      {
+        return false;
+      }
+    }
+    else if (aRest > aHalf || aProd1 != 0)
+    {
+      // the exact remainder is above the half, unless it may carry over the mantissa
+      if (aRest == (1ull << aShift) - 1 && aProd1 == ~0ull)
+      {
+        return false;
+      }
+      ++aMantissa;
+    }
+    else
+    {
+      // may be a tie
+      return false;
+    }
+
+    int aBinExp = aShift + 128 + aTable.Shift (theExp10) + theExp10 - aLeadZeros;
+    if (aMantissa == (1ull << 53))
+    {
+      aMantissa >>= 1;
+      ++aBinExp;
+    }
+    const int aBiasedExp = aBinExp + 52 + 1023;
+    if (aBiasedExp < 1 || aBiasedExp > 2046)
+    {
+      // subnormal or overflow
+      return false;
+    }
+
+    Interface_UInt64 aBits = ((Interface_UInt64 )aBiasedExp << 52) | (aMantissa & ((1ull << 52) - 1));
+    if (theIsNegative)
+    {
+      aBits |= 1ull << 63;
+    }
+    theValue = bitsToDouble (aBits);
+    return true;
+  }
+
+  //! Returns (theValue * theMul) >> theShift, theMul being given by two 64-bit words, theShift > 64.
+  inline Interface_UInt64 multiplyShift (const Interface_UInt64  theValue,
+                                         const Interface_UInt64* theMul,
+                                         const int               theShift)
+  {
+    Interface_UInt64 aHigh1 = 0, aHigh0 = 0;
+    const Interface_UInt64 aLow1 = multiply128 (theValue, theMul[1], aHigh1);
+    multiply128 (theValue, theMul[0], aHigh0);
+    const Interface_UInt64 aSum = aHigh0 + aLow1;
+    if (aSum < aHigh0)
+    {
+      ++aHigh1;
+    }
+    const int aDist = theShift - 64;
+    return aDist == 0 ? aSum : ((aHigh1 << (64 - aDist)) | (aSum >> aDist));
+  }
+
+  //! Returns the number of bits of 5^theExp (1 for zero exponent).
+  inline int pow5Bits (const int theExp)
+  {
+    return int(((unsigned int )theExp * 1217359u) >> 19) + 1;
+  }
+
+  //! Returns floor (log10 (2^theExp)).
+  inline int log10Pow2 (const int theExp)
+  {
+    return int(((unsigned int )theExp * 78913u) >> 18);
+  }
+
+  //! Returns floor (log10 (5^theExp)).
+  inline int log10Pow5 (const int theExp)
+  {
+    return int(((unsigned int )theExp * 732923u) >> 20);
+  }
+
+  //! Returns true if the value is divisible by 5^thePower.
+  inline bool isMultipleOfPow5 (Interface_UInt64 theValue, const int thePower)
+  {
+    int aCount = 0;
+    for (; theValue % 5 == 0; theValue /= 5)
+    {
+      if (++aCount >= thePower)
+      {
+        return true;
+      }
+    }
+    return aCount >= thePower;
+  }
+
+  //! Returns true if the value is divisible by 2^thePower.
+  inline bool isMultipleOfPow2 (const Interface_UInt64 theValue, const int thePower)
+  {
+    return (theValue & ((1ull << thePower) - 1)) == 0;
+  }
+}
+
+//=======================================================================
+//function : Read
+//purpose  :
+//=======================================================================
+Standard_Real Interface_FloatConverter::Read (const char* theStr, char** theNextPtr)
+{
+  const char* aPos = theStr;
+  bool isNegative = false;
+  if (*aPos == '-' || *aPos == '+')
+  {
+    isNegative = (*aPos == '-');
+    ++aPos;
+  }
+  if (aPos[0] == '0' && (aPos[1] == 'x' || aPos[1] == 'X'))
+  {
+    // hexadecimal notation
+    return Strtod (theStr, theNextPtr);
+  }
+
+  // collect up to 19 significant digits; longer numbers are left to Strtod()
+  Interface_UInt64 aDigits = 0;
+  int aNbDigits = 0;
+  int anExp10 = 0;
+  bool hasDigits = false;
+  for (; *aPos >= '0' && *aPos <= '9'; ++aPos)
+  {
+    hasDigits = true;
+    if (aNbDigits == 19)
+    {
+      return Strtod (theStr, theNextPtr);
+    }
+    aDigits = aDigits * 10 + (*aPos - '0');
+    if (aDigits != 0)
+    {
+      ++aNbDigits;
+    }
+  }
+  if (*aPos == '.')
+  {
+    for (++aPos; *aPos >= '0' && *aPos <= '9'; ++aPos)
+    {
+      hasDigits = true;
+      if (aNbDigits == 19)
+      {
+        return Strtod (theStr, theNextPtr);
+      }
+      aDigits = aDigits * 10 + (*aPos - '0');
+      if (aDigits != 0)
+      {
+        ++aNbDigits;
+      }
+      --anExp10;
+    }
+  }
+  if (!hasDigits)
+  {
+    // blanks, infinity, NaN or no number at all
+    return Strtod (theStr, theNextPtr);
+  }
+
+  if (*aPos == 'e' || *aPos == 'E')
+  {
+    const char* anExpPos = aPos + 1;
+    bool isNegExp = false;
+    if (*anExpPos == '-' || *anExpPos == '+')
+    {
+      isNegExp = (*anExpPos == '-');
+      ++anExpPos;
+    }
+    if (*anExpPos >= '0' && *anExpPos <= '9')
+    {
+      int anExp = 0;
+      for (; *anExpPos >= '0' && *anExpPos <= '9'; ++anExpPos)
+      {
+        if (anExp < 100000)
+        {
+          anExp = anExp * 10 + (*anExpPos - '0');
+        }
+      }
+      anExp10 += isNegExp ? -anExp : anExp;
+      aPos = anExpPos;
+    }
+  }
+
+  double aValue = 0.0;
+  if (!computeReal (aDigits, anExp10, isNegative, aValue))
+  {
+    return Strtod (theStr, theNextPtr);
+  }
+  if (theNextPtr != NULL)
+  {
+    *theNextPtr = (char* )aPos;
+  }
+  return aValue;
+}
+
+//=======================================================================
+//function : ShortestDigits
+//purpose  : Ryu algorithm: the interval of decimals rounding to the value
+//           is computed with 125-bit approximations of powers of five,
+//           then digits are removed while the interval allows it
+//=======================================================================
+Standard_Integer Interface_FloatConverter::ShortestDigits (const Standard_Real theValue,
+                                                           char* theDigits,
+                                                           Standard_Integer& theExponent)
+{
+  const Interface_UInt64 aBits = doubleToBits (theValue);
+  const Interface_UInt64 anIeeeMantissa = aBits & ((1ull << 52) - 1);
+  const int anIeeeExponent = int((aBits >> 52) & 0x7FF);
+  theExponent = 0;
+  if (anIeeeExponent == 0x7FF)
+  {
+    theDigits[0] = '\0';
+    return 0;
+  }
+  if (anIeeeExponent == 0 && anIeeeMantissa == 0)
+  {
+    theDigits[0] = '0';
+    theDigits[1] = '\0';
+    return 1;
+  }
+
+  int anExp2 = 0;
+  Interface_UInt64 aMant2 = 0;
+  if (anIeeeExponent == 0)
+  {
+    anExp2 = 1 - 1023 - 52 - 2;
+    aMant2 = anIeeeMantissa;
+  }
+  else
+  {
+    anExp2 = anIeeeExponent - 1023 - 52 - 2;
+    aMant2 = (1ull << 52) | anIeeeMantissa;
+  }
+  const bool isAcceptBounds = (aMant2 & 1) == 0;
+
+  // interval of values rounding to the given one: (4*m - 1 - shift, 4*m + 2) * 2^e2
+  const Interface_UInt64 aMv = 4 * aMant2;
+  const int aMmShift = (anIeeeMantissa != 0 || anIeeeExponent <= 1) ? 1 : 0;
+
+  const Interface_PowersOfFive& aTable = Interface_PowersOfFive::Get();
+  Interface_UInt64 aVr = 0, aVp = 0, aVm = 0;
+  int anExp10 = 0;
+  bool isVmTrailingZeros = false, isVrTrailingZeros = false;
+  if (anExp2 >= 0)
+  {
+    const int aQ = log10Pow2 (anExp2) - (anExp2 > 3 ? 1 : 0);
+    anExp10 = aQ;
+    const int aK = 125 + pow5Bits (aQ) - 1;
+    const int aShift = -anExp2 + aQ + aK;
+    // floor (2^(pow5bits + 124) / 5^q) + 1, derived from the 128-bit table
+    Interface_UInt64 aMul[2];
+    if (aQ == 0)
+    {
+      aMul[0] = 1;
+      aMul[1] = 1ull << 61;
+    }
+    else
+    {
+      aMul[0] = (aTable.Low (-aQ) >> 3) | (aTable.High (-aQ) << 61);
+      aMul[1] =  aTable.High (-aQ) >> 3;
+      if (++aMul[0] == 0)
+      {
+        ++aMul[1];
+      }
+    }
+    aVr = multiplyShift (aMv,                aMul, aShift);
+    aVp = multiplyShift (aMv + 2,            aMul, aShift);
+    aVm = multiplyShift (aMv - 1 - aMmShift, aMul, aShift);
+    if (aQ <= 21)
+    {
+      if (aMv % 5 == 0)
+      {
+        isVrTrailingZeros = isMultipleOfPow5 (aMv, aQ);
+      }
+      else if (isAcceptBounds)
+      {
+        isVmTrailingZeros = isMultipleOfPow5 (aMv - 1 - aMmShift, aQ);
+      }
+      else
+      {
+        aVp -= isMultipleOfPow5 (aMv + 2, aQ) ? 1 : 0;
+      }
+    }
+  }
+  else
+  {
+    const int aQ = log10Pow5 (-anExp2) - (-anExp2 > 1 ? 1 : 0);
+    anExp10 = aQ + anExp2;
+    const int anI = -anExp2 - aQ;
+    const int aK = pow5Bits (anI) - 125;
+    const int aShift = aQ - aK;
+    // 5^i truncated to 125 bits, derived from the 128-bit table
+    Interface_UInt64 aMul[2];
+    aMul[0] = (aTable.Low (anI) >> 3) | (aTable.High (anI) << 61);
+    aMul[1] =  aTable.High (anI) >> 3;
+    aVr = multiplyShift (aMv,                aMul, aShift);
+    aVp = multiplyShift (aMv + 2,            aMul, aShift);
+    aVm = multiplyShift (aMv - 1 - aMmShift, aMul, aShift);
+    if (aQ <= 1)
+    {
+      isVrTrailingZeros = true;
+      if (isAcceptBounds)
+      {
+        isVmTrailingZeros = (aMmShift == 1);
+      }
+      else
+      {
+        --aVp;
+      }
+    }
+    else if (aQ < 63)
+    {
+      isVrTrailingZeros = isMultipleOfPow2 (aMv, aQ);
+    }
+  }
+
+  // remove digits while the interval contains a shorter number
+  int aRemoved = 0;
+  int aLastRemoved = 0;
+  Interface_UInt64 anOutput = 0;
+  if (isVmTrailingZeros || isVrTrailingZeros)
+  {
+    while (aVp / 10 > aVm / 10)
+    {
+      isVmTrailingZeros &= (aVm % 10 == 0);
+      isVrTrailingZeros &= (aLastRemoved == 0);
+      aLastRemoved = int(aVr % 10);
+      aVr /= 10; aVp /= 10; aVm /= 10;
+      ++aRemoved;
+    }
+    if (isVmTrailingZeros)
+    {
+      while (aVm % 10 == 0)
+      {
+        isVrTrailingZeros &= (aLastRemoved == 0);
+        aLastRemoved = int(aVr % 10);
+        aVr /= 10; aVp /= 10; aVm /= 10;
+        ++aRemoved;
+      }
+    }
+    if (isVrTrailingZeros && aLastRemoved == 5 && aVr % 2 == 0)
+    {
+      // exact value is ...50..0, round to even
+      aLastRemoved = 4;
+    }
+    anOutput = aVr + (((aVr == aVm && (!isAcceptBounds || !isVmTrailingZeros)) || aLastRemoved >= 5) ? 1 : 0);
+  }
+  else
+  {
+    bool toRoundUp = false;
+    if (aVp / 100 > aVm / 100)
+    {
+      toRoundUp = (aVr % 100 >= 50);
+      aVr /= 100; aVp /= 100; aVm /= 100;
+      aRemoved += 2;
+    }
+    while (aVp / 10 > aVm / 10)
+    {
+      toRoundUp = (aVr % 10 >= 5);
+      aVr /= 10; aVp /= 10; aVm /= 10;
+      ++aRemoved;
+    }
+    anOutput = aVr + ((aVr == aVm || toRoundUp) ? 1 : 0);
+  }
+
+  char aBuffer[24];
+  int aNbDigits = 0;
+  for (; anOutput != 0; anOutput /= 10)
+  {
+    aBuffer[aNbDigits++] = char('0' + anOutput % 10);
+  }
+  for (int i = 0; i < aNbDigits; ++i)
+  {
+    theDigits[i] = aBuffer[aNbDigits - 1 - i];
+  }
+  theDigits[aNbDigits] = '\0';
+  theExponent = anExp10 + aRemoved;
+  return aNbDigits;
+}
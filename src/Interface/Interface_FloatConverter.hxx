@@ -0,0 +1,57 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Interface_FloatConverter_HeaderFile
+#define _Interface_FloatConverter_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Integer.hxx>
+#include <Standard_Real.hxx>
+
+//! Locale-independent conversion of reals between binary and decimal text,
+//! used by readers and writers of exchange files (STEP, IGES).
+//!
+//! Reading gives exactly the same (correctly rounded) value as Strtod().
+//! Numbers with up to 19 significant digits are converted by integer
+//! arithmetic on a 128-bit approximation of the power of ten (Eisel-Lemire method),
+//! the rare cases which cannot be decided this way are passed to Strtod().
+//!
+//! Writing computes the shortest sequence of decimal digits which is read back
+//! to exactly the same binary value (Ryu method).
+class Interface_FloatConverter
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Converts the text to a real value, with the same syntax and result as Strtod().
+  //! @param theStr     [in]  text to convert
+  //! @param theNextPtr [out] if not NULL, receives the pointer to the first character after the number
+  //! @return converted value
+  Standard_EXPORT static Standard_Real Read (const char* theStr, char** theNextPtr = NULL);
+
+  //! Computes the shortest decimal representation of a finite value,
+  //! so that the number <theDigits> * 10^<theExponent> is read back as <theValue>.
+  //! The sign of the value is ignored; the zero value gives a single digit '0'.
+  //! @param theValue    [in]  value to convert
+  //! @param theDigits   [out] buffer receiving the digits (at least 18 characters), null-terminated
+  //! @param theExponent [out] decimal exponent of the last digit
+  //! @return number of digits (at most 17), or 0 if the value is infinite or NaN
+  Standard_EXPORT static Standard_Integer ShortestDigits (const Standard_Real theValue,
+                                                          char* theDigits,
+                                                          Standard_Integer& theExponent);
+
+};
+
+#endif // _Interface_FloatConverter_HeaderFile
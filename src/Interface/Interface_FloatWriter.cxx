@@ -15,6 +15,10 @@
 
 #include <Interface_FloatWriter.hxx>
 
+#include <Interface_FloatConverter.hxx>
+
+#include <cmath>
+
 Interface_FloatWriter::Interface_FloatWriter (const Standard_Integer chars)
 {
   SetDefaults(chars);
@@ -26,6 +30,7 @@ Interface_FloatWriter::Interface_FloatWriter (const Standard_Integer chars)
   (const Standard_CString form, const Standard_Boolean reset)
 {
   strcpy(themainform,form);
+  theshortest = Standard_False;
   if (!reset) return;
   therange1 = therange2 = 0.;    // second form : inhibee
   thezerosup = Standard_False;
@@ -43,6 +48,9 @@ Interface_FloatWriter::Interface_FloatWriter (const Standard_Integer chars)
     void Interface_FloatWriter::SetZeroSuppress (const Standard_Boolean mode)
       {  thezerosup = mode;  }
 
+    void Interface_FloatWriter::SetShortestRoundTrip (const Standard_Boolean mode)
+      {  theshortest = mode;  }
+
     void Interface_FloatWriter::SetDefaults (const Standard_Integer chars)
 {
   if (chars <= 0) {
@@ -55,6 +63,7 @@ Interface_FloatWriter::Interface_FloatWriter (const Standard_Integer chars)
   }
   therange1 = 0.1; therange2 = 1000.;
   thezerosup = Standard_True;
+  theshortest = Standard_False;
 }
 
     void Interface_FloatWriter::Options
@@ -78,6 +87,8 @@ Interface_FloatWriter::Interface_FloatWriter (const Standard_Integer chars)
     Standard_Integer Interface_FloatWriter::Write
   (const Standard_Real val, const Standard_CString text) const
 {
+  if (theshortest)
+    return ConvertShortest (val,text,thezerosup,therange1,therange2);
   const Standard_CString mainform  = Standard_CString(themainform);
   const Standard_CString rangeform = Standard_CString(therangeform);
   return Convert
@@ -151,3 +162,72 @@ Standard_Integer Interface_FloatWriter::Convert (const Standard_Real val,
   }
   return (Standard_Integer)strlen(text);
 }
+
+//=======================================================================
+//function : ConvertShortest
+//purpose  : 
+//=======================================================================
+Standard_Integer Interface_FloatWriter::ConvertShortest (const Standard_Real val,
+							 const Standard_CString text,
+							 const Standard_Boolean zsup,
+							 const Standard_Real R1,
+							 const Standard_Real R2)
+{
+  char aDigits[24];
+  Standard_Integer anExp = 0;
+  const Standard_Integer aNbDigits = Interface_FloatConverter::ShortestDigits (val, aDigits, anExp);
+  if (aNbDigits == 0)
+    return Convert (val,text,zsup,R1,R2,"%E","%E");
+
+  // decimal exponent of the first digit
+  const Standard_Integer aPointExp = aNbDigits - 1 + anExp;
+  char* pText = (char *)text;
+  Standard_Integer aLen = 0;
+  if (std::signbit (val))
+    pText[aLen++] = '-';
+
+  if ( ((val >= R1 && val <  R2) || (val <= -R1 && val > -R2)) && aPointExp >= -5 && aPointExp <= 16 )
+  {
+    //  without exponent : digits are completed by zeros up to the decimal point
+    if (aPointExp >= 0)
+    {
+      for (Standard_Integer i = 0; i <= aPointExp; i ++)
+        pText[aLen++] = (i < aNbDigits ? aDigits[i] : '0');
+      pText[aLen++] = '.';
+      for (Standard_Integer i = aPointExp + 1; i < aNbDigits; i ++)
+        pText[aLen++] = aDigits[i];
+    }
+    else
+    {
+      pText[aLen++] = '0';
+      pText[aLen++] = '.';
+      for (Standard_Integer i = aPointExp + 1; i < 0; i ++)
+        pText[aLen++] = '0';
+      for (Standard_Integer i = 0; i < aNbDigits; i ++)
+        pText[aLen++] = aDigits[i];
+    }
+    pText[aLen] = '\0';
+    return aLen;
+  }
+
+  //  with exponent, at least 2 digits as produced by "%E"
+  pText[aLen++] = aDigits[0];
+  pText[aLen++] = '.';
+  for (Standard_Integer i = 1; i < aNbDigits; i ++)
+    pText[aLen++] = aDigits[i];
+  if (aPointExp != 0 || !zsup)
+  {
+    Standard_Integer anAbsExp = Abs (aPointExp);
+    pText[aLen++] = 'E';
+    pText[aLen++] = (aPointExp < 0 ? '-' : '+');
+    if (anAbsExp >= 100)
+    {
+      pText[aLen++] = char('0' + anAbsExp / 100);
+      anAbsExp %= 100;
+    }
+    pText[aLen++] = char('0' + anAbsExp / 10);
+    pText[aLen++] = char('0' + anAbsExp % 10);
+  }
+  pText[aLen] = '\0';
+  return aLen;
+}
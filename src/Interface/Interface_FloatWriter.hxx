@@ -72,6 +72,18 @@ public:
   //! Sets again options to the defaults given by Create
   Standard_EXPORT void SetDefaults (const Standard_Integer chars = 0);
   
+  //! Sets Sending Real Parameters with the shortest count of digits
+  //! which gives back exactly the same value when read, if <mode> is
+  //! given True. Formats are then not used, values in the range are
+  //! written without exponent, other ones with exponent; trailing
+  //! zeros are never written.
+  //! A call to SetFormat or SetDefaults resets this mode to False
+  //! (Default from Creation is False)
+  Standard_EXPORT void SetShortestRoundTrip (const Standard_Boolean mode);
+  
+  //! Returns True if the shortest round trip mode is set
+  Standard_Boolean IsShortestRoundTrip() const { return theshortest; }
+  
   //! Returns active options : <zerosup> is the option ZeroSuppress,
   //! <range> is True if a range is set, False else
   //! R1,R2 give the range (if it is set)
@@ -88,8 +100,8 @@ public:
   
   //! Writes a Real value <val> to a string <text> by using the
   //! options. Returns the useful Length of produced string.
-  //! It calls the class method Convert.
-  //! Warning : <text> is assumed to be wide enough (20-30 is correct)
+  //! It calls the class method Convert (or ConvertShortest).
+  //! Warning : <text> is assumed to be wide enough (25-30 is correct)
   //! And, even if declared in, its content will be modified
   Standard_EXPORT Standard_Integer Write (const Standard_Real val, const Standard_CString text) const;
   
@@ -97,6 +109,14 @@ public:
   //! options given as arguments. It can be called independently.
   //! Warning : even if declared in, content of <text> will be modified
   Standard_EXPORT static Standard_Integer Convert (const Standard_Real val, const Standard_CString text, const Standard_Boolean zerosup, const Standard_Real Range1, const Standard_Real Range2, const Standard_CString mainform, const Standard_CString rangeform);
+  
+  //! This class method converts a Real Value to the shortest string
+  //! which is read back as the same value (see SetShortestRoundTrip).
+  //! <zerosup> suppresses null exponent ("E+00"), values between
+  //! Range1 and Range2 (in absolute values) are written without exponent.
+  //! Infinite and NaN values are converted by Convert with "%E" format.
+  //! Warning : <text> is assumed to be at least 25 characters wide
+  Standard_EXPORT static Standard_Integer ConvertShortest (const Standard_Real val, const Standard_CString text, const Standard_Boolean zerosup, const Standard_Real Range1, const Standard_Real Range2);
 
 
 
@@ -116,6 +136,7 @@ private:
   Standard_Real therange2;
   Standard_Character therangeform[12];
   Standard_Boolean thezerosup;
+  Standard_Boolean theshortest;
 
 
 };
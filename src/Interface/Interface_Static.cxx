@@ -12,6 +12,7 @@
 // commercial license or contractual agreement.
 
 #include <Interface_Static.hxx>
+#include <Interface_StaticSnapshot.hxx>
 
 #include <OSD_Path.hxx>
 #include <Standard_Transient.hxx>
@@ -288,6 +289,10 @@ Standard_Integer  Interface_Static::IDef
 Standard_Boolean  Interface_Static::IsSet
   (const Standard_CString name, const Standard_Boolean proper)
 {
+  if (const Interface_StaticSnapshot* aSnapshot = Interface_StaticSnapshot::Active())
+  {
+    return aSnapshot->IsSet (name, proper);
+  }
   Handle(Interface_Static) item = Interface_Static::Static(name);
   if (item.IsNull()) return Standard_False;
   if (item->IsSetValue()) return Standard_True;
@@ -299,6 +304,10 @@ Standard_Boolean  Interface_Static::IsSet
 
 Standard_CString  Interface_Static::CVal  (const Standard_CString name)
 {
+  if (const Interface_StaticSnapshot* aSnapshot = Interface_StaticSnapshot::Active())
+  {
+    return aSnapshot->CVal (name);
+  }
   Handle(Interface_Static) item = Interface_Static::Static(name);
   if (item.IsNull()) {
 #ifdef OCCT_DEBUG
@@ -312,6 +321,10 @@ Standard_CString  Interface_Static::CVal  (const Standard_CString name)
 
 Standard_Integer  Interface_Static::IVal  (const Standard_CString name)
 {
+  if (const Interface_StaticSnapshot* aSnapshot = Interface_StaticSnapshot::Active())
+  {
+    return aSnapshot->IVal (name);
+  }
   Handle(Interface_Static) item = Interface_Static::Static(name);
   if (item.IsNull()) {
 #ifdef OCCT_DEBUG
@@ -325,6 +338,10 @@ Standard_Integer  Interface_Static::IVal  (const Standard_CString name)
 
 Standard_Real Interface_Static::RVal (const Standard_CString name)
 {
+  if (const Interface_StaticSnapshot* aSnapshot = Interface_StaticSnapshot::Active())
+  {
+    return aSnapshot->RVal (name);
+  }
   Handle(Interface_Static) item = Interface_Static::Static(name);
   if (item.IsNull()) {
 #ifdef OCCT_DEBUG
@@ -414,6 +431,12 @@ Handle(TColStd_HSequenceOfHAsciiString)  Interface_Static::Items
 //=======================================================================
 void Interface_Static::FillMap (NCollection_DataMap<TCollection_AsciiString, TCollection_AsciiString>& theMap)
 {
+  if (const Interface_StaticSnapshot* aSnapshot = Interface_StaticSnapshot::Active())
+  {
+    aSnapshot->FillMap (theMap);
+    return;
+  }
+
   theMap.Clear();
 
   NCollection_DataMap<TCollection_AsciiString, Handle(Standard_Transient)>& aMap = MoniTool_TypedValue::Stats();
@@ -169,6 +169,9 @@ public:
   //! parameter identified by the string name.
   //! If the specified parameter does not exist, an empty
   //! string is returned.
+  //! If a snapshot of parameters is active in the current thread
+  //! (see Interface_StaticSnapshot), the value is taken from it;
+  //! the same applies to IVal(), RVal(), IsSet() and FillMap().
   //! Example
   //! Interface_Static::CVal("write.step.schema");
   //! which could return:
@@ -0,0 +1,314 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Interface_StaticSnapshot.hxx>
+
+#include <Interface_Static.hxx>
+#include <TCollection_HAsciiString.hxx>
+#include <TColStd_HSequenceOfHAsciiString.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(Interface_StaticSnapshot, Standard_Transient)
+
+namespace
+{
+  //! Snapshot active in the current thread
+  static Standard_THREADLOCAL const Interface_StaticSnapshot* THE_ACTIVE_SNAPSHOT = NULL;
+
+  //! Deactivates the snapshot of the current thread for the lifetime of the object,
+  //! so that Interface_Static returns the global values of the Statics
+  //! not recorded in the snapshot (e.g. registered after it has been taken).
+  class GlobalValuesScope
+  {
+  public:
+    GlobalValuesScope() : myPrevious (THE_ACTIVE_SNAPSHOT) { THE_ACTIVE_SNAPSHOT = NULL; }
+    ~GlobalValuesScope() { THE_ACTIVE_SNAPSHOT = myPrevious; }
+  private:
+    GlobalValuesScope (const GlobalValuesScope&);
+    GlobalValuesScope& operator= (const GlobalValuesScope&);
+  private:
+    const Interface_StaticSnapshot* myPrevious;
+  };
+}
+
+//=======================================================================
+//function : Sentry
+//purpose  :
+//=======================================================================
+Interface_StaticSnapshot::Sentry::Sentry (const Handle(Interface_StaticSnapshot)& theSnapshot)
+: mySnapshot (theSnapshot),
+  myPrevious (THE_ACTIVE_SNAPSHOT)
+{
+  if (!mySnapshot.IsNull())
+  {
+    THE_ACTIVE_SNAPSHOT = mySnapshot.get();
+  }
+}
+
+//=======================================================================
+//function : ~Sentry
+//purpose  :
+//=======================================================================
+Interface_StaticSnapshot::Sentry::~Sentry()
+{
+  if (!mySnapshot.IsNull())
+  {
+    THE_ACTIVE_SNAPSHOT = myPrevious;
+  }
+}
+
+//=======================================================================
+//function : Interface_StaticSnapshot
+//purpose  :
+//=======================================================================
+Interface_StaticSnapshot::Interface_StaticSnapshot()
+{
+  // all the Statics: the ones of usual families, then the ones of families beginning by '$'
+  Handle(TColStd_HSequenceOfHAsciiString) aNames = Interface_Static::Items (0, "");
+  aNames->Append (Interface_Static::Items (0, "$"));
+  if (aNames->IsEmpty())
+  {
+    return;
+  }
+
+  myValues.Resize (1, aNames->Length(), Standard_False);
+  for (Standard_Integer anIndex = 1; anIndex <= aNames->Length(); ++anIndex)
+  {
+    Value& aValue = myValues.ChangeValue (anIndex);
+    aValue.Name = aNames->Value (anIndex)->String();
+
+    Handle(Interface_Static) aStatic = Interface_Static::Static (aValue.Name.ToCString());
+    aValue.CVal    = aStatic->CStringValue();
+    aValue.IVal    = aStatic->IntegerValue();
+    aValue.RVal    = aStatic->RealValue();
+    aValue.IsSet   = aStatic->IsSetValue();
+    aValue.HasText = !aStatic->HStringValue().IsNull();
+    if (!aStatic->Wild().IsNull())
+    {
+      aValue.Wild = aStatic->Wild()->Name();
+    }
+  }
+  updateIndices();
+}
+
+//=======================================================================
+//function : Interface_StaticSnapshot
+//purpose  :
+//=======================================================================
+Interface_StaticSnapshot::Interface_StaticSnapshot (const Handle(Interface_StaticSnapshot)& theOther)
+{
+  if (!theOther.IsNull() && !theOther->myValues.IsEmpty())
+  {
+    myValues.Resize (theOther->myValues.Lower(), theOther->myValues.Upper(), Standard_False);
+    myValues.Assign (theOther->myValues);
+  }
+  updateIndices();
+}
+
+//=======================================================================
+//function : updateIndices
+//purpose  :
+//=======================================================================
+void Interface_StaticSnapshot::updateIndices()
+{
+  myIndices.Clear();
+  if (myValues.IsEmpty())
+  {
+    return;
+  }
+
+  myIndices.ReSize (myValues.Length());
+  for (Standard_Integer anIndex = myValues.Lower(); anIndex <= myValues.Upper(); ++anIndex)
+  {
+    myIndices.Bind (myValues.Value (anIndex).Name.ToCString(), anIndex);
+  }
+}
+
+//=======================================================================
+//function : Active
+//purpose  :
+//=======================================================================
+const Interface_StaticSnapshot* Interface_StaticSnapshot::Active()
+{
+  return THE_ACTIVE_SNAPSHOT;
+}
+
+//=======================================================================
+//function : IsPresent
+//purpose  :
+//=======================================================================
+Standard_Boolean Interface_StaticSnapshot::IsPresent (const Standard_CString theName) const
+{
+  return find (theName) != NULL;
+}
+
+//=======================================================================
+//function : IsSet
+//purpose  :
+//=======================================================================
+Standard_Boolean Interface_StaticSnapshot::IsSet (const Standard_CString theName,
+                                                  const Standard_Boolean theProper) const
+{
+  const Value* aValue = find (theName);
+  if (aValue == NULL)
+  {
+    GlobalValuesScope aGlobalScope;
+    return Interface_Static::IsSet (theName, theProper);
+  }
+  if (aValue->IsSet)
+  {
+    return Standard_True;
+  }
+  if (theProper || aValue->Wild.IsEmpty())
+  {
+    return Standard_False;
+  }
+  const Value* aWild = find (aValue->Wild.ToCString());
+  return aWild != NULL && aWild->IsSet;
+}
+
+//=======================================================================
+//function : CVal
+//purpose  :
+//=======================================================================
+Standard_CString Interface_StaticSnapshot::CVal (const Standard_CString theName) const
+{
+  const Value* aValue = find (theName);
+  if (aValue == NULL)
+  {
+    GlobalValuesScope aGlobalScope;
+    return Interface_Static::CVal (theName);
+  }
+  return aValue->CVal.ToCString();
+}
+
+//=======================================================================
+//function : IVal
+//purpose  :
+//=======================================================================
+Standard_Integer Interface_StaticSnapshot::IVal (const Standard_CString theName) const
+{
+  const Value* aValue = find (theName);
+  if (aValue == NULL)
+  {
+    GlobalValuesScope aGlobalScope;
+    return Interface_Static::IVal (theName);
+  }
+  return aValue->IVal;
+}
+
+//=======================================================================
+//function : RVal
+//purpose  :
+//=======================================================================
+Standard_Real Interface_StaticSnapshot::RVal (const Standard_CString theName) const
+{
+  const Value* aValue = find (theName);
+  if (aValue == NULL)
+  {
+    GlobalValuesScope aGlobalScope;
+    return Interface_Static::RVal (theName);
+  }
+  return aValue->RVal;
+}
+
+//=======================================================================
+//function : setValue
+//purpose  :
+//=======================================================================
+template<typename TheSetter>
+Standard_Boolean Interface_StaticSnapshot::setValue (const Standard_CString theName,
+                                                     TheSetter theSetter)
+{
+  const Standard_Integer* anIndex = myIndices.Seek (theName);
+  if (anIndex == NULL)
+  {
+    return Standard_False;
+  }
+
+  // the global Static provides the definition (type, limits, enumeration) to check the value;
+  // its copy is modified so that the global value remains untouched
+  Handle(Interface_Static) aDefinition = Interface_Static::Static (theName);
+  if (aDefinition.IsNull())
+  {
+    return Standard_False;
+  }
+  Handle(Interface_Static) aStatic = new Interface_Static (aDefinition->Family(), theName, aDefinition);
+  if (!theSetter (aStatic))
+  {
+    return Standard_False;
+  }
+
+  Value& aValue = myValues.ChangeValue (*anIndex);
+  aValue.CVal    = aStatic->CStringValue();
+  aValue.IVal    = aStatic->IntegerValue();
+  aValue.RVal    = aStatic->RealValue();
+  aValue.IsSet   = aStatic->IsSetValue();
+  aValue.HasText = !aStatic->HStringValue().IsNull();
+  return Standard_True;
+}
+
+//=======================================================================
+//function : SetCVal
+//purpose  :
+//=======================================================================
+Standard_Boolean Interface_StaticSnapshot::SetCVal (const Standard_CString theName,
+                                                    const Standard_CString theValue)
+{
+  return setValue (theName, [theValue](const Handle(Interface_Static)& theStatic)
+  {
+    return theStatic->SetCStringValue (theValue);
+  });
+}
+
+//=======================================================================
+//function : SetIVal
+//purpose  :
+//=======================================================================
+Standard_Boolean Interface_StaticSnapshot::SetIVal (const Standard_CString theName,
+                                                    const Standard_Integer theValue)
+{
+  return setValue (theName, [theValue](const Handle(Interface_Static)& theStatic)
+  {
+    return theStatic->SetIntegerValue (theValue);
+  });
+}
+
+//=======================================================================
+//function : SetRVal
+//purpose  :
+//=======================================================================
+Standard_Boolean Interface_StaticSnapshot::SetRVal (const Standard_CString theName,
+                                                    const Standard_Real theValue)
+{
+  return setValue (theName, [theValue](const Handle(Interface_Static)& theStatic)
+  {
+    return theStatic->SetRealValue (theValue);
+  });
+}
+
+//=======================================================================
+//function : FillMap
+//purpose  :
+//=======================================================================
+void Interface_StaticSnapshot::FillMap (NCollection_DataMap<TCollection_AsciiString, TCollection_AsciiString>& theMap) const
+{
+  theMap.Clear();
+  for (NCollection_Array1<Value>::Iterator anIt (myValues); anIt.More(); anIt.Next())
+  {
+    const Value& aValue = anIt.Value();
+    if (aValue.HasText)
+    {
+      theMap.Bind (aValue.Name, aValue.CVal);
+    }
+  }
+}
@@ -0,0 +1,160 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Interface_StaticSnapshot_HeaderFile
+#define _Interface_StaticSnapshot_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <Standard_CStringHasher.hxx>
+#include <Standard_Transient.hxx>
+#include <TCollection_AsciiString.hxx>
+
+class Interface_StaticSnapshot;
+DEFINE_STANDARD_HANDLE(Interface_StaticSnapshot, Standard_Transient)
+
+//! Frozen copy of the values of all the Statics (translation parameters),
+//! which can be bound to a work session (see XSControl_WorkSession::SetParameters).
+//!
+//! While a snapshot is active in a thread (see class Sentry), the functions
+//! Interface_Static::CVal(), IVal(), RVal() and IsSet() called in this thread
+//! return the values recorded in the snapshot instead of the global ones.
+//! This allows translations with different parameters to run concurrently
+//! in different threads, without modification of the global values and without locking.
+//!
+//! A snapshot may be modified by SetCVal(), SetIVal() and SetRVal() only before
+//! it is made active; a snapshot which is in use should be copied instead.
+class Interface_StaticSnapshot : public Standard_Transient
+{
+public:
+
+  //! Activates a snapshot in the current thread for the lifetime of the sentry,
+  //! and restores the previously active one on destruction.
+  //! Does nothing if the snapshot is Null.
+  class Sentry
+  {
+  public:
+
+    //! Activates the snapshot in the current thread
+    Standard_EXPORT Sentry (const Handle(Interface_StaticSnapshot)& theSnapshot);
+
+    //! Restores the previously active snapshot
+    Standard_EXPORT ~Sentry();
+
+  private:
+
+    Sentry (const Sentry&);
+    Sentry& operator= (const Sentry&);
+
+  private:
+
+    Handle(Interface_StaticSnapshot) mySnapshot; //!< activated snapshot, kept alive while active
+    const Interface_StaticSnapshot*  myPrevious; //!< snapshot active before
+  };
+
+public:
+
+  //! Creates a snapshot of the current global values of all the Statics
+  Standard_EXPORT Interface_StaticSnapshot();
+
+  //! Creates a copy of another snapshot, which can then be modified
+  Standard_EXPORT Interface_StaticSnapshot (const Handle(Interface_StaticSnapshot)& theOther);
+
+  //! Returns the snapshot active in the current thread,
+  //! NULL if the global values of Statics are used
+  Standard_EXPORT static const Interface_StaticSnapshot* Active();
+
+  //! Returns True if a parameter <theName> is recorded
+  Standard_EXPORT Standard_Boolean IsPresent (const Standard_CString theName) const;
+
+  //! Returns True if the parameter <theName> is recorded AND set.
+  //! If <theProper> is False and the parameter is not set,
+  //! considers its wild-card (as Interface_Static::IsSet()).
+  //! A parameter not recorded in the snapshot (e.g. registered after the snapshot
+  //! has been taken) is checked among the global Statics.
+  Standard_EXPORT Standard_Boolean IsSet (const Standard_CString theName,
+                                          const Standard_Boolean theProper = Standard_True) const;
+
+  //! Returns the text value of the parameter.
+  //! The global value is returned for a parameter not recorded in the snapshot
+  Standard_EXPORT Standard_CString CVal (const Standard_CString theName) const;
+
+  //! Returns the integer value of the parameter (the case number for an enumeration).
+  //! The global value is returned for a parameter not recorded in the snapshot
+  Standard_EXPORT Standard_Integer IVal (const Standard_CString theName) const;
+
+  //! Returns the real value of the parameter.
+  //! The global value is returned for a parameter not recorded in the snapshot
+  Standard_EXPORT Standard_Real RVal (const Standard_CString theName) const;
+
+  //! Modifies the value of the parameter in this snapshot.
+  //! The value is checked against the definition of the global Static.
+  //! Returns False if the parameter does not exist or the value is not accepted
+  Standard_EXPORT Standard_Boolean SetCVal (const Standard_CString theName,
+                                            const Standard_CString theValue);
+
+  //! Modifies the integer value (or the case number of enumeration) of the parameter.
+  //! Returns False if the parameter does not exist or the value is not accepted
+  Standard_EXPORT Standard_Boolean SetIVal (const Standard_CString theName,
+                                            const Standard_Integer theValue);
+
+  //! Modifies the real value of the parameter.
+  //! Returns False if the parameter does not exist or the value is not accepted
+  Standard_EXPORT Standard_Boolean SetRVal (const Standard_CString theName,
+                                            const Standard_Real theValue);
+
+  //! Fills given string-to-string map with the recorded values which are set
+  //! (as Interface_Static::FillMap() does for the global values)
+  Standard_EXPORT void FillMap (NCollection_DataMap<TCollection_AsciiString, TCollection_AsciiString>& theMap) const;
+
+  DEFINE_STANDARD_RTTIEXT(Interface_StaticSnapshot, Standard_Transient)
+
+private:
+
+  //! Recorded value of one Static
+  struct Value
+  {
+    TCollection_AsciiString Name;     //!< name of the parameter, the key of the index map points to it
+    TCollection_AsciiString Wild;     //!< name of the wild-card, empty if none
+    TCollection_AsciiString CVal;     //!< text value
+    Standard_Integer        IVal;     //!< integer value
+    Standard_Real           RVal;     //!< real value
+    Standard_Boolean        IsSet;    //!< value is set
+    Standard_Boolean        HasText;  //!< value is defined as a text
+
+    Value() : IVal (0), RVal (0.0), IsSet (Standard_False), HasText (Standard_False) {}
+  };
+
+  //! Returns the recorded value, NULL if the parameter is not recorded
+  const Value* find (const Standard_CString theName) const
+  {
+    const Standard_Integer* anIndex = myIndices.Seek (theName);
+    return anIndex != NULL ? &myValues.Value (*anIndex) : NULL;
+  }
+
+  //! Fills the index map from the array of values
+  void updateIndices();
+
+  //! Records the value of the Static modified by the function,
+  //! applied to a copy of the global definition
+  template<typename TheSetter>
+  Standard_Boolean setValue (const Standard_CString theName, TheSetter theSetter);
+
+private:
+
+  NCollection_Array1<Value> myValues;
+  NCollection_DataMap<Standard_CString, Standard_Integer, Standard_CStringHasher> myIndices;
+
+};
+
+#endif // _Interface_StaticSnapshot_HeaderFile
@@ -21,12 +21,16 @@
 #include <BRep_Builder.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakePolygon.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepLib.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepMesh_MultiLODMesh.hxx>
+#include <BRepMesh_ShapeDecimator.hxx>
 #include <BRepTest.hxx>
+#include <BRepTest_DrawableHistory.hxx>
 #include <BRepTools.hxx>
 #include <CSLib.hxx>
 #include <DBRep.hxx>
@@ -35,10 +39,15 @@
 #include <Draw_Segment2D.hxx>
 #include <DrawTrSurf.hxx>
 #include <GeometryTest.hxx>
+#include <gp_Circ2d.hxx>
 #include <IMeshData_Status.hxx>
+#include <IMeshTools_MeshStatistics.hxx>
 #include <Message.hxx>
 #include <Message_ProgressRange.hxx>
+#include <math_BullardGenerator.hxx>
+#include <OSD_MemInfo.hxx>
 #include <OSD_OpenFile.hxx>
+#include <OSD_Timer.hxx>
 #include <Poly_MergeNodesTool.hxx>
 #include <Poly_TriangulationParameters.hxx>
 #include <Prs3d_Drawer.hxx>
@@ -47,7 +56,10 @@
 #include <BRep_TEdge.hxx>
 #include <TopExp.hxx> 
 
+#include <BRepMesh_CircleTool.hxx>
 #include <BRepMesh_Context.hxx>
+#include <BRepMesh_DataStructureOfDelaun.hxx>
+#include <BRepMesh_Delaun.hxx>
 #include <BRepMesh_FaceDiscret.hxx>
 #include <BRepMesh_MeshAlgoFactory.hxx>
 #include <BRepMesh_DelabellaMeshAlgoFactory.hxx>
@@ -91,7 +103,10 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
 
   TopoDS_ListOfShape aListOfShapes;
   IMeshTools_Parameters aMeshParams;
-  bool hasDefl = false, hasAngDefl = false, isPrsDefl = false;
+  bool hasDefl = false, hasAngDefl = false, isPrsDefl = false, toPrintStats = false;
+  Handle(BRepTools_History) aHistory;
+  TopoDS_Shape anInitialShape;
+  NCollection_Sequence<Standard_Real> aLODs;
 
   Handle(IMeshTools_Context) aContext = new BRepMesh_Context();
   for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
@@ -108,6 +123,10 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
     {
       aMeshParams.InParallel = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
     }
+    else if (aNameCase == "-parallel_face")
+    {
+      aMeshParams.InParallelFace = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
     else if (aNameCase == "-int_vert_off")
     {
       aMeshParams.InternalVerticesMode = !Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
@@ -132,6 +151,44 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
     {
       aMeshParams.AllowQualityDecrease = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
     }
+    else if (aNameCase == "-flat_ds")
+    {
+      aMeshParams.FlatDataStructure = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aNameCase == "-lods"
+          && anArgIter + 1 < theNbArgs)
+    {
+      while (anArgIter + 1 < theNbArgs
+          && TCollection_AsciiString (theArgVec[anArgIter + 1]).IsRealValue (true))
+      {
+        const Standard_Real aVal = Draw::Atof (theArgVec[++anArgIter]);
+        if (aVal <= Precision::Confusion())
+        {
+          theDI << "Syntax error: invalid input parameter '" << theArgVec[anArgIter] << "'";
+          return 1;
+        }
+        aLODs.Append (aVal);
+      }
+    }
+    else if (aNameCase == "-history"
+          && anArgIter + 2 < theNbArgs)
+    {
+      Handle(BRepTest_DrawableHistory) aDrawHistory =
+        Handle(BRepTest_DrawableHistory)::DownCast (Draw::Get (theArgVec[++anArgIter]));
+      if (aDrawHistory.IsNull() || aDrawHistory->History().IsNull())
+      {
+        theDI << "Syntax error: history with the name '" << theArgVec[anArgIter] << "' does not exist";
+        return 1;
+      }
+      aHistory = aDrawHistory->History();
+
+      anInitialShape = DBRep::Get (theArgVec[++anArgIter]);
+      if (anInitialShape.IsNull())
+      {
+        theDI << "Syntax error: null shapes are not allowed here '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
     else if (aNameCase == "-algo"
           && anArgIter + 1 < theNbArgs)
     {
@@ -161,6 +218,10 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
         return 1;
       }
     }
+    else if (aNameCase == "-stats")
+    {
+      toPrintStats = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
     else if ((aNameCase == "-prs"
            || aNameCase == "-presentation"
            || aNameCase == "-vis"
@@ -279,13 +340,52 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
   }
 
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator (theDI, 1);
-  BRepMesh_IncrementalMesh aMesher;
-  aMesher.SetShape (aShape);
-  aMesher.ChangeParameters() = aMeshParams;
-  aMesher.Perform (aContext, aProgress->Start());
+  Standard_Integer aStatus = 0;
+  if (!aLODs.IsEmpty())
+  {
+    if (!aHistory.IsNull())
+    {
+      theDI << "Syntax error: -lods and -history cannot be used together";
+      return 1;
+    }
+    if (toPrintStats)
+    {
+      theDI << "Syntax error: -lods and -stats cannot be used together";
+      return 1;
+    }
+
+    BRepMesh_MultiLODMesh aMesher;
+    aMesher.SetShape (aShape);
+    aMesher.ChangeParameters() = aMeshParams;
+    aMesher.AddLevel (aMeshParams.Deflection);
+    for (NCollection_Sequence<Standard_Real>::Iterator aLODIter (aLODs); aLODIter.More(); aLODIter.Next())
+    {
+      aMesher.AddLevel (aLODIter.Value());
+    }
+    aMesher.Perform (aProgress->Start());
+    aStatus = aMesher.GetStatusFlags();
+  }
+  else
+  {
+    BRepMesh_IncrementalMesh aMesher;
+    aMesher.SetShape (aShape);
+    aMesher.ChangeParameters() = aMeshParams;
+    aMesher.SetHistory (anInitialShape, aHistory);
+    if (toPrintStats)
+    {
+      aContext->SetStatistics (new IMeshTools_MeshStatistics());
+    }
+    aMesher.Perform (aContext, aProgress->Start());
+    aStatus = aMesher.GetStatusFlags();
+    if (toPrintStats)
+    {
+      Standard_SStream aStatsStream;
+      aContext->GetStatistics()->Dump (aStatsStream);
+      theDI << aStatsStream;
+    }
+  }
 
   theDI << "Meshing statuses: ";
-  const Standard_Integer aStatus = aMesher.GetStatusFlags();
   if (aStatus == 0)
   {
     theDI << "NoError";
@@ -481,6 +581,266 @@ static Standard_Integer MemLeakTest(Draw_Interpretor&, Standard_Integer /*nbarg*
   return 0;
 }
 
+namespace
+{
+  //! Incremental allocator counting the memory requested from it.
+  class MeshTest_CountingAllocator : public NCollection_IncAllocator
+  {
+  public:
+
+    MeshTest_CountingAllocator() : NCollection_IncAllocator (IMeshData::MEMORY_BLOCK_SIZE_HUGE), myAllocated (0) {}
+
+    virtual void* AllocateOptimal (const size_t theSize) Standard_OVERRIDE
+    {
+      myAllocated += theSize;
+      return NCollection_IncAllocator::AllocateOptimal (theSize);
+    }
+
+    //! Returns the memory requested from the allocator.
+    size_t Allocated() const { return myAllocated; }
+
+  private:
+    size_t myAllocated;
+  };
+}
+
+//=======================================================================
+//function : MeshDataBench
+//purpose  : Compares the storages of the data structure of 2D triangulation
+//=======================================================================
+static Standard_Integer MeshDataBench (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs < 2)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  // the corpus: parametric nodes of the triangulations of faces
+  NCollection_Vector<Handle(IMeshData::Array1OfVertexOfDelaun)> aCorpus;
+  Standard_Integer aNbIter = 1, aNbNodes = 0;
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase (theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgCase == "-niter"
+     && anArgIter + 1 < theNbArgs)
+    {
+      aNbIter = Draw::Atoi (theArgVec[++anArgIter]);
+      if (aNbIter < 1)
+      {
+        theDI << "Syntax error: wrong number of iterations '" << theArgVec[anArgIter] << "'\n";
+        return 1;
+      }
+      continue;
+    }
+
+    TopoDS_Shape aShape = DBRep::Get (theArgVec[anArgIter]);
+    if (aShape.IsNull())
+    {
+      theDI << "Syntax error: '" << theArgVec[anArgIter] << "' is not a shape\n";
+      return 1;
+    }
+
+    for (TopExp_Explorer aFaceIt (aShape, TopAbs_FACE); aFaceIt.More(); aFaceIt.Next())
+    {
+      TopLoc_Location aLoc;
+      const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation (TopoDS::Face (aFaceIt.Current()), aLoc);
+      if (aTriangulation.IsNull()
+      || !aTriangulation->HasUVNodes()
+      ||  aTriangulation->NbNodes() < 3)
+      {
+        continue;
+      }
+
+      Handle(IMeshData::Array1OfVertexOfDelaun) aVertices = new IMeshData::Array1OfVertexOfDelaun (1, aTriangulation->NbNodes());
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aTriangulation->NbNodes(); ++aNodeIter)
+      {
+        aVertices->ChangeValue (aNodeIter) = BRepMesh_Vertex (aTriangulation->UVNode (aNodeIter).XY(), aNodeIter, BRepMesh_Free);
+      }
+      aCorpus.Append (aVertices);
+      aNbNodes += aTriangulation->NbNodes();
+    }
+  }
+  if (aCorpus.IsEmpty())
+  {
+    theDI << "Error: shapes have no faces with triangulation\n";
+    return 1;
+  }
+
+  const BRepMesh_DataStructureOfDelaun::Storage aStorages[2] =
+  {
+    BRepMesh_DataStructureOfDelaun::Storage_Maps,
+    BRepMesh_DataStructureOfDelaun::Storage_Flat
+  };
+  const char* aStorageNames[2] = { "maps", "flat" };
+  Standard_Real    aTime[2]       = { 0.0, 0.0 };
+  size_t           aMemory[2]     = { 0, 0 };
+  Standard_Integer aNbElements[2] = { 0, 0 };
+  for (Standard_Integer aStorageIter = 0; aStorageIter < 2; ++aStorageIter)
+  {
+    for (Standard_Integer anIter = 0; anIter < aNbIter; ++anIter)
+    {
+      for (NCollection_Vector<Handle(IMeshData::Array1OfVertexOfDelaun)>::Iterator aFaceIt (aCorpus); aFaceIt.More(); aFaceIt.Next())
+      {
+        IMeshData::Array1OfVertexOfDelaun& aVertices = *aFaceIt.Value();
+        Handle(MeshTest_CountingAllocator) anAllocator = new MeshTest_CountingAllocator();
+
+        OSD_Timer aTimer;
+        aTimer.Start();
+        Handle(BRepMesh_DataStructureOfDelaun) aStructure =
+          new BRepMesh_DataStructureOfDelaun (anAllocator, aVertices.Length(), aStorages[aStorageIter]);
+        BRepMesh_Delaun aDelaun (aStructure, aVertices);
+        aTimer.Stop();
+
+        aTime[aStorageIter] += aTimer.ElapsedTime();
+        if (anIter == 0)
+        {
+          aMemory[aStorageIter]     += anAllocator->Allocated();
+          aNbElements[aStorageIter] += aStructure->ElementsOfDomain().Extent();
+        }
+      }
+    }
+  }
+
+  theDI << "Faces: " << aCorpus.Length() << ", nodes: " << aNbNodes << ", iterations: " << aNbIter << "\n";
+  for (Standard_Integer aStorageIter = 0; aStorageIter < 2; ++aStorageIter)
+  {
+    theDI << aStorageNames[aStorageIter] << ": time " << aTime[aStorageIter] << " s, memory "
+          << Standard_Real (aMemory[aStorageIter]) / 1024.0 << " KiB, triangles " << aNbElements[aStorageIter] << "\n";
+  }
+  theDI << "Speedup: " << (aTime[1] > 0.0 ? aTime[0] / aTime[1] : 1.0)
+        << ", memory ratio: " << (aMemory[0] > 0 ? Standard_Real (aMemory[1]) / Standard_Real (aMemory[0]) : 1.0) << "\n";
+  if (aNbElements[0] != aNbElements[1])
+  {
+    theDI << "Error: storages give different triangulations\n";
+  }
+  return 0;
+}
+
+//=======================================================================
+//function : MeshBench
+//purpose  :
+//=======================================================================
+static Standard_Integer MeshBench (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs < 4)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  TopoDS_Compound aCorpus;
+  BRep_Builder().MakeCompound (aCorpus);
+  NCollection_Sequence<Standard_Real> aDeflections;
+  IMeshTools_Parameters aMeshParams;
+  Standard_Integer aNbIter = 1;
+  bool toPrintStats = false, isEmpty = true;
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase (theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgCase == "-defl"
+     && anArgIter + 1 < theNbArgs)
+    {
+      while (anArgIter + 1 < theNbArgs
+          && TCollection_AsciiString (theArgVec[anArgIter + 1]).IsRealValue (true))
+      {
+        const Standard_Real aVal = Draw::Atof (theArgVec[++anArgIter]);
+        if (aVal <= Precision::Confusion())
+        {
+          theDI << "Syntax error: invalid deflection '" << theArgVec[anArgIter] << "'\n";
+          return 1;
+        }
+        aDeflections.Append (aVal);
+      }
+    }
+    else if (anArgCase == "-angular"
+          && anArgIter + 1 < theNbArgs)
+    {
+      aMeshParams.Angle = Draw::Atof (theArgVec[++anArgIter]) * M_PI / 180.0;
+    }
+    else if (anArgCase == "-parallel")
+    {
+      aMeshParams.InParallel = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-niter"
+          && anArgIter + 1 < theNbArgs)
+    {
+      aNbIter = Draw::Atoi (theArgVec[++anArgIter]);
+      if (aNbIter < 1)
+      {
+        theDI << "Syntax error: wrong number of iterations '" << theArgVec[anArgIter] << "'\n";
+        return 1;
+      }
+    }
+    else if (anArgCase == "-stats")
+    {
+      toPrintStats = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else
+    {
+      TopoDS_Shape aShape = DBRep::Get (theArgVec[anArgIter]);
+      if (aShape.IsNull())
+      {
+        theDI << "Syntax error: '" << theArgVec[anArgIter] << "' is not a shape\n";
+        return 1;
+      }
+      BRep_Builder().Add (aCorpus, aShape);
+      isEmpty = false;
+    }
+  }
+  if (isEmpty || aDeflections.IsEmpty())
+  {
+    theDI << "Syntax error: shapes and deflections should be specified\n";
+    return 1;
+  }
+
+  theDI << "Mesh benchmark, multi-threading " << (aMeshParams.InParallel ? "ON" : "OFF")
+        << ", iterations: " << aNbIter << "\n";
+  for (NCollection_Sequence<Standard_Real>::Iterator aDeflIter (aDeflections); aDeflIter.More(); aDeflIter.Next())
+  {
+    aMeshParams.Deflection = aDeflIter.Value();
+    aMeshParams.DeflectionInterior = aDeflIter.Value();
+    aMeshParams.MinSize = 0.0;
+
+    // the corpus is meshed anew on each iteration, the statistics is kept for the last one
+    Handle(IMeshTools_MeshStatistics) aStats = new IMeshTools_MeshStatistics();
+    Standard_Real aTime = 0.0;
+    for (Standard_Integer anIter = 0; anIter < aNbIter; ++anIter)
+    {
+      const TopoDS_Shape aShape = BRepBuilderAPI_Copy (aCorpus, Standard_False, Standard_False).Shape();
+      Handle(IMeshTools_Context) aContext = new BRepMesh_Context (aMeshParams.MeshAlgo);
+      aStats->Reset();
+      aContext->SetStatistics (aStats);
+
+      OSD_Timer aTimer;
+      aTimer.Start();
+      BRepMesh_IncrementalMesh aMesher;
+      aMesher.SetShape (aShape);
+      aMesher.ChangeParameters() = aMeshParams;
+      aMesher.Perform (aContext);
+      aTimer.Stop();
+      aTime += aTimer.ElapsedTime();
+    }
+    aTime /= aNbIter;
+
+    const OSD_MemInfo aMemInfo;
+    theDI << "Deflection " << aMeshParams.Deflection << ": faces " << aStats->NbFaces()
+          << ", failed " << aStats->NbFailedFaces() << ", triangles " << (Standard_Integer )aStats->NbTriangles()
+          << ", time " << aTime << " s, triangles/s "
+          << (aTime > 0.0 ? Standard_Real (aStats->NbTriangles()) / aTime : 0.0)
+          << ", peak memory " << aMemInfo.ValuePreciseMiB (OSD_MemInfo::MemWorkingSetPeak) << " MiB\n";
+    if (toPrintStats)
+    {
+      Standard_SStream aStatsStream;
+      aStats->Dump (aStatsStream);
+      theDI << aStatsStream;
+    }
+  }
+  return 0;
+}
+
 //=======================================================================
 //function : TrLateLoad
 //purpose  :
@@ -1442,7 +1802,7 @@ static Standard_Integer TrMergeNodes (Draw_Interpretor& theDI, Standard_Integer
   }
 
   Standard_Real aMergeAngle = M_PI / 4.0, aMergeToler = 0.0;
-  bool toForce = false;
+  bool toForce = false, toBatch = false, toParallel = false;
   TCollection_AsciiString aResFace;
   for (Standard_Integer anArgIter = 2; anArgIter < theNbArgs; ++anArgIter)
   {
@@ -1479,6 +1839,11 @@ static Standard_Integer TrMergeNodes (Draw_Interpretor& theDI, Standard_Integer
     {
       toForce = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
     }
+    else if (anArgCase == "-parallel")
+    {
+      toBatch = true;
+      toParallel = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
     else if (anArgIter + 1 < theNbArgs
           && anArgCase == "-oneface")
     {
@@ -1497,6 +1862,8 @@ static Standard_Integer TrMergeNodes (Draw_Interpretor& theDI, Standard_Integer
   {
     TopLoc_Location aFaceLoc;
     Poly_MergeNodesTool aMergeTool (aMergeAngle, aMergeToler);
+    aMergeTool.SetRunParallel (toParallel);
+    NCollection_Vector<Poly_MergeNodesTool::TriangulationItem> aBatch;
     for (TopExp_Explorer aFaceIter (aShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
     {
       const TopoDS_Face& aFace = TopoDS::Face (aFaceIter.Value());
@@ -1510,7 +1877,18 @@ static Standard_Integer TrMergeNodes (Draw_Interpretor& theDI, Standard_Integer
 
       aNbNodesOld += aTris->NbNodes();
       aNbTrisOld  += aTris->NbTriangles();
-      aMergeTool.AddTriangulation (aTris, aFaceLoc, aFace.Orientation() == TopAbs_REVERSED);
+      if (toBatch)
+      {
+        aBatch.Append (Poly_MergeNodesTool::TriangulationItem (aTris, aFaceLoc, aFace.Orientation() == TopAbs_REVERSED));
+      }
+      else
+      {
+        aMergeTool.AddTriangulation (aTris, aFaceLoc, aFace.Orientation() == TopAbs_REVERSED);
+      }
+    }
+    if (toBatch)
+    {
+      aMergeTool.AddTriangulations (aBatch);
     }
     Handle(Poly_Triangulation) aNewTris = aMergeTool.Result();
     if (aNewTris.IsNull())
@@ -1566,6 +1944,288 @@ static Standard_Integer TrMergeNodes (Draw_Interpretor& theDI, Standard_Integer
   return 0;
 }
 
+//=======================================================================
+//function : TrCompact
+//purpose  :
+//=======================================================================
+static Standard_Integer TrCompact (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs < 2)
+  {
+    theDI << "Syntax error: not enough arguments";
+    return 1;
+  }
+
+  TopoDS_Shape aShape = DBRep::Get (theArgVec[1]);
+  if (aShape.IsNull())
+  {
+    theDI << "Syntax error: '" << theArgVec[1] << "' is not a shape";
+    return 1;
+  }
+
+  bool toCompact = true;
+  for (Standard_Integer anArgIter = 2; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase (theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgCase == "-off")
+    {
+      toCompact = false;
+    }
+    else if (anArgCase == "-on")
+    {
+      toCompact = true;
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+
+  Standard_Integer aNbTris = 0, aNbCompact = 0;
+  TopTools_MapOfShape aProcessedFaces;
+  for (TopExp_Explorer aFaceIter (aShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (aFaceIter.Value());
+    if (!aProcessedFaces.Add (aFace.Located (TopLoc_Location())))
+    {
+      continue;
+    }
+
+    TopLoc_Location aDummy;
+    for (Poly_ListOfTriangulation::Iterator aTrisIter (BRep_Tool::Triangulations (aFace, aDummy));
+         aTrisIter.More(); aTrisIter.Next())
+    {
+      const Handle(Poly_Triangulation)& aTris = aTrisIter.Value();
+      if (aTris.IsNull())
+      {
+        continue;
+      }
+
+      aTris->SetCompact (toCompact);
+      ++aNbTris;
+      if (aTris->IsCompact())
+      {
+        ++aNbCompact;
+      }
+    }
+  }
+  theDI << "Triangulations: " << aNbTris << ", Compact: " << aNbCompact << "\n";
+  return 0;
+}
+
+//=======================================================================
+//function : TrDecimate
+//purpose  :
+//=======================================================================
+static Standard_Integer TrDecimate (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs < 2)
+  {
+    theDI << "Syntax error: not enough arguments";
+    return 1;
+  }
+
+  TopoDS_Shape aShape = DBRep::Get (theArgVec[1]);
+  if (aShape.IsNull())
+  {
+    theDI << "Syntax error: '" << theArgVec[1] << "' is not a shape";
+    return 1;
+  }
+
+  BRepMesh_ShapeDecimator aDecimator;
+  for (Standard_Integer anArgIter = 2; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase (theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    Standard_Real aValue = 0.0;
+    if (anArgIter + 1 < theNbArgs
+     && anArgCase == "-ratio"
+     && Draw::ParseReal (theArgVec[anArgIter + 1], aValue))
+    {
+      if (aValue <= 0.0 || aValue > 1.0)
+      {
+        theDI << "Syntax error: ratio should be within (0,1] range";
+        return 1;
+      }
+
+      ++anArgIter;
+      aDecimator.SetTargetRatio (aValue);
+    }
+    else if (anArgIter + 1 < theNbArgs
+          && (anArgCase == "-maxerror"
+           || anArgCase == "-error")
+          && Draw::ParseReal (theArgVec[anArgIter + 1], aValue))
+    {
+      if (aValue < 0.0)
+      {
+        theDI << "Syntax error: error should be within >=0";
+        return 1;
+      }
+
+      ++anArgIter;
+      aDecimator.SetMaxError (aValue);
+    }
+    else if (anArgCase == "-parallel")
+    {
+      aDecimator.SetRunParallel (Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter));
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator (theDI, 1);
+  aDecimator.Perform (aShape, aProgress->Start());
+  theDI << "Triangles: " << aDecimator.NbSourceTriangles() << " -> " << aDecimator.NbResultTriangles()
+        << ", Error: " << aDecimator.Error() << "\n";
+  return 0;
+}
+
+//! Shoots circles of a new BRepMesh_CircleTool by points near their boundaries
+//! and random points; returns lists of shot circles for all points.
+static void shootCircles (const Standard_Integer theNbCircles,
+                          NCollection_Vector<IMeshData::ListOfInteger>& theShots)
+{
+  const Standard_Real aTol = Precision::PConfusion();
+  const Handle(NCollection_IncAllocator) anAlloc = new NCollection_IncAllocator();
+  BRepMesh_CircleTool aTool (theNbCircles, anAlloc);
+  aTool.Init (theNbCircles);
+  aTool.SetCellSize (0.05, 0.04);
+  aTool.SetMinMaxSize (gp_XY (0.0, 0.0), gp_XY (1.0, 1.0));
+
+  math_BullardGenerator aRandom;
+  NCollection_Vector<gp_XY> aLocations;
+  NCollection_Vector<Standard_Real> aRadii;
+  for (Standard_Integer aCircleIt = 0; aCircleIt < theNbCircles; ++aCircleIt)
+  {
+    // each fifth circle shares the center with the previous one
+    const gp_XY aLoc = (aCircleIt % 5 == 4)
+                     ? aLocations.Last()
+                     : gp_XY (aRandom.NextReal(), aRandom.NextReal());
+    const Standard_Real aRadius = 0.002 + 0.1 * aRandom.NextReal();
+    aLocations.Append (aLoc);
+    aRadii.Append (aRadius);
+    aTool.Bind (aCircleIt, gp_Circ2d (gp_Ax2d (gp_Pnt2d (aLoc), gp::DX2d()), aRadius));
+  }
+  for (Standard_Integer aCircleIt = 0; aCircleIt < theNbCircles; aCircleIt += 7)
+  {
+    aTool.Delete (aCircleIt);
+  }
+
+  // offsets of points from the boundary around the tolerance of the check,
+  // which is compared with the difference of squared distance and squared radius
+  for (Standard_Integer aCircleIt = 0; aCircleIt < theNbCircles; ++aCircleIt)
+  {
+    const Standard_Real aRadius = aRadii.Value (aCircleIt);
+    const Standard_Real aBoundary = aTol * aTol / (2.0 * aRadius);
+    const Standard_Real anOffsets[] = { 0.0, aBoundary, -aBoundary, 0.5 * aBoundary, 2.0 * aBoundary, -aTol, aTol };
+    for (Standard_Integer anOffsetIt = 0; anOffsetIt < 7; ++anOffsetIt)
+    {
+      const Standard_Real anAngle = 2.0 * M_PI * aRandom.NextReal();
+      const gp_XY aPnt = aLocations.Value (aCircleIt)
+                       + gp_XY (Cos (anAngle), Sin (anAngle)) * (aRadius + anOffsets[anOffsetIt]);
+      theShots.Append (aTool.Select (aPnt));
+    }
+    theShots.Append (aTool.Select (gp_XY (aRandom.NextReal(), aRandom.NextReal())));
+  }
+}
+
+//=======================================================================
+//function : MeshCircleKernel
+//purpose  :
+//=======================================================================
+static Standard_Integer MeshCircleKernel (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  Standard_Integer aNbCircles = -1;
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase (theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgCase == "-compare")
+    {
+      aNbCircles = 2000;
+      if (anArgIter + 1 < theNbArgs
+       && Draw::ParseInteger (theArgVec[anArgIter + 1], aNbCircles))
+      {
+        if (aNbCircles < 1)
+        {
+          theDI << "Syntax error: number of circles should be positive";
+          return 1;
+        }
+        ++anArgIter;
+      }
+    }
+    else if (anArgCase == "cellfilter")
+    {
+      BRepMesh_CircleTool::SetCellFilterMode (Standard_True);
+    }
+    else if (BRepMesh_CircleCells::SetKernel (anArgCase.ToCString()))
+    {
+      BRepMesh_CircleTool::SetCellFilterMode (Standard_False);
+    }
+    else
+    {
+      theDI << "Syntax error: kernel '" << theArgVec[anArgIter] << "' is unknown or not supported";
+      return 1;
+    }
+  }
+
+  if (aNbCircles > 0)
+  {
+    const Standard_Boolean isCellFilter = BRepMesh_CircleTool::IsCellFilterMode();
+    const TCollection_AsciiString aKernel (BRepMesh_CircleCells::KernelName());
+
+    // reference result of the cell filter checking circles one by one
+    NCollection_Vector<IMeshData::ListOfInteger> aRefShots;
+    BRepMesh_CircleTool::SetCellFilterMode (Standard_True);
+    shootCircles (aNbCircles, aRefShots);
+    BRepMesh_CircleTool::SetCellFilterMode (Standard_False);
+
+    Standard_Integer aNbHits = 0;
+    for (NCollection_Vector<IMeshData::ListOfInteger>::Iterator aShotIter (aRefShots); aShotIter.More(); aShotIter.Next())
+    {
+      aNbHits += aShotIter.Value().Extent();
+    }
+
+    // kernels should return the same circles in the same order as the cell filter
+    const char* aKernels[] = { "scalar", "sse2", "avx2", "neon" };
+    theDI << "Points: " << aRefShots.Length() << ", Hits: " << aNbHits << ", Kernels:";
+    for (Standard_Integer aKernelIt = 0; aKernelIt < 4; ++aKernelIt)
+    {
+      if (!BRepMesh_CircleCells::SetKernel (aKernels[aKernelIt]))
+      {
+        continue;
+      }
+
+      theDI << " " << aKernels[aKernelIt];
+      NCollection_Vector<IMeshData::ListOfInteger> aShots;
+      shootCircles (aNbCircles, aShots);
+      for (Standard_Integer aPntIt = 0; aPntIt < aRefShots.Length(); ++aPntIt)
+      {
+        const IMeshData::ListOfInteger& aShot    = aShots   .Value (aPntIt);
+        const IMeshData::ListOfInteger& aRefShot = aRefShots.Value (aPntIt);
+        if (aShot.Extent() != aRefShot.Extent()
+        || !std::equal (aShot.begin(), aShot.end(), aRefShot.begin()))
+        {
+          theDI << "\nError: kernel '" << aKernels[aKernelIt] << "' differs from the cell filter at point " << aPntIt;
+          break;
+        }
+      }
+    }
+    theDI << "\n";
+
+    BRepMesh_CircleCells::SetKernel (aKernel.ToCString());
+    BRepMesh_CircleTool::SetCellFilterMode (isCellFilter);
+  }
+
+  theDI << "Kernel: " << (BRepMesh_CircleTool::IsCellFilterMode() ? "cellfilter" : BRepMesh_CircleCells::KernelName()) << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : correctnormals
 //purpose  : Corrects normals in shape triangulation nodes (...)
@@ -1605,11 +2265,12 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
 
   theCommands.Add("incmesh",
     "incmesh Shape LinDefl [-angular Angle]=28.64 [-prs]"
-    "\n\t\t:   [-relative {0|1}]=0 [-parallel {0|1}]=0 [-min Size]"
+    "\n\t\t:   [-relative {0|1}]=0 [-parallel {0|1}]=0 [-parallel_face {0|1}]=0 [-min Size]"
     "\n\t\t:   [-algo {watson|delabella}]=watson"
     "\n\t\t:   [-di Value] [-ai Angle]=57.29"
     "\n\t\t:   [-int_vert_off {0|1}]=0 [-surf_def_off {0|1}]=0 [-adjust_min {0|1}]=0"
-    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0"
+    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0 [-flat_ds {0|1}]=0"
+    "\n\t\t:   [-history History InitialShape] [-lods Defl1 [Defl2 ...]] [-stats]"
     "\n\t\t: Builds triangular mesh for the shape."
     "\n\t\t:  LinDefl         linear deflection to control mesh quality;"
     "\n\t\t:  -angular        angular deflection for edges in deg (~28.64 deg = 0.5 rad by default);"
@@ -1617,6 +2278,7 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:                  (20 deg angular deflection, 0.001 of bounding box linear deflection);"
     "\n\t\t:  -relative       notifies that relative deflection is used (FALSE by default);"
     "\n\t\t:  -parallel       enables parallel execution (FALSE by default);"
+    "\n\t\t:  -parallel_face  enables parallel triangulation of sub-domains of large faces (FALSE by default);"
     "\n\t\t:  -algo           changes core triangulation algorithm to one with specified id (watson by default);"
     "\n\t\t:  -min            minimum size parameter limiting size of triangle's edges to prevent sinking"
     "\n\t\t:                  into amplification in case of distorted curves and surfaces;"
@@ -1629,10 +2291,35 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:  -adjust_min     enables local adjustment of min size depending on edge size (FALSE by default);"
     "\n\t\t:  -force_face_def disables usage of shape tolerances for computing face deflection (FALSE by default);"
     "\n\t\t:  -decrease       enforces the meshing of the shape even if current mesh satisfies the new criteria"
-    "\n\t\t:                  (FALSE by default).",
+    "\n\t\t:                  (FALSE by default);"
+    "\n\t\t:  -flat_ds        uses flat storage of links in the data structure of 2D triangulation"
+    "\n\t\t:                  (FALSE by default);"
+    "\n\t\t:  -history        meshes incrementally the result of the modeling operation with given history"
+    "\n\t\t:                  (see savehistory), applied to the meshed InitialShape: only modified faces"
+    "\n\t\t:                  are meshed, the mesh of the kept faces is reused;"
+    "\n\t\t:  -lods           builds in one pass additional levels of detail with given linear deflections"
+    "\n\t\t:                  (see BRepMesh_MultiLODMesh); the triangulations of faces are ordered"
+    "\n\t\t:                  from the finest to the coarsest one, the finest one is active;"
+    "\n\t\t:  -stats          prints elapsed time of stages of meshing and counters of faces"
+    "\n\t\t:                  per type of surface (see IMeshTools_MeshStatistics).",
   __FILE__, incrementalmesh, g);
   theCommands.Add("tessellate","Builds triangular mesh for the surface, run w/o args for help",__FILE__, tessellate, g);
   theCommands.Add("MemLeakTest","MemLeakTest",__FILE__, MemLeakTest, g);
+  theCommands.Add("meshdsbench",
+                  "meshdsbench shape1 [shape2 ...] [-niter N]=1"
+                  "\n\t\t: Triangulates the parametric nodes of the meshed faces of given shapes"
+                  "\n\t\t: using each storage of the data structure of 2D triangulation"
+                  "\n\t\t: (see BRepMesh_DataStructureOfDelaun::Storage), and prints time and memory.",
+                  __FILE__, MeshDataBench, g);
+  theCommands.Add("meshbench",
+                  "meshbench shape1 [shape2 ...] -defl Defl1 [Defl2 ...] [-angular Angle]=28.64"
+                  "\n\t\t:   [-parallel {0|1}]=0 [-niter N]=1 [-stats]"
+                  "\n\t\t: Meshes anew the copy of given shapes with each linear deflection"
+                  "\n\t\t: and prints number of faces and triangles, mean elapsed time, triangles per second"
+                  "\n\t\t: and peak working set of the process."
+                  "\n\t\t:  -stats prints elapsed time of stages of meshing and counters of faces"
+                  "\n\t\t:         per type of surface (see IMeshTools_MeshStatistics).",
+                  __FILE__, MeshBench, g);
 
   theCommands.Add("tri2d", "tri2d facename",__FILE__, tri2d, g);
   theCommands.Add("trinfo",
@@ -1663,11 +2350,34 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
                   __FILE__, TrLateLoad, g);
   theCommands.Add("trmergenodes",
                   "trmergenodes shapeName"
-                  "\n\t\t:   [-angle Angle] [-tolerance Value] [-oneFace Result]"
+                  "\n\t\t:   [-angle Angle] [-tolerance Value] [-oneFace Result [-parallel {on|off}]]"
                   "\n\t\t: Merging nodes within triangulation data."
                   "\n\t\t:   -angle     merge angle upper limit in degrees; 45 when unspecified"
                   "\n\t\t:   -tolerance linear tolerance to merge nodes; 0.0 when unspecified"
-                  "\n\t\t:   -oneFace   create a new single Face with specified name for the whole triangulation",
+                  "\n\t\t:   -oneFace   create a new single Face with specified name for the whole triangulation"
+                  "\n\t\t:   -parallel  merge triangulations of all faces in one batch in multiple threads"
+                  "\n\t\t:              (see Poly_MergeNodesTool::AddTriangulations()); result does not depend on this flag",
                   __FILE__, TrMergeNodes, g);
+  theCommands.Add("trcompact",
+                  "trcompact shapeName [-on|-off]"
+                  "\n\t\t: Switches triangulations of the shape (all LODs) to compact storage"
+                  "\n\t\t: with quantized nodes, packed normals and 16-bit indices of triangles"
+                  "\n\t\t: (see Poly_Triangulation::SetCompact()), or back to full precision with -off.",
+                  __FILE__, TrCompact, g);
+  theCommands.Add("trdecimate",
+                  "trdecimate shapeName [-ratio Ratio] [-maxError Value] [-parallel {on|off}]=off"
+                  "\n\t\t: Decimates triangulations of faces by collapsing edges with minimal quadric error,"
+                  "\n\t\t: keeping nodes of polygons on triangulation of edges (see BRepMesh_ShapeDecimator)."
+                  "\n\t\t:   -ratio    ratio of target number of triangles of each face to the current one; 1 when unspecified"
+                  "\n\t\t:   -maxError maximum error of decimation; infinite when unspecified"
+                  "\n\t\t:   -parallel decimate faces in parallel",
+                  __FILE__, TrDecimate, g);
+  theCommands.Add("meshcirclekernel",
+                  "meshcirclekernel [auto|scalar|sse2|avx2|neon|cellfilter] [-compare [NbCircles]=2000]"
+                  "\n\t\t: Sets the kernel checking circles of Delaunay triangulation (see BRepMesh_CircleCells::SetKernel()),"
+                  "\n\t\t: or the former cell filter checking circles one by one, and prints the current one."
+                  "\n\t\t:   -compare shoot circles by points near their boundaries with all kernels supported"
+                  "\n\t\t:            by the processor and compare results with the cell filter (shot circles and their order)",
+                  __FILE__, MeshCircleKernel, g);
   theCommands.Add("correctnormals", "correctnormals shape",__FILE__, correctnormals, g);
 }
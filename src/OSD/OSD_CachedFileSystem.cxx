@@ -102,3 +102,12 @@ std::shared_ptr<std::streambuf> OSD_CachedFileSystem::OpenStreamBuffer (const TC
   myStream.StreamBuf = myLinkedFS->OpenStreamBuffer (theUrl, theMode, theOffset, theOutBufSize);
   return myStream.StreamBuf;
 }
+
+//=======================================================================
+// function : OpenMemoryBuffer
+// purpose :
+//=======================================================================
+Handle(NCollection_Buffer) OSD_CachedFileSystem::OpenMemoryBuffer (const TCollection_AsciiString& theUrl)
+{
+  return myLinkedFS->OpenMemoryBuffer (theUrl);
+}
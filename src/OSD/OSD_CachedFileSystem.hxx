@@ -61,6 +61,9 @@ public:
                            const int64_t theOffset = 0,
                            int64_t* theOutBufSize = NULL) Standard_OVERRIDE;
 
+  //! Opens memory buffer for specified file URL by calling linked file system.
+  Standard_EXPORT virtual Handle(NCollection_Buffer) OpenMemoryBuffer (const TCollection_AsciiString& theUrl) Standard_OVERRIDE;
+
 protected:
 
   // Auxiliary structure to save shared stream with path to it.
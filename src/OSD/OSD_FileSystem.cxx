@@ -15,6 +15,10 @@
 #include <OSD_FileSystemSelector.hxx>
 #include <OSD_LocalFileSystem.hxx>
 
+#include <NCollection_BaseAllocator.hxx>
+
+#include <limits>
+
 IMPLEMENT_STANDARD_RTTIEXT(OSD_FileSystem, Standard_Transient)
 
 //=======================================================================
@@ -136,3 +140,27 @@ std::shared_ptr<std::ostream> OSD_FileSystem::OpenOStream (const TCollection_Asc
   aNewStream.reset(new OSD_OStreamBuffer (theUrl.ToCString(), aFileBuf));
   return aNewStream;
 }
+
+//=======================================================================
+// function : OpenMemoryBuffer
+// purpose :
+//=======================================================================
+Handle(NCollection_Buffer) OSD_FileSystem::OpenMemoryBuffer (const TCollection_AsciiString& theUrl)
+{
+  int64_t aFileSize = 0;
+  std::shared_ptr<std::streambuf> aFileBuf = OpenStreamBuffer (theUrl, std::ios::in | std::ios::binary, 0, &aFileSize);
+  if (aFileBuf.get() == NULL
+   || aFileSize <= 0
+   || (uint64_t )aFileSize > (uint64_t )std::numeric_limits<size_t>::max())
+  {
+    return Handle(NCollection_Buffer)();
+  }
+
+  Handle(NCollection_Buffer) aBuffer = new NCollection_Buffer (NCollection_BaseAllocator::CommonBaseAllocator());
+  if (!aBuffer->Allocate ((size_t )aFileSize)
+    || aFileBuf->sgetn ((char* )aBuffer->ChangeData(), (std::streamsize )aFileSize) != (std::streamsize )aFileSize)
+  {
+    return Handle(NCollection_Buffer)();
+  }
+  return aBuffer;
+}
@@ -14,6 +14,7 @@
 #ifndef _OSD_FileSystem_HeaderFile
 #define _OSD_FileSystem_HeaderFile
 
+#include <NCollection_Buffer.hxx>
 #include <OSD_StreamBuffer.hxx>
 #include <TCollection_AsciiString.hxx>
 #include <NCollection_DefineAlloc.hxx>
@@ -81,6 +82,14 @@ public:
                                                             const int64_t theOffset = 0,
                                                             int64_t* theOutBufSize = NULL) = 0;
 
+  //! Opens the whole file for reading as a contiguous read-only memory buffer,
+  //! which allows scanning the file content in place without intermediate copies made by stream buffers.
+  //! Default implementation reads the content of stream buffer returned by OSD_FileSystem::OpenStreamBuffer()
+  //! into memory; OSD_LocalFileSystem maps the file into memory instead.
+  //! @param theUrl [in] path to open
+  //! @return buffer holding the file content or NULL in case of failure
+  Standard_EXPORT virtual Handle(NCollection_Buffer) OpenMemoryBuffer (const TCollection_AsciiString& theUrl);
+
   //! Constructor.
   Standard_EXPORT OSD_FileSystem();
 
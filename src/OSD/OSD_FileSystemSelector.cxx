@@ -176,3 +176,24 @@ std::shared_ptr<std::streambuf> OSD_FileSystemSelector::OpenStreamBuffer (const
   }
   return std::shared_ptr<std::streambuf>();
 }
+
+//=======================================================================
+// function : OpenMemoryBuffer
+// purpose :
+//=======================================================================
+Handle(NCollection_Buffer) OSD_FileSystemSelector::OpenMemoryBuffer (const TCollection_AsciiString& theUrl)
+{
+  for (NCollection_List<Handle(OSD_FileSystem)>::Iterator aProtIter (myProtocols); aProtIter.More(); aProtIter.Next())
+  {
+    const Handle(OSD_FileSystem)& aFileSystem = aProtIter.Value();
+    if (aFileSystem->IsSupportedPath (theUrl))
+    {
+      Handle(NCollection_Buffer) aBuffer = aFileSystem->OpenMemoryBuffer (theUrl);
+      if (!aBuffer.IsNull())
+      {
+        return aBuffer;
+      }
+    }
+  }
+  return Handle(NCollection_Buffer)();
+}
@@ -64,6 +64,9 @@ public:
                            const int64_t theOffset = 0,
                            int64_t* theOutBufSize = NULL) Standard_OVERRIDE;
 
+  //! Opens memory buffer using one of registered protocols.
+  Standard_EXPORT virtual Handle(NCollection_Buffer) OpenMemoryBuffer (const TCollection_AsciiString& theUrl) Standard_OVERRIDE;
+
 protected:
 
   NCollection_List<Handle(OSD_FileSystem)> myProtocols;
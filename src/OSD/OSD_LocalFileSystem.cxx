@@ -12,6 +12,7 @@
 // commercial license or contractual agreement.
 
 #include <OSD_LocalFileSystem.hxx>
+#include <OSD_MappedFileBuffer.hxx>
 #include <OSD_OpenFile.hxx>
 #include <OSD_Path.hxx>
 #include <Standard_Assert.hxx>
@@ -89,3 +90,17 @@ std::shared_ptr<std::streambuf> OSD_LocalFileSystem::OpenStreamBuffer (const TCo
   }
   return aNewBuf;
 }
+
+//=======================================================================
+// function : OpenMemoryBuffer
+// purpose :
+//=======================================================================
+Handle(NCollection_Buffer) OSD_LocalFileSystem::OpenMemoryBuffer (const TCollection_AsciiString& theUrl)
+{
+  Handle(OSD_MappedFileBuffer) aMappedBuffer = new OSD_MappedFileBuffer();
+  if (aMappedBuffer->Map (theUrl))
+  {
+    return aMappedBuffer;
+  }
+  return OSD_FileSystem::OpenMemoryBuffer (theUrl);
+}
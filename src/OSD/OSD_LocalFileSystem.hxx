@@ -40,5 +40,9 @@ public:
                            const std::ios_base::openmode theMode,
                            const int64_t theOffset = 0,
                            int64_t* theOutBufSize = NULL) Standard_OVERRIDE;
+
+  //! Maps the file into memory for reading (see OSD_MappedFileBuffer);
+  //! falls back to reading the file into memory if mapping fails.
+  Standard_EXPORT virtual Handle(NCollection_Buffer) OpenMemoryBuffer (const TCollection_AsciiString& theUrl) Standard_OVERRIDE;
 };
 #endif // _OSD_LocalFileSystem_HeaderFile
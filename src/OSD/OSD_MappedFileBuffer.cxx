@@ -0,0 +1,143 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_MappedFileBuffer.hxx>
+
+#include <OSD_OpenFile.hxx>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+IMPLEMENT_STANDARD_RTTIEXT(OSD_MappedFileBuffer, NCollection_Buffer)
+
+//=======================================================================
+// function : OSD_MappedFileBuffer
+// purpose :
+//=======================================================================
+OSD_MappedFileBuffer::OSD_MappedFileBuffer()
+: NCollection_Buffer (Handle(NCollection_BaseAllocator)())
+{
+  //
+}
+
+//=======================================================================
+// function : ~OSD_MappedFileBuffer
+// purpose :
+//=======================================================================
+OSD_MappedFileBuffer::~OSD_MappedFileBuffer()
+{
+  Unmap();
+}
+
+//=======================================================================
+// function : Map
+// purpose :
+//=======================================================================
+bool OSD_MappedFileBuffer::Map (const TCollection_AsciiString& thePath)
+{
+  Unmap();
+#if defined(_WIN32) && !defined(OCCT_UWP)
+  const TCollection_ExtendedString aPathW (thePath);
+  HANDLE aFile = CreateFileW (aPathW.ToWideString(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (aFile == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+
+  LARGE_INTEGER aFileSize;
+  if (!GetFileSizeEx (aFile, &aFileSize)
+    || aFileSize.QuadPart <= 0
+    || (uint64_t )aFileSize.QuadPart > (uint64_t )SIZE_MAX)
+  {
+    CloseHandle (aFile);
+    return false;
+  }
+
+  HANDLE aMapping = CreateFileMappingW (aFile, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle (aFile);
+  if (aMapping == NULL)
+  {
+    return false;
+  }
+
+  // the view keeps the mapping object alive
+  void* aView = MapViewOfFile (aMapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle (aMapping);
+  if (aView == NULL)
+  {
+    return false;
+  }
+  myData = (Standard_Byte* )aView;
+  mySize = (Standard_Size )aFileSize.QuadPart;
+  return true;
+#elif !defined(_WIN32)
+  const int aFileDesc = OSD_OpenFileDescriptor (TCollection_ExtendedString (thePath), std::ios::in | std::ios::binary);
+  if (aFileDesc == -1)
+  {
+    return false;
+  }
+
+  struct stat aStat;
+  if (fstat (aFileDesc, &aStat) != 0
+   || !S_ISREG(aStat.st_mode)
+   || aStat.st_size <= 0
+   || (uint64_t )aStat.st_size > (uint64_t )SIZE_MAX)
+  {
+    close (aFileDesc);
+    return false;
+  }
+
+  // the mapping remains valid after closing the file descriptor
+  void* aView = mmap (NULL, (size_t )aStat.st_size, PROT_READ, MAP_PRIVATE, aFileDesc, 0);
+  close (aFileDesc);
+  if (aView == MAP_FAILED)
+  {
+    return false;
+  }
+#if defined(MADV_SEQUENTIAL)
+  // readers scan the content from the beginning to the end
+  madvise (aView, (size_t )aStat.st_size, MADV_SEQUENTIAL);
+#endif
+  myData = (Standard_Byte* )aView;
+  mySize = (Standard_Size )aStat.st_size;
+  return true;
+#else
+  (void )thePath;
+  return false;
+#endif
+}
+
+//=======================================================================
+// function : Unmap
+// purpose :
+//=======================================================================
+void OSD_MappedFileBuffer::Unmap()
+{
+  if (myData == NULL)
+  {
+    return;
+  }
+#if defined(_WIN32) && !defined(OCCT_UWP)
+  UnmapViewOfFile (myData);
+#elif !defined(_WIN32)
+  munmap (myData, mySize);
+#endif
+  myData = NULL;
+  mySize = 0;
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _OSD_MappedFileBuffer_HeaderFile
+#define _OSD_MappedFileBuffer_HeaderFile
+
+#include <NCollection_Buffer.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! Read-only buffer holding the whole content of the local file mapped into memory.
+//! The content is accessed directly from the page cache of the system without copying it into the heap,
+//! so that file readers may scan it in place.
+//! The file should not be modified while the buffer is mapped.
+class OSD_MappedFileBuffer : public NCollection_Buffer
+{
+  DEFINE_STANDARD_RTTIEXT(OSD_MappedFileBuffer, NCollection_Buffer)
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT OSD_MappedFileBuffer();
+
+  //! Destructor, unmaps the file.
+  Standard_EXPORT virtual ~OSD_MappedFileBuffer();
+
+  //! Maps the file into memory for reading.
+  //! @param thePath [in] path to the local file (UTF-8)
+  //! @return FALSE if file cannot be opened, it is empty or mapping is not supported by the system
+  Standard_EXPORT bool Map (const TCollection_AsciiString& thePath);
+
+  //! Unmaps the file.
+  Standard_EXPORT void Unmap();
+
+private:
+
+  OSD_MappedFileBuffer (const OSD_MappedFileBuffer& );
+  OSD_MappedFileBuffer& operator= (const OSD_MappedFileBuffer& );
+
+};
+
+DEFINE_STANDARD_HANDLE(OSD_MappedFileBuffer, NCollection_Buffer)
+
+#endif // _OSD_MappedFileBuffer_HeaderFile
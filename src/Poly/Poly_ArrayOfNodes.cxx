@@ -18,7 +18,10 @@
 // purpose  :
 // =======================================================================
 Poly_ArrayOfNodes::Poly_ArrayOfNodes (const Poly_ArrayOfNodes& theOther)
-: NCollection_AliasedArray (theOther)
+: NCollection_AliasedArray (theOther),
+  myQuantOrigin  (theOther.myQuantOrigin),
+  myQuantStep    (theOther.myQuantStep),
+  myQuantInvStep (theOther.myQuantInvStep)
 {
   //
 }
@@ -43,7 +46,10 @@ Poly_ArrayOfNodes& Poly_ArrayOfNodes::Assign (const Poly_ArrayOfNodes& theOther)
     return *this;
   }
 
-  if (myStride == theOther.myStride)
+  if (myStride == theOther.myStride
+  && (!IsQuantized()
+    || (myQuantOrigin.IsEqual (theOther.myQuantOrigin, 0.0)
+     && myQuantStep  .IsEqual (theOther.myQuantStep,   0.0))))
   {
     // fast copy
     NCollection_AliasedArray::Assign (theOther);
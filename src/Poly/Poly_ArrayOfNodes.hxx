@@ -20,8 +20,14 @@
 #include <Standard_Macro.hxx>
 
 //! Defines an array of 3D nodes of single/double precision configurable at construction time.
+//! Alternatively, the nodes can be quantized to 16-bit unsigned integers within some range (see SetQuantized()).
 class Poly_ArrayOfNodes : public NCollection_AliasedArray<>
 {
+public:
+
+  //! Node quantized to 16-bit unsigned integers.
+  typedef NCollection_Vec3<uint16_t> QuantizedNode;
+
 public:
 
   //! Empty constructor of double-precision array.
@@ -70,6 +76,34 @@ public:
     myStride = Standard_Integer(theIsDouble ? sizeof(gp_Pnt) : sizeof(gp_Vec3f));
   }
 
+  //! Returns TRUE if array defines nodes quantized to 16-bit unsigned integers.
+  bool IsQuantized() const { return myStride == (Standard_Integer )sizeof(QuantizedNode); }
+
+  //! Sets if array should define nodes quantized to 16-bit unsigned integers
+  //! within the range [theMin, theMax], which takes 4 times less memory than double precision.
+  //! The node is restored with an error up to half of the quantization step, i.e. 1/131070 of the range along each axis;
+  //! the nodes out of the range are clamped to it.
+  //! Raises exception if array was already allocated.
+  void SetQuantized (const gp_XYZ& theMin,
+                     const gp_XYZ& theMax)
+  {
+    if (myData != NULL) { throw Standard_ProgramError ("Poly_ArrayOfNodes::SetQuantized() should be called before allocation"); }
+    myStride = (Standard_Integer )sizeof(QuantizedNode);
+    myQuantOrigin = theMin;
+    for (Standard_Integer aCoordIter = 1; aCoordIter <= 3; ++aCoordIter)
+    {
+      const Standard_Real aRange = theMax.Coord (aCoordIter) - theMin.Coord (aCoordIter);
+      myQuantStep   .SetCoord (aCoordIter, aRange > 0.0 ? aRange / THE_QUANT_MAX : 0.0);
+      myQuantInvStep.SetCoord (aCoordIter, aRange > 0.0 ? THE_QUANT_MAX / aRange : 0.0);
+    }
+  }
+
+  //! Returns the lower corner of the quantization range.
+  const gp_XYZ& QuantizationOrigin() const { return myQuantOrigin; }
+
+  //! Returns the quantization step along each axis.
+  const gp_XYZ& QuantizationStep() const { return myQuantStep; }
+
   //! Copies data of theOther array to this.
   //! The arrays should have the same length,
   //! but may have different precision / number of components (data conversion will be applied in the latter case).
@@ -79,6 +113,9 @@ public:
   Poly_ArrayOfNodes& Move (Poly_ArrayOfNodes& theOther)
   {
     NCollection_AliasedArray::Move (theOther);
+    myQuantOrigin  = theOther.myQuantOrigin;
+    myQuantStep    = theOther.myQuantStep;
+    myQuantInvStep = theOther.myQuantInvStep;
     return *this;
   }
 
@@ -87,7 +124,10 @@ public:
 
   //! Move constructor
   Poly_ArrayOfNodes (Poly_ArrayOfNodes&& theOther) Standard_Noexcept
-  : NCollection_AliasedArray (std::move (theOther))
+  : NCollection_AliasedArray (std::move (theOther)),
+    myQuantOrigin  (theOther.myQuantOrigin),
+    myQuantStep    (theOther.myQuantStep),
+    myQuantInvStep (theOther.myQuantInvStep)
   {
     //
   }
@@ -109,6 +149,24 @@ public:
   //! operator[] - alias to Value
   gp_Pnt operator[] (Standard_Integer theIndex) const { return Value (theIndex); }
 
+private:
+
+  //! Quantizes the coordinate of the node.
+  static uint16_t quantize (const Standard_Real theValue)
+  {
+    return theValue <= 0.0
+         ? 0
+         : (theValue >= THE_QUANT_MAX ? (uint16_t )THE_QUANT_MAX : (uint16_t )(theValue + 0.5));
+  }
+
+private:
+
+  static constexpr Standard_Real THE_QUANT_MAX = 65535.0; //!< maximal value of quantized coordinate
+
+  gp_XYZ myQuantOrigin;  //!< lower corner of the quantization range
+  gp_XYZ myQuantStep;    //!< quantization step along each axis
+  gp_XYZ myQuantInvStep; //!< inversed quantization step along each axis (0 for empty range)
+
 };
 
 // =======================================================================
@@ -121,11 +179,18 @@ inline gp_Pnt Poly_ArrayOfNodes::Value (Standard_Integer theIndex) const
   {
     return NCollection_AliasedArray::Value<gp_Pnt> (theIndex);
   }
-  else
+  else if (myStride == (Standard_Integer )sizeof(gp_Vec3f))
   {
     const gp_Vec3f& aVec3 = NCollection_AliasedArray::Value<gp_Vec3f> (theIndex);
     return gp_Pnt (aVec3.x(), aVec3.y(), aVec3.z());
   }
+  else
+  {
+    const QuantizedNode& aVec3 = NCollection_AliasedArray::Value<QuantizedNode> (theIndex);
+    return gp_Pnt (myQuantOrigin.X() + myQuantStep.X() * aVec3.x(),
+                   myQuantOrigin.Y() + myQuantStep.Y() * aVec3.y(),
+                   myQuantOrigin.Z() + myQuantStep.Z() * aVec3.z());
+  }
 }
 
 // =======================================================================
@@ -138,11 +203,18 @@ inline void Poly_ArrayOfNodes::SetValue (Standard_Integer theIndex, const gp_Pnt
   {
     NCollection_AliasedArray::ChangeValue<gp_Pnt> (theIndex) = theValue;
   }
-  else
+  else if (myStride == (Standard_Integer )sizeof(gp_Vec3f))
   {
     gp_Vec3f& aVec3 = NCollection_AliasedArray::ChangeValue<gp_Vec3f> (theIndex);
     aVec3.SetValues ((float )theValue.X(), (float )theValue.Y(), (float )theValue.Z());
   }
+  else
+  {
+    QuantizedNode& aVec3 = NCollection_AliasedArray::ChangeValue<QuantizedNode> (theIndex);
+    aVec3.SetValues (quantize ((theValue.X() - myQuantOrigin.X()) * myQuantInvStep.X()),
+                     quantize ((theValue.Y() - myQuantOrigin.Y()) * myQuantInvStep.Y()),
+                     quantize ((theValue.Z() - myQuantOrigin.Z()) * myQuantInvStep.Z()));
+  }
 }
 
 #endif // _Poly_ArrayOfNodes_HeaderFile
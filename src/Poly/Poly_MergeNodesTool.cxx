@@ -14,6 +14,8 @@
 #include <Poly_MergeNodesTool.hxx>
 
 #include <NCollection_IncAllocator.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_Atomic.hxx>
 #include <Standard_CStringHasher.hxx>
 
 #include <algorithm>
@@ -27,6 +29,29 @@ namespace
          ? theNbFacets * 2 // consider ratio 1:2 (NbTriangles:MergedNodes) as expected
          : 995329;         // default initial value for mesh of unknown size
   }
+
+  //! Offsets of 26 cells neighbor to the cell.
+  static const int THE_NEIGHBRS[26][3] =
+  {
+    {-1, 0, 0},{ 1, 0, 0},{ 0,-1, 0},{ 0, 1, 0},{ 0, 0,-1},{ 0, 0, 1},
+    {-1,-1, 0},{ 1,-1, 0},{ 1, 1, 0},{-1, 1, 0},
+    { 0,-1,-1},{ 0, 1,-1},{ 0, 1, 1},{ 0,-1, 1},
+    {-1, 0,-1},{ 1, 0,-1},{ 1, 0, 1},{-1, 0, 1},
+    {-1,-1,-1},{ 1,-1,-1},{-1, 1,-1},{ 1, 1,-1},{-1,-1, 1},{ 1,-1, 1},{-1, 1, 1},{ 1, 1, 1}
+  };
+
+  //! Number of triangles or nodes processed by a single task in batch mode.
+  static const int THE_BATCH_TASK_SIZE = 65536;
+
+  //! Compute normal for the triangle (see Poly_MergeNodesTool::computeTriNormal()).
+  static NCollection_Vec3<float> triangleNormal (const gp_XYZ thePlaces[3])
+  {
+    const gp_XYZ aVec01 = thePlaces[1] - thePlaces[0];
+    const gp_XYZ aVec02 = thePlaces[2] - thePlaces[0];
+    const gp_XYZ aCross = aVec01 ^ aVec02;
+    NCollection_Vec3<float> aNorm ((float )aCross.X(), (float )aCross.Y(), (float )aCross.Z());
+    return aNorm.Normalized();
+  }
 }
 
 IMPLEMENT_STANDARD_RTTIEXT(Poly_MergeNodesTool, Standard_Transient)
@@ -211,18 +236,12 @@ inline bool Poly_MergeNodesTool::MergedNodesMap::Bind (int& theIndex,
   }
   if (myInvTol > 0.0f)
   {
-    static const CellVec3i THE_NEIGHBRS[26] =
-    {
-      CellVec3i(-1, 0, 0),CellVec3i( 1, 0, 0),CellVec3i( 0,-1, 0),CellVec3i( 0, 1, 0),CellVec3i( 0, 0,-1),CellVec3i( 0, 0, 1),
-      CellVec3i(-1,-1, 0),CellVec3i( 1,-1, 0),CellVec3i( 1, 1, 0),CellVec3i(-1, 1, 0),
-      CellVec3i( 0,-1,-1),CellVec3i( 0, 1,-1),CellVec3i( 0, 1, 1),CellVec3i( 0,-1, 1),
-      CellVec3i(-1, 0,-1),CellVec3i( 1, 0,-1),CellVec3i( 1, 0, 1),CellVec3i(-1, 0, 1),
-      CellVec3i(-1,-1,-1),CellVec3i( 1,-1,-1),CellVec3i(-1, 1,-1),CellVec3i( 1, 1,-1),CellVec3i(-1,-1, 1),CellVec3i( 1,-1, 1),CellVec3i(-1, 1, 1),CellVec3i(1, 1, 1)
-    };
     const CellVec3i anIndexCnt = vec3ToCell (thePos);
     for (int aNeigIter = 0; aNeigIter < 26; ++aNeigIter)
     {
-      const CellVec3i anIndex = anIndexCnt + THE_NEIGHBRS[aNeigIter];
+      const CellVec3i anIndex = anIndexCnt + CellVec3i (THE_NEIGHBRS[aNeigIter][0],
+                                                        THE_NEIGHBRS[aNeigIter][1],
+                                                        THE_NEIGHBRS[aNeigIter][2]);
       const size_t aHashEx = vec3iHashCode (anIndex, NbBuckets());
       for (DataMapNode* aNodeIter = aData[aHashEx]; aNodeIter != NULL;
            aNodeIter = (DataMapNode* )aNodeIter->Next())
@@ -270,6 +289,53 @@ inline void Poly_MergeNodesTool::MergedNodesMap::ReSize (const int theSize)
   }
 }
 
+// =======================================================================
+// function : MergedNodesMap::BucketIndex
+// purpose  :
+// =======================================================================
+size_t Poly_MergeNodesTool::MergedNodesMap::BucketIndex (const NCollection_Vec3<float>& thePos,
+                                                         const int theUpper) const
+{
+  return hashCode (thePos, thePos, theUpper);
+}
+
+// =======================================================================
+// function : MergedNodesMap::NeighborBucketIndexes
+// purpose  :
+// =======================================================================
+int Poly_MergeNodesTool::MergedNodesMap::NeighborBucketIndexes (const NCollection_Vec3<float>& thePos,
+                                                                const int theUpper,
+                                                                size_t theIndexes[26]) const
+{
+  if (myInvTol <= 0.0f)
+  {
+    return 0;
+  }
+
+  const CellVec3i anIndexCnt = vec3ToCell (thePos);
+  for (int aNeigIter = 0; aNeigIter < 26; ++aNeigIter)
+  {
+    const CellVec3i anIndex = anIndexCnt + CellVec3i (THE_NEIGHBRS[aNeigIter][0],
+                                                      THE_NEIGHBRS[aNeigIter][1],
+                                                      THE_NEIGHBRS[aNeigIter][2]);
+    theIndexes[aNeigIter] = vec3iHashCode (anIndex, theUpper);
+  }
+  return 26;
+}
+
+// =======================================================================
+// function : MergedNodesMap::IsMergeable
+// purpose  :
+// =======================================================================
+bool Poly_MergeNodesTool::MergedNodesMap::IsMergeable (const NCollection_Vec3<float>& thePos1,
+                                                       const NCollection_Vec3<float>& theNorm1,
+                                                       const NCollection_Vec3<float>& thePos2,
+                                                       const NCollection_Vec3<float>& theNorm2) const
+{
+  bool isOpposite = false;
+  return isEqual (Vec3AndNormal (thePos1, theNorm1), thePos2, theNorm2, isOpposite);
+}
+
 // =======================================================================
 // function : Poly_MergeNodesTool
 // purpose  :
@@ -290,7 +356,8 @@ Poly_MergeNodesTool::Poly_MergeNodesTool (const double theSmoothAngle,
   myNbDegenElems  (0),
   myNbMergedElems (0),
   myToDropDegenerative (true),
-  myToMergeElems (false)
+  myToMergeElems (false),
+  myToRunParallel (false)
 {
   SetMergeAngle (theSmoothAngle);
   SetMergeTolerance (theMergeTolerance);
@@ -360,6 +427,15 @@ void Poly_MergeNodesTool::PushLastElement (int theNbNodes)
     }
   }
 
+  pushElement (theNbNodes);
+}
+
+// =======================================================================
+// function : pushElement
+// purpose  :
+// =======================================================================
+void Poly_MergeNodesTool::pushElement (int theNbNodes)
+{
   if (myToDropDegenerative)
   {
     // warning - removing degenerate elements may produce unused nodes
@@ -448,6 +524,289 @@ void Poly_MergeNodesTool::AddTriangulation (const Handle(Poly_Triangulation)& th
   }
 }
 
+// =======================================================================
+// function : AddTriangulations
+// purpose  :
+// =======================================================================
+void Poly_MergeNodesTool::AddTriangulations (const NCollection_Vector<TriangulationItem>& theItems)
+{
+  Standard_Size aNbTris = 0;
+  for (NCollection_Vector<TriangulationItem>::Iterator anItemIter (theItems); anItemIter.More(); anItemIter.Next())
+  {
+    if (!anItemIter.Value().Triangulation.IsNull())
+    {
+      aNbTris += anItemIter.Value().Triangulation->NbTriangles();
+    }
+  }
+
+  if (!myToRunParallel
+   || myNbNodes != 0
+   || myNbElems != 0
+   || (!myNodeIndexMap.HasMergeAngle()
+    && !myNodeIndexMap.HasMergeTolerance())
+   || aNbTris > Standard_Size(IntegerLast() / 3))
+  {
+    for (NCollection_Vector<TriangulationItem>::Iterator anItemIter (theItems); anItemIter.More(); anItemIter.Next())
+    {
+      const TriangulationItem& anItem = anItemIter.Value();
+      AddTriangulation (anItem.Triangulation, anItem.Trsf, anItem.ToReverse);
+    }
+    return;
+  }
+
+  addTriangulationsBatch (theItems);
+}
+
+// =======================================================================
+// function : addTriangulationsBatch
+// purpose  :
+// =======================================================================
+void Poly_MergeNodesTool::addTriangulationsBatch (const NCollection_Vector<TriangulationItem>& theItems)
+{
+  // offsets of the triangles of each triangulation within the batch
+  const int aNbItems = theItems.Size();
+  NCollection_Array1<int> aTriOffsets (0, aNbItems);
+  int aNbTris = 0;
+  for (int anItemIter = 0; anItemIter < aNbItems; ++anItemIter)
+  {
+    aTriOffsets (anItemIter) = aNbTris;
+    const Handle(Poly_Triangulation)& aTris = theItems.Value (anItemIter).Triangulation;
+    if (!aTris.IsNull())
+    {
+      if (!myPolyData.IsNull()
+        && aNbTris == 0)
+      {
+        myPolyData->SetDoublePrecision (aTris->IsDoublePrecision());
+      }
+      aNbTris += aTris->NbTriangles();
+    }
+  }
+  aTriOffsets (aNbItems) = aNbTris;
+  if (aNbTris == 0)
+  {
+    return;
+  }
+
+  const int  aNbCorners = aNbTris * 3;
+  const bool isSingleThread = !myToRunParallel;
+  const int  aNbTriTasks    = (aNbTris    + THE_BATCH_TASK_SIZE - 1) / THE_BATCH_TASK_SIZE;
+  const int  aNbCornerTasks = (aNbCorners + THE_BATCH_TASK_SIZE - 1) / THE_BATCH_TASK_SIZE;
+
+  // returns the index of triangulation containing the triangle with specified index within the batch
+  const int* anOffsetsBegin = &aTriOffsets.First();
+  const int* anOffsetsEnd   = anOffsetsBegin + aNbItems;
+  auto findItem = [anOffsetsBegin, anOffsetsEnd](int theTriIndex)
+  {
+    return int(std::upper_bound (anOffsetsBegin, anOffsetsEnd, theTriIndex) - anOffsetsBegin) - 1;
+  };
+
+  // returns the node of triangulation defining the triangle node with specified index within the batch
+  auto cornerNode = [&theItems, &aTriOffsets](int theItem, int theCorner)
+  {
+    const TriangulationItem& anItem = theItems.Value (theItem);
+    const Poly_Triangle aTri = anItem.Triangulation->Triangle (theCorner / 3 - aTriOffsets (theItem) + 1);
+    int aTriNode = theCorner % 3;
+    if (anItem.ToReverse
+     && aTriNode != 0)
+    {
+      aTriNode = 3 - aTriNode;
+    }
+    return anItem.Triangulation->Node (aTri.Value (aTriNode + 1)).Transformed (anItem.Trsf);
+  };
+
+  // positions of triangle nodes and normals to triangles;
+  // triangle nodes are binned into buckets of spatial cells at once, bucket indexes are within [1, aNbBuckets] range
+  const bool toComputeNormals = !myNodeIndexMap.ToMergeAnyAngle();
+  const NCollection_Vec3<float> aDefNormal (0.0f, 0.0f, 1.0f);
+  const int aNbBuckets = aNbCorners;
+  NCollection_Array1<NCollection_Vec3<float>> aPositions (0, aNbCorners - 1);
+  NCollection_Array1<NCollection_Vec3<float>> aNormals   (0, toComputeNormals ? aNbTris - 1 : 0);
+  NCollection_Array1<int> aBucketStarts (0, aNbBuckets + 1);
+  NCollection_Array1<int> aNodeIndexes  (0, aNbCorners - 1); // bucket indexes at first
+  aBucketStarts.Init (0);
+  OSD_Parallel::For (0, aNbTriTasks, [&](int theTaskIndex)
+  {
+    const int aTriLower = theTaskIndex * THE_BATCH_TASK_SIZE;
+    const int aTriUpper = Min (aTriLower + THE_BATCH_TASK_SIZE, aNbTris);
+    int anItem = findItem (aTriLower);
+    for (int aTriIter = aTriLower; aTriIter < aTriUpper; ++aTriIter)
+    {
+      while (aTriIter >= aTriOffsets (anItem + 1))
+      {
+        ++anItem;
+      }
+
+      gp_XYZ aPlaces[3];
+      for (int aTriNodeIter = 0; aTriNodeIter < 3; ++aTriNodeIter)
+      {
+        const int aCorner = aTriIter * 3 + aTriNodeIter;
+        aPlaces[aTriNodeIter] = cornerNode (anItem, aCorner).XYZ();
+        aPositions (aCorner) = NCollection_Vec3<float> ((float )aPlaces[aTriNodeIter].X(),
+                                                        (float )aPlaces[aTriNodeIter].Y(),
+                                                        (float )aPlaces[aTriNodeIter].Z());
+        const int aBucket = (int )myNodeIndexMap.BucketIndex (aPositions (aCorner), aNbBuckets);
+        aNodeIndexes (aCorner) = aBucket;
+        Standard_Atomic_Increment (&aBucketStarts (aBucket));
+      }
+      if (toComputeNormals)
+      {
+        aNormals (aTriIter) = triangleNormal (aPlaces);
+      }
+    }
+  }, isSingleThread);
+
+  // sort triangle nodes by buckets keeping them in order of addition within the bucket;
+  // the last element of bucket starts keeps the end of the last bucket
+  int aSum = 0;
+  for (int aBucketIter = 0; aBucketIter <= aNbBuckets + 1; ++aBucketIter)
+  {
+    const int aBucketSize = aBucketStarts (aBucketIter);
+    aBucketStarts (aBucketIter) = aSum;
+    aSum += aBucketSize;
+  }
+  NCollection_Array1<int> aBucketCorners (0, aNbCorners - 1);
+  {
+    NCollection_Array1<int> aBucketFill (aBucketStarts);
+    OSD_Parallel::For (0, aNbCornerTasks, [&](int theTaskIndex)
+    {
+      const int aLower = theTaskIndex * THE_BATCH_TASK_SIZE;
+      const int anUpper = Min (aLower + THE_BATCH_TASK_SIZE, aNbCorners);
+      for (int aCornerIter = aLower; aCornerIter < anUpper; ++aCornerIter)
+      {
+        const int aPos = Standard_Atomic_Increment (&aBucketFill (aNodeIndexes (aCornerIter))) - 1;
+        aBucketCorners (aPos) = aCornerIter;
+      }
+    }, isSingleThread);
+  }
+  int* aBucketCornersData = &aBucketCorners.ChangeFirst();
+  OSD_Parallel::For (0, (aNbBuckets + 1 + THE_BATCH_TASK_SIZE - 1) / THE_BATCH_TASK_SIZE, [&](int theTaskIndex)
+  {
+    const int aLower = theTaskIndex * THE_BATCH_TASK_SIZE;
+    const int anUpper = Min (aLower + THE_BATCH_TASK_SIZE, aNbBuckets + 1);
+    for (int aBucketIter = aLower; aBucketIter < anUpper; ++aBucketIter)
+    {
+      std::sort (aBucketCornersData + aBucketStarts (aBucketIter),
+                 aBucketCornersData + aBucketStarts (aBucketIter + 1));
+    }
+  }, isSingleThread);
+
+  // returns the node preceding the specified one which should be merged with it (or -1),
+  // optionally skipping already merged nodes (with the first node of their group different from themselves);
+  // as in MergedNodesMap::Bind(), the node of the same cell is preferred over the ones of neighbor cells,
+  // and the node added last is preferred over the ones added before;
+  // the search can be continued after the node found before
+  NCollection_Array1<int> aFirstNodes (0, aNbCorners - 1);
+  auto findMatchingNode = [&](int theCorner, bool theToSkipMerged, int theFoundBefore)
+  {
+    const NCollection_Vec3<float>& aPos  = aPositions (theCorner);
+    const NCollection_Vec3<float>& aNorm = toComputeNormals ? aNormals (theCorner / 3) : aDefNormal;
+    size_t aBuckets[27];
+    aBuckets[0] = myNodeIndexMap.BucketIndex (aPos, aNbBuckets);
+    const int aNbCheckBuckets = 1 + myNodeIndexMap.NeighborBucketIndexes (aPos, aNbBuckets, aBuckets + 1);
+    int aFirstBucket = 0;
+    if (theFoundBefore >= 0)
+    {
+      // buckets preceding the one of found node have no matching nodes at all
+      const size_t aBucketBefore = myNodeIndexMap.BucketIndex (aPositions (theFoundBefore), aNbBuckets);
+      for (; aBuckets[aFirstBucket] != aBucketBefore; ++aFirstBucket) {}
+    }
+
+    for (int aBucketIter = aFirstBucket; aBucketIter < aNbCheckBuckets; ++aBucketIter)
+    {
+      const int aBucket = (int )aBuckets[aBucketIter];
+      const int* aBucketBegin = aBucketCornersData + aBucketStarts (aBucket);
+      const int* aBucketEnd   = aBucketCornersData + aBucketStarts (aBucket + 1);
+      const int  aBucketLimit = aBucketIter == aFirstBucket && theFoundBefore >= 0 ? theFoundBefore : theCorner;
+      for (const int* aNodeIter = std::lower_bound (aBucketBegin, aBucketEnd, aBucketLimit);
+           aNodeIter != aBucketBegin; )
+      {
+        const int anOther = *--aNodeIter;
+        if (theToSkipMerged
+         && aFirstNodes (anOther) != anOther)
+        {
+          continue;
+        }
+        if (myNodeIndexMap.IsMergeable (aPositions (anOther),
+                                        toComputeNormals ? aNormals (anOther / 3) : aDefNormal,
+                                        aPos, aNorm))
+        {
+          return anOther;
+        }
+      }
+    }
+    return -1;
+  };
+
+  OSD_Parallel::For (0, aNbCornerTasks, [&](int theTaskIndex)
+  {
+    const int aLower = theTaskIndex * THE_BATCH_TASK_SIZE;
+    const int anUpper = Min (aLower + THE_BATCH_TASK_SIZE, aNbCorners);
+    for (int aCornerIter = aLower; aCornerIter < anUpper; ++aCornerIter)
+    {
+      aFirstNodes (aCornerIter) = findMatchingNode (aCornerIter, false, -1);
+    }
+  }, isSingleThread);
+
+  // the matching node is the node to merge with, if it is not merged itself;
+  // otherwise (rare case of chain of matching nodes) the matching non-merged node is searched;
+  // the node without matching nodes starts a new group, so that the set of resulting nodes
+  // and their order are the same as in sequential merging
+  int aNbNodes = 0;
+  for (int aCornerIter = 0; aCornerIter < aNbCorners; ++aCornerIter)
+  {
+    int aFirstNode = aFirstNodes (aCornerIter);
+    if (aFirstNode >= 0
+     && aFirstNodes (aFirstNode) != aFirstNode)
+    {
+      aFirstNode = findMatchingNode (aCornerIter, true, aFirstNode);
+    }
+
+    if (aFirstNode < 0)
+    {
+      aFirstNodes  (aCornerIter) = aCornerIter;
+      aNodeIndexes (aCornerIter) = aNbNodes++;
+    }
+    else
+    {
+      aFirstNodes  (aCornerIter) = aFirstNode;
+      aNodeIndexes (aCornerIter) = aNodeIndexes (aFirstNode);
+    }
+  }
+
+  myNbNodes = aNbNodes;
+  if (!myPolyData.IsNull())
+  {
+    myPolyData->ResizeNodes     (aNbNodes, false);
+    myPolyData->ResizeTriangles (aNbTris,  false);
+    OSD_Parallel::For (0, aNbTriTasks, [&](int theTaskIndex)
+    {
+      const int aTriLower = theTaskIndex * THE_BATCH_TASK_SIZE;
+      const int aTriUpper = Min (aTriLower + THE_BATCH_TASK_SIZE, aNbTris);
+      int anItem = findItem (aTriLower);
+      for (int aCornerIter = aTriLower * 3; aCornerIter < aTriUpper * 3; ++aCornerIter)
+      {
+        while (aCornerIter / 3 >= aTriOffsets (anItem + 1))
+        {
+          ++anItem;
+        }
+        if (aFirstNodes (aCornerIter) == aCornerIter)
+        {
+          myPolyData->SetNode (aNodeIndexes (aCornerIter) + 1, cornerNode (anItem, aCornerIter).XYZ() * myUnitFactor);
+        }
+      }
+    }, isSingleThread);
+  }
+
+  for (int aTriIter = 0; aTriIter < aNbTris; ++aTriIter)
+  {
+    myNodeInds[0] = aNodeIndexes (aTriIter * 3);
+    myNodeInds[1] = aNodeIndexes (aTriIter * 3 + 1);
+    myNodeInds[2] = aNodeIndexes (aTriIter * 3 + 2);
+    myNodeInds[3] = -1;
+    pushElement (3);
+  }
+}
+
 // =======================================================================
 // function : Result
 // purpose  :
@@ -493,3 +852,31 @@ Handle(Poly_Triangulation) Poly_MergeNodesTool::MergeNodes (const Handle(Poly_Tr
   }
   return aMergeTool.Result();
 }
+
+// =======================================================================
+// function : MergeNodes
+// purpose  :
+// =======================================================================
+Handle(Poly_Triangulation) Poly_MergeNodesTool::MergeNodes (const NCollection_Vector<TriangulationItem>& theItems,
+                                                            const double theSmoothAngle,
+                                                            const double theMergeTolerance,
+                                                            const bool   theToRunParallel)
+{
+  int aNbTris = 0;
+  for (NCollection_Vector<TriangulationItem>::Iterator anItemIter (theItems); anItemIter.More(); anItemIter.Next())
+  {
+    if (!anItemIter.Value().Triangulation.IsNull())
+    {
+      aNbTris += anItemIter.Value().Triangulation->NbTriangles();
+    }
+  }
+  if (aNbTris < 1)
+  {
+    return Handle(Poly_Triangulation)();
+  }
+
+  Poly_MergeNodesTool aMergeTool (theSmoothAngle, theMergeTolerance, aNbTris);
+  aMergeTool.SetRunParallel (theToRunParallel);
+  aMergeTool.AddTriangulations (theItems);
+  return aMergeTool.Result();
+}
@@ -15,6 +15,7 @@
 #define _Poly_MergeNodesTool_HeaderFile
 
 #include <NCollection_Map.hxx>
+#include <NCollection_Vector.hxx>
 #include <Poly_Triangulation.hxx>
 #include <Standard_HashUtils.hxx>
 
@@ -23,6 +24,23 @@
 class Poly_MergeNodesTool : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(Poly_MergeNodesTool, Standard_Transient)
+public:
+
+  //! Triangulation to be added by AddTriangulations() with its placement.
+  struct TriangulationItem
+  {
+    Handle(Poly_Triangulation) Triangulation; //!< triangulation to add
+    gp_Trsf                    Trsf;          //!< transformation to apply
+    Standard_Boolean           ToReverse;     //!< reverse triangle nodes order
+
+    TriangulationItem() : ToReverse (false) {}
+
+    TriangulationItem (const Handle(Poly_Triangulation)& theTris,
+                       const gp_Trsf& theTrsf = gp_Trsf(),
+                       const Standard_Boolean theToReverse = false)
+    : Triangulation (theTris), Trsf (theTrsf), ToReverse (theToReverse) {}
+  };
+
 public:
 
   //! Merge nodes of existing mesh and return the new mesh.
@@ -40,6 +58,17 @@ public:
                                                                 const double theMergeTolerance = 0.0,
                                                                 const bool   theToForce = true);
 
+  //! Merge nodes of several triangulations into a single mesh (see AddTriangulations()).
+  //! @param[in] theItems triangulations to merge
+  //! @param[in] theSmoothAngle merge angle in radians
+  //! @param[in] theMergeTolerance linear merge tolerance
+  //! @param[in] theToRunParallel flag to use several threads (see SetRunParallel())
+  //! @return merged triangulation or NULL on no result
+  Standard_EXPORT static Handle(Poly_Triangulation) MergeNodes (const NCollection_Vector<TriangulationItem>& theItems,
+                                                                const double theSmoothAngle,
+                                                                const double theMergeTolerance = 0.0,
+                                                                const bool   theToRunParallel = true);
+
 public:
 
   //! Constructor
@@ -83,6 +112,12 @@ public:
   //! Set if equal elements should be filtered.
   void SetMergeElems (bool theToMerge) { myToMergeElems = theToMerge; }
 
+  //! Return TRUE if AddTriangulations() should use several threads; FALSE by default.
+  bool ToRunParallel() const { return myToRunParallel; }
+
+  //! Set if AddTriangulations() should use several threads.
+  void SetRunParallel (bool theToRunParallel) { myToRunParallel = theToRunParallel; }
+
   //! Compute normal for the mesh element.
   NCollection_Vec3<float> computeTriNormal() const
   {
@@ -103,6 +138,20 @@ public:
                                                  const gp_Trsf& theTrsf = gp_Trsf(),
                                                  const Standard_Boolean theToReverse = false);
 
+  //! Add several triangulations at once.
+  //! When ToRunParallel() is set, instead of binding nodes to the map one by one, all nodes are binned
+  //! into buckets of spatial cells concurrently (counting sort with atomic counters),
+  //! and the node to merge with is searched within neighbor cells concurrently for each node,
+  //! so that only the final assignment of node indexes is sequential.
+  //! The node to merge with is chosen with the same priorities as in the map,
+  //! so that the result does not depend on the number of threads and is the same as
+  //! of adding the same triangulations by AddTriangulation() one by one
+  //! (up to rare collisions of hash codes of neighbor cells).
+  //! Batch processing is applied only to the tool without data, otherwise triangulations are added one by one;
+  //! nodes added in batch are not used for merging nodes of elements added later.
+  //! @param[in] theItems triangulations to add
+  Standard_EXPORT virtual void AddTriangulations (const NCollection_Vector<TriangulationItem>& theItems);
+
   //! Prepare and return result triangulation (temporary data will be truncated to result size).
   Standard_EXPORT Handle(Poly_Triangulation) Result();
 
@@ -162,6 +211,12 @@ public:
 
 private:
 
+  //! Add triangulations in batch (see AddTriangulations()).
+  void addTriangulationsBatch (const NCollection_Vector<TriangulationItem>& theItems);
+
+  //! Push element with node indexes defined by myNodeInds, filtering degenerate and equal elements.
+  void pushElement (int theNbNodes);
+
   //! Push triangle node with normal angle comparison.
   void pushNodeCheck (bool& theIsOpposite,
                       const int theTriNode)
@@ -272,6 +327,29 @@ private:
     //! ReSize the map.
     Standard_EXPORT void ReSize (const int theSize);
 
+  public: //! @name interface for merging nodes in batch
+
+    //! Return index of bucket within [1, theUpper] range for the node position;
+    //! nodes which could be merged have the same index of bucket or the index of one of neighbor cells.
+    Standard_EXPORT size_t BucketIndex (const NCollection_Vec3<float>& thePos,
+                                        const int theUpper) const;
+
+    //! Return indexes of buckets of 26 cells neighbor to the cell of node position;
+    //! nothing is returned for zero merge tolerance.
+    Standard_EXPORT int NeighborBucketIndexes (const NCollection_Vec3<float>& thePos,
+                                               const int theUpper,
+                                               size_t theIndexes[26]) const;
+
+    //! Return TRUE if the node should be merged with the already bound node.
+    //! @param thePos1  [in] position of bound node
+    //! @param theNorm1 [in] element normal of bound node
+    //! @param thePos2  [in] position of node to merge
+    //! @param theNorm2 [in] element normal of node to merge
+    Standard_EXPORT bool IsMergeable (const NCollection_Vec3<float>& thePos1,
+                                      const NCollection_Vec3<float>& theNorm1,
+                                      const NCollection_Vec3<float>& thePos2,
+                                      const NCollection_Vec3<float>& theNorm2) const;
+
   private:
 
     //! Return cell index for specified 3D point and inverted cell size.
@@ -346,6 +424,7 @@ private:
   Standard_Integer           myNbMergedElems;      //!< number of merged elements
   Standard_Boolean           myToDropDegenerative; //!< flag to filter our degenerate elements
   Standard_Boolean           myToMergeElems;       //!< flag to merge elements
+  Standard_Boolean           myToRunParallel;      //!< flag to add triangulations in batch using several threads
 
 };
 
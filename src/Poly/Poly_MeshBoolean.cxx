@@ -0,0 +1,2716 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Poly_MeshBoolean.hxx>
+
+#include <Bnd_Box.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <gp_XY.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Map.hxx>
+#include <OSD_Parallel.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <stdint.h>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(Poly_MeshBoolean, Standard_Transient)
+
+namespace
+{
+  //! Half of the machine epsilon for the round-to-nearest arithmetic.
+  static const double THE_EPS = 1.1102230246251565e-16;
+
+  //! Relative error bound of the floating-point evaluation of the 2D orientation.
+  static const double THE_ORIENT2D_BOUND = (3.0 + 16.0 * THE_EPS) * THE_EPS;
+
+  //! Relative error bound of the floating-point evaluation of the 3D orientation.
+  static const double THE_ORIENT3D_BOUND = (7.0 + 56.0 * THE_EPS) * THE_EPS;
+
+  //! Number of pairs of triangles intersected by one parallel task.
+  static const int THE_NB_PAIRS_PER_TASK = 256;
+
+  //! Maximal depth of recursion of the insertion of the constraint edge.
+  static const int THE_MAX_CONSTRAINT_DEPTH = 64;
+
+  //! Relative tolerance of the barycentric coordinates of the ray hits considered ambiguous.
+  static const double THE_RAY_TOLERANCE = 1.0e-9;
+
+  //! Codes of the features of the mesh: vertex (node), edge and triangle.
+  enum FeatureType
+  {
+    FeatureType_Vertex   = 0,
+    FeatureType_Edge     = 1,
+    FeatureType_Triangle = 2
+  };
+
+  //! Return the code of the feature of the mesh.
+  static int featureCode (const int theIndex, const FeatureType theType) { return (theIndex << 2) | theType; }
+
+  //! Return the type of the feature.
+  static FeatureType featureType (const int theCode) { return FeatureType (theCode & 3); }
+
+  //! Return the index of the feature (node, edge or triangle) in the mesh.
+  static int featureIndex (const int theCode) { return theCode >> 2; }
+
+  //! Return the key of the pair of integers; the pair is ordered if theIsOrdered is FALSE.
+  static uint64_t pairKey (const int theFirst, const int theSecond, const bool theIsOrdered = true)
+  {
+    if (!theIsOrdered && theFirst > theSecond)
+    {
+      return pairKey (theSecond, theFirst);
+    }
+    return (uint64_t (uint32_t (theFirst)) << 32) | uint64_t (uint32_t (theSecond));
+  }
+
+  // =======================================================================
+  // Exact arithmetic on floating-point expansions (J.R. Shewchuk)
+  // =======================================================================
+
+  //! Sum of two values as the non-overlapping pair (theSum + theErr).
+  static void twoSum (const double theA, const double theB, double& theSum, double& theErr)
+  {
+    theSum = theA + theB;
+    const double aBVirt = theSum - theA;
+    const double anAVirt = theSum - aBVirt;
+    theErr = (theA - anAVirt) + (theB - aBVirt);
+  }
+
+  //! Difference of two values as the non-overlapping pair (theDiff + theErr).
+  static void twoDiff (const double theA, const double theB, double& theDiff, double& theErr)
+  {
+    theDiff = theA - theB;
+    const double aBVirt = theA - theDiff;
+    const double anAVirt = theDiff + aBVirt;
+    theErr = (theA - anAVirt) + (aBVirt - theB);
+  }
+
+  //! Product of two values as the non-overlapping pair (theProd + theErr).
+  static void twoProduct (const double theA, const double theB, double& theProd, double& theErr)
+  {
+    theProd = theA * theB;
+    theErr = std::fma (theA, theB, -theProd);
+  }
+
+  //! Exact value represented as the sum of non-overlapping components of increasing magnitude.
+  //! The length of the expansions used by the predicates is bounded by 192 components.
+  class Expansion
+  {
+  public:
+
+    //! Zero value.
+    Expansion() : myLength (0) {}
+
+    //! Exact difference of two values.
+    static Expansion Diff (const double theA, const double theB)
+    {
+      Expansion aRes;
+      double aDiff = 0.0, anErr = 0.0;
+      twoDiff (theA, theB, aDiff, anErr);
+      aRes.add (anErr);
+      aRes.add (aDiff);
+      return aRes;
+    }
+
+    //! Return the sign of the value.
+    int Sign() const
+    {
+      return myLength == 0 ? 0 : (myTerms[myLength - 1] > 0.0 ? 1 : -1);
+    }
+
+    Expansion operator+ (const Expansion& theOther) const
+    {
+      Expansion aRes (*this);
+      for (int i = 0; i < theOther.myLength; ++i)
+      {
+        aRes.grow (theOther.myTerms[i]);
+      }
+      return aRes;
+    }
+
+    Expansion operator- (const Expansion& theOther) const
+    {
+      Expansion aRes (*this);
+      for (int i = 0; i < theOther.myLength; ++i)
+      {
+        aRes.grow (-theOther.myTerms[i]);
+      }
+      return aRes;
+    }
+
+    Expansion operator* (const Expansion& theOther) const
+    {
+      Expansion aRes;
+      for (int i = 0; i < theOther.myLength; ++i)
+      {
+        aRes = aRes + scale (theOther.myTerms[i]);
+      }
+      return aRes;
+    }
+
+  private:
+
+    //! Appends the component larger than all existing ones.
+    void add (const double theValue)
+    {
+      if (theValue != 0.0)
+      {
+        myTerms[myLength++] = theValue;
+      }
+    }
+
+    //! Adds the value to the expansion eliminating zero components.
+    void grow (const double theValue)
+    {
+      double aQ = theValue;
+      int aNewLength = 0;
+      for (int i = 0; i < myLength; ++i)
+      {
+        double aSum = 0.0, anErr = 0.0;
+        twoSum (aQ, myTerms[i], aSum, anErr);
+        aQ = aSum;
+        if (anErr != 0.0)
+        {
+          myTerms[aNewLength++] = anErr;
+        }
+      }
+      myLength = aNewLength;
+      add (aQ);
+    }
+
+    //! Return the expansion multiplied by the value.
+    Expansion scale (const double theValue) const
+    {
+      Expansion aRes;
+      if (myLength == 0 || theValue == 0.0)
+      {
+        return aRes;
+      }
+
+      double aQ = 0.0, anErr = 0.0;
+      twoProduct (myTerms[0], theValue, aQ, anErr);
+      aRes.add (anErr);
+      for (int i = 1; i < myLength; ++i)
+      {
+        double aProd = 0.0, aProdErr = 0.0, aSum = 0.0, aSumErr = 0.0;
+        twoProduct (myTerms[i], theValue, aProd, aProdErr);
+        twoSum (aQ, aProdErr, aSum, aSumErr);
+        aRes.add (aSumErr);
+        aQ = aProd + aSum;
+        aRes.add (aSum - (aQ - aProd));
+      }
+      aRes.add (aQ);
+      return aRes;
+    }
+
+  private:
+
+    double myTerms[256];
+    int    myLength;
+  };
+
+  //! Return the sign of the value.
+  static int signOf (const double theValue)
+  {
+    return theValue > 0.0 ? 1 : (theValue < 0.0 ? -1 : 0);
+  }
+
+  //! Return the sign of the orientation of the point theC relative to the line (theA, theB):
+  //! positive if theC lies on the left side of the line.
+  static int orient2d (const gp_XY& theA, const gp_XY& theB, const gp_XY& theC)
+  {
+    const double aLeft  = (theB.X() - theA.X()) * (theC.Y() - theA.Y());
+    const double aRight = (theB.Y() - theA.Y()) * (theC.X() - theA.X());
+    const double aDet = aLeft - aRight;
+    const double aBound = THE_ORIENT2D_BOUND * (Abs (aLeft) + Abs (aRight));
+    if (Abs (aDet) > aBound)
+    {
+      return signOf (aDet);
+    }
+
+    const Expansion aBAx = Expansion::Diff (theB.X(), theA.X());
+    const Expansion aBAy = Expansion::Diff (theB.Y(), theA.Y());
+    const Expansion aCAx = Expansion::Diff (theC.X(), theA.X());
+    const Expansion aCAy = Expansion::Diff (theC.Y(), theA.Y());
+    return (aBAx * aCAy - aBAy * aCAx).Sign();
+  }
+
+  //! Return the sign of the orientation of the point theD relative to the plane (theA, theB, theC):
+  //! the sign of the mixed product ((theB - theA) ^ (theC - theA)) * (theD - theA),
+  //! positive if theD lies on the side of the normal of the triangle.
+  static int orient3d (const gp_XYZ& theA, const gp_XYZ& theB, const gp_XYZ& theC, const gp_XYZ& theD)
+  {
+    const gp_XYZ aBA = theB - theA;
+    const gp_XYZ aCA = theC - theA;
+    const gp_XYZ aDA = theD - theA;
+    const double aX = aBA.Y() * aCA.Z() - aBA.Z() * aCA.Y();
+    const double aY = aBA.Z() * aCA.X() - aBA.X() * aCA.Z();
+    const double aZ = aBA.X() * aCA.Y() - aBA.Y() * aCA.X();
+    const double aDet = aX * aDA.X() + aY * aDA.Y() + aZ * aDA.Z();
+    const double aPermanent =
+        (Abs (aBA.Y() * aCA.Z()) + Abs (aBA.Z() * aCA.Y())) * Abs (aDA.X())
+      + (Abs (aBA.Z() * aCA.X()) + Abs (aBA.X() * aCA.Z())) * Abs (aDA.Y())
+      + (Abs (aBA.X() * aCA.Y()) + Abs (aBA.Y() * aCA.X())) * Abs (aDA.Z());
+    if (Abs (aDet) > THE_ORIENT3D_BOUND * aPermanent)
+    {
+      return signOf (aDet);
+    }
+
+    const Expansion aBAx = Expansion::Diff (theB.X(), theA.X());
+    const Expansion aBAy = Expansion::Diff (theB.Y(), theA.Y());
+    const Expansion aBAz = Expansion::Diff (theB.Z(), theA.Z());
+    const Expansion aCAx = Expansion::Diff (theC.X(), theA.X());
+    const Expansion aCAy = Expansion::Diff (theC.Y(), theA.Y());
+    const Expansion aCAz = Expansion::Diff (theC.Z(), theA.Z());
+    const Expansion aDAx = Expansion::Diff (theD.X(), theA.X());
+    const Expansion aDAy = Expansion::Diff (theD.Y(), theA.Y());
+    const Expansion aDAz = Expansion::Diff (theD.Z(), theA.Z());
+    const Expansion aNx = aBAy * aCAz - aBAz * aCAy;
+    const Expansion aNy = aBAz * aCAx - aBAx * aCAz;
+    const Expansion aNz = aBAx * aCAy - aBAy * aCAx;
+    return (aNx * aDAx + aNy * aDAy + aNz * aDAz).Sign();
+  }
+
+  //! Return TRUE if the point theD lies strictly inside the circumcircle of the triangle (theA, theB, theC)
+  //! oriented counterclockwise. The test is used for the quality of the triangulation only, thus the
+  //! points close to the circle are considered outside to avoid the cycles of flips.
+  static bool isInCircle (const gp_XY& theA, const gp_XY& theB, const gp_XY& theC, const gp_XY& theD)
+  {
+    const double aAdx = theA.X() - theD.X(), aAdy = theA.Y() - theD.Y();
+    const double aBdx = theB.X() - theD.X(), aBdy = theB.Y() - theD.Y();
+    const double aCdx = theC.X() - theD.X(), aCdy = theC.Y() - theD.Y();
+    const double aALift = aAdx * aAdx + aAdy * aAdy;
+    const double aBLift = aBdx * aBdx + aBdy * aBdy;
+    const double aCLift = aCdx * aCdx + aCdy * aCdy;
+    const double aDet = aALift * (aBdx * aCdy - aCdx * aBdy)
+                      + aBLift * (aCdx * aAdy - aAdx * aCdy)
+                      + aCLift * (aAdx * aBdy - aBdx * aAdy);
+    const double aPermanent = aALift * (Abs (aBdx * aCdy) + Abs (aCdx * aBdy))
+                            + aBLift * (Abs (aCdx * aAdy) + Abs (aAdx * aCdy))
+                            + aCLift * (Abs (aAdx * aBdy) + Abs (aBdx * aAdy));
+    return aDet > 1.0e-12 * aPermanent;
+  }
+
+  //! Return the index of the largest by modulus coordinate of the vector (0 for X).
+  static int dominantAxis (const gp_XYZ& theVec)
+  {
+    const double aX = Abs (theVec.X()), aY = Abs (theVec.Y()), aZ = Abs (theVec.Z());
+    return (aX >= aY && aX >= aZ) ? 0 : (aY >= aZ ? 1 : 2);
+  }
+
+  //! Projection of the 3D points on the coordinate plane orthogonal to the given axis,
+  //! optionally mirrored to make the given triangle oriented counterclockwise.
+  struct Projection
+  {
+    int  Axis;     //!< index of the dropped coordinate
+    bool IsMirror; //!< flag of mirrored first coordinate
+
+    Projection (const int theAxis = 2, const bool theIsMirror = false) : Axis (theAxis), IsMirror (theIsMirror) {}
+
+    gp_XY operator() (const gp_XYZ& thePnt) const
+    {
+      // coordinates are taken in the cyclic order to keep the orientation of the plane
+      const gp_XY aPnt (thePnt.Coord ((Axis + 1) % 3 + 1), thePnt.Coord ((Axis + 2) % 3 + 1));
+      return IsMirror ? gp_XY (-aPnt.X(), aPnt.Y()) : aPnt;
+    }
+  };
+
+  // =======================================================================
+  // Input meshes
+  // =======================================================================
+
+  typedef BVH_BoxSet<double, 3, int> TriangleBoxSet;
+
+  //! Mesh argument of the operation with the topology of its edges.
+  struct MeshData
+  {
+    std::vector<gp_XYZ>  Nodes;         //!< nodes of the mesh
+    std::vector<int>     Triangles;     //!< three nodes of each triangle (0-based)
+    std::vector<int>     TriEdges;      //!< three edges of each triangle, edge k connects nodes k and k+1
+    std::vector<int>     EdgeNodes;     //!< two nodes of each edge
+    std::vector<int>     EdgeTriStart;  //!< position of the first triangle of the edge in EdgeTriList
+    std::vector<int>     EdgeTriList;   //!< triangles sharing the edges
+    std::vector<bool>    IsDegenerated; //!< flags of triangles with collinear nodes
+    opencascade::handle<TriangleBoxSet> BoxSet; //!< bounding boxes of triangles
+    int                  NodeOffset;    //!< offset of indices of the nodes in the common array of nodes
+
+    MeshData() : NodeOffset (0) {}
+
+    int NbTriangles() const { return int (Triangles.size() / 3); }
+    int NbEdges()     const { return int (EdgeNodes.size() / 2); }
+    const gp_XYZ& TriNode (const int theTri, const int theCorner) const { return Nodes[Triangles[3 * theTri + theCorner]]; }
+
+    //! Loads the nodes and the triangles of the triangulation.
+    void Load (const Handle(Poly_Triangulation)& theMesh, const int theNodeOffset)
+    {
+      NodeOffset = theNodeOffset;
+      Nodes.resize (theMesh->NbNodes());
+      for (int aNodeIter = 0; aNodeIter < theMesh->NbNodes(); ++aNodeIter)
+      {
+        Nodes[aNodeIter] = theMesh->Node (aNodeIter + 1).XYZ();
+      }
+
+      Triangles.resize (3 * theMesh->NbTriangles());
+      for (int aTriIter = 0; aTriIter < theMesh->NbTriangles(); ++aTriIter)
+      {
+        theMesh->Triangle (aTriIter + 1).Get (Triangles[3 * aTriIter], Triangles[3 * aTriIter + 1], Triangles[3 * aTriIter + 2]);
+        for (int aCorner = 0; aCorner < 3; ++aCorner)
+        {
+          --Triangles[3 * aTriIter + aCorner];
+        }
+      }
+    }
+
+    //! Moves the nodes lying within the tolerance from the nodes of the other mesh onto these nodes,
+    //! so that the coinciding parts of the meshes are handled by the exact predicates as coinciding.
+    //! The nodes moved onto the same node of the other mesh are merged.
+    //! @return number of moved nodes
+    int SnapTo (const MeshData& theOther, const double theTolerance)
+    {
+      if (theTolerance <= 0.0)
+      {
+        return 0;
+      }
+
+      std::vector<std::pair<double, int> > anOtherSorted (theOther.Nodes.size());
+      for (size_t aNodeIter = 0; aNodeIter < theOther.Nodes.size(); ++aNodeIter)
+      {
+        anOtherSorted[aNodeIter] = std::make_pair (theOther.Nodes[aNodeIter].X(), int (aNodeIter));
+      }
+      std::sort (anOtherSorted.begin(), anOtherSorted.end());
+
+      const double aSqTolerance = theTolerance * theTolerance;
+      std::vector<int> aNodeMap (Nodes.size());
+      NCollection_DataMap<int, int> aSnappedNodes;
+      int aNbSnapped = 0;
+      for (size_t aNodeIter = 0; aNodeIter < Nodes.size(); ++aNodeIter)
+      {
+        aNodeMap[aNodeIter] = int (aNodeIter);
+        const gp_XYZ& aPnt = Nodes[aNodeIter];
+        int aNearest = -1;
+        double aMinSqDist = aSqTolerance;
+        for (std::vector<std::pair<double, int> >::const_iterator anOtherIter
+               = std::lower_bound (anOtherSorted.begin(), anOtherSorted.end(), std::make_pair (aPnt.X() - theTolerance, -1));
+             anOtherIter != anOtherSorted.end() && anOtherIter->first <= aPnt.X() + theTolerance; ++anOtherIter)
+        {
+          const double aSqDist = (theOther.Nodes[anOtherIter->second] - aPnt).SquareModulus();
+          if (aSqDist <= aMinSqDist)
+          {
+            aMinSqDist = aSqDist;
+            aNearest = anOtherIter->second;
+          }
+        }
+        if (aNearest == -1)
+        {
+          continue;
+        }
+
+        if (aSnappedNodes.Find (aNearest, aNodeMap[aNodeIter]))
+        {
+          ++aNbSnapped;
+          continue;
+        }
+        aSnappedNodes.Bind (aNearest, int (aNodeIter));
+        if (!aPnt.IsEqual (theOther.Nodes[aNearest], 0.0))
+        {
+          Nodes[aNodeIter] = theOther.Nodes[aNearest];
+          ++aNbSnapped;
+        }
+      }
+
+      if (aNbSnapped != 0)
+      {
+        for (size_t aNodeIter = 0; aNodeIter < Triangles.size(); ++aNodeIter)
+        {
+          Triangles[aNodeIter] = aNodeMap[Triangles[aNodeIter]];
+        }
+      }
+      return aNbSnapped;
+    }
+
+    //! Defines the topology of the edges and the bounding boxes of the loaded triangles;
+    //! triangles with repeated nodes are skipped.
+    void Build()
+    {
+      size_t aNbKept = 0;
+      for (size_t aTriIter = 0; aTriIter < Triangles.size(); aTriIter += 3)
+      {
+        const int aN1 = Triangles[aTriIter], aN2 = Triangles[aTriIter + 1], aN3 = Triangles[aTriIter + 2];
+        if (aN1 != aN2 && aN2 != aN3 && aN3 != aN1)
+        {
+          Triangles[aNbKept++] = aN1;
+          Triangles[aNbKept++] = aN2;
+          Triangles[aNbKept++] = aN3;
+        }
+      }
+      Triangles.resize (aNbKept);
+
+      // edges are defined by the sorted sides of triangles
+      const int aNbTris = NbTriangles();
+      std::vector<std::pair<uint64_t, int> > aSides (3 * aNbTris);
+      for (int aSideIter = 0; aSideIter < 3 * aNbTris; ++aSideIter)
+      {
+        const int aNext = aSideIter - aSideIter % 3 + (aSideIter + 1) % 3;
+        aSides[aSideIter] = std::make_pair (pairKey (Triangles[aSideIter], Triangles[aNext], false), aSideIter);
+      }
+      std::sort (aSides.begin(), aSides.end());
+
+      TriEdges.resize (3 * aNbTris);
+      EdgeTriList.reserve (3 * aNbTris);
+      for (size_t aFirst = 0; aFirst < aSides.size();)
+      {
+        const int anEdge = NbEdges();
+        EdgeNodes.push_back (int (aSides[aFirst].first >> 32));
+        EdgeNodes.push_back (int (aSides[aFirst].first & 0xFFFFFFFF));
+        EdgeTriStart.push_back (int (EdgeTriList.size()));
+        size_t aLast = aFirst;
+        for (; aLast < aSides.size() && aSides[aLast].first == aSides[aFirst].first; ++aLast)
+        {
+          TriEdges[aSides[aLast].second] = anEdge;
+          EdgeTriList.push_back (aSides[aLast].second / 3);
+        }
+        aFirst = aLast;
+      }
+      EdgeTriStart.push_back (int (EdgeTriList.size()));
+
+      // triangles with collinear nodes are not intersected
+      IsDegenerated.resize (aNbTris);
+      BoxSet = new TriangleBoxSet (new BVH_LinearBuilder<double, 3>());
+      BoxSet->SetSize (aNbTris);
+      for (int aTriIter = 0; aTriIter < aNbTris; ++aTriIter)
+      {
+        bool isDegenerated = true;
+        for (int anAxis = 0; anAxis < 3 && isDegenerated; ++anAxis)
+        {
+          const Projection aProj (anAxis);
+          isDegenerated = orient2d (aProj (TriNode (aTriIter, 0)), aProj (TriNode (aTriIter, 1)), aProj (TriNode (aTriIter, 2))) == 0;
+        }
+        IsDegenerated[aTriIter] = isDegenerated;
+
+        BVH_Box<double, 3> aBox;
+        for (int aCorner = 0; aCorner < 3; ++aCorner)
+        {
+          const gp_XYZ& aPnt = TriNode (aTriIter, aCorner);
+          aBox.Add (BVH_Vec3d (aPnt.X(), aPnt.Y(), aPnt.Z()));
+        }
+        BoxSet->Add (aTriIter, aBox);
+      }
+      BoxSet->Build();
+    }
+  };
+
+  //! Selector of the pairs of triangles with interfering bounding boxes.
+  class TrianglePairSelector : public BVH_PairTraverse<double, 3, TriangleBoxSet>
+  {
+  public:
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin1, const BVH_Vec3d& theCMax1,
+                                         const BVH_Vec3d& theCMin2, const BVH_Vec3d& theCMax2,
+                                         double&) const Standard_OVERRIDE
+    {
+      return BVH_Box<double, 3> (theCMin1, theCMax1).IsOut (theCMin2, theCMax2);
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                     const Standard_Integer theIndex2) Standard_OVERRIDE
+    {
+      if (myBVHSet1->Box (theIndex1).IsOut (myBVHSet2->Box (theIndex2)))
+      {
+        return Standard_False;
+      }
+      Pairs.push_back (std::make_pair (myBVHSet1->Element (theIndex1), myBVHSet2->Element (theIndex2)));
+      return Standard_True;
+    }
+
+  public:
+
+    std::vector<std::pair<int, int> > Pairs; //!< selected pairs of triangles
+  };
+
+  // =======================================================================
+  // Intersection of the pairs of triangles
+  // =======================================================================
+
+  //! Point of intersection identified by the features of both meshes containing it.
+  struct PointLabel
+  {
+    int Features[2];
+
+    bool operator== (const PointLabel& theOther) const
+    {
+      return Features[0] == theOther.Features[0] && Features[1] == theOther.Features[1];
+    }
+
+    uint64_t Key() const { return pairKey (Features[0], Features[1]); }
+  };
+
+  //! Return the label of the point.
+  static PointLabel makeLabel (const int theFeature1, const int theFeature2)
+  {
+    PointLabel aLabel;
+    aLabel.Features[0] = theFeature1;
+    aLabel.Features[1] = theFeature2;
+    return aLabel;
+  }
+
+  //! Segment of intersection of two triangles.
+  struct IntSegment
+  {
+    int        Triangles[2]; //!< intersected triangles of both meshes
+    PointLabel Ends[2];      //!< labels of the end points
+    int        Nodes[2];     //!< nodes of the end points in the common array of nodes
+    bool       IsCoplanar;   //!< flag of the segment of coplanar triangles
+  };
+
+  //! Triangle of the mesh with the codes of its features.
+  struct TriangleView
+  {
+    gp_XYZ Pnts[3];     //!< nodes
+    int    Vertices[3]; //!< codes of the vertices
+    int    Edges[3];    //!< codes of the edges, edge k connects vertices k and k+1
+    int    Interior;    //!< code of the triangle itself
+
+    TriangleView (const MeshData& theMesh, const int theTri)
+    {
+      for (int aCorner = 0; aCorner < 3; ++aCorner)
+      {
+        Pnts[aCorner] = theMesh.TriNode (theTri, aCorner);
+        Vertices[aCorner] = featureCode (theMesh.Triangles[3 * theTri + aCorner], FeatureType_Vertex);
+        Edges[aCorner] = featureCode (theMesh.TriEdges[3 * theTri + aCorner], FeatureType_Edge);
+      }
+      Interior = featureCode (theTri, FeatureType_Triangle);
+    }
+  };
+
+  //! End of the interval of the triangle on the line of intersection of the planes.
+  //! Its position on the line is compared by the edge of the triangle crossing the plane
+  //! of the other triangle, oriented from the negative side of the plane to the positive one.
+  struct IntervalEnd
+  {
+    int Feature; //!< code of the feature containing the point
+    int Org;     //!< first vertex of the edge
+    int Ext;     //!< last vertex of the edge
+  };
+
+  //! Interval of the triangle on the line of intersection of the planes.
+  struct Interval
+  {
+    IntervalEnd Min;     //!< first end
+    IntervalEnd Max;     //!< last end
+    int         Support; //!< code of the feature containing the interior of the interval
+  };
+
+  //! Computes the interval of the triangle on the line of intersection with the plane of the other triangle.
+  //! The ends are ordered along the direction N1 ^ N2, where N1 and N2 are the normals of the triangles
+  //! of the first and of the second mesh.
+  //! @param theTri [in] triangle
+  //! @param theSigns [in] orientation of the vertices of the triangle relative to the other plane
+  //! @param theIsSecond [in] flag of the triangle of the second mesh
+  static Interval computeInterval (const TriangleView& theTri, const int theSigns[3], const bool theIsSecond)
+  {
+    Interval anInterval;
+    int aLone = -1;
+    for (int i = 0; i < 3 && aLone < 0; ++i)
+    {
+      if (theSigns[i] != 0 && theSigns[(i + 1) % 3] != theSigns[i] && theSigns[(i + 2) % 3] != theSigns[i])
+      {
+        aLone = i;
+      }
+    }
+
+    if (aLone < 0)
+    {
+      // single vertex touches the plane
+      const int aVertex = theSigns[0] == 0 ? 0 : (theSigns[1] == 0 ? 1 : 2);
+      const int anOther = (aVertex + 1) % 3;
+      IntervalEnd anEnd;
+      anEnd.Feature = theTri.Vertices[aVertex];
+      anEnd.Org = theSigns[anOther] > 0 ? aVertex : anOther;
+      anEnd.Ext = theSigns[anOther] > 0 ? anOther : aVertex;
+      anInterval.Min = anInterval.Max = anEnd;
+      anInterval.Support = theTri.Interior;
+      return anInterval;
+    }
+
+    // the vertex on one side of the plane and two others on the other side or on the plane
+    const int j = (aLone + 1) % 3, k = (aLone + 2) % 3;
+    IntervalEnd anEndJ, anEndK;
+    anEndJ.Feature = theSigns[j] == 0 ? theTri.Vertices[j] : theTri.Edges[aLone];
+    anEndK.Feature = theSigns[k] == 0 ? theTri.Vertices[k] : theTri.Edges[k];
+    if (theSigns[aLone] > 0)
+    {
+      anEndJ.Org = j;     anEndJ.Ext = aLone;
+      anEndK.Org = k;     anEndK.Ext = aLone;
+    }
+    else
+    {
+      anEndJ.Org = aLone; anEndJ.Ext = j;
+      anEndK.Org = aLone; anEndK.Ext = k;
+    }
+
+    const bool isKFirst = (theSigns[aLone] > 0) != theIsSecond;
+    anInterval.Min = isKFirst ? anEndK : anEndJ;
+    anInterval.Max = isKFirst ? anEndJ : anEndK;
+    anInterval.Support = (theSigns[j] == 0 && theSigns[k] == 0) ? theTri.Edges[j] : theTri.Interior;
+    return anInterval;
+  }
+
+  //! Return the sign of the displacement from the end of the interval of the first triangle
+  //! to the end of the interval of the second triangle along the direction N1 ^ N2.
+  static int compareEnds (const TriangleView& theTri1, const IntervalEnd& theEnd1,
+                          const TriangleView& theTri2, const IntervalEnd& theEnd2)
+  {
+    return orient3d (theTri1.Pnts[theEnd1.Org], theTri1.Pnts[theEnd1.Ext],
+                     theTri2.Pnts[theEnd2.Org], theTri2.Pnts[theEnd2.Ext]);
+  }
+
+  //! Intersects the triangles lying in different planes.
+  //! @return FALSE if the triangles do not intersect or touch in a single point
+  static bool intersectTriangles (const TriangleView& theTri1, const int theSigns1[3],
+                                  const TriangleView& theTri2, const int theSigns2[3],
+                                  IntSegment& theSegment)
+  {
+    const Interval anInt1 = computeInterval (theTri1, theSigns1, false);
+    const Interval anInt2 = computeInterval (theTri2, theSigns2, true);
+    if (compareEnds (theTri1, anInt1.Min, theTri2, anInt2.Max) <= 0
+     || compareEnds (theTri1, anInt1.Max, theTri2, anInt2.Min) >= 0)
+    {
+      return false;
+    }
+
+    const int aStart = compareEnds (theTri1, anInt1.Min, theTri2, anInt2.Min);
+    theSegment.Ends[0] = aStart > 0 ? makeLabel (anInt1.Support, anInt2.Min.Feature)
+                       : (aStart < 0 ? makeLabel (anInt1.Min.Feature, anInt2.Support)
+                                     : makeLabel (anInt1.Min.Feature, anInt2.Min.Feature));
+    const int anEnd = compareEnds (theTri1, anInt1.Max, theTri2, anInt2.Max);
+    theSegment.Ends[1] = anEnd < 0 ? makeLabel (anInt1.Support, anInt2.Max.Feature)
+                       : (anEnd > 0 ? makeLabel (anInt1.Max.Feature, anInt2.Support)
+                                    : makeLabel (anInt1.Max.Feature, anInt2.Max.Feature));
+    return !(theSegment.Ends[0] == theSegment.Ends[1]);
+  }
+
+  //! Clips the edge of one triangle by the other coplanar triangle.
+  //! @param theTri [in] clipping triangle
+  //! @param theT [in] projected nodes of the clipping triangle
+  //! @param theTSign [in] orientation of the projected clipping triangle
+  //! @param theP [in] projected first node of the edge
+  //! @param theQ [in] projected last node of the edge
+  //! @param theEdgeFeatures [in] codes of the first node, last node and the edge itself
+  //! @param theIsTFirst [in] flag of the clipping triangle of the first mesh
+  //! @param theEnds [out] labels of the ends of the clipped edge
+  //! @return FALSE if the edge does not overlap the triangle by more than a point
+  static bool clipEdge (const TriangleView& theTri, const gp_XY theT[3], const int theTSign,
+                        const gp_XY& theP, const gp_XY& theQ, const int theEdgeFeatures[3],
+                        const bool theIsTFirst, PointLabel theEnds[2])
+  {
+    struct Candidate
+    {
+      double Param;
+      int    FeatureT;
+      int    FeatureE;
+    };
+    Candidate aCands[8];
+    int aNbCands = 0;
+
+    // ends of the edge inside the triangle or on its boundary
+    int aSignsP[3], aSignsQ[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      aSignsP[i] = theTSign * orient2d (theT[i], theT[(i + 1) % 3], theP);
+      aSignsQ[i] = theTSign * orient2d (theT[i], theT[(i + 1) % 3], theQ);
+    }
+    for (int anEnd = 0; anEnd < 2; ++anEnd)
+    {
+      const int* aSigns = anEnd == 0 ? aSignsP : aSignsQ;
+      if (aSigns[0] < 0 || aSigns[1] < 0 || aSigns[2] < 0)
+      {
+        continue;
+      }
+
+      const int aNbZeros = (aSigns[0] == 0) + (aSigns[1] == 0) + (aSigns[2] == 0);
+      Candidate& aCand = aCands[aNbCands++];
+      aCand.Param = anEnd == 0 ? 0.0 : 1.0;
+      aCand.FeatureE = theEdgeFeatures[anEnd];
+      aCand.FeatureT = theTri.Interior;
+      if (aNbZeros == 1)
+      {
+        aCand.FeatureT = theTri.Edges[aSigns[0] == 0 ? 0 : (aSigns[1] == 0 ? 1 : 2)];
+      }
+      else if (aNbZeros >= 2)
+      {
+        // vertex shared by two edges containing the point
+        aCand.FeatureT = theTri.Vertices[aSigns[0] != 0 ? 2 : (aSigns[1] != 0 ? 0 : 1)];
+      }
+    }
+
+    // vertices of the triangle inside the edge and crossings of the edges of the triangle
+    const gp_XY aPQ = theQ - theP;
+    const double aSqLen = aPQ.SquareModulus();
+    if (aSqLen == 0.0)
+    {
+      return false;
+    }
+    const int aCoord = Abs (aPQ.X()) >= Abs (aPQ.Y()) ? 1 : 2;
+    for (int i = 0; i < 3; ++i)
+    {
+      const gp_XY& aU = theT[i];
+      const gp_XY& aW = theT[(i + 1) % 3];
+      const int aSignU = orient2d (theP, theQ, aU);
+      if (aSignU == 0)
+      {
+        if ((aU.Coord (aCoord) - theP.Coord (aCoord)) * (aU.Coord (aCoord) - theQ.Coord (aCoord)) < 0.0)
+        {
+          Candidate& aCand = aCands[aNbCands++];
+          aCand.Param = (aU - theP).Dot (aPQ) / aSqLen;
+          aCand.FeatureT = theTri.Vertices[i];
+          aCand.FeatureE = theEdgeFeatures[2];
+        }
+        continue;
+      }
+
+      const int aSignW = orient2d (theP, theQ, aW);
+      if (aSignU * aSignW < 0 && aSignsP[i] * aSignsQ[i] < 0)
+      {
+        const gp_XY aUW = aW - aU;
+        const double aDistP = aUW.Crossed (theP - aU);
+        const double aDistQ = aUW.Crossed (theQ - aU);
+        Candidate& aCand = aCands[aNbCands++];
+        aCand.Param = aDistP / (aDistP - aDistQ);
+        aCand.FeatureT = theTri.Edges[i];
+        aCand.FeatureE = theEdgeFeatures[2];
+      }
+    }
+    if (aNbCands < 2)
+    {
+      return false;
+    }
+
+    int aFirst = 0, aLast = 0;
+    for (int i = 1; i < aNbCands; ++i)
+    {
+      aFirst = aCands[i].Param < aCands[aFirst].Param ? i : aFirst;
+      aLast  = aCands[i].Param > aCands[aLast].Param  ? i : aLast;
+    }
+    const Candidate* anEnds[2] = { &aCands[aFirst], &aCands[aLast] };
+    for (int anEnd = 0; anEnd < 2; ++anEnd)
+    {
+      theEnds[anEnd] = theIsTFirst ? makeLabel (anEnds[anEnd]->FeatureT, anEnds[anEnd]->FeatureE)
+                                   : makeLabel (anEnds[anEnd]->FeatureE, anEnds[anEnd]->FeatureT);
+    }
+    return !(theEnds[0] == theEnds[1]);
+  }
+
+  //! Intersects the coplanar triangles; the segments are the parts of the edges
+  //! of each triangle overlapping the other triangle.
+  static void intersectCoplanar (const TriangleView& theTri1, const int theTriIndex1,
+                                 const TriangleView& theTri2, const int theTriIndex2,
+                                 std::vector<IntSegment>& theSegments)
+  {
+    const gp_XYZ aNorm = (theTri1.Pnts[1] - theTri1.Pnts[0]).Crossed (theTri1.Pnts[2] - theTri1.Pnts[0]);
+    const Projection aProj (dominantAxis (aNorm));
+    gp_XY aPnts[2][3];
+    for (int i = 0; i < 3; ++i)
+    {
+      aPnts[0][i] = aProj (theTri1.Pnts[i]);
+      aPnts[1][i] = aProj (theTri2.Pnts[i]);
+    }
+    const int aSigns[2] = { orient2d (aPnts[0][0], aPnts[0][1], aPnts[0][2]),
+                            orient2d (aPnts[1][0], aPnts[1][1], aPnts[1][2]) };
+    if (aSigns[0] == 0 || aSigns[1] == 0)
+    {
+      return;
+    }
+
+    const TriangleView* aTris[2] = { &theTri1, &theTri2 };
+    for (int aClip = 0; aClip < 2; ++aClip)
+    {
+      const TriangleView& aClipTri = *aTris[aClip];
+      const TriangleView& anEdgeTri = *aTris[1 - aClip];
+      for (int k = 0; k < 3; ++k)
+      {
+        const int anEdgeFeatures[3] = { anEdgeTri.Vertices[k], anEdgeTri.Vertices[(k + 1) % 3], anEdgeTri.Edges[k] };
+        IntSegment aSegment;
+        if (clipEdge (aClipTri, aPnts[aClip], aSigns[aClip],
+                      aPnts[1 - aClip][k], aPnts[1 - aClip][(k + 1) % 3], anEdgeFeatures,
+                      aClip == 0, aSegment.Ends))
+        {
+          aSegment.Triangles[0] = theTriIndex1;
+          aSegment.Triangles[1] = theTriIndex2;
+          aSegment.Nodes[0] = aSegment.Nodes[1] = -1;
+          aSegment.IsCoplanar = true;
+          theSegments.push_back (aSegment);
+        }
+      }
+    }
+  }
+
+  //! Results of intersection of the group of pairs of triangles.
+  struct PairsIntersection
+  {
+    std::vector<IntSegment>           Segments; //!< segments of intersection
+    std::vector<std::pair<int, int> > Coplanar; //!< pairs of coplanar overlapping triangles
+  };
+
+  //! Intersects the pair of triangles.
+  static void intersectPair (const MeshData& theMesh1, const int theTri1,
+                             const MeshData& theMesh2, const int theTri2,
+                             PairsIntersection& theResult)
+  {
+    if (theMesh1.IsDegenerated[theTri1] || theMesh2.IsDegenerated[theTri2])
+    {
+      return;
+    }
+
+    const TriangleView aTri1 (theMesh1, theTri1);
+    const TriangleView aTri2 (theMesh2, theTri2);
+    int aSigns1[3], aSigns2[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      aSigns1[i] = orient3d (aTri2.Pnts[0], aTri2.Pnts[1], aTri2.Pnts[2], aTri1.Pnts[i]);
+    }
+    if (aSigns1[0] == aSigns1[1] && aSigns1[1] == aSigns1[2] && aSigns1[0] != 0)
+    {
+      return;
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+      aSigns2[i] = orient3d (aTri1.Pnts[0], aTri1.Pnts[1], aTri1.Pnts[2], aTri2.Pnts[i]);
+    }
+    if (aSigns2[0] == aSigns2[1] && aSigns2[1] == aSigns2[2] && aSigns2[0] != 0)
+    {
+      return;
+    }
+
+    const bool isCoplanar1 = aSigns1[0] == 0 && aSigns1[1] == 0 && aSigns1[2] == 0;
+    const bool isCoplanar2 = aSigns2[0] == 0 && aSigns2[1] == 0 && aSigns2[2] == 0;
+    if (isCoplanar1 != isCoplanar2)
+    {
+      return;
+    }
+
+    if (isCoplanar1)
+    {
+      const size_t aNbSegments = theResult.Segments.size();
+      intersectCoplanar (aTri1, theTri1, aTri2, theTri2, theResult.Segments);
+      if (theResult.Segments.size() > aNbSegments)
+      {
+        theResult.Coplanar.push_back (std::make_pair (theTri1, theTri2));
+      }
+      return;
+    }
+
+    IntSegment aSegment;
+    if (intersectTriangles (aTri1, aSigns1, aTri2, aSigns2, aSegment))
+    {
+      aSegment.Triangles[0] = theTri1;
+      aSegment.Triangles[1] = theTri2;
+      aSegment.Nodes[0] = aSegment.Nodes[1] = -1;
+      aSegment.IsCoplanar = false;
+      theResult.Segments.push_back (aSegment);
+    }
+  }
+
+  // =======================================================================
+  // Splitting of the triangles
+  // =======================================================================
+
+  //! Constrained Delaunay triangulation of the triangle split by the intersection segments.
+  //! The first three vertices are the corners of the triangle in the counterclockwise order.
+  class TriangleSplitter
+  {
+  public:
+
+    //! Triangle of the splitting; edge k connects nodes k and k+1.
+    struct Triangle
+    {
+      int  Nodes[3];    //!< vertices
+      int  Adjacent[3]; //!< adjacent triangles across the edges or -1 on the boundary
+      bool IsFixed[3];  //!< flags of constrained edges
+    };
+
+  public:
+
+    //! Creates the triangulation of the single triangle.
+    TriangleSplitter (const gp_XY& theP0, const gp_XY& theP1, const gp_XY& theP2)
+    : myNbFlips (0)
+    {
+      myPnts.push_back (theP0);
+      myPnts.push_back (theP1);
+      myPnts.push_back (theP2);
+      Triangle aTri;
+      for (int k = 0; k < 3; ++k)
+      {
+        aTri.Nodes[k] = k;
+        aTri.Adjacent[k] = -1;
+        aTri.IsFixed[k] = false;
+      }
+      myTris.push_back (aTri);
+    }
+
+    const gp_XY& Point (const int theVertex) const { return myPnts[theVertex]; }
+
+    const std::vector<Triangle>& Triangles() const { return myTris; }
+
+    //! Adds the vertex lying on the boundary edge (theFrom, theTo) of the triangulation.
+    int InsertOnBoundary (const gp_XY& thePnt, const int theFrom, const int theTo)
+    {
+      int aTri = -1, anEdge = -1;
+      if (!findEdge (theFrom, theTo, aTri, anEdge))
+      {
+        return InsertInside (thePnt);
+      }
+      const int aVertex = addVertex (thePnt);
+      splitEdge (aTri, anEdge, aVertex);
+      return aVertex;
+    }
+
+    //! Adds the vertex lying inside the triangulation.
+    //! @return new vertex or the existing one coinciding with the point
+    int InsertInside (const gp_XY& thePnt)
+    {
+      int aBestTri = 0;
+      double aBestDist = -RealLast();
+      for (int aTriIter = 0; aTriIter < int (myTris.size()); ++aTriIter)
+      {
+        const Triangle& aTri = myTris[aTriIter];
+        int aSigns[3];
+        bool isOut = false;
+        for (int k = 0; k < 3; ++k)
+        {
+          aSigns[k] = orient2d (myPnts[aTri.Nodes[k]], myPnts[aTri.Nodes[(k + 1) % 3]], thePnt);
+          isOut = isOut || aSigns[k] < 0;
+        }
+        if (!isOut)
+        {
+          const int aNbZeros = (aSigns[0] == 0) + (aSigns[1] == 0) + (aSigns[2] == 0);
+          if (aNbZeros >= 2)
+          {
+            return aTri.Nodes[aSigns[0] != 0 ? 2 : (aSigns[1] != 0 ? 0 : 1)];
+          }
+          const int aVertex = addVertex (thePnt);
+          const int aZeroEdge = aSigns[0] == 0 ? 0 : (aSigns[1] == 0 ? 1 : 2);
+          if (aNbZeros == 1)
+          {
+            splitEdge (aTriIter, aZeroEdge, aVertex);
+          }
+          else
+          {
+            splitTriangle (aTriIter, aVertex);
+          }
+          return aVertex;
+        }
+
+        // the point outside all triangles due to rounding of its coordinates
+        // is inserted into the nearest triangle
+        double aMinDist = RealLast();
+        for (int k = 0; k < 3; ++k)
+        {
+          const gp_XY& aP1 = myPnts[aTri.Nodes[k]];
+          const gp_XY aDir = myPnts[aTri.Nodes[(k + 1) % 3]] - aP1;
+          const double aLen = aDir.Modulus();
+          aMinDist = Min (aMinDist, aLen > 0.0 ? aDir.Crossed (thePnt - aP1) / aLen : 0.0);
+        }
+        if (aMinDist > aBestDist)
+        {
+          aBestDist = aMinDist;
+          aBestTri = aTriIter;
+        }
+      }
+
+      const int aVertex = addVertex (thePnt);
+      splitTriangle (aBestTri, aVertex);
+      return aVertex;
+    }
+
+    //! Makes the segment between two vertices the edge of the triangulation and fixes it.
+    //! @return FALSE if the edge cannot be recovered
+    bool InsertConstraint (const int theV1, const int theV2, const int theDepth = 0)
+    {
+      if (theV1 == theV2)
+      {
+        return true;
+      }
+      if (theDepth > THE_MAX_CONSTRAINT_DEPTH)
+      {
+        return false;
+      }
+      if (fixEdge (theV1, theV2))
+      {
+        return true;
+      }
+
+      // triangle around the first vertex containing the direction to the second one
+      const gp_XY& aP1 = myPnts[theV1];
+      const gp_XY& aP2 = myPnts[theV2];
+      int aStartTri = -1, aRight = -1, aLeft = -1;
+      for (int aTriIter = 0; aTriIter < int (myTris.size()) && aStartTri < 0; ++aTriIter)
+      {
+        const Triangle& aTri = myTris[aTriIter];
+        for (int k = 0; k < 3; ++k)
+        {
+          if (aTri.Nodes[k] != theV1)
+          {
+            continue;
+          }
+          const int aVA = aTri.Nodes[(k + 1) % 3];
+          const int aVB = aTri.Nodes[(k + 2) % 3];
+          const int aSignA = orient2d (aP1, myPnts[aVA], aP2);
+          const int aSignB = orient2d (aP1, myPnts[aVB], aP2);
+          if (aSignA == 0 && isBetween (theV1, aVA, theV2))
+          {
+            return InsertConstraint (theV1, aVA, theDepth + 1) && InsertConstraint (aVA, theV2, theDepth + 1);
+          }
+          if (aSignB == 0 && isBetween (theV1, aVB, theV2))
+          {
+            return InsertConstraint (theV1, aVB, theDepth + 1) && InsertConstraint (aVB, theV2, theDepth + 1);
+          }
+          if (aSignA > 0 && aSignB < 0)
+          {
+            aStartTri = aTriIter;
+            aRight = aVA;
+            aLeft = aVB;
+          }
+          break;
+        }
+      }
+      if (aStartTri < 0)
+      {
+        return false;
+      }
+
+      // edges crossed by the segment up to the second vertex or to the vertex lying on the segment
+      std::vector<std::pair<int, int> > aCrossed;
+      aCrossed.push_back (std::make_pair (aRight, aLeft));
+      int aTarget = theV2;
+      for (int aTriIter = aStartTri;;)
+      {
+        const int anAdjacent = myTris[aTriIter].Adjacent[edgeIndex (aTriIter, aRight, aLeft)];
+        if (anAdjacent < 0 || aCrossed.size() > myTris.size())
+        {
+          return false;
+        }
+        const int anOpposite = oppositeVertex (anAdjacent, aLeft, aRight);
+        if (anOpposite == theV2)
+        {
+          break;
+        }
+        const int aSign = orient2d (aP1, aP2, myPnts[anOpposite]);
+        if (aSign == 0)
+        {
+          aTarget = anOpposite;
+          break;
+        }
+        if (aSign > 0)
+        {
+          aLeft = anOpposite;
+        }
+        else
+        {
+          aRight = anOpposite;
+        }
+        aCrossed.push_back (std::make_pair (aRight, aLeft));
+        aTriIter = anAdjacent;
+      }
+
+      // flip the crossed edges until none of them crosses the segment
+      const gp_XY& aPT = myPnts[aTarget];
+      const size_t aMaxIter = 32 * (aCrossed.size() + 1) * (aCrossed.size() + 1);
+      size_t aNbIter = 0;
+      for (size_t aHead = 0; aHead < aCrossed.size(); ++aHead)
+      {
+        if (++aNbIter > aMaxIter)
+        {
+          return false;
+        }
+
+        const std::pair<int, int> anEdge = aCrossed[aHead];
+        int aTriIndex = -1, anEdgeIndex = -1;
+        if (!findEdge (anEdge.first, anEdge.second, aTriIndex, anEdgeIndex)
+         && !findEdge (anEdge.second, anEdge.first, aTriIndex, anEdgeIndex))
+        {
+          continue;
+        }
+        const Triangle& aTri = myTris[aTriIndex];
+        if (aTri.IsFixed[anEdgeIndex] || aTri.Adjacent[anEdgeIndex] < 0)
+        {
+          return false;
+        }
+
+        const int aVA = aTri.Nodes[anEdgeIndex];
+        const int aVB = aTri.Nodes[(anEdgeIndex + 1) % 3];
+        const int aVC = aTri.Nodes[(anEdgeIndex + 2) % 3];
+        const int aVD = oppositeVertex (aTri.Adjacent[anEdgeIndex], aVB, aVA);
+        if (!isConvex (aVA, aVD, aVB, aVC))
+        {
+          aCrossed.push_back (anEdge);
+          continue;
+        }
+
+        flip (aTriIndex, anEdgeIndex);
+        if (aVC != theV1 && aVC != aTarget && aVD != theV1 && aVD != aTarget
+         && orient2d (aP1, aPT, myPnts[aVC]) * orient2d (aP1, aPT, myPnts[aVD]) < 0)
+        {
+          aCrossed.push_back (std::make_pair (aVC, aVD));
+        }
+      }
+
+      if (!fixEdge (theV1, aTarget))
+      {
+        return false;
+      }
+      return aTarget == theV2 || InsertConstraint (aTarget, theV2, theDepth + 1);
+    }
+
+  private:
+
+    int addVertex (const gp_XY& thePnt)
+    {
+      myPnts.push_back (thePnt);
+      return int (myPnts.size()) - 1;
+    }
+
+    //! Finds the triangle containing the directed edge.
+    bool findEdge (const int theFrom, const int theTo, int& theTri, int& theEdge) const
+    {
+      for (int aTriIter = 0; aTriIter < int (myTris.size()); ++aTriIter)
+      {
+        const Triangle& aTri = myTris[aTriIter];
+        for (int k = 0; k < 3; ++k)
+        {
+          if (aTri.Nodes[k] == theFrom && aTri.Nodes[(k + 1) % 3] == theTo)
+          {
+            theTri = aTriIter;
+            theEdge = k;
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+
+    //! Return the index of the directed edge in the triangle.
+    int edgeIndex (const int theTri, const int theFrom, const int theTo) const
+    {
+      const Triangle& aTri = myTris[theTri];
+      for (int k = 0; k < 3; ++k)
+      {
+        if (aTri.Nodes[k] == theFrom && aTri.Nodes[(k + 1) % 3] == theTo)
+        {
+          return k;
+        }
+      }
+      return 0;
+    }
+
+    //! Return the vertex of the triangle different from the given ones.
+    int oppositeVertex (const int theTri, const int theV1, const int theV2) const
+    {
+      const Triangle& aTri = myTris[theTri];
+      for (int k = 0; k < 3; ++k)
+      {
+        if (aTri.Nodes[k] != theV1 && aTri.Nodes[k] != theV2)
+        {
+          return aTri.Nodes[k];
+        }
+      }
+      return aTri.Nodes[0];
+    }
+
+    //! Return TRUE if the vertex theV lying on the line (theV1, theV2) lies strictly between them.
+    bool isBetween (const int theV1, const int theV, const int theV2) const
+    {
+      const gp_XY& aP1 = myPnts[theV1];
+      const gp_XY& aP2 = myPnts[theV2];
+      const gp_XY& aP  = myPnts[theV];
+      const int aCoord = Abs (aP2.X() - aP1.X()) >= Abs (aP2.Y() - aP1.Y()) ? 1 : 2;
+      return (aP.Coord (aCoord) - aP1.Coord (aCoord)) * (aP.Coord (aCoord) - aP2.Coord (aCoord)) < 0.0;
+    }
+
+    //! Return TRUE if the quadrilateral (theA, theD, theB, theC) is strictly convex,
+    //! i.e. the diagonal (theA, theB) may be flipped to (theC, theD).
+    bool isConvex (const int theA, const int theD, const int theB, const int theC) const
+    {
+      return orient2d (myPnts[theA], myPnts[theD], myPnts[theC]) > 0
+          && orient2d (myPnts[theD], myPnts[theB], myPnts[theC]) > 0;
+    }
+
+    //! Makes the edge with the given index the first one.
+    void rotate (Triangle& theTri, const int theEdge)
+    {
+      for (int aShift = 0; aShift < theEdge; ++aShift)
+      {
+        std::rotate (theTri.Nodes, theTri.Nodes + 1, theTri.Nodes + 3);
+        std::rotate (theTri.Adjacent, theTri.Adjacent + 1, theTri.Adjacent + 3);
+        std::rotate (theTri.IsFixed, theTri.IsFixed + 1, theTri.IsFixed + 3);
+      }
+    }
+
+    //! Replaces the adjacent triangle across the edge (theTo, theFrom) of the triangle.
+    void replaceAdjacent (const int theTri, const int theFrom, const int theTo, const int theAdjacent)
+    {
+      if (theTri >= 0)
+      {
+        myTris[theTri].Adjacent[edgeIndex (theTri, theTo, theFrom)] = theAdjacent;
+      }
+    }
+
+    //! Fixes the edge; return FALSE if there is no such edge.
+    bool fixEdge (const int theV1, const int theV2)
+    {
+      bool isFound = false;
+      int aTri = -1, anEdge = -1;
+      if (findEdge (theV1, theV2, aTri, anEdge))
+      {
+        myTris[aTri].IsFixed[anEdge] = isFound = true;
+      }
+      if (findEdge (theV2, theV1, aTri, anEdge))
+      {
+        myTris[aTri].IsFixed[anEdge] = isFound = true;
+      }
+      return isFound;
+    }
+
+    //! Splits the triangle (a, b, c) into (a, b, p), (b, c, p) and (c, a, p).
+    void splitTriangle (const int theTri, const int theVertex)
+    {
+      const Triangle anOld = myTris[theTri];
+      const int aTri1 = int (myTris.size());
+      const int aTri2 = aTri1 + 1;
+      const int aTris[3] = { theTri, aTri1, aTri2 };
+      myTris.resize (myTris.size() + 2);
+      for (int k = 0; k < 3; ++k)
+      {
+        Triangle& aTri = myTris[aTris[k]];
+        aTri.Nodes[0] = anOld.Nodes[k];
+        aTri.Nodes[1] = anOld.Nodes[(k + 1) % 3];
+        aTri.Nodes[2] = theVertex;
+        aTri.Adjacent[0] = anOld.Adjacent[k];
+        aTri.Adjacent[1] = aTris[(k + 1) % 3];
+        aTri.Adjacent[2] = aTris[(k + 2) % 3];
+        aTri.IsFixed[0] = anOld.IsFixed[k];
+        aTri.IsFixed[1] = aTri.IsFixed[2] = false;
+        if (k > 0)
+        {
+          replaceAdjacent (anOld.Adjacent[k], anOld.Nodes[k], anOld.Nodes[(k + 1) % 3], aTris[k]);
+        }
+      }
+
+      std::vector<std::pair<int, int> > aStack;
+      for (int k = 0; k < 3; ++k)
+      {
+        aStack.push_back (std::make_pair (aTris[k], 0));
+      }
+      legalize (aStack);
+    }
+
+    //! Splits the edge k (a, b) of the triangle (a, b, c) and the adjacent triangle (b, a, d)
+    //! into (a, p, c), (p, b, c), (b, p, d) and (p, a, d).
+    void splitEdge (const int theTri, const int theEdge, const int theVertex)
+    {
+      rotate (myTris[theTri], theEdge);
+      const Triangle anOld = myTris[theTri];
+      const int anAdj = anOld.Adjacent[0];
+      const int aVA = anOld.Nodes[0], aVB = anOld.Nodes[1], aVC = anOld.Nodes[2];
+
+      const int aTriPBC = int (myTris.size());
+      myTris.resize (myTris.size() + 1);
+      std::vector<std::pair<int, int> > aStack;
+      {
+        Triangle& aTriAPC = myTris[theTri];
+        Triangle& aTriPBC_ = myTris[aTriPBC];
+        aTriAPC.Nodes[0] = aVA; aTriAPC.Nodes[1] = theVertex; aTriAPC.Nodes[2] = aVC;
+        aTriPBC_.Nodes[0] = theVertex; aTriPBC_.Nodes[1] = aVB; aTriPBC_.Nodes[2] = aVC;
+        aTriAPC.Adjacent[1] = aTriPBC;
+        aTriAPC.Adjacent[2] = anOld.Adjacent[2];
+        aTriAPC.IsFixed[1] = false;
+        aTriAPC.IsFixed[2] = anOld.IsFixed[2];
+        aTriPBC_.Adjacent[1] = anOld.Adjacent[1];
+        aTriPBC_.Adjacent[2] = theTri;
+        aTriPBC_.IsFixed[0] = anOld.IsFixed[0];
+        aTriPBC_.IsFixed[1] = anOld.IsFixed[1];
+        aTriPBC_.IsFixed[2] = false;
+        aTriAPC.IsFixed[0] = anOld.IsFixed[0];
+      }
+      replaceAdjacent (anOld.Adjacent[1], aVB, aVC, aTriPBC);
+      aStack.push_back (std::make_pair (theTri, 2));
+      aStack.push_back (std::make_pair (aTriPBC, 1));
+
+      if (anAdj < 0)
+      {
+        myTris[theTri].Adjacent[0] = -1;
+        myTris[aTriPBC].Adjacent[0] = -1;
+        legalize (aStack);
+        return;
+      }
+
+      rotate (myTris[anAdj], edgeIndex (anAdj, aVB, aVA));
+      const Triangle anOldAdj = myTris[anAdj];
+      const int aVD = anOldAdj.Nodes[2];
+      const int aTriPAD = int (myTris.size());
+      myTris.resize (myTris.size() + 1);
+      {
+        Triangle& aTriBPD = myTris[anAdj];
+        Triangle& aTriPAD_ = myTris[aTriPAD];
+        aTriBPD.Nodes[0] = aVB; aTriBPD.Nodes[1] = theVertex; aTriBPD.Nodes[2] = aVD;
+        aTriPAD_.Nodes[0] = theVertex; aTriPAD_.Nodes[1] = aVA; aTriPAD_.Nodes[2] = aVD;
+        aTriBPD.Adjacent[0] = aTriPBC;
+        aTriBPD.Adjacent[1] = aTriPAD;
+        aTriBPD.Adjacent[2] = anOldAdj.Adjacent[2];
+        aTriBPD.IsFixed[0] = anOldAdj.IsFixed[0];
+        aTriBPD.IsFixed[1] = false;
+        aTriBPD.IsFixed[2] = anOldAdj.IsFixed[2];
+        aTriPAD_.Adjacent[0] = theTri;
+        aTriPAD_.Adjacent[1] = anOldAdj.Adjacent[1];
+        aTriPAD_.Adjacent[2] = anAdj;
+        aTriPAD_.IsFixed[0] = anOldAdj.IsFixed[0];
+        aTriPAD_.IsFixed[1] = anOldAdj.IsFixed[1];
+        aTriPAD_.IsFixed[2] = false;
+      }
+      replaceAdjacent (anOldAdj.Adjacent[1], aVA, aVD, aTriPAD);
+      myTris[theTri].Adjacent[0] = aTriPAD;
+      myTris[aTriPBC].Adjacent[0] = anAdj;
+      aStack.push_back (std::make_pair (anAdj, 2));
+      aStack.push_back (std::make_pair (aTriPAD, 1));
+      legalize (aStack);
+    }
+
+    //! Flips the edge k (a, b) of the triangle (a, b, c) and the adjacent triangle (b, a, d)
+    //! producing the triangles (a, d, c) and (d, b, c).
+    void flip (const int theTri, const int theEdge)
+    {
+      rotate (myTris[theTri], theEdge);
+      const Triangle anOld = myTris[theTri];
+      const int anAdj = anOld.Adjacent[0];
+      rotate (myTris[anAdj], edgeIndex (anAdj, anOld.Nodes[1], anOld.Nodes[0]));
+      const Triangle anOldAdj = myTris[anAdj];
+      const int aVA = anOld.Nodes[0], aVB = anOld.Nodes[1], aVC = anOld.Nodes[2], aVD = anOldAdj.Nodes[2];
+
+      Triangle& aTriADC = myTris[theTri];
+      aTriADC.Nodes[0] = aVA; aTriADC.Nodes[1] = aVD; aTriADC.Nodes[2] = aVC;
+      aTriADC.Adjacent[0] = anOldAdj.Adjacent[1];
+      aTriADC.Adjacent[1] = anAdj;
+      aTriADC.Adjacent[2] = anOld.Adjacent[2];
+      aTriADC.IsFixed[0] = anOldAdj.IsFixed[1];
+      aTriADC.IsFixed[1] = false;
+      aTriADC.IsFixed[2] = anOld.IsFixed[2];
+
+      Triangle& aTriDBC = myTris[anAdj];
+      aTriDBC.Nodes[0] = aVD; aTriDBC.Nodes[1] = aVB; aTriDBC.Nodes[2] = aVC;
+      aTriDBC.Adjacent[0] = anOldAdj.Adjacent[2];
+      aTriDBC.Adjacent[1] = anOld.Adjacent[1];
+      aTriDBC.Adjacent[2] = theTri;
+      aTriDBC.IsFixed[0] = anOldAdj.IsFixed[2];
+      aTriDBC.IsFixed[1] = anOld.IsFixed[1];
+      aTriDBC.IsFixed[2] = false;
+
+      replaceAdjacent (anOldAdj.Adjacent[1], aVA, aVD, theTri);
+      replaceAdjacent (anOld.Adjacent[1], aVB, aVC, anAdj);
+    }
+
+    //! Restores the Delaunay property by flipping the edges opposite to the inserted vertex.
+    void legalize (std::vector<std::pair<int, int> >& theStack)
+    {
+      while (!theStack.empty())
+      {
+        const std::pair<int, int> anItem = theStack.back();
+        theStack.pop_back();
+        const Triangle& aTri = myTris[anItem.first];
+        const int anAdj = aTri.Adjacent[anItem.second];
+        if (anAdj < 0 || aTri.IsFixed[anItem.second])
+        {
+          continue;
+        }
+
+        const int aVA = aTri.Nodes[anItem.second];
+        const int aVB = aTri.Nodes[(anItem.second + 1) % 3];
+        const int aVC = aTri.Nodes[(anItem.second + 2) % 3];
+        const int aVD = oppositeVertex (anAdj, aVA, aVB);
+        if (!isInCircle (myPnts[aVA], myPnts[aVB], myPnts[aVC], myPnts[aVD])
+         || !isConvex (aVA, aVD, aVB, aVC)
+         || ++myNbFlips > 64 * myPnts.size() * myPnts.size())
+        {
+          continue;
+        }
+
+        flip (anItem.first, anItem.second);
+        theStack.push_back (std::make_pair (anItem.first, 0));
+        theStack.push_back (std::make_pair (anAdj, 0));
+      }
+    }
+
+  private:
+
+    std::vector<gp_XY>    myPnts;    //!< vertices
+    std::vector<Triangle> myTris;    //!< triangles
+    size_t                myNbFlips; //!< number of flips made by legalization
+  };
+
+  //! Result of splitting of the triangle.
+  struct SplitResult
+  {
+    std::vector<int>  Triangles; //!< three nodes of each sub-triangle in the common array of nodes
+    std::vector<char> OnStates;  //!< orientation of the coplanar triangle of the other mesh containing the sub-triangle
+    std::vector<int>  CutEdges;  //!< two nodes of each edge lying on the intersection lines
+    std::vector<int>  Aliases;   //!< pairs of different nodes found at the same point of the triangle
+  };
+
+  // =======================================================================
+  // Classification
+  // =======================================================================
+
+  //! Counter of the intersections of the ray with the triangles of the mesh.
+  class RayHitCounter : public BVH_Traverse<double, 3, TriangleBoxSet, int>
+  {
+  public:
+
+    RayHitCounter (const MeshData& theMesh, const gp_XYZ& theOrigin, const gp_XYZ& theDir, const double theTolerance)
+    : myMesh (theMesh),
+      myOrigin (theOrigin.X(), theOrigin.Y(), theOrigin.Z()),
+      myDir (theDir.X(), theDir.Y(), theDir.Z()),
+      myOriginXYZ (theOrigin),
+      myDirXYZ (theDir),
+      myTolerance (theTolerance),
+      myNbHits (0),
+      myIsAmbiguous (false)
+    {
+      SetBVHSet (theMesh.BoxSet.get());
+    }
+
+    //! Return the number of hits.
+    int NbHits() const { return myNbHits; }
+
+    //! Return TRUE if the ray touches an edge or a vertex of the mesh or its origin lies on the mesh.
+    bool IsAmbiguous() const { return myIsAmbiguous; }
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin, const BVH_Vec3d& theCMax, int& theMetric) const Standard_OVERRIDE
+    {
+      theMetric = 0;
+      double aTimeEnter = 0.0, aTimeLeave = 0.0;
+      return !BVH_Tools<double, 3>::RayBoxIntersection (myOrigin, myDir, theCMin, theCMax, aTimeEnter, aTimeLeave);
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex, const int&) Standard_OVERRIDE
+    {
+      const int aTri = myBVHSet->Element (theIndex);
+      const gp_XYZ& aP0 = myMesh.TriNode (aTri, 0);
+      const gp_XYZ anEdge1 = myMesh.TriNode (aTri, 1) - aP0;
+      const gp_XYZ anEdge2 = myMesh.TriNode (aTri, 2) - aP0;
+      const gp_XYZ aPVec = myDirXYZ.Crossed (anEdge2);
+      const double aDet = anEdge1.Dot (aPVec);
+      if (Abs (aDet) <= THE_RAY_TOLERANCE * anEdge1.Modulus() * anEdge2.Modulus())
+      {
+        // the ray parallel to the triangle hits its neighbors at their edges
+        return Standard_False;
+      }
+
+      const gp_XYZ aTVec = myOriginXYZ - aP0;
+      const double aU = aTVec.Dot (aPVec) / aDet;
+      if (aU < -THE_RAY_TOLERANCE || aU > 1.0 + THE_RAY_TOLERANCE)
+      {
+        return Standard_False;
+      }
+      const gp_XYZ aQVec = aTVec.Crossed (anEdge1);
+      const double aV = myDirXYZ.Dot (aQVec) / aDet;
+      if (aV < -THE_RAY_TOLERANCE || aU + aV > 1.0 + THE_RAY_TOLERANCE)
+      {
+        return Standard_False;
+      }
+      const double aT = anEdge2.Dot (aQVec) / aDet;
+      if (aT < -myTolerance)
+      {
+        return Standard_False;
+      }
+
+      if (aT <= myTolerance
+       || aU < THE_RAY_TOLERANCE || aV < THE_RAY_TOLERANCE || aU + aV > 1.0 - THE_RAY_TOLERANCE)
+      {
+        myIsAmbiguous = true;
+      }
+      ++myNbHits;
+      return Standard_True;
+    }
+
+    virtual Standard_Boolean Stop() const Standard_OVERRIDE { return myIsAmbiguous; }
+
+  private:
+
+    const MeshData& myMesh;
+    BVH_Vec3d       myOrigin;
+    BVH_Vec3d       myDir;
+    gp_XYZ          myOriginXYZ;
+    gp_XYZ          myDirXYZ;
+    double          myTolerance;
+    int             myNbHits;
+    bool            myIsAmbiguous;
+  };
+
+  //! Return TRUE if the point lies inside the closed mesh.
+  //! The rays of several fixed directions are tried until the unambiguous one.
+  static bool isPointInside (const MeshData& theMesh, const gp_XYZ& thePnt, const double theTolerance)
+  {
+    static const double THE_DIRS[][3] =
+    {
+      {  0.5773, 0.6437, 0.5024 }, { -0.4372, 0.7163, -0.5438 }, {  0.8136, -0.3219, 0.4841 },
+      { -0.2913, -0.5872, 0.7551 }, { 0.6682, 0.2371, -0.7051 }, { -0.7297, -0.4183, -0.5409 },
+      {  0.1327, 0.9136, 0.3843 }, {  0.9214, 0.1149, -0.3713 }
+    };
+
+    bool isInside = false;
+    for (size_t aDirIter = 0; aDirIter < sizeof (THE_DIRS) / sizeof (THE_DIRS[0]); ++aDirIter)
+    {
+      const gp_XYZ aDir = gp_XYZ (THE_DIRS[aDirIter][0], THE_DIRS[aDirIter][1], THE_DIRS[aDirIter][2]).Normalized();
+      RayHitCounter aCounter (theMesh, thePnt, aDir, theTolerance);
+      aCounter.Select();
+      isInside = aCounter.NbHits() % 2 == 1;
+      if (!aCounter.IsAmbiguous())
+      {
+        break;
+      }
+    }
+    return isInside;
+  }
+
+  //! Union-find structure with path halving.
+  class DisjointSets
+  {
+  public:
+
+    explicit DisjointSets (const int theSize = 0) : myParents (theSize)
+    {
+      for (int anIter = 0; anIter < theSize; ++anIter)
+      {
+        myParents[anIter] = anIter;
+      }
+    }
+
+    int Size() const { return int (myParents.size()); }
+
+    int Add()
+    {
+      myParents.push_back (Size());
+      return Size() - 1;
+    }
+
+    int Find (int theItem)
+    {
+      while (myParents[theItem] != theItem)
+      {
+        myParents[theItem] = myParents[myParents[theItem]];
+        theItem = myParents[theItem];
+      }
+      return theItem;
+    }
+
+    //! Unites the sets keeping the smaller root.
+    void Unite (const int theItem1, const int theItem2)
+    {
+      const int aRoot1 = Find (theItem1), aRoot2 = Find (theItem2);
+      if (aRoot1 < aRoot2)
+      {
+        myParents[aRoot2] = aRoot1;
+      }
+      else if (aRoot2 < aRoot1)
+      {
+        myParents[aRoot1] = aRoot2;
+      }
+    }
+
+  private:
+
+    std::vector<int> myParents;
+  };
+
+  //! States of the parts of the mesh.
+  enum PartState
+  {
+    PartState_Out,
+    PartState_In,
+    PartState_OnSame,
+    PartState_OnOpposite,
+    PartState_Split       //!< triangle replaced by its sub-triangles
+  };
+
+  //! Triangles split by the intersection lines and adjacency of the parts of one mesh.
+  struct MeshSplits
+  {
+    std::vector<int>         SegStart;   //!< position of the first segment of the triangle in SegList
+    std::vector<int>         SegList;    //!< segments lying on the triangles
+    std::vector<int>         PntStart;   //!< position of the first node of the edge in PntList
+    std::vector<int>         PntList;    //!< nodes lying on the edges
+    std::vector<int>         CopStart;   //!< position of the first coplanar triangle in CopList
+    std::vector<int>         CopList;    //!< overlapping coplanar triangles of the other mesh
+    std::vector<int>         SplitIndex; //!< index of the split of the triangle or -1
+    std::vector<int>         Split;      //!< split triangles
+    std::vector<SplitResult> Results;    //!< results of splitting
+    std::vector<int>         SubStart;   //!< first slot of the sub-triangles of the split
+    std::vector<char>        States;     //!< states of the slots of the triangles and sub-triangles
+  };
+
+  //! Fills the compressed lists from the pairs (key, value).
+  static void fillLists (std::vector<std::pair<int, int> >& thePairs, const int theNbKeys,
+                         std::vector<int>& theStart, std::vector<int>& theList)
+  {
+    std::sort (thePairs.begin(), thePairs.end());
+    thePairs.erase (std::unique (thePairs.begin(), thePairs.end()), thePairs.end());
+    theStart.assign (theNbKeys + 1, 0);
+    theList.resize (thePairs.size());
+    for (size_t anIter = 0; anIter < thePairs.size(); ++anIter)
+    {
+      ++theStart[thePairs[anIter].first + 1];
+      theList[anIter] = thePairs[anIter].second;
+    }
+    for (int aKey = 0; aKey < theNbKeys; ++aKey)
+    {
+      theStart[aKey + 1] += theStart[aKey];
+    }
+  }
+
+  // =======================================================================
+  // Algorithm
+  // =======================================================================
+
+  //! Return the number of the oriented edges of the triangulation shared by several triangles in the same direction
+  //! or having no single oppositely oriented partner; zero for the closed manifold triangulation.
+  static int countOpenEdges (const Handle(Poly_Triangulation)& theMesh)
+  {
+    std::vector<uint64_t> anEdges;
+    anEdges.reserve (3 * theMesh->NbTriangles());
+    for (int aTriIter = 1; aTriIter <= theMesh->NbTriangles(); ++aTriIter)
+    {
+      int aNodes[3];
+      theMesh->Triangle (aTriIter).Get (aNodes[0], aNodes[1], aNodes[2]);
+      for (int k = 0; k < 3; ++k)
+      {
+        anEdges.push_back (pairKey (aNodes[k], aNodes[(k + 1) % 3]));
+      }
+    }
+    std::sort (anEdges.begin(), anEdges.end());
+
+    int aNbOpen = 0;
+    for (size_t anEdgeIter = 0; anEdgeIter < anEdges.size(); ++anEdgeIter)
+    {
+      const uint64_t aKey = anEdges[anEdgeIter];
+      const bool isRepeated = (anEdgeIter > 0                  && anEdges[anEdgeIter - 1] == aKey)
+                           || (anEdgeIter + 1 < anEdges.size() && anEdges[anEdgeIter + 1] == aKey);
+      const uint64_t anOpposite = pairKey (int (aKey & 0xFFFFFFFF), int (aKey >> 32));
+      std::vector<uint64_t>::const_iterator aPartner = std::lower_bound (anEdges.begin(), anEdges.end(), anOpposite);
+      const bool hasOnePartner = aPartner != anEdges.end() && *aPartner == anOpposite
+                              && (aPartner + 1 == anEdges.end() || *(aPartner + 1) != anOpposite);
+      if (isRepeated || !hasOnePartner)
+      {
+        ++aNbOpen;
+      }
+    }
+    return aNbOpen;
+  }
+
+  //! Implementation of the Boolean operation.
+  class MeshBooleanTool
+  {
+  public:
+
+    MeshBooleanTool (const bool theToRunParallel) : myToRunParallel (theToRunParallel), myTolerance (0.0) {}
+
+    //! Initializes the data of the meshes; the nodes of the second mesh lying within the tolerance
+    //! from the nodes of the first mesh are moved onto these nodes.
+    //! @return number of moved nodes
+    int Init (const Handle(Poly_Triangulation)& theMesh1, const Handle(Poly_Triangulation)& theMesh2,
+              const double theSnapTolerance)
+    {
+      myMeshes[0].Load (theMesh1, 0);
+      myMeshes[1].Load (theMesh2, theMesh1->NbNodes());
+      const int aNbSnapped = myMeshes[1].SnapTo (myMeshes[0], theSnapTolerance);
+      OSD_Parallel::For (0, 2, [&](int theMesh)
+      {
+        myMeshes[theMesh].Build();
+      }, !myToRunParallel);
+      myNodes.reserve (theMesh1->NbNodes() + theMesh2->NbNodes());
+      myNodes.insert (myNodes.end(), myMeshes[0].Nodes.begin(), myMeshes[0].Nodes.end());
+      myNodes.insert (myNodes.end(), myMeshes[1].Nodes.begin(), myMeshes[1].Nodes.end());
+
+      Bnd_Box aBox;
+      for (size_t aNodeIter = 0; aNodeIter < myNodes.size(); ++aNodeIter)
+      {
+        aBox.Add (gp_Pnt (myNodes[aNodeIter]));
+      }
+      myTolerance = aBox.IsVoid() ? 0.0 : 1.0e-12 * Sqrt (aBox.SquareExtent());
+      return aNbSnapped;
+    }
+
+    //! Selects the pairs of triangles with interfering boxes.
+    int SelectPairs()
+    {
+      TrianglePairSelector aSelector;
+      aSelector.SetBVHSets (myMeshes[0].BoxSet.get(), myMeshes[1].BoxSet.get());
+      aSelector.Select();
+      myPairs.swap (aSelector.Pairs);
+      std::sort (myPairs.begin(), myPairs.end());
+      return int (myPairs.size());
+    }
+
+    //! Intersects the pairs of triangles and defines the nodes of the segments.
+    void IntersectPairs()
+    {
+      const int aNbTasks = (int (myPairs.size()) + THE_NB_PAIRS_PER_TASK - 1) / THE_NB_PAIRS_PER_TASK;
+      std::vector<PairsIntersection> aResults (aNbTasks);
+      OSD_Parallel::For (0, aNbTasks, [&](int theTask)
+      {
+        const size_t aLast = std::min (myPairs.size(), size_t (theTask + 1) * THE_NB_PAIRS_PER_TASK);
+        for (size_t aPairIter = size_t (theTask) * THE_NB_PAIRS_PER_TASK; aPairIter < aLast; ++aPairIter)
+        {
+          intersectPair (myMeshes[0], myPairs[aPairIter].first, myMeshes[1], myPairs[aPairIter].second, aResults[theTask]);
+        }
+      }, !myToRunParallel);
+
+      for (int aTask = 0; aTask < aNbTasks; ++aTask)
+      {
+        mySegments.insert (mySegments.end(), aResults[aTask].Segments.begin(), aResults[aTask].Segments.end());
+        myCoplanar.insert (myCoplanar.end(), aResults[aTask].Coplanar.begin(), aResults[aTask].Coplanar.end());
+      }
+
+      // nodes of the segments are defined sequentially for the deterministic result
+      myNodeSets = DisjointSets (int (myNodes.size()));
+      NCollection_DataMap<uint64_t, int> aLabelNodes;
+      for (size_t aSegIter = 0; aSegIter < mySegments.size(); ++aSegIter)
+      {
+        IntSegment& aSegment = mySegments[aSegIter];
+        for (int anEnd = 0; anEnd < 2; ++anEnd)
+        {
+          const PointLabel& aLabel = aSegment.Ends[anEnd];
+          const bool isVertex1 = featureType (aLabel.Features[0]) == FeatureType_Vertex;
+          const bool isVertex2 = featureType (aLabel.Features[1]) == FeatureType_Vertex;
+          if (isVertex1 || isVertex2)
+          {
+            const int aNode1 = featureIndex (aLabel.Features[0]) + myMeshes[0].NodeOffset;
+            const int aNode2 = featureIndex (aLabel.Features[1]) + myMeshes[1].NodeOffset;
+            if (isVertex1 && isVertex2)
+            {
+              myNodeSets.Unite (aNode1, aNode2);
+            }
+            aSegment.Nodes[anEnd] = isVertex1 ? aNode1 : aNode2;
+            continue;
+          }
+
+          if (!aLabelNodes.Find (aLabel.Key(), aSegment.Nodes[anEnd]))
+          {
+            aSegment.Nodes[anEnd] = myNodeSets.Add();
+            myNodes.push_back (computePoint (aLabel));
+            aLabelNodes.Bind (aLabel.Key(), aSegment.Nodes[anEnd]);
+          }
+        }
+      }
+
+      updateCanonical();
+    }
+
+    //! Splits the triangles of both meshes by the intersection segments.
+    int SplitTriangles()
+    {
+      std::vector<std::pair<int, int> > aTasks;
+      for (int aMeshIter = 0; aMeshIter < 2; ++aMeshIter)
+      {
+        collectSplitData (aMeshIter);
+        const MeshSplits& aSplits = mySplits[aMeshIter];
+        for (size_t aSplitIter = 0; aSplitIter < aSplits.Split.size(); ++aSplitIter)
+        {
+          aTasks.push_back (std::make_pair (aMeshIter, int (aSplitIter)));
+        }
+      }
+
+      OSD_Parallel::For (0, int (aTasks.size()), [&](int theTask)
+      {
+        MeshSplits& aSplits = mySplits[aTasks[theTask].first];
+        splitTriangle (aTasks[theTask].first, aSplits.Split[aTasks[theTask].second], aSplits.Results[aTasks[theTask].second]);
+      }, !myToRunParallel);
+
+      // nodes found at the same point of some triangle are merged in all split triangles
+      bool hasAliases = false;
+      for (int aMeshIter = 0; aMeshIter < 2; ++aMeshIter)
+      {
+        const MeshSplits& aSplits = mySplits[aMeshIter];
+        for (size_t aSplitIter = 0; aSplitIter < aSplits.Results.size(); ++aSplitIter)
+        {
+          const std::vector<int>& anAliases = aSplits.Results[aSplitIter].Aliases;
+          for (size_t anAliasIter = 0; anAliasIter < anAliases.size(); anAliasIter += 2)
+          {
+            myNodeSets.Unite (anAliases[anAliasIter], anAliases[anAliasIter + 1]);
+            hasAliases = true;
+          }
+        }
+      }
+      if (hasAliases)
+      {
+        updateCanonical();
+        for (int aMeshIter = 0; aMeshIter < 2; ++aMeshIter)
+        {
+          MeshSplits& aSplits = mySplits[aMeshIter];
+          for (size_t aSplitIter = 0; aSplitIter < aSplits.Results.size(); ++aSplitIter)
+          {
+            SplitResult& aResult = aSplits.Results[aSplitIter];
+            for (size_t aNodeIter = 0; aNodeIter < aResult.Triangles.size(); ++aNodeIter)
+            {
+              aResult.Triangles[aNodeIter] = myCanonical[aResult.Triangles[aNodeIter]];
+            }
+            for (size_t aNodeIter = 0; aNodeIter < aResult.CutEdges.size(); ++aNodeIter)
+            {
+              aResult.CutEdges[aNodeIter] = myCanonical[aResult.CutEdges[aNodeIter]];
+            }
+          }
+        }
+      }
+
+      for (int aMeshIter = 0; aMeshIter < 2; ++aMeshIter)
+      {
+        const MeshSplits& aSplits = mySplits[aMeshIter];
+        for (size_t aSplitIter = 0; aSplitIter < aSplits.Results.size(); ++aSplitIter)
+        {
+          const std::vector<int>& aCutEdges = aSplits.Results[aSplitIter].CutEdges;
+          for (size_t anEdgeIter = 0; anEdgeIter < aCutEdges.size(); anEdgeIter += 2)
+          {
+            myCutEdges.Add (pairKey (aCutEdges[anEdgeIter], aCutEdges[anEdgeIter + 1], false));
+          }
+        }
+      }
+      return int (aTasks.size());
+    }
+
+    //! Classifies the parts of the mesh bounded by the intersection lines relative to the other mesh.
+    void Classify (const int theMesh)
+    {
+      const MeshData& aMesh = myMeshes[theMesh];
+      MeshSplits& aSplits = mySplits[theMesh];
+      const int aNbTris = aMesh.NbTriangles();
+
+      // slots of the sub-triangles follow the slots of the original triangles
+      aSplits.SubStart.resize (aSplits.Split.size() + 1);
+      aSplits.SubStart[0] = aNbTris;
+      for (size_t aSplitIter = 0; aSplitIter < aSplits.Split.size(); ++aSplitIter)
+      {
+        aSplits.SubStart[aSplitIter + 1] = aSplits.SubStart[aSplitIter] + int (aSplits.Results[aSplitIter].Triangles.size() / 3);
+      }
+      const int aNbSlots = aSplits.SubStart.back();
+
+      // parts are the sets of triangles connected through the edges not lying on the intersection lines
+      DisjointSets aParts (aNbSlots);
+      NCollection_DataMap<uint64_t, int> anEdgeSlots;
+      for (size_t aSplitIter = 0; aSplitIter < aSplits.Split.size(); ++aSplitIter)
+      {
+        const std::vector<int>& aSubTris = aSplits.Results[aSplitIter].Triangles;
+        for (size_t aTriIter = 0; aTriIter < aSubTris.size(); aTriIter += 3)
+        {
+          const int aSlot = aSplits.SubStart[aSplitIter] + int (aTriIter / 3);
+          for (int k = 0; k < 3; ++k)
+          {
+            const uint64_t aKey = pairKey (aSubTris[aTriIter + k], aSubTris[aTriIter + (k + 1) % 3], false);
+            int anOther = -1;
+            if (myCutEdges.Contains (aKey))
+            {
+              continue;
+            }
+            if (anEdgeSlots.Find (aKey, anOther))
+            {
+              aParts.Unite (aSlot, anOther);
+            }
+            else
+            {
+              anEdgeSlots.Bind (aKey, aSlot);
+            }
+          }
+        }
+      }
+      for (int aTriIter = 0; aTriIter < aNbTris; ++aTriIter)
+      {
+        if (aSplits.SplitIndex[aTriIter] >= 0)
+        {
+          continue;
+        }
+        for (int k = 0; k < 3; ++k)
+        {
+          const int anEdge = aMesh.TriEdges[3 * aTriIter + k];
+          for (int anAdjIter = aMesh.EdgeTriStart[anEdge]; anAdjIter < aMesh.EdgeTriStart[anEdge + 1]; ++anAdjIter)
+          {
+            const int anAdj = aMesh.EdgeTriList[anAdjIter];
+            if (anAdj != aTriIter && aSplits.SplitIndex[anAdj] < 0)
+            {
+              aParts.Unite (aTriIter, anAdj);
+            }
+          }
+          const uint64_t aKey = pairKey (canonicalNode (theMesh, aMesh.Triangles[3 * aTriIter + k]),
+                                         canonicalNode (theMesh, aMesh.Triangles[3 * aTriIter + (k + 1) % 3]), false);
+          int aSlot = -1;
+          if (!myCutEdges.Contains (aKey) && anEdgeSlots.Find (aKey, aSlot))
+          {
+            aParts.Unite (aTriIter, aSlot);
+          }
+        }
+      }
+
+      // each part is classified by the largest triangle not lying on the other mesh
+      std::vector<int>    aRoots (aNbSlots);
+      std::vector<int>    aRepresentatives (aNbSlots, -1);
+      std::vector<double> anAreas (aNbSlots, -1.0);
+      aSplits.States.assign (aNbSlots, PartState_Out);
+      for (int aSlot = 0; aSlot < aNbSlots; ++aSlot)
+      {
+        aRoots[aSlot] = aParts.Find (aSlot);
+        if (aSlot < aNbTris && aSplits.SplitIndex[aSlot] >= 0)
+        {
+          aSplits.States[aSlot] = PartState_Split;
+          continue;
+        }
+
+        const char anOnState = slotOnState (theMesh, aSlot);
+        if (anOnState != 0)
+        {
+          aSplits.States[aSlot] = char (anOnState > 0 ? PartState_OnSame : PartState_OnOpposite);
+          continue;
+        }
+
+        int aNodes[3];
+        slotNodes (theMesh, aSlot, aNodes);
+        const double anArea = (myNodes[aNodes[1]] - myNodes[aNodes[0]]).Crossed (myNodes[aNodes[2]] - myNodes[aNodes[0]]).SquareModulus();
+        if (anArea > anAreas[aRoots[aSlot]])
+        {
+          anAreas[aRoots[aSlot]] = anArea;
+          aRepresentatives[aRoots[aSlot]] = aSlot;
+        }
+      }
+
+      std::vector<int> aClassified;
+      for (int aSlot = 0; aSlot < aNbSlots; ++aSlot)
+      {
+        if (aRepresentatives[aSlot] >= 0)
+        {
+          aClassified.push_back (aSlot);
+        }
+      }
+      std::vector<char> anInside (aNbSlots, 0);
+      OSD_Parallel::For (0, int (aClassified.size()), [&](int theIndex)
+      {
+        int aNodes[3];
+        slotNodes (theMesh, aRepresentatives[aClassified[theIndex]], aNodes);
+        const gp_XYZ aCenter = (myNodes[aNodes[0]] + myNodes[aNodes[1]] + myNodes[aNodes[2]]) / 3.0;
+        anInside[aClassified[theIndex]] = isPointInside (myMeshes[1 - theMesh], aCenter, myTolerance) ? 1 : 0;
+      }, !myToRunParallel);
+
+      for (int aSlot = 0; aSlot < aNbSlots; ++aSlot)
+      {
+        if (aSplits.States[aSlot] == PartState_Out && anInside[aRoots[aSlot]] != 0)
+        {
+          aSplits.States[aSlot] = PartState_In;
+        }
+      }
+    }
+
+    //! Builds the result of the operation.
+    Handle(Poly_Triangulation) BuildResult (const Poly_MeshBoolean::Operation theOperation) const
+    {
+      std::vector<int> aTris;
+      for (int aMeshIter = 0; aMeshIter < 2; ++aMeshIter)
+      {
+        const MeshSplits& aSplits = mySplits[aMeshIter];
+        for (int aSlot = 0; aSlot < int (aSplits.States.size()); ++aSlot)
+        {
+          bool isReversed = false;
+          if (!isSelected (theOperation, aMeshIter, PartState (aSplits.States[aSlot]), isReversed))
+          {
+            continue;
+          }
+          int aNodes[3];
+          slotNodes (aMeshIter, aSlot, aNodes);
+          if (aNodes[0] == aNodes[1] || aNodes[1] == aNodes[2] || aNodes[2] == aNodes[0])
+          {
+            continue;
+          }
+          aTris.push_back (aNodes[0]);
+          aTris.push_back (aNodes[isReversed ? 2 : 1]);
+          aTris.push_back (aNodes[isReversed ? 1 : 2]);
+        }
+      }
+
+      std::vector<int> aNodeMap (myNodes.size(), 0);
+      int aNbNodes = 0;
+      for (size_t aNodeIter = 0; aNodeIter < aTris.size(); ++aNodeIter)
+      {
+        if (aNodeMap[aTris[aNodeIter]] == 0)
+        {
+          aNodeMap[aTris[aNodeIter]] = ++aNbNodes;
+        }
+      }
+
+      Handle(Poly_Triangulation) aResult = new Poly_Triangulation();
+      aResult->SetDoublePrecision (true);
+      if (aTris.empty())
+      {
+        return aResult;
+      }
+      aResult->ResizeNodes     (aNbNodes, false);
+      aResult->ResizeTriangles (int (aTris.size() / 3), false);
+      for (size_t aNodeIter = 0; aNodeIter < myNodes.size(); ++aNodeIter)
+      {
+        if (aNodeMap[aNodeIter] != 0)
+        {
+          aResult->SetNode (aNodeMap[aNodeIter], gp_Pnt (myNodes[aNodeIter]));
+        }
+      }
+      for (size_t aTriIter = 0; aTriIter < aTris.size(); aTriIter += 3)
+      {
+        aResult->SetTriangle (int (aTriIter / 3) + 1, Poly_Triangle (aNodeMap[aTris[aTriIter]],
+                                                                     aNodeMap[aTris[aTriIter + 1]],
+                                                                     aNodeMap[aTris[aTriIter + 2]]));
+      }
+      return aResult;
+    }
+
+    //! Chains the segments of intersection of the non-coplanar triangles into the polygons.
+    void BuildSectionLines (NCollection_Sequence<Handle(Poly_Polygon3D)>& theLines) const
+    {
+      std::vector<std::pair<int, int> > anEdges;
+      NCollection_Map<uint64_t> anEdgeMap;
+      for (size_t aSegIter = 0; aSegIter < mySegments.size(); ++aSegIter)
+      {
+        const IntSegment& aSegment = mySegments[aSegIter];
+        const int aNode1 = myCanonical[aSegment.Nodes[0]];
+        const int aNode2 = myCanonical[aSegment.Nodes[1]];
+        if (!aSegment.IsCoplanar && aNode1 != aNode2 && anEdgeMap.Add (pairKey (aNode1, aNode2, false)))
+        {
+          anEdges.push_back (std::make_pair (aNode1, aNode2));
+        }
+      }
+
+      std::vector<std::pair<int, int> > aNodeEdges;
+      for (size_t anEdgeIter = 0; anEdgeIter < anEdges.size(); ++anEdgeIter)
+      {
+        aNodeEdges.push_back (std::make_pair (anEdges[anEdgeIter].first,  int (anEdgeIter)));
+        aNodeEdges.push_back (std::make_pair (anEdges[anEdgeIter].second, int (anEdgeIter)));
+      }
+      std::vector<int> aStart, aList;
+      fillLists (aNodeEdges, int (myNodes.size()), aStart, aList);
+
+      // open chains start from the nodes of odd degree, the rest are closed
+      std::vector<bool> isUsed (anEdges.size(), false);
+      for (int aPass = 0; aPass < 2; ++aPass)
+      {
+        for (int aNodeIter = 0; aNodeIter < int (myNodes.size()); ++aNodeIter)
+        {
+          const int aDegree = aStart[aNodeIter + 1] - aStart[aNodeIter];
+          if (aDegree == 0 || (aPass == 0 && aDegree % 2 == 0))
+          {
+            continue;
+          }
+
+          for (;;)
+          {
+            std::vector<int> aChain (1, aNodeIter);
+            for (int aNode = aNodeIter;;)
+            {
+              int aNext = -1;
+              for (int anIter = aStart[aNode]; anIter < aStart[aNode + 1] && aNext < 0; ++anIter)
+              {
+                const int anEdge = aList[anIter];
+                if (!isUsed[anEdge])
+                {
+                  isUsed[anEdge] = true;
+                  aNext = anEdges[anEdge].first == aNode ? anEdges[anEdge].second : anEdges[anEdge].first;
+                }
+              }
+              if (aNext < 0)
+              {
+                break;
+              }
+              aChain.push_back (aNext);
+              aNode = aNext;
+            }
+            if (aChain.size() < 2)
+            {
+              break;
+            }
+
+            TColgp_Array1OfPnt aPnts (1, int (aChain.size()));
+            for (size_t aPntIter = 0; aPntIter < aChain.size(); ++aPntIter)
+            {
+              aPnts.SetValue (int (aPntIter) + 1, gp_Pnt (myNodes[aChain[aPntIter]]));
+            }
+            theLines.Append (new Poly_Polygon3D (aPnts));
+          }
+        }
+      }
+    }
+
+  private:
+
+    //! Computes the point of intersection of the features of the meshes.
+    gp_XYZ computePoint (const PointLabel& theLabel) const
+    {
+      const MeshData& aMesh1 = myMeshes[0];
+      const MeshData& aMesh2 = myMeshes[1];
+      const int anIndex1 = featureIndex (theLabel.Features[0]);
+      const int anIndex2 = featureIndex (theLabel.Features[1]);
+      const bool isEdge1 = featureType (theLabel.Features[0]) == FeatureType_Edge;
+      const bool isEdge2 = featureType (theLabel.Features[1]) == FeatureType_Edge;
+      if (isEdge1 && isEdge2)
+      {
+        // middle of the common perpendicular of the lines of the edges
+        const gp_XYZ& aP1 = aMesh1.Nodes[aMesh1.EdgeNodes[2 * anIndex1]];
+        const gp_XYZ& aP2 = aMesh2.Nodes[aMesh2.EdgeNodes[2 * anIndex2]];
+        const gp_XYZ aD1 = aMesh1.Nodes[aMesh1.EdgeNodes[2 * anIndex1 + 1]] - aP1;
+        const gp_XYZ aD2 = aMesh2.Nodes[aMesh2.EdgeNodes[2 * anIndex2 + 1]] - aP2;
+        const gp_XYZ aR = aP1 - aP2;
+        const double aA = aD1.SquareModulus(), aB = aD1.Dot (aD2), aC = aD2.SquareModulus();
+        const double aD = aD1.Dot (aR), aE = aD2.Dot (aR);
+        const double aDenom = aA * aC - aB * aB;
+        double aT1 = 0.5, aT2 = 0.5;
+        if (aDenom > 0.0)
+        {
+          aT1 = Max (0.0, Min (1.0, (aB * aE - aC * aD) / aDenom));
+          aT2 = Max (0.0, Min (1.0, (aA * aE - aB * aD) / aDenom));
+        }
+        return ((aP1 + aD1 * aT1) + (aP2 + aD2 * aT2)) * 0.5;
+      }
+
+      // intersection of the edge with the plane of the triangle
+      const MeshData& anEdgeMesh = isEdge1 ? aMesh1 : aMesh2;
+      const MeshData& aTriMesh   = isEdge1 ? aMesh2 : aMesh1;
+      const int anEdge = isEdge1 ? anIndex1 : anIndex2;
+      const int aTri   = isEdge1 ? anIndex2 : anIndex1;
+      const gp_XYZ& aP = anEdgeMesh.Nodes[anEdgeMesh.EdgeNodes[2 * anEdge]];
+      const gp_XYZ aD = anEdgeMesh.Nodes[anEdgeMesh.EdgeNodes[2 * anEdge + 1]] - aP;
+      const gp_XYZ& aT0 = aTriMesh.TriNode (aTri, 0);
+      const gp_XYZ aNorm = (aTriMesh.TriNode (aTri, 1) - aT0).Crossed (aTriMesh.TriNode (aTri, 2) - aT0);
+      const double aDenom = aNorm.Dot (aD);
+      const double aT = aDenom != 0.0 ? Max (0.0, Min (1.0, aNorm.Dot (aT0 - aP) / aDenom)) : 0.5;
+      return aP + aD * aT;
+    }
+
+    //! Return the canonical node of the node of the mesh.
+    int canonicalNode (const int theMesh, const int theNode) const
+    {
+      return myCanonical[theNode + myMeshes[theMesh].NodeOffset];
+    }
+
+    //! Collects the segments, the nodes on the edges and the coplanar triangles for the triangles of the mesh.
+    void collectSplitData (const int theMesh)
+    {
+      const MeshData& aMesh = myMeshes[theMesh];
+      MeshSplits& aSplits = mySplits[theMesh];
+      std::vector<std::pair<int, int> > aTriSegs, anEdgePnts, aTriCops;
+      for (size_t aSegIter = 0; aSegIter < mySegments.size(); ++aSegIter)
+      {
+        const IntSegment& aSegment = mySegments[aSegIter];
+        aTriSegs.push_back (std::make_pair (aSegment.Triangles[theMesh], int (aSegIter)));
+        for (int anEnd = 0; anEnd < 2; ++anEnd)
+        {
+          const int aFeature = aSegment.Ends[anEnd].Features[theMesh];
+          if (featureType (aFeature) == FeatureType_Edge)
+          {
+            anEdgePnts.push_back (std::make_pair (featureIndex (aFeature), myCanonical[aSegment.Nodes[anEnd]]));
+          }
+        }
+      }
+      for (size_t aPairIter = 0; aPairIter < myCoplanar.size(); ++aPairIter)
+      {
+        const std::pair<int, int>& aPair = myCoplanar[aPairIter];
+        aTriCops.push_back (theMesh == 0 ? aPair : std::make_pair (aPair.second, aPair.first));
+      }
+      fillLists (aTriSegs,   aMesh.NbTriangles(), aSplits.SegStart, aSplits.SegList);
+      fillLists (anEdgePnts, aMesh.NbEdges(),     aSplits.PntStart, aSplits.PntList);
+      sortEdgeNodes (theMesh);
+      fillLists (aTriCops,   aMesh.NbTriangles(), aSplits.CopStart, aSplits.CopList);
+
+      aSplits.SplitIndex.assign (aMesh.NbTriangles(), -1);
+      for (int aTriIter = 0; aTriIter < aMesh.NbTriangles(); ++aTriIter)
+      {
+        bool isSplit = aSplits.SegStart[aTriIter + 1] > aSplits.SegStart[aTriIter];
+        for (int k = 0; k < 3 && !isSplit; ++k)
+        {
+          const int anEdge = aMesh.TriEdges[3 * aTriIter + k];
+          isSplit = aSplits.PntStart[anEdge + 1] > aSplits.PntStart[anEdge];
+        }
+        if (isSplit)
+        {
+          aSplits.SplitIndex[aTriIter] = int (aSplits.Split.size());
+          aSplits.Split.push_back (aTriIter);
+        }
+      }
+      aSplits.Results.resize (aSplits.Split.size());
+    }
+
+    //! Sorts the nodes on each edge of the mesh from its first node to the last one,
+    //! so that both triangles sharing the edge split it in the same order.
+    void sortEdgeNodes (const int theMesh)
+    {
+      const MeshData& aMesh = myMeshes[theMesh];
+      MeshSplits& aSplits = mySplits[theMesh];
+      std::vector<std::pair<double, int> > aParams;
+      for (int anEdge = 0; anEdge < aMesh.NbEdges(); ++anEdge)
+      {
+        const int aFirst = aSplits.PntStart[anEdge], aLast = aSplits.PntStart[anEdge + 1];
+        if (aLast - aFirst < 2)
+        {
+          continue;
+        }
+        const gp_XYZ& aStart = aMesh.Nodes[aMesh.EdgeNodes[2 * anEdge]];
+        const gp_XYZ aDir = aMesh.Nodes[aMesh.EdgeNodes[2 * anEdge + 1]] - aStart;
+        aParams.clear();
+        for (int aPntIter = aFirst; aPntIter < aLast; ++aPntIter)
+        {
+          const int aNode = aSplits.PntList[aPntIter];
+          aParams.push_back (std::make_pair ((myNodes[aNode] - aStart).Dot (aDir), aNode));
+        }
+        std::sort (aParams.begin(), aParams.end());
+        for (int aPntIter = aFirst; aPntIter < aLast; ++aPntIter)
+        {
+          aSplits.PntList[aPntIter] = aParams[aPntIter - aFirst].second;
+        }
+      }
+    }
+
+    //! Splits the triangle of the mesh by the segments and the nodes on its edges.
+    void splitTriangle (const int theMesh, const int theTri, SplitResult& theResult) const
+    {
+      const MeshData& aMesh = myMeshes[theMesh];
+      const MeshSplits& aSplits = mySplits[theMesh];
+      int aCorners[3];
+      for (int k = 0; k < 3; ++k)
+      {
+        aCorners[k] = canonicalNode (theMesh, aMesh.Triangles[3 * theTri + k]);
+      }
+
+      // projection keeping the triangle counterclockwise
+      Projection aProj;
+      int anOrient = 0;
+      const gp_XYZ aNorm = (myNodes[aCorners[1]] - myNodes[aCorners[0]]).Crossed (myNodes[aCorners[2]] - myNodes[aCorners[0]]);
+      for (int anAxisIter = 0; anAxisIter < 3 && anOrient == 0; ++anAxisIter)
+      {
+        aProj = Projection ((dominantAxis (aNorm) + anAxisIter) % 3);
+        anOrient = orient2d (aProj (myNodes[aCorners[0]]), aProj (myNodes[aCorners[1]]), aProj (myNodes[aCorners[2]]));
+      }
+      aProj.IsMirror = anOrient < 0;
+      const bool isDegenerated = anOrient == 0
+                              || aCorners[0] == aCorners[1] || aCorners[1] == aCorners[2] || aCorners[2] == aCorners[0];
+
+      // nodes on the sides of the triangle ordered from its first corner to the second one
+      std::vector<int> aSides[3];
+      for (int k = 0; k < 3; ++k)
+      {
+        const int anEdge = aMesh.TriEdges[3 * theTri + k];
+        aSides[k].push_back (aCorners[k]);
+        for (int aPntIter = aSplits.PntStart[anEdge]; aPntIter < aSplits.PntStart[anEdge + 1]; ++aPntIter)
+        {
+          const int aNode = aSplits.PntList[aPntIter];
+          if (aNode != aCorners[k] && aNode != aCorners[(k + 1) % 3])
+          {
+            aSides[k].push_back (aNode);
+          }
+        }
+        if (aMesh.Triangles[3 * theTri + k] != aMesh.EdgeNodes[2 * anEdge])
+        {
+          std::reverse (aSides[k].begin() + 1, aSides[k].end());
+        }
+        aSides[k].push_back (aCorners[(k + 1) % 3]);
+      }
+
+      std::vector<int> aGlobalNodes;
+      if (isDegenerated)
+      {
+        // fan of the boundary polygon of the degenerated triangle
+        std::vector<int> aPolygon;
+        for (int k = 0; k < 3; ++k)
+        {
+          aPolygon.insert (aPolygon.end(), aSides[k].begin(), aSides[k].end() - 1);
+        }
+        for (size_t aNodeIter = 1; aNodeIter + 1 < aPolygon.size(); ++aNodeIter)
+        {
+          theResult.Triangles.push_back (aPolygon[0]);
+          theResult.Triangles.push_back (aPolygon[aNodeIter]);
+          theResult.Triangles.push_back (aPolygon[aNodeIter + 1]);
+        }
+      }
+      else
+      {
+        TriangleSplitter aSplitter (aProj (myNodes[aCorners[0]]), aProj (myNodes[aCorners[1]]), aProj (myNodes[aCorners[2]]));
+        NCollection_DataMap<int, int> aLocalNodes;
+        aGlobalNodes.assign (aCorners, aCorners + 3);
+        for (int k = 0; k < 3; ++k)
+        {
+          aLocalNodes.Bind (aCorners[k], k);
+        }
+        for (int k = 0; k < 3; ++k)
+        {
+          int aPrev = k;
+          for (size_t aNodeIter = 1; aNodeIter + 1 < aSides[k].size(); ++aNodeIter)
+          {
+            const int aNode = aSides[k][aNodeIter];
+            if (aLocalNodes.IsBound (aNode))
+            {
+              continue;
+            }
+            const int aLocal = aSplitter.InsertOnBoundary (aProj (myNodes[aNode]), aPrev, (k + 1) % 3);
+            bindLocalNode (aNode, aLocal, aLocalNodes, aGlobalNodes, theResult.Aliases);
+            aPrev = aLocal;
+          }
+        }
+
+        // interior nodes of the segments
+        for (int aSegIter = aSplits.SegStart[theTri]; aSegIter < aSplits.SegStart[theTri + 1]; ++aSegIter)
+        {
+          const IntSegment& aSegment = mySegments[aSplits.SegList[aSegIter]];
+          for (int anEnd = 0; anEnd < 2; ++anEnd)
+          {
+            const int aNode = myCanonical[aSegment.Nodes[anEnd]];
+            if (!aLocalNodes.IsBound (aNode))
+            {
+              bindLocalNode (aNode, aSplitter.InsertInside (aProj (myNodes[aNode])), aLocalNodes, aGlobalNodes, theResult.Aliases);
+            }
+          }
+        }
+
+        // segments inside the triangle are inserted as constraints
+        for (int aSegIter = aSplits.SegStart[theTri]; aSegIter < aSplits.SegStart[theTri + 1]; ++aSegIter)
+        {
+          const IntSegment& aSegment = mySegments[aSplits.SegList[aSegIter]];
+          const int aNode1 = myCanonical[aSegment.Nodes[0]];
+          const int aNode2 = myCanonical[aSegment.Nodes[1]];
+          if (aNode1 != aNode2
+          && !markSideCut (theMesh, theTri, aSegment, aSides, theResult.CutEdges))
+          {
+            aSplitter.InsertConstraint (aLocalNodes.Find (aNode1), aLocalNodes.Find (aNode2));
+          }
+        }
+
+        const std::vector<TriangleSplitter::Triangle>& aSubTris = aSplitter.Triangles();
+        for (size_t aTriIter = 0; aTriIter < aSubTris.size(); ++aTriIter)
+        {
+          const TriangleSplitter::Triangle& aSubTri = aSubTris[aTriIter];
+          for (int k = 0; k < 3; ++k)
+          {
+            theResult.Triangles.push_back (aGlobalNodes[aSubTri.Nodes[k]]);
+            if (aSubTri.IsFixed[k] && aSubTri.Adjacent[k] >= 0 && aSubTri.Nodes[k] < aSubTri.Nodes[(k + 1) % 3])
+            {
+              theResult.CutEdges.push_back (aGlobalNodes[aSubTri.Nodes[k]]);
+              theResult.CutEdges.push_back (aGlobalNodes[aSubTri.Nodes[(k + 1) % 3]]);
+            }
+          }
+        }
+      }
+
+      if (isDegenerated)
+      {
+        for (int aSegIter = aSplits.SegStart[theTri]; aSegIter < aSplits.SegStart[theTri + 1]; ++aSegIter)
+        {
+          markSideCut (theMesh, theTri, mySegments[aSplits.SegList[aSegIter]], aSides, theResult.CutEdges);
+        }
+      }
+
+      // sub-triangles lying on the coplanar triangles of the other mesh
+      const int aNbSubTris = int (theResult.Triangles.size() / 3);
+      theResult.OnStates.assign (aNbSubTris, 0);
+      if (isDegenerated || aSplits.CopStart[theTri + 1] == aSplits.CopStart[theTri])
+      {
+        return;
+      }
+      const MeshData& anOther = myMeshes[1 - theMesh];
+      for (int aSubIter = 0; aSubIter < aNbSubTris; ++aSubIter)
+      {
+        const int* aNodes = &theResult.Triangles[3 * aSubIter];
+        const gp_XY aCenter = (aProj (myNodes[aNodes[0]]) + aProj (myNodes[aNodes[1]]) + aProj (myNodes[aNodes[2]])) / 3.0;
+        for (int aCopIter = aSplits.CopStart[theTri]; aCopIter < aSplits.CopStart[theTri + 1]; ++aCopIter)
+        {
+          const int aCopTri = aSplits.CopList[aCopIter];
+          gp_XY aPnts[3];
+          for (int k = 0; k < 3; ++k)
+          {
+            aPnts[k] = aProj (anOther.TriNode (aCopTri, k));
+          }
+          const int aSign = orient2d (aPnts[0], aPnts[1], aPnts[2]);
+          bool isInside = aSign != 0;
+          for (int k = 0; k < 3 && isInside; ++k)
+          {
+            isInside = aSign * orient2d (aPnts[k], aPnts[(k + 1) % 3], aCenter) >= 0;
+          }
+          if (isInside)
+          {
+            theResult.OnStates[aSubIter] = char (aSign);
+            break;
+          }
+        }
+      }
+    }
+
+    //! Binds the global node to the local vertex of the splitting;
+    //! the global node bound to the existing vertex is recorded as its alias.
+    static void bindLocalNode (const int theNode, const int theLocal,
+                               NCollection_DataMap<int, int>& theLocalNodes, std::vector<int>& theGlobalNodes,
+                               std::vector<int>& theAliases)
+    {
+      theLocalNodes.Bind (theNode, theLocal);
+      if (theLocal >= int (theGlobalNodes.size()))
+      {
+        theGlobalNodes.resize (theLocal + 1, theNode);
+      }
+      else if (theGlobalNodes[theLocal] != theNode)
+      {
+        theAliases.push_back (theGlobalNodes[theLocal]);
+        theAliases.push_back (theNode);
+      }
+    }
+
+    //! Updates the canonical nodes from the sets of coinciding nodes.
+    void updateCanonical()
+    {
+      myCanonical.resize (myNodes.size());
+      for (int aNodeIter = 0; aNodeIter < int (myNodes.size()); ++aNodeIter)
+      {
+        myCanonical[aNodeIter] = myNodeSets.Find (aNodeIter);
+      }
+    }
+
+    //! Return the side of the triangle containing the feature of the mesh or -1;
+    //! the corner k belongs to the sides k and k-1.
+    static void featureSides (const MeshData& theMesh, const int theTri, const int theFeature, int theSides[2])
+    {
+      theSides[0] = theSides[1] = -1;
+      const int anIndex = featureIndex (theFeature);
+      for (int k = 0; k < 3; ++k)
+      {
+        if (featureType (theFeature) == FeatureType_Vertex && theMesh.Triangles[3 * theTri + k] == anIndex)
+        {
+          theSides[0] = k;
+          theSides[1] = (k + 2) % 3;
+        }
+        else if (featureType (theFeature) == FeatureType_Edge && theMesh.TriEdges[3 * theTri + k] == anIndex)
+        {
+          theSides[0] = k;
+        }
+      }
+    }
+
+    //! Marks the sub-edges of the side of the triangle covered by the segment lying on this side.
+    //! @return FALSE if the segment does not lie on the side of the triangle
+    bool markSideCut (const int theMesh, const int theTri, const IntSegment& theSegment,
+                      const std::vector<int> theSides[3], std::vector<int>& theCutEdges) const
+    {
+      int aSides1[2], aSides2[2];
+      featureSides (myMeshes[theMesh], theTri, theSegment.Ends[0].Features[theMesh], aSides1);
+      featureSides (myMeshes[theMesh], theTri, theSegment.Ends[1].Features[theMesh], aSides2);
+      int aSide = -1;
+      for (int i = 0; i < 2 && aSide < 0; ++i)
+      {
+        for (int j = 0; j < 2 && aSide < 0; ++j)
+        {
+          aSide = (aSides1[i] >= 0 && aSides1[i] == aSides2[j]) ? aSides1[i] : -1;
+        }
+      }
+      if (aSide < 0)
+      {
+        return false;
+      }
+
+      const std::vector<int>& aSideNodes = theSides[aSide];
+      const std::vector<int>::const_iterator aPos1 = std::find (aSideNodes.begin(), aSideNodes.end(), myCanonical[theSegment.Nodes[0]]);
+      const std::vector<int>::const_iterator aPos2 = std::find (aSideNodes.begin(), aSideNodes.end(), myCanonical[theSegment.Nodes[1]]);
+      if (aPos1 == aSideNodes.end() || aPos2 == aSideNodes.end())
+      {
+        return false;
+      }
+      for (std::vector<int>::const_iterator anIter = std::min (aPos1, aPos2); anIter != std::max (aPos1, aPos2); ++anIter)
+      {
+        theCutEdges.push_back (*anIter);
+        theCutEdges.push_back (*(anIter + 1));
+      }
+      return true;
+    }
+
+    //! Return the nodes of the triangle or sub-triangle in the slot.
+    void slotNodes (const int theMesh, const int theSlot, int theNodes[3]) const
+    {
+      const MeshData& aMesh = myMeshes[theMesh];
+      const MeshSplits& aSplits = mySplits[theMesh];
+      if (theSlot < aMesh.NbTriangles())
+      {
+        for (int k = 0; k < 3; ++k)
+        {
+          theNodes[k] = canonicalNode (theMesh, aMesh.Triangles[3 * theSlot + k]);
+        }
+        return;
+      }
+
+      const size_t aSplit = std::upper_bound (aSplits.SubStart.begin(), aSplits.SubStart.end(), theSlot) - aSplits.SubStart.begin() - 1;
+      const int* aNodes = &aSplits.Results[aSplit].Triangles[3 * (theSlot - aSplits.SubStart[aSplit])];
+      theNodes[0] = aNodes[0];
+      theNodes[1] = aNodes[1];
+      theNodes[2] = aNodes[2];
+    }
+
+    //! Return the orientation of the coplanar triangle of the other mesh containing the slot or 0.
+    char slotOnState (const int theMesh, const int theSlot) const
+    {
+      const MeshSplits& aSplits = mySplits[theMesh];
+      if (theSlot < myMeshes[theMesh].NbTriangles())
+      {
+        return 0;
+      }
+      const size_t aSplit = std::upper_bound (aSplits.SubStart.begin(), aSplits.SubStart.end(), theSlot) - aSplits.SubStart.begin() - 1;
+      return aSplits.Results[aSplit].OnStates[theSlot - aSplits.SubStart[aSplit]];
+    }
+
+    //! Return TRUE if the part of the mesh in the given state belongs to the result of the operation.
+    static bool isSelected (const Poly_MeshBoolean::Operation theOperation, const int theMesh,
+                            const PartState theState, bool& theIsReversed)
+    {
+      theIsReversed = false;
+      if (theMesh == 0)
+      {
+        switch (theOperation)
+        {
+          case Poly_MeshBoolean::Operation_Fuse:   return theState == PartState_Out || theState == PartState_OnSame;
+          case Poly_MeshBoolean::Operation_Common: return theState == PartState_In  || theState == PartState_OnSame;
+          case Poly_MeshBoolean::Operation_Cut:    return theState == PartState_Out || theState == PartState_OnOpposite;
+          default: return false;
+        }
+      }
+
+      // the parts of the second mesh lying on the first one are taken from the first mesh
+      switch (theOperation)
+      {
+        case Poly_MeshBoolean::Operation_Fuse:   return theState == PartState_Out;
+        case Poly_MeshBoolean::Operation_Common: return theState == PartState_In;
+        case Poly_MeshBoolean::Operation_Cut:    theIsReversed = true; return theState == PartState_In;
+        default: return false;
+      }
+    }
+
+  private:
+
+    MeshData                          myMeshes[2];     //!< arguments of the operation
+    MeshSplits                        mySplits[2];     //!< split triangles of the arguments
+    std::vector<gp_XYZ>               myNodes;         //!< nodes of both meshes followed by the new nodes
+    std::vector<int>                  myCanonical;     //!< canonical nodes of the coinciding nodes
+    DisjointSets                      myNodeSets;      //!< sets of the coinciding nodes
+    std::vector<std::pair<int, int> > myPairs;         //!< pairs of triangles with interfering boxes
+    std::vector<IntSegment>           mySegments;      //!< segments of intersection of the pairs
+    std::vector<std::pair<int, int> > myCoplanar;      //!< pairs of overlapping coplanar triangles
+    NCollection_Map<uint64_t>         myCutEdges;      //!< edges lying on the intersection lines
+    bool                              myToRunParallel; //!< flag to use several threads
+    double                            myTolerance;     //!< tolerance of the ray casting
+  };
+}
+
+// =======================================================================
+// function : Poly_MeshBoolean
+// purpose  :
+// =======================================================================
+Poly_MeshBoolean::Poly_MeshBoolean()
+: myOperation (Operation_Fuse),
+  myTolerance (0.0),
+  myToRunParallel (false),
+  myNbCandidatePairs (0),
+  myNbSplitTriangles (0),
+  myNbSnappedNodes (0),
+  myNbOpenEdges (0)
+{
+  //
+}
+
+// =======================================================================
+// function : Perform
+// purpose  :
+// =======================================================================
+Handle(Poly_Triangulation) Poly_MeshBoolean::Perform (const Handle(Poly_Triangulation)& theMesh1,
+                                                      const Handle(Poly_Triangulation)& theMesh2,
+                                                      const Operation theOperation,
+                                                      const bool theToRunParallel)
+{
+  Poly_MeshBoolean aBoolean;
+  aBoolean.SetOperation (theOperation);
+  aBoolean.SetRunParallel (theToRunParallel);
+  if (!aBoolean.Perform (theMesh1, theMesh2))
+  {
+    return Handle(Poly_Triangulation)();
+  }
+  return aBoolean.Result();
+}
+
+// =======================================================================
+// function : Perform
+// purpose  :
+// =======================================================================
+bool Poly_MeshBoolean::Perform (const Handle(Poly_Triangulation)& theMesh1,
+                                const Handle(Poly_Triangulation)& theMesh2,
+                                const Message_ProgressRange& theRange)
+{
+  myResult.Nullify();
+  mySectionLines.Clear();
+  myNbCandidatePairs = 0;
+  myNbSplitTriangles = 0;
+  myNbSnappedNodes = 0;
+  myNbOpenEdges = 0;
+  if (theMesh1.IsNull() || theMesh1->NbTriangles() < 1
+   || theMesh2.IsNull() || theMesh2->NbTriangles() < 1)
+  {
+    return false;
+  }
+
+  Message_ProgressScope aPS (theRange, "Mesh Boolean operation", 5);
+  MeshBooleanTool aTool (myToRunParallel);
+  myNbSnappedNodes = aTool.Init (theMesh1, theMesh2, myTolerance);
+  myNbCandidatePairs = aTool.SelectPairs();
+  aPS.Next();
+  if (!aPS.More())
+  {
+    return false;
+  }
+
+  aTool.IntersectPairs();
+  aPS.Next();
+  if (!aPS.More())
+  {
+    return false;
+  }
+
+  myNbSplitTriangles = aTool.SplitTriangles();
+  aPS.Next();
+  if (!aPS.More())
+  {
+    return false;
+  }
+
+  aTool.BuildSectionLines (mySectionLines);
+  if (myOperation == Operation_Section)
+  {
+    return true;
+  }
+
+  aTool.Classify (0);
+  aTool.Classify (1);
+  aPS.Next();
+  if (!aPS.More())
+  {
+    return false;
+  }
+
+  myResult = aTool.BuildResult (myOperation);
+  myResult->Deflection (Max (theMesh1->Deflection(), theMesh2->Deflection()));
+  aPS.Next();
+
+  // the result is rejected if the intersection lines have not been resolved consistently,
+  // e.g. for the nearly coinciding parts of the meshes beyond the tolerance
+  myNbOpenEdges = countOpenEdges (myResult);
+  return myNbOpenEdges == 0;
+}
@@ -0,0 +1,142 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Poly_MeshBoolean_HeaderFile
+#define _Poly_MeshBoolean_HeaderFile
+
+#include <Message_ProgressRange.hxx>
+#include <NCollection_Sequence.hxx>
+#include <Poly_Polygon3D.hxx>
+#include <Poly_Triangulation.hxx>
+
+//! Boolean operations (fuse, common, cut and section) on closed triangulations.
+//!
+//! Each argument should be a closed (watertight) triangulation with nodes shared by adjacent
+//! triangles, the order of nodes of the triangles defining the normals directed outside of the volume.
+//! The operation is performed directly on the triangles of two meshes:
+//! - The nodes of the second mesh lying within the tolerance from the nodes of the first mesh
+//!   are moved onto these nodes, so that the parts of the meshes differing by rounding errors only
+//!   (e.g. the meshes of the shared surfaces) coincide exactly;
+//! - The pairs of triangles with interfering bounding boxes are selected by traversing
+//!   the BVH trees of both meshes;
+//! - The pairs of triangles are intersected concurrently. Positions of the nodes relative to the planes
+//!   and edges of the triangles are defined by adaptive-precision predicates (floating-point filter with
+//!   exact evaluation on floating-point expansions, J.R. Shewchuk), so that the topology of intersection
+//!   is consistent for all pairs, while the coordinates of the new nodes are computed in double precision.
+//!   Each new node is identified by the features (vertex, edge or interior) of both meshes it lies on,
+//!   so that it is shared by all triangles containing these features;
+//! - The intersected triangles are split by the constrained Delaunay triangulation
+//!   conforming to the intersection segments and to the nodes on their edges;
+//! - The parts of the meshes bounded by the intersection lines are classified relative to the other
+//!   mesh by ray casting, while the parts lying on the coplanar triangles of the other mesh
+//!   are classified by the orientation of the triangles.
+//!
+//! The result of the Fuse, Common and Cut operations is the closed triangulation with nodes shared
+//! along the intersection lines: each oriented edge of the result has exactly one oppositely oriented
+//! partner, otherwise the operation fails. The intersection lines are returned as polygons for all operations.
+class Poly_MeshBoolean : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Poly_MeshBoolean, Standard_Transient)
+public:
+
+  //! Type of the Boolean operation.
+  enum Operation
+  {
+    Operation_Fuse,   //!< union of the volumes of the meshes
+    Operation_Common, //!< intersection of the volumes of the meshes
+    Operation_Cut,    //!< volume of the first mesh without the volume of the second one
+    Operation_Section //!< intersection lines of the meshes
+  };
+
+  //! Performs the operation and returns its result.
+  //! @param[in] theMesh1 first (object) mesh
+  //! @param[in] theMesh2 second (tool) mesh
+  //! @param[in] theOperation type of the operation
+  //! @param[in] theToRunParallel flag to use several threads
+  //! @return resulting triangulation or NULL on failure or for the Section operation
+  Standard_EXPORT static Handle(Poly_Triangulation) Perform (const Handle(Poly_Triangulation)& theMesh1,
+                                                             const Handle(Poly_Triangulation)& theMesh2,
+                                                             const Operation theOperation,
+                                                             const bool theToRunParallel = false);
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Poly_MeshBoolean();
+
+  //! Return type of the operation; Operation_Fuse by default.
+  Operation GetOperation() const { return myOperation; }
+
+  //! Set type of the operation.
+  void SetOperation (Operation theOperation) { myOperation = theOperation; }
+
+  //! Return TRUE if the pairs of triangles should be intersected, the triangles split
+  //! and the parts of the meshes classified using several threads; FALSE by default.
+  bool ToRunParallel() const { return myToRunParallel; }
+
+  //! Set if several threads should be used.
+  void SetRunParallel (bool theToRunParallel) { myToRunParallel = theToRunParallel; }
+
+  //! Return the tolerance of coincidence of the nodes of different meshes; 0.0 by default.
+  double Tolerance() const { return myTolerance; }
+
+  //! Set the tolerance of coincidence of the nodes of different meshes:
+  //! the nodes of the second mesh lying within the tolerance from the nodes of the first mesh
+  //! are moved onto these nodes before the intersection.
+  void SetTolerance (double theTolerance) { myTolerance = theTolerance; }
+
+  //! Performs the operation.
+  //! @param[in] theMesh1 first (object) mesh
+  //! @param[in] theMesh2 second (tool) mesh
+  //! @param[in] theRange progress indicator
+  //! @return FALSE on empty input, user break or not closed result (see NbOpenEdges())
+  Standard_EXPORT bool Perform (const Handle(Poly_Triangulation)& theMesh1,
+                                const Handle(Poly_Triangulation)& theMesh2,
+                                const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Return the resulting triangulation; NULL for the Section operation.
+  //! The result may have no triangles, e.g. for the Common operation of disjoint meshes.
+  const Handle(Poly_Triangulation)& Result() const { return myResult; }
+
+  //! Return the intersection lines of the meshes, computed for all operations.
+  //! Closed lines have equal first and last nodes.
+  const NCollection_Sequence<Handle(Poly_Polygon3D)>& SectionLines() const { return mySectionLines; }
+
+  //! Return the number of pairs of triangles with interfering bounding boxes.
+  int NbCandidatePairs() const { return myNbCandidatePairs; }
+
+  //! Return the number of triangles of both meshes split by the intersection lines.
+  int NbSplitTriangles() const { return myNbSplitTriangles; }
+
+  //! Return the number of nodes of the second mesh moved onto the nodes of the first mesh.
+  int NbSnappedNodes() const { return myNbSnappedNodes; }
+
+  //! Return the number of the oriented edges of the result without exactly one oppositely oriented partner;
+  //! the operation fails if it is not zero, while the open result is kept for analysis.
+  int NbOpenEdges() const { return myNbOpenEdges; }
+
+private:
+
+  Handle(Poly_Triangulation)                   myResult;           //!< resulting triangulation
+  NCollection_Sequence<Handle(Poly_Polygon3D)> mySectionLines;     //!< intersection lines
+  Operation                                    myOperation;        //!< type of the operation
+  double                                       myTolerance;        //!< tolerance of coincidence of the nodes of different meshes
+  bool                                         myToRunParallel;    //!< flag to use several threads
+  int                                          myNbCandidatePairs; //!< number of pairs of interfering boxes
+  int                                          myNbSplitTriangles; //!< number of split triangles
+  int                                          myNbSnappedNodes;   //!< number of nodes moved onto the nodes of the other mesh
+  int                                          myNbOpenEdges;      //!< number of open edges of the result
+
+};
+
+#endif // _Poly_MeshBoolean_HeaderFile
@@ -0,0 +1,628 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Poly_MeshDecimator.hxx>
+
+#include <TColStd_MapIteratorOfPackedMapOfInteger.hxx>
+
+#include <algorithm>
+#include <queue>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(Poly_MeshDecimator, Standard_Transient)
+
+namespace
+{
+  //! Minimal cosine of angle between normals of triangle before and after collapse.
+  static const double THE_MIN_NORMAL_COS = 0.2;
+
+  //! Symmetric 4x4 matrix of quadric of squared distances to planes.
+  struct Quadric
+  {
+    double A2, AB, AC, AD, B2, BC, BD, C2, CD, D2;
+
+    Quadric() : A2 (0.0), AB (0.0), AC (0.0), AD (0.0), B2 (0.0), BC (0.0), BD (0.0), C2 (0.0), CD (0.0), D2 (0.0) {}
+
+    //! Quadric of the plane with unit normal theNorm and equation theNorm * P + theD = 0.
+    Quadric (const gp_XYZ& theNorm, const double theD)
+    : A2 (theNorm.X() * theNorm.X()), AB (theNorm.X() * theNorm.Y()), AC (theNorm.X() * theNorm.Z()), AD (theNorm.X() * theD),
+      B2 (theNorm.Y() * theNorm.Y()), BC (theNorm.Y() * theNorm.Z()), BD (theNorm.Y() * theD),
+      C2 (theNorm.Z() * theNorm.Z()), CD (theNorm.Z() * theD),
+      D2 (theD * theD) {}
+
+    Quadric& operator+= (const Quadric& theOther)
+    {
+      A2 += theOther.A2; AB += theOther.AB; AC += theOther.AC; AD += theOther.AD;
+      B2 += theOther.B2; BC += theOther.BC; BD += theOther.BD;
+      C2 += theOther.C2; CD += theOther.CD;
+      D2 += theOther.D2;
+      return *this;
+    }
+
+    Quadric operator+ (const Quadric& theOther) const
+    {
+      Quadric aSum (*this);
+      aSum += theOther;
+      return aSum;
+    }
+
+    //! Return sum of squared distances from the point to the planes.
+    double Evaluate (const gp_XYZ& theP) const
+    {
+      const double x = theP.X(), y = theP.Y(), z = theP.Z();
+      const double aVal = A2 * x * x + 2.0 * AB * x * y + 2.0 * AC * x * z + 2.0 * AD * x
+                        + B2 * y * y + 2.0 * BC * y * z + 2.0 * BD * y
+                        + C2 * z * z + 2.0 * CD * z
+                        + D2;
+      return Max (aVal, 0.0);
+    }
+  };
+
+  //! Candidate collapse of node From into node To.
+  struct Collapse
+  {
+    double Error;
+    int    From;
+    int    To;
+    int    FromStamp;
+    int    ToStamp;
+
+    //! Comparison for the queue returning the collapse of minimal error first.
+    bool operator< (const Collapse& theOther) const
+    {
+      if (Error != theOther.Error)
+      {
+        return Error > theOther.Error;
+      }
+      if (From != theOther.From)
+      {
+        return From > theOther.From;
+      }
+      return To > theOther.To;
+    }
+  };
+
+  //! Edge of triangulation with nodes sorted.
+  struct TriEdge
+  {
+    int Node1;
+    int Node2;
+
+    bool operator< (const TriEdge& theOther) const
+    {
+      return Node1 < theOther.Node1
+          || (Node1 == theOther.Node1 && Node2 < theOther.Node2);
+    }
+
+    bool operator== (const TriEdge& theOther) const
+    {
+      return Node1 == theOther.Node1 && Node2 == theOther.Node2;
+    }
+  };
+
+  //! Auxiliary structure performing collapses of edges.
+  //! Triangles of each node are kept in linked list, so that the list of removed node
+  //! is appended to the list of the node it is collapsed into; removed triangles are skipped.
+  class QuadricDecimation
+  {
+  public:
+
+    QuadricDecimation (const Handle(Poly_Triangulation)& theTris)
+    : myNodes    (0, theTris->NbNodes() - 1),
+      myQuadrics (0, theTris->NbNodes() - 1),
+      myIsFixed  (0, theTris->NbNodes() - 1),
+      myNodeTo   (0, theTris->NbNodes() - 1),
+      myStamps   (0, theTris->NbNodes() - 1),
+      myMarks    (0, theTris->NbNodes() - 1),
+      myHeads    (0, theTris->NbNodes() - 1),
+      myTails    (0, theTris->NbNodes() - 1),
+      myTriNodes (0, theTris->NbTriangles() * 3 - 1),
+      myNexts    (0, theTris->NbTriangles() * 3 - 1),
+      myMarkGen  (0),
+      myNbTris   (0),
+      myError    (0.0)
+    {
+      myIsFixed.Init (false);
+      myStamps.Init (0);
+      myMarks.Init (0);
+      myHeads.Init (-1);
+      myTails.Init (-1);
+      for (int aNodeIter = 0; aNodeIter < myNodes.Size(); ++aNodeIter)
+      {
+        myNodes  (aNodeIter) = theTris->Node (aNodeIter + 1).XYZ();
+        myNodeTo (aNodeIter) = aNodeIter;
+      }
+
+      for (int aTriIter = 0; aTriIter < theTris->NbTriangles(); ++aTriIter)
+      {
+        int aNodes[3];
+        theTris->Triangle (aTriIter + 1).Get (aNodes[0], aNodes[1], aNodes[2]);
+        const bool isDegenerate = aNodes[0] == aNodes[1] || aNodes[0] == aNodes[2] || aNodes[1] == aNodes[2];
+        for (int aTriNodeIter = 0; aTriNodeIter < 3; ++aTriNodeIter)
+        {
+          // degenerate triangles are removed
+          myTriNodes (aTriIter * 3 + aTriNodeIter) = isDegenerate ? -1 : aNodes[aTriNodeIter] - 1;
+        }
+        if (isDegenerate)
+        {
+          continue;
+        }
+
+        ++myNbTris;
+        for (int aTriNodeIter = 0; aTriNodeIter < 3; ++aTriNodeIter)
+        {
+          appendCorner (aNodes[aTriNodeIter] - 1, aTriIter * 3 + aTriNodeIter);
+        }
+
+        const gp_XYZ& aP0 = myNodes (aNodes[0] - 1);
+        const gp_XYZ aNorm = (myNodes (aNodes[1] - 1) - aP0).Crossed (myNodes (aNodes[2] - 1) - aP0);
+        const double aNormLen = aNorm.Modulus();
+        if (aNormLen > gp::Resolution())
+        {
+          const gp_XYZ aUnitNorm = aNorm / aNormLen;
+          const Quadric aPlane (aUnitNorm, -aUnitNorm.Dot (aP0));
+          for (int aTriNodeIter = 0; aTriNodeIter < 3; ++aTriNodeIter)
+          {
+            myQuadrics (aNodes[aTriNodeIter] - 1) += aPlane;
+          }
+        }
+      }
+    }
+
+    //! Mark node as fixed.
+    void SetFixed (int theNode) { myIsFixed (theNode) = true; }
+
+    //! Return number of triangles.
+    int NbTriangles() const { return myNbTris; }
+
+    //! Return maximum error of performed collapses.
+    double Error() const { return myError; }
+
+    //! Return the node which the node has been collapsed into, or the node itself.
+    int FinalNode (int theNode) const
+    {
+      int aNode = theNode;
+      while (myNodeTo (aNode) != aNode)
+      {
+        aNode = myNodeTo (aNode);
+      }
+      return aNode;
+    }
+
+    //! Return node of triangle corner, or -1 for removed triangle.
+    int CornerNode (int theCorner) const { return myTriNodes (theCorner); }
+
+    //! Mark nodes of free (if requested) and non-manifold edges as fixed.
+    void FixBoundary (bool theToFixFree)
+    {
+      std::vector<TriEdge> anEdges;
+      collectEdges (anEdges);
+      for (size_t anEdgeIter = 0; anEdgeIter < anEdges.size(); )
+      {
+        size_t aNext = anEdgeIter + 1;
+        for (; aNext < anEdges.size() && anEdges[aNext] == anEdges[anEdgeIter]; ++aNext) {}
+        const size_t aNbEdgeTris = aNext - anEdgeIter;
+        if (aNbEdgeTris > 2
+         || (aNbEdgeTris == 1 && theToFixFree))
+        {
+          myIsFixed (anEdges[anEdgeIter].Node1) = true;
+          myIsFixed (anEdges[anEdgeIter].Node2) = true;
+        }
+        anEdgeIter = aNext;
+      }
+    }
+
+    //! Collapse edges while the number of triangles exceeds the target one
+    //! and the squared error does not exceed the maximum one.
+    void Perform (const int theTargetNbTris, const double theMaxSqError)
+    {
+      std::vector<TriEdge> anEdges;
+      collectEdges (anEdges);
+      anEdges.erase (std::unique (anEdges.begin(), anEdges.end()), anEdges.end());
+      for (std::vector<TriEdge>::const_iterator anEdgeIter = anEdges.begin(); anEdgeIter != anEdges.end(); ++anEdgeIter)
+      {
+        pushEdge (anEdgeIter->Node1, anEdgeIter->Node2);
+      }
+      anEdges.clear();
+
+      while (myNbTris > theTargetNbTris
+         && !myQueue.empty())
+      {
+        const Collapse aCollapse = myQueue.top();
+        myQueue.pop();
+        if (aCollapse.Error > theMaxSqError)
+        {
+          break;
+        }
+        if (myNodeTo (aCollapse.From) != aCollapse.From
+         || myNodeTo (aCollapse.To)   != aCollapse.To
+         || myStamps (aCollapse.From) != aCollapse.FromStamp
+         || myStamps (aCollapse.To)   != aCollapse.ToStamp
+         || !isValidCollapse (aCollapse.From, aCollapse.To))
+        {
+          continue;
+        }
+
+        collapse (aCollapse.From, aCollapse.To);
+        myError = Max (myError, aCollapse.Error);
+
+        // errors of collapsing edges of the kept node have changed
+        const int aNode = aCollapse.To;
+        const int aMark = ++myMarkGen;
+        myMarks (aNode) = aMark;
+        for (int aCorner = myHeads (aNode); aCorner != -1; aCorner = myNexts (aCorner))
+        {
+          const int aTri = aCorner / 3;
+          if (myTriNodes (aTri * 3) == -1)
+          {
+            continue;
+          }
+          for (int aTriNodeIter = 0; aTriNodeIter < 3; ++aTriNodeIter)
+          {
+            const int anOther = myTriNodes (aTri * 3 + aTriNodeIter);
+            if (myMarks (anOther) != aMark)
+            {
+              myMarks (anOther) = aMark;
+              pushEdge (aNode, anOther);
+            }
+          }
+        }
+      }
+      myError = Sqrt (myError);
+    }
+
+  private:
+
+    //! Append triangle corner to the list of node.
+    void appendCorner (int theNode, int theCorner)
+    {
+      myNexts (theCorner) = -1;
+      if (myTails (theNode) == -1)
+      {
+        myHeads (theNode) = theCorner;
+      }
+      else
+      {
+        myNexts (myTails (theNode)) = theCorner;
+      }
+      myTails (theNode) = theCorner;
+    }
+
+    //! Collect edges of not removed triangles sorted by nodes (repeated for each triangle).
+    void collectEdges (std::vector<TriEdge>& theEdges) const
+    {
+      theEdges.reserve (myNbTris * 3);
+      for (int aTriIter = 0; aTriIter < myTriNodes.Size() / 3; ++aTriIter)
+      {
+        if (myTriNodes (aTriIter * 3) == -1)
+        {
+          continue;
+        }
+        for (int aTriNodeIter = 0; aTriNodeIter < 3; ++aTriNodeIter)
+        {
+          const int aNode1 = myTriNodes (aTriIter * 3 + aTriNodeIter);
+          const int aNode2 = myTriNodes (aTriIter * 3 + (aTriNodeIter + 1) % 3);
+          TriEdge anEdge;
+          anEdge.Node1 = Min (aNode1, aNode2);
+          anEdge.Node2 = Max (aNode1, aNode2);
+          theEdges.push_back (anEdge);
+        }
+      }
+      std::sort (theEdges.begin(), theEdges.end());
+    }
+
+    //! Put into the queue the collapse of edge with the least error.
+    void pushEdge (int theNode1, int theNode2)
+    {
+      if (myIsFixed (theNode1)
+       && myIsFixed (theNode2))
+      {
+        return;
+      }
+
+      const Quadric aQuadric = myQuadrics (theNode1) + myQuadrics (theNode2);
+      const double anError12 = myIsFixed (theNode1) ? RealLast() : aQuadric.Evaluate (myNodes (theNode2));
+      const double anError21 = myIsFixed (theNode2) ? RealLast() : aQuadric.Evaluate (myNodes (theNode1));
+      Collapse aCollapse;
+      aCollapse.Error = Min (anError12, anError21);
+      aCollapse.From  = anError12 <= anError21 ? theNode1 : theNode2;
+      aCollapse.To    = anError12 <= anError21 ? theNode2 : theNode1;
+      aCollapse.FromStamp = myStamps (aCollapse.From);
+      aCollapse.ToStamp   = myStamps (aCollapse.To);
+      myQueue.push (aCollapse);
+    }
+
+    //! Check that collapse keeps the mesh manifold and does not flip triangles.
+    bool isValidCollapse (int theFrom, int theTo)
+    {
+      // mark nodes adjacent to the removed node, and count triangles of the edge
+      const int aMarkFrom = ++myMarkGen;
+      int aNbEdgeTris = 0;
+      for (int aCorner = myHeads (theFrom); aCorner != -1; aCorner = myNexts (aCorner))
+      {
+        const int aTri = aCorner / 3;
+        if (myTriNodes (aTri * 3) == -1)
+        {
+          continue;
+        }
+
+        bool hasTo = false;
+        for (int aTriNodeIter = 0; aTriNodeIter < 3; ++aTriNodeIter)
+        {
+          const int aNode = myTriNodes (aTri * 3 + aTriNodeIter);
+          myMarks (aNode) = aMarkFrom;
+          hasTo = hasTo || aNode == theTo;
+        }
+        if (hasTo)
+        {
+          ++aNbEdgeTris;
+        }
+      }
+      if (aNbEdgeTris == 0)
+      {
+        return false;
+      }
+
+      // nodes adjacent to both nodes should be only the opposite nodes of triangles of the edge
+      const int aMarkCommon = ++myMarkGen;
+      int aNbCommon = 0;
+      for (int aCorner = myHeads (theTo); aCorner != -1; aCorner = myNexts (aCorner))
+      {
+        const int aTri = aCorner / 3;
+        if (myTriNodes (aTri * 3) == -1)
+        {
+          continue;
+        }
+        for (int aTriNodeIter = 0; aTriNodeIter < 3; ++aTriNodeIter)
+        {
+          const int aNode = myTriNodes (aTri * 3 + aTriNodeIter);
+          if (aNode != theFrom
+           && aNode != theTo
+           && myMarks (aNode) == aMarkFrom)
+          {
+            myMarks (aNode) = aMarkCommon;
+            ++aNbCommon;
+          }
+        }
+      }
+      if (aNbCommon != aNbEdgeTris)
+      {
+        return false;
+      }
+
+      // remaining triangles of the removed node should not be flipped or degenerated
+      for (int aCorner = myHeads (theFrom); aCorner != -1; aCorner = myNexts (aCorner))
+      {
+        const int aTri = aCorner / 3;
+        if (myTriNodes (aTri * 3) == -1)
+        {
+          continue;
+        }
+
+        gp_XYZ aPnts[3], aNewPnts[3];
+        bool hasTo = false;
+        for (int aTriNodeIter = 0; aTriNodeIter < 3; ++aTriNodeIter)
+        {
+          const int aNode = myTriNodes (aTri * 3 + aTriNodeIter);
+          hasTo = hasTo || aNode == theTo;
+          aPnts[aTriNodeIter]    = myNodes (aNode);
+          aNewPnts[aTriNodeIter] = myNodes (aNode == theFrom ? theTo : aNode);
+        }
+        if (hasTo)
+        {
+          continue;
+        }
+
+        const gp_XYZ aNorm    = (aPnts[1] - aPnts[0]).Crossed (aPnts[2] - aPnts[0]);
+        const gp_XYZ aNewNorm = (aNewPnts[1] - aNewPnts[0]).Crossed (aNewPnts[2] - aNewPnts[0]);
+        const double aSqModProd = aNorm.SquareModulus() * aNewNorm.SquareModulus();
+        if (aSqModProd <= gp::Resolution()
+         || aNorm.Dot (aNewNorm) < THE_MIN_NORMAL_COS * Sqrt (aSqModProd))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    //! Collapse node into another one.
+    void collapse (int theFrom, int theTo)
+    {
+      for (int aCorner = myHeads (theFrom); aCorner != -1; aCorner = myNexts (aCorner))
+      {
+        const int aTri = aCorner / 3;
+        if (myTriNodes (aTri * 3) == -1)
+        {
+          continue;
+        }
+
+        if (myTriNodes (aTri * 3)     == theTo
+         || myTriNodes (aTri * 3 + 1) == theTo
+         || myTriNodes (aTri * 3 + 2) == theTo)
+        {
+          // triangle of collapsed edge
+          myTriNodes (aTri * 3) = myTriNodes (aTri * 3 + 1) = myTriNodes (aTri * 3 + 2) = -1;
+          --myNbTris;
+        }
+        else
+        {
+          myTriNodes (aCorner) = theTo;
+        }
+      }
+
+      // append the triangles of removed node to the kept one
+      if (myHeads (theFrom) != -1)
+      {
+        if (myTails (theTo) == -1)
+        {
+          myHeads (theTo) = myHeads (theFrom);
+        }
+        else
+        {
+          myNexts (myTails (theTo)) = myHeads (theFrom);
+        }
+        myTails (theTo) = myTails (theFrom);
+      }
+      myHeads (theFrom) = myTails (theFrom) = -1;
+
+      myQuadrics (theTo) += myQuadrics (theFrom);
+      myNodeTo (theFrom) = theTo;
+      ++myStamps (theTo);
+    }
+
+  private:
+
+    NCollection_Array1<gp_XYZ>  myNodes;    //!< node positions
+    NCollection_Array1<Quadric> myQuadrics; //!< node quadrics
+    NCollection_Array1<bool>    myIsFixed;  //!< flags of fixed nodes
+    NCollection_Array1<int>     myNodeTo;   //!< node which the node has been collapsed into, or node itself
+    NCollection_Array1<int>     myStamps;   //!< counters of changes of node
+    NCollection_Array1<int>     myMarks;    //!< auxiliary marks of nodes
+    NCollection_Array1<int>     myHeads;    //!< first triangle corner of node
+    NCollection_Array1<int>     myTails;    //!< last triangle corner of node
+    NCollection_Array1<int>     myTriNodes; //!< nodes of triangle corners, -1 for removed triangle
+    NCollection_Array1<int>     myNexts;    //!< next triangle corner of the same node
+    std::priority_queue<Collapse> myQueue;  //!< candidate collapses
+    int                         myMarkGen;  //!< last used mark
+    int                         myNbTris;   //!< number of not removed triangles
+    double                      myError;    //!< maximum squared error, or error after performing
+  };
+}
+
+// =======================================================================
+// function : Poly_MeshDecimator
+// purpose  :
+// =======================================================================
+Poly_MeshDecimator::Poly_MeshDecimator()
+: myTargetNbTris (0),
+  myMaxError (Precision::Infinite()),
+  myError (0.0),
+  myToKeepBoundary (true)
+{
+  //
+}
+
+// =======================================================================
+// function : Decimate
+// purpose  :
+// =======================================================================
+Handle(Poly_Triangulation) Poly_MeshDecimator::Decimate (const Handle(Poly_Triangulation)& theTris,
+                                                         const int theNbTriangles,
+                                                         const double theMaxError)
+{
+  Poly_MeshDecimator aDecimator;
+  aDecimator.SetTargetNbTriangles (theNbTriangles);
+  aDecimator.SetMaxError (theMaxError);
+  if (!aDecimator.Perform (theTris))
+  {
+    return Handle(Poly_Triangulation)();
+  }
+  return aDecimator.Result();
+}
+
+// =======================================================================
+// function : Perform
+// purpose  :
+// =======================================================================
+bool Poly_MeshDecimator::Perform (const Handle(Poly_Triangulation)& theTris,
+                                  const TColStd_PackedMapOfInteger& theFixedNodes)
+{
+  myResult.Nullify();
+  myNodeMap = NCollection_Array1<int>();
+  myError = 0.0;
+  if (theTris.IsNull()
+   || theTris->NbNodes() < 3
+   || theTris->NbTriangles() < 1)
+  {
+    return false;
+  }
+
+  QuadricDecimation aDecimation (theTris);
+  aDecimation.FixBoundary (myToKeepBoundary);
+  for (TColStd_MapIteratorOfPackedMapOfInteger aNodeIter (theFixedNodes); aNodeIter.More(); aNodeIter.Next())
+  {
+    if (aNodeIter.Key() >= 1
+     && aNodeIter.Key() <= theTris->NbNodes())
+    {
+      aDecimation.SetFixed (aNodeIter.Key() - 1);
+    }
+  }
+
+  const double aMaxSqError = myMaxError < Sqrt (RealLast()) ? myMaxError * myMaxError : RealLast();
+  aDecimation.Perform (myTargetNbTris, aMaxSqError);
+  myError = aDecimation.Error();
+
+  // nodes which have not been collapsed are kept in the same order
+  const int aNbSrcNodes = theTris->NbNodes();
+  myNodeMap.Resize (1, aNbSrcNodes, false);
+  int aNbNodes = 0;
+  for (int aNodeIter = 1; aNodeIter <= aNbSrcNodes; ++aNodeIter)
+  {
+    myNodeMap (aNodeIter) = aDecimation.FinalNode (aNodeIter - 1) == aNodeIter - 1 ? ++aNbNodes : 0;
+  }
+  for (int aNodeIter = 1; aNodeIter <= aNbSrcNodes; ++aNodeIter)
+  {
+    if (myNodeMap (aNodeIter) == 0)
+    {
+      myNodeMap (aNodeIter) = myNodeMap (aDecimation.FinalNode (aNodeIter - 1) + 1);
+    }
+  }
+
+  myResult = new Poly_Triangulation();
+  myResult->SetDoublePrecision (theTris->IsDoublePrecision());
+  myResult->ResizeNodes     (aNbNodes, false);
+  myResult->ResizeTriangles (aDecimation.NbTriangles(), false);
+  if (theTris->HasUVNodes())
+  {
+    myResult->AddUVNodes();
+  }
+  if (theTris->HasNormals())
+  {
+    myResult->AddNormals();
+  }
+  myResult->SetMeshPurpose (theTris->MeshPurpose());
+  myResult->Deflection (theTris->Deflection() + myError);
+  for (int aNodeIter = 1, aNodeIndex = 0; aNodeIter <= aNbSrcNodes; ++aNodeIter)
+  {
+    if (aDecimation.FinalNode (aNodeIter - 1) != aNodeIter - 1)
+    {
+      continue;
+    }
+
+    ++aNodeIndex;
+    myResult->SetNode (aNodeIndex, theTris->Node (aNodeIter));
+    if (theTris->HasUVNodes())
+    {
+      myResult->SetUVNode (aNodeIndex, theTris->UVNode (aNodeIter));
+    }
+    if (theTris->HasNormals())
+    {
+      gp_Vec3f aNorm;
+      theTris->Normal (aNodeIter, aNorm);
+      myResult->SetNormal (aNodeIndex, aNorm);
+    }
+  }
+
+  for (int aTriIter = 0, aTriIndex = 0; aTriIter < theTris->NbTriangles(); ++aTriIter)
+  {
+    if (aDecimation.CornerNode (aTriIter * 3) == -1)
+    {
+      continue;
+    }
+
+    myResult->SetTriangle (++aTriIndex, Poly_Triangle (myNodeMap (aDecimation.CornerNode (aTriIter * 3)     + 1),
+                                                       myNodeMap (aDecimation.CornerNode (aTriIter * 3 + 1) + 1),
+                                                       myNodeMap (aDecimation.CornerNode (aTriIter * 3 + 2) + 1)));
+  }
+  return true;
+}
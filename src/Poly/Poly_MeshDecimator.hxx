@@ -0,0 +1,104 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Poly_MeshDecimator_HeaderFile
+#define _Poly_MeshDecimator_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <TColStd_PackedMapOfInteger.hxx>
+
+//! Simplification of triangulation by collapsing edges in order of increasing quadric error
+//! (M. Garland, P. Heckbert "Surface Simplification Using Quadric Error Metrics").
+//!
+//! Each node accumulates the quadric of squared distances to the planes of its triangles.
+//! The edge is collapsed into one of its nodes (half-edge collapse), so that nodes of the result
+//! are a subset of source nodes keeping their UV coordinates and normals;
+//! the error of collapse is the square root of sum of squared distances from that node
+//! to the planes of all source triangles merged into the ones around the removed node,
+//! thus it is not less than the distance to any of these planes.
+//!
+//! Edges are collapsed while the number of triangles exceeds the target one and the error
+//! does not exceed the maximum one. Collapses making the mesh non-manifold, flipping
+//! or degenerating triangles are rejected.
+//! Nodes of free and non-manifold edges of triangulation are kept (see SetKeepBoundary()),
+//! as well as the nodes specified as fixed, e.g. nodes of polygons on triangulation
+//! shared with adjacent faces (see BRepMesh_ShapeDecimator).
+class Poly_MeshDecimator : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Poly_MeshDecimator, Standard_Transient)
+public:
+
+  //! Decimate triangulation and return the new one.
+  //! @param[in] theTris triangulation to decimate
+  //! @param[in] theNbTriangles target number of triangles; 0 to limit decimation only by error
+  //! @param[in] theMaxError maximum error of decimation
+  //! @return decimated triangulation or NULL on empty input
+  Standard_EXPORT static Handle(Poly_Triangulation) Decimate (const Handle(Poly_Triangulation)& theTris,
+                                                              const int theNbTriangles,
+                                                              const double theMaxError = Precision::Infinite());
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Poly_MeshDecimator();
+
+  //! Return target number of triangles; 0 by default meaning that decimation is limited only by error.
+  int TargetNbTriangles() const { return myTargetNbTris; }
+
+  //! Set target number of triangles.
+  void SetTargetNbTriangles (int theNbTriangles) { myTargetNbTris = theNbTriangles; }
+
+  //! Return maximum error of decimation; infinite by default.
+  double MaxError() const { return myMaxError; }
+
+  //! Set maximum error of decimation.
+  void SetMaxError (double theError) { myMaxError = theError; }
+
+  //! Return TRUE if nodes of free edges of triangulation should be kept; TRUE by default.
+  //! Nodes of non-manifold edges are kept regardless of this flag.
+  bool ToKeepBoundary() const { return myToKeepBoundary; }
+
+  //! Set if nodes of free edges of triangulation should be kept.
+  void SetKeepBoundary (bool theToKeep) { myToKeepBoundary = theToKeep; }
+
+  //! Decimate triangulation.
+  //! @param[in] theTris triangulation to decimate
+  //! @param[in] theFixedNodes indexes of nodes which should be kept
+  //! @return FALSE on empty input
+  Standard_EXPORT bool Perform (const Handle(Poly_Triangulation)& theTris,
+                                const TColStd_PackedMapOfInteger& theFixedNodes = TColStd_PackedMapOfInteger());
+
+  //! Return decimated triangulation.
+  const Handle(Poly_Triangulation)& Result() const { return myResult; }
+
+  //! Return index of the node of result corresponding to the node of source triangulation;
+  //! removed node corresponds to the node it has been collapsed into.
+  int ResultNode (int theSourceNode) const { return myNodeMap.Value (theSourceNode); }
+
+  //! Return maximum error of performed collapses.
+  double Error() const { return myError; }
+
+private:
+
+  Handle(Poly_Triangulation)   myResult;         //!< decimated triangulation
+  NCollection_Array1<int>      myNodeMap;        //!< indexes of result nodes for source nodes
+  int                          myTargetNbTris;   //!< target number of triangles
+  double                       myMaxError;       //!< maximum error
+  double                       myError;          //!< maximum error of performed collapses
+  bool                         myToKeepBoundary; //!< flag to keep nodes of free edges
+
+};
+
+#endif // _Poly_MeshDecimator_HeaderFile
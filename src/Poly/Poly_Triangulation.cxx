@@ -20,10 +20,17 @@
 #include <OSD_FileSystem.hxx>
 #include <Poly_Triangle.hxx>
 #include <Standard_Dump.hxx>
+#include <Standard_Mutex.hxx>
 #include <Standard_Type.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT (Poly_Triangulation, Standard_Transient)
 
+namespace
+{
+  //! Maximal number of nodes of compact triangulation which triangles are defined by 16-bit indices.
+  static const Standard_Integer THE_MAX_PACKED_NODES = 65536;
+}
+
 //=======================================================================
 //function : Poly_Triangulation
 //purpose  : 
@@ -31,7 +38,8 @@ IMPLEMENT_STANDARD_RTTIEXT (Poly_Triangulation, Standard_Transient)
 Poly_Triangulation::Poly_Triangulation()
 : myCachedMinMax (NULL),
   myDeflection   (0),
-  myPurpose      (Poly_MeshPurpose_NONE)
+  myPurpose      (Poly_MeshPurpose_NONE),
+  myIsCompact    (false)
 {
   //
 }
@@ -48,7 +56,8 @@ Poly_Triangulation::Poly_Triangulation (const Standard_Integer theNbNodes,
   myDeflection(0),
   myNodes     (theNbNodes),
   myTriangles (1, theNbTriangles),
-  myPurpose   (Poly_MeshPurpose_NONE)
+  myPurpose   (Poly_MeshPurpose_NONE),
+  myIsCompact (false)
 {
   if (theHasUVNodes)
   {
@@ -70,7 +79,8 @@ Poly_Triangulation::Poly_Triangulation (const TColgp_Array1OfPnt&    theNodes,
   myDeflection   (0),
   myNodes        (theNodes.Length()),
   myTriangles    (1, theTriangles.Length()),
-  myPurpose      (Poly_MeshPurpose_NONE)
+  myPurpose      (Poly_MeshPurpose_NONE),
+  myIsCompact    (false)
 {
   const Poly_ArrayOfNodes aNodeWrapper (theNodes.First(), theNodes.Length());
   myNodes = aNodeWrapper;
@@ -90,7 +100,8 @@ Poly_Triangulation::Poly_Triangulation (const TColgp_Array1OfPnt&    theNodes,
   myNodes        (theNodes.Length()),
   myTriangles    (1, theTriangles.Length()),
   myUVNodes      (theNodes.Length()),
-  myPurpose      (Poly_MeshPurpose_NONE)
+  myPurpose      (Poly_MeshPurpose_NONE),
+  myIsCompact    (false)
 {
   const Poly_ArrayOfNodes aNodeWrapper (theNodes.First(), theNodes.Length());
   myNodes = aNodeWrapper;
@@ -130,7 +141,10 @@ Poly_Triangulation::Poly_Triangulation (const Handle(Poly_Triangulation)& theTri
   myTriangles (theTriangulation->myTriangles),
   myUVNodes   (theTriangulation->myUVNodes),
   myNormals   (theTriangulation->myNormals),
-  myPurpose   (theTriangulation->myPurpose)
+  myPurpose   (theTriangulation->myPurpose),
+  myPackedTriangles (theTriangulation->myPackedTriangles),
+  myPackedNormals   (theTriangulation->myPackedNormals),
+  myIsCompact (theTriangulation->myIsCompact)
 {
   SetCachedMinMax (theTriangulation->CachedMinMax());
 }
@@ -143,8 +157,9 @@ void Poly_Triangulation::Clear()
 {
   if (!myNodes.IsEmpty())
   {
+    // quantization range is defined by cleared nodes, so that double precision is restored
     Poly_ArrayOfNodes anEmptyNodes;
-    anEmptyNodes.SetDoublePrecision (myNodes.IsDoublePrecision());
+    anEmptyNodes.SetDoublePrecision (myNodes.IsDoublePrecision() || myNodes.IsQuantized());
     myNodes.Move (anEmptyNodes);
   }
   if (!myTriangles.IsEmpty())
@@ -152,8 +167,15 @@ void Poly_Triangulation::Clear()
     Poly_Array1OfTriangle anEmptyTriangles;
     myTriangles.Move(anEmptyTriangles);
   }
+  if (!myPackedTriangles.IsEmpty())
+  {
+    NCollection_Array1<PackedTriangle> anEmptyTriangles;
+    myPackedTriangles.Move (anEmptyTriangles);
+  }
+  resetUnpackedTriangles();
   RemoveUVNodes();
   RemoveNormals();
+  myIsCompact = false;
 }
 
 //=======================================================================
@@ -181,6 +203,11 @@ void Poly_Triangulation::RemoveNormals()
     NCollection_Array1<gp_Vec3f> anEmpty;
     myNormals.Move (anEmpty);
   }
+  if (!myPackedNormals.IsEmpty())
+  {
+    NCollection_Array1<PackedNormal> anEmpty;
+    myPackedNormals.Move (anEmpty);
+  }
 }
 
 //=======================================================================
@@ -220,6 +247,16 @@ Handle(TColgp_HArray1OfPnt) Poly_Triangulation::MapNodeArray() const
 //=======================================================================
 Handle(Poly_HArray1OfTriangle) Poly_Triangulation::MapTriangleArray() const
 {
+  if (!myPackedTriangles.IsEmpty())
+  {
+    // deep copy
+    Handle(Poly_HArray1OfTriangle) anArray = new Poly_HArray1OfTriangle (1, NbTriangles());
+    for (Standard_Integer aTriIter = 1; aTriIter <= NbTriangles(); ++aTriIter)
+    {
+      anArray->SetValue (aTriIter, Triangle (aTriIter));
+    }
+    return anArray;
+  }
   if (myTriangles.IsEmpty())
   {
     return Handle(Poly_HArray1OfTriangle)();
@@ -268,6 +305,19 @@ Handle(TColgp_HArray1OfPnt2d) Poly_Triangulation::MapUVNodeArray() const
 //=======================================================================
 Handle(TShort_HArray1OfShortReal) Poly_Triangulation::MapNormalArray() const
 {
+  if (!myPackedNormals.IsEmpty())
+  {
+    // deep copy
+    Handle(TShort_HArray1OfShortReal) anArray = new TShort_HArray1OfShortReal (1, 3 * NbNodes());
+    for (Standard_Integer aNodeIter = 0; aNodeIter < NbNodes(); ++aNodeIter)
+    {
+      const gp_Vec3f aNorm = decodeNormal (myPackedNormals.Value (aNodeIter));
+      anArray->SetValue (aNodeIter * 3 + 1, aNorm.x());
+      anArray->SetValue (aNodeIter * 3 + 2, aNorm.y());
+      anArray->SetValue (aNodeIter * 3 + 3, aNorm.z());
+    }
+    return anArray;
+  }
   if (myNormals.IsEmpty())
   {
     return Handle(TShort_HArray1OfShortReal)();
@@ -328,6 +378,15 @@ void Poly_Triangulation::ResizeNodes (Standard_Integer theNbNodes,
   {
     myNormals.Resize (0, theNbNodes - 1, theToCopyOld);
   }
+  if (!myPackedNormals.IsEmpty())
+  {
+    myPackedNormals.Resize (0, theNbNodes - 1, theToCopyOld);
+  }
+  if (!myPackedTriangles.IsEmpty()
+    && theNbNodes > THE_MAX_PACKED_NODES)
+  {
+    unpackTriangles();
+  }
 }
 
 // =======================================================================
@@ -337,6 +396,13 @@ void Poly_Triangulation::ResizeNodes (Standard_Integer theNbNodes,
 void Poly_Triangulation::ResizeTriangles (Standard_Integer theNbTriangles,
                                           Standard_Boolean theToCopyOld)
 {
+  if (!myPackedTriangles.IsEmpty()
+   || (myIsCompact && myTriangles.IsEmpty() && NbNodes() <= THE_MAX_PACKED_NODES))
+  {
+    myPackedTriangles.Resize (1, theNbTriangles, theToCopyOld);
+    resetUnpackedTriangles();
+    return;
+  }
   myTriangles.Resize (1, theNbTriangles, theToCopyOld);
 }
 
@@ -358,6 +424,14 @@ void Poly_Triangulation::AddUVNodes()
 // =======================================================================
 void Poly_Triangulation::AddNormals()
 {
+  if (myIsCompact && myNormals.IsEmpty())
+  {
+    if (myPackedNormals.IsEmpty() || myPackedNormals.Size() != myNodes.Size())
+    {
+      myPackedNormals.Resize (0, myNodes.Size() - 1, false);
+    }
+    return;
+  }
   if (myNormals.IsEmpty() || myNormals.Size() != myNodes.Size())
   {
     myNormals.Resize (0, myNodes.Size() - 1, false);
@@ -380,8 +454,14 @@ void Poly_Triangulation::DumpJson (Standard_OStream& theOStream, Standard_Intege
     OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myUVNodes.Size())
   if (!myNormals.IsEmpty())
     OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myNormals.Size())
+  if (!myPackedNormals.IsEmpty())
+    OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myPackedNormals.Size())
   OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myTriangles.Size())
+  if (!myPackedTriangles.IsEmpty())
+    OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myPackedTriangles.Size())
   OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myPurpose)
+  if (myIsCompact)
+    OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myIsCompact)
 
 }
 
@@ -482,6 +562,14 @@ Bnd_Box Poly_Triangulation::computeBoundingBox (const gp_Trsf& theTrsf) const
 //=======================================================================
 void Poly_Triangulation::ComputeNormals()
 {
+  if (!myPackedNormals.IsEmpty()
+   || !myPackedTriangles.IsEmpty()
+   || (myIsCompact && myNormals.IsEmpty()))
+  {
+    computePackedNormals();
+    return;
+  }
+
   // zero values
   AddNormals();
   myNormals.Init (gp_Vec3f (0.0f));
@@ -513,6 +601,164 @@ void Poly_Triangulation::ComputeNormals()
   }
 }
 
+//=======================================================================
+//function : computePackedNormals
+//purpose  :
+//=======================================================================
+void Poly_Triangulation::computePackedNormals()
+{
+  NCollection_Array1<gp_Vec3f> aNormals (0, NbNodes() - 1);
+  aNormals.Init (gp_Vec3f (0.0f));
+
+  Standard_Integer anElem[3] = {0, 0, 0};
+  for (Standard_Integer aTriIter = 1; aTriIter <= NbTriangles(); ++aTriIter)
+  {
+    Triangle (aTriIter).Get (anElem[0], anElem[1], anElem[2]);
+    const gp_XYZ aNode0 = myNodes.Value (anElem[0] - 1).XYZ();
+    const gp_XYZ aTriNorm = (myNodes.Value (anElem[1] - 1).XYZ() - aNode0)
+                          ^ (myNodes.Value (anElem[2] - 1).XYZ() - aNode0);
+    const gp_Vec3f aNorm3f = gp_Vec3f (float(aTriNorm.X()), float(aTriNorm.Y()), float(aTriNorm.Z()));
+    for (Standard_Integer aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+    {
+      aNormals.ChangeValue (anElem[aNodeIter] - 1) += aNorm3f;
+    }
+  }
+
+  AddNormals();
+  for (Standard_Integer aNodeIter = 0; aNodeIter < NbNodes(); ++aNodeIter)
+  {
+    const gp_Vec3f& aNorm3f = aNormals.Value (aNodeIter);
+    const float aMod = aNorm3f.Modulus();
+    SetNormal (aNodeIter + 1, aMod == 0.0f ? gp_Vec3f (0.0f, 0.0f, 1.0f) : (aNorm3f / aMod));
+  }
+}
+
+//=======================================================================
+//function : SetCompact
+//purpose  :
+//=======================================================================
+void Poly_Triangulation::SetCompact (bool theToCompact)
+{
+  if (theToCompact == myIsCompact
+   || myNodes.IsEmpty())
+  {
+    return;
+  }
+
+  const Standard_Integer aNbNodes = NbNodes();
+  if (!theToCompact)
+  {
+    Poly_ArrayOfNodes aNodes (aNbNodes);
+    aNodes.Assign (myNodes);
+    myNodes.Move (aNodes);
+    if (!myPackedNormals.IsEmpty())
+    {
+      unpackNormals();
+    }
+    if (!myPackedTriangles.IsEmpty())
+    {
+      unpackTriangles();
+    }
+    myIsCompact = false;
+    return;
+  }
+
+  // the same step is used along all axes, so that quantized nodes are restored by uniform scaling
+  const Bnd_Box aBox = computeBoundingBox (gp_Trsf());
+  const gp_XYZ aMin  = aBox.CornerMin().XYZ();
+  const gp_XYZ aSize = aBox.CornerMax().XYZ() - aMin;
+  const Standard_Real aMaxSize = Max (aSize.X(), Max (aSize.Y(), aSize.Z()));
+  Poly_ArrayOfNodes aNodes;
+  aNodes.SetQuantized (aMin, aMin + gp_XYZ (aMaxSize, aMaxSize, aMaxSize));
+  aNodes.Resize (aNbNodes, false);
+  aNodes.Assign (myNodes);
+  myNodes.Move (aNodes);
+
+  if (!myNormals.IsEmpty())
+  {
+    myPackedNormals.Resize (0, aNbNodes - 1, false);
+    for (Standard_Integer aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+    {
+      myPackedNormals.SetValue (aNodeIter, encodeNormal (myNormals.Value (aNodeIter)));
+    }
+    NCollection_Array1<gp_Vec3f> anEmpty;
+    myNormals.Move (anEmpty);
+  }
+
+  if (!myTriangles.IsEmpty()
+    && aNbNodes <= THE_MAX_PACKED_NODES)
+  {
+    const Standard_Integer aNbTriangles = myTriangles.Length();
+    myPackedTriangles.Resize (1, aNbTriangles, false);
+    Poly_Array1OfTriangle aTriangles, anEmpty;
+    aTriangles.Move (myTriangles);
+    myTriangles.Move (anEmpty);
+    resetUnpackedTriangles();
+    for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+    {
+      SetTriangle (aTriIter, aTriangles.Value (aTriIter));
+    }
+  }
+  myIsCompact = true;
+}
+
+//=======================================================================
+//function : unpackTriangles
+//purpose  :
+//=======================================================================
+void Poly_Triangulation::unpackTriangles()
+{
+  const Standard_Integer aNbTriangles = myPackedTriangles.Length();
+  Poly_Array1OfTriangle aTriangles (1, aNbTriangles);
+  for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+  {
+    aTriangles.SetValue (aTriIter, Triangle (aTriIter));
+  }
+
+  NCollection_Array1<PackedTriangle> anEmpty;
+  myPackedTriangles.Move (anEmpty);
+  myTriangles.Move (aTriangles);
+  resetUnpackedTriangles();
+}
+
+//=======================================================================
+//function : Triangles
+//purpose  :
+//=======================================================================
+const Poly_Array1OfTriangle& Poly_Triangulation::Triangles() const
+{
+  if (myPackedTriangles.IsEmpty())
+  {
+    return myTriangles;
+  }
+
+  // packed triangles may be read concurrently, so they are not unpacked in place
+  static Standard_Mutex THE_UNPACK_MUTEX;
+  Standard_Mutex::Sentry aLock (THE_UNPACK_MUTEX);
+  if (myUnpackedTriangles.IsNull())
+  {
+    myUnpackedTriangles = MapTriangleArray();
+  }
+  return myUnpackedTriangles->Array1();
+}
+
+//=======================================================================
+//function : unpackNormals
+//purpose  :
+//=======================================================================
+void Poly_Triangulation::unpackNormals()
+{
+  NCollection_Array1<gp_Vec3f> aNormals (0, myPackedNormals.Size() - 1);
+  for (Standard_Integer aNodeIter = 0; aNodeIter < myPackedNormals.Size(); ++aNodeIter)
+  {
+    aNormals.SetValue (aNodeIter, decodeNormal (myPackedNormals.Value (aNodeIter)));
+  }
+
+  NCollection_Array1<PackedNormal> anEmpty;
+  myPackedNormals.Move (anEmpty);
+  myNormals.Move (aNormals);
+}
+
 //=======================================================================
 //function : LoadDeferredData
 //purpose  :
@@ -22,6 +22,7 @@
 #include <Poly_ArrayOfNodes.hxx>
 #include <Poly_ArrayOfUVNodes.hxx>
 #include <Poly_MeshPurpose.hxx>
+#include <NCollection_Vec2.hxx>
 #include <TColgp_HArray1OfPnt.hxx>
 #include <TColgp_HArray1OfPnt2d.hxx>
 #include <TShort_HArray1OfShortReal.hxx>
@@ -48,6 +49,8 @@ DEFINE_STANDARD_HANDLE(Poly_Triangulation, Standard_Transient)
 //! - An optional table of 3D vectors, parallel to the table of 3D nodes, defining normals to the surface at specified 3D point.
 //! - An optional deflection, which maximizes the distance from a point on the surface to the corresponding point on its approximate triangulation.
 //!
+//! The data can be stored in compact form to reduce memory consumption (see SetCompact()).
+//!
 //! In many cases, algorithms do not need to work with the exact representation of a surface.
 //! A triangular representation induces simpler and more robust adjusting, faster performances, and the results are as good.
 class Poly_Triangulation : public Standard_Transient
@@ -111,19 +114,19 @@ public:
   Standard_EXPORT virtual void Clear();
 
   //! Returns TRUE if triangulation has some geometry.
-  virtual Standard_Boolean HasGeometry() const { return !myNodes.IsEmpty() && !myTriangles.IsEmpty(); }
+  virtual Standard_Boolean HasGeometry() const { return !myNodes.IsEmpty() && NbTriangles() > 0; }
 
   //! Returns the number of nodes for this triangulation.
   Standard_Integer NbNodes() const { return myNodes.Length(); }
 
   //! Returns the number of triangles for this triangulation.
-  Standard_Integer NbTriangles() const { return myTriangles.Length(); }
+  Standard_Integer NbTriangles() const { return myTriangles.Length() + myPackedTriangles.Length(); }
 
   //! Returns Standard_True if 2D nodes are associated with 3D nodes for this triangulation.
   Standard_Boolean HasUVNodes() const { return !myUVNodes.IsEmpty(); }
 
   //! Returns Standard_True if nodal normals are defined.
-  Standard_Boolean HasNormals() const { return !myNormals.IsEmpty(); }
+  Standard_Boolean HasNormals() const { return !myNormals.IsEmpty() || !myPackedNormals.IsEmpty(); }
 
   //! Returns a node at the given index.
   //! @param[in] theIndex node index within [1, NbNodes()] range
@@ -156,7 +159,15 @@ public:
   //! Returns triangle at the given index.
   //! @param[in] theIndex triangle index within [1, NbTriangles()] range
   //! @return triangle node indices, with each node defined within [1, NbNodes()] range
-  const Poly_Triangle& Triangle (Standard_Integer theIndex) const { return myTriangles.Value (theIndex); }
+  Poly_Triangle Triangle (Standard_Integer theIndex) const
+  {
+    if (!myPackedTriangles.IsEmpty())
+    {
+      const PackedTriangle& aTri = myPackedTriangles.Value (theIndex);
+      return Poly_Triangle (aTri.x() + 1, aTri.y() + 1, aTri.z() + 1);
+    }
+    return myTriangles.Value (theIndex);
+  }
 
   //! Sets a triangle.
   //! @param[in] theIndex triangle index within [1, NbTriangles()] range
@@ -164,6 +175,17 @@ public:
   void SetTriangle (Standard_Integer theIndex,
                     const Poly_Triangle& theTriangle)
   {
+    if (!myPackedTriangles.IsEmpty())
+    {
+      myPackedTriangles.ChangeValue (theIndex).SetValues ((uint16_t )(theTriangle.Value (1) - 1),
+                                                          (uint16_t )(theTriangle.Value (2) - 1),
+                                                          (uint16_t )(theTriangle.Value (3) - 1));
+      if (!myUnpackedTriangles.IsNull())
+      {
+        myUnpackedTriangles->SetValue (theIndex, theTriangle);
+      }
+      return;
+    }
     myTriangles.SetValue (theIndex, theTriangle);
   }
 
@@ -172,7 +194,8 @@ public:
   //! @return normalized 3D vector defining a surface normal
   gp_Dir Normal (Standard_Integer theIndex) const
   {
-    const gp_Vec3f& aNorm = myNormals.Value (theIndex - 1);
+    gp_Vec3f aNorm;
+    Normal (theIndex, aNorm);
     return gp_Dir (aNorm.x(), aNorm.y(), aNorm.z());
   }
 
@@ -182,6 +205,11 @@ public:
   void Normal (Standard_Integer theIndex,
                gp_Vec3f& theVec3) const
   {
+    if (!myPackedNormals.IsEmpty())
+    {
+      theVec3 = decodeNormal (myPackedNormals.Value (theIndex - 1));
+      return;
+    }
     theVec3 = myNormals.Value (theIndex - 1);
   }
 
@@ -191,6 +219,11 @@ public:
   void SetNormal (const Standard_Integer theIndex,
                   const gp_Vec3f& theNormal)
   {
+    if (!myPackedNormals.IsEmpty())
+    {
+      myPackedNormals.SetValue (theIndex - 1, encodeNormal (theNormal));
+      return;
+    }
     myNormals.SetValue (theIndex - 1, theNormal);
   }
 
@@ -256,6 +289,23 @@ public:
   //! Raises exception if data was already allocated.
   Standard_EXPORT void SetDoublePrecision (bool theIsDouble);
 
+  //! Returns TRUE if triangulation data is stored in compact form; FALSE by default.
+  bool IsCompact() const { return myIsCompact; }
+
+  //! Converts triangulation data into compact form or back into full double precision.
+  //! Compact triangulation keeps:
+  //! - 3D nodes quantized to 16-bit integers within the cube enclosing the bounding box of nodes
+  //!   (see Poly_ArrayOfNodes::SetQuantized()), so that the quantization step is the same along all axes;
+  //! - normals encoded by two 16-bit integers (octahedral encoding);
+  //! - triangles by 16-bit node indices when the number of nodes does not exceed 65536.
+  //! This takes about 2.5 times less memory than double precision, while the data are accessed
+  //! by the same methods Node(), Normal(), Triangle() and their setters.
+  //! The conversion is lossy: nodes are moved by up to 1/131070 of the largest dimension of the box along each axis,
+  //! and normals are deviated by less than 1e-4 radians.
+  //! The nodes set after conversion are clamped to the cube enclosing the nodes given before conversion.
+  //! Does nothing for triangulation without nodes.
+  Standard_EXPORT void SetCompact (bool theToCompact);
+
   //! Method resizing internal arrays of nodes (synchronously for all attributes).
   //! @param theNbNodes   [in] new number of nodes
   //! @param theToCopyOld [in] copy old nodes into the new array
@@ -309,10 +359,19 @@ public:
 
   //! Returns an internal array of triangles.
   //! Triangle()/SetTriangle() should be used instead in portable code.
-  Poly_Array1OfTriangle& InternalTriangles() { return myTriangles; }
+  //! Triangles of compact triangulation are converted into 32-bit node indices.
+  Poly_Array1OfTriangle& InternalTriangles()
+  {
+    if (!myPackedTriangles.IsEmpty())
+    {
+      unpackTriangles();
+    }
+    return myTriangles;
+  }
 
   //! Returns an internal array of nodes.
   //! Node()/SetNode() should be used instead in portable code.
+  //! Nodes of compact triangulation are quantized (see Poly_ArrayOfNodes::IsQuantized()).
   Poly_ArrayOfNodes& InternalNodes() { return myNodes; }
 
   //! Returns an internal array of UV nodes.
@@ -321,19 +380,29 @@ public:
 
   //! Return an internal array of normals.
   //! Normal()/SetNormal() should be used instead in portable code.
-  NCollection_Array1<gp_Vec3f>& InternalNormals() { return myNormals; }
+  //! Normals of compact triangulation are decoded into single precision vectors.
+  NCollection_Array1<gp_Vec3f>& InternalNormals()
+  {
+    if (!myPackedNormals.IsEmpty())
+    {
+      unpackNormals();
+    }
+    return myNormals;
+  }
 
   Standard_DEPRECATED("Deprecated method, SetNormal() should be used instead")
   Standard_EXPORT void SetNormals (const Handle(TShort_HArray1OfShortReal)& theNormals);
 
+  //! Triangles of compact triangulation are not modified: they are converted once
+  //! into a separate array, kept until triangles are resized or the storage is changed.
   Standard_DEPRECATED("Deprecated method, Triangle() should be used instead")
-  const Poly_Array1OfTriangle& Triangles() const { return myTriangles; }
+  Standard_EXPORT const Poly_Array1OfTriangle& Triangles() const;
 
   Standard_DEPRECATED("Deprecated method, SetTriangle() should be used instead")
-  Poly_Array1OfTriangle& ChangeTriangles() { return myTriangles; }
+  Poly_Array1OfTriangle& ChangeTriangles() { return InternalTriangles(); }
 
   Standard_DEPRECATED("Deprecated method, SetTriangle() should be used instead")
-  Poly_Triangle& ChangeTriangle (const Standard_Integer theIndex) { return myTriangles.ChangeValue (theIndex); }
+  Poly_Triangle& ChangeTriangle (const Standard_Integer theIndex) { return InternalTriangles().ChangeValue (theIndex); }
 
 public: //! @name late-load deferred data interface
 
@@ -362,6 +431,11 @@ public: //! @name late-load deferred data interface
   //! Releases triangulation data if it has connected deferred storage.
   Standard_EXPORT virtual Standard_Boolean UnloadDeferredData();
 
+  //! Loads triangulation data from deferred storage on access to the triangulation of the face
+  //! (see BRep_Tool::Triangulation()), if the storage allows such loading.
+  //! Default implementation does nothing, so that the data should be loaded explicitly by LoadDeferredData().
+  virtual void LoadOnAccess() {}
+
 protected:
 
   //! Creates new triangulation object (can be inheritor of Poly_Triangulation).
@@ -379,6 +453,61 @@ protected:
     return false;
   }
 
+protected:
+
+  //! Triangle defined by 16-bit node indices starting from 0.
+  typedef NCollection_Vec3<uint16_t> PackedTriangle;
+
+  //! Normal encoded by two 16-bit integers.
+  typedef NCollection_Vec2<int16_t> PackedNormal;
+
+  //! Encodes unit vector by octahedral mapping: the vector is projected onto octahedron |x| + |y| + |z| = 1,
+  //! which lower half is unfolded onto the square of upper one.
+  static PackedNormal encodeNormal (const gp_Vec3f& theNorm)
+  {
+    const float aSum = std::abs (theNorm.x()) + std::abs (theNorm.y()) + std::abs (theNorm.z());
+    if (aSum <= 0.0f)
+    {
+      return PackedNormal (0, 0);
+    }
+
+    float aU = theNorm.x() / aSum;
+    float aV = theNorm.y() / aSum;
+    if (theNorm.z() < 0.0f)
+    {
+      const float anOldU = aU;
+      aU = (1.0f - std::abs (aV))     * (aU >= 0.0f ? 1.0f : -1.0f);
+      aV = (1.0f - std::abs (anOldU)) * (aV >= 0.0f ? 1.0f : -1.0f);
+    }
+    return PackedNormal ((int16_t )(aU * 32767.0f + (aU >= 0.0f ? 0.5f : -0.5f)),
+                         (int16_t )(aV * 32767.0f + (aV >= 0.0f ? 0.5f : -0.5f)));
+  }
+
+  //! Decodes unit vector encoded by encodeNormal().
+  static gp_Vec3f decodeNormal (const PackedNormal& thePacked)
+  {
+    gp_Vec3f aNorm (float(thePacked.x()) / 32767.0f, float(thePacked.y()) / 32767.0f, 0.0f);
+    aNorm.z() = 1.0f - std::abs (aNorm.x()) - std::abs (aNorm.y());
+    if (aNorm.z() < 0.0f)
+    {
+      aNorm.x() += aNorm.x() >= 0.0f ? aNorm.z() : -aNorm.z();
+      aNorm.y() += aNorm.y() >= 0.0f ? aNorm.z() : -aNorm.z();
+    }
+    return aNorm.Normalized();
+  }
+
+  //! Converts packed triangles into 32-bit node indices.
+  Standard_EXPORT void unpackTriangles();
+
+  //! Releases packed triangles converted by Triangles() const.
+  void resetUnpackedTriangles() { myUnpackedTriangles.Nullify(); }
+
+  //! Converts packed normals into single precision vectors.
+  Standard_EXPORT void unpackNormals();
+
+  //! Computes smooth normals of compact triangulation.
+  Standard_EXPORT void computePackedNormals();
+
 protected:
 
   //! Clears cached min - max range saved previously.
@@ -398,6 +527,11 @@ protected:
   NCollection_Array1<gp_Vec3f> myNormals;
   Poly_MeshPurpose             myPurpose;
 
+  NCollection_Array1<PackedTriangle> myPackedTriangles; //!< triangles of compact triangulation with 16-bit indices
+  NCollection_Array1<PackedNormal>   myPackedNormals;   //!< normals of compact triangulation
+  bool                               myIsCompact;       //!< flag indicating compact storage of data
+  mutable Handle(Poly_HArray1OfTriangle) myUnpackedTriangles; //!< packed triangles converted by Triangles() const
+
   Handle(Poly_TriangulationParameters) myParams;
 };
 
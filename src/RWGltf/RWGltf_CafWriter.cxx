@@ -14,11 +14,14 @@
 #include <RWGltf_CafWriter.hxx>
 
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
 #include <gp_Quaternion.hxx>
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Sequence.hxx>
+#include <NCollection_Vector.hxx>
 #include <OSD_FileSystem.hxx>
 #include <OSD_File.hxx>
 #include <OSD_Parallel.hxx>
@@ -36,6 +39,7 @@
 #include <TDataStd_Name.hxx>
 #include <TDF_Tool.hxx>
 #include <TDocStd_Document.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
@@ -78,6 +82,39 @@ namespace
     theStream.write ((const char* )aVec2.GetData(), sizeof(aVec2));
   }
 
+  //! Write three 16-bit integer values padded by the fourth one
+  //! to keep 4-byte alignment of vertex attributes required by KHR_mesh_quantization.
+  template<typename Type_t>
+  static void writeVec3Padded (std::ostream& theStream,
+                               const NCollection_Vec3<Type_t>& theVec3)
+  {
+    const NCollection_Vec4<Type_t> aVec4 (theVec3);
+    theStream.write ((const char* )aVec4.GetData(), sizeof(aVec4));
+  }
+
+  //! Round position component given in steps of quantization into 16-bit unsigned integer.
+  static uint16_t quantizePosition (const Standard_Real theValue)
+  {
+    return (uint16_t )(Max (0.0, Min (65535.0, theValue)) + 0.5);
+  }
+
+  //! Quantize normal vector component into normalized 16-bit signed integer.
+  static int16_t quantizeNormal (const float theValue)
+  {
+    return (int16_t )std::lround (Max (-1.0f, Min (1.0f, theValue)) * 32767.0f);
+  }
+
+  //! Return the root of the group of primitives sharing the range of quantized positions.
+  static Standard_Integer findQuantGroup (const NCollection_Vector<Standard_Integer>& theParents,
+                                          Standard_Integer theGroup)
+  {
+    while (theParents.Value (theGroup) != theGroup)
+    {
+      theGroup = theParents.Value (theGroup);
+    }
+    return theGroup;
+  }
+
   //! Write triangle indices.
   static void writeTriangle32 (std::ostream& theStream,
                                const Graphic3d_Vec3i& theTri)
@@ -253,7 +290,8 @@ RWGltf_CafWriter::RWGltf_CafWriter (const TCollection_AsciiString& theFile,
   myToMergeFaces (false),
   myToSplitIndices16 (false),
   myBinDataLen64  (0),
-  myToParallel (false)
+  myToParallel (false),
+  myToQuantizeMesh (false)
 {
   myCSTrsf.SetOutputLengthUnit (1.0); // meters
   myCSTrsf.SetOutputCoordinateSystem (RWMesh_CoordinateSystem_glTF);
@@ -295,6 +333,188 @@ Standard_Boolean RWGltf_CafWriter::toSkipFaceMesh (const RWMesh_FaceIterator& th
   return theFaceIter.IsEmptyMesh();
 }
 
+//================================================================
+// Function : computeQuantizationRange
+// Purpose  :
+//================================================================
+void RWGltf_CafWriter::computeQuantizationRange (const Handle(TDocStd_Document)& theDocument,
+                                                 const TDF_LabelSequence& theRootLabels,
+                                                 const TColStd_MapOfAsciiString* theLabelFilter)
+{
+  myQuantPrimRanges.Clear();
+  myQuantNodeRanges.Clear();
+
+  // dequantization is put into transformation of the node referring the mesh, so that all primitives of the mesh
+  // should share the same range; the primitives written once and referred by several meshes join these meshes
+  NCollection_DataMap<TopoDS_Shape, Standard_Integer, TopTools_ShapeMapHasher> aPrimGroups;
+  NCollection_Vector<Standard_Integer>   aGroupParents;
+  NCollection_Vector<Graphic3d_BndBox3d> aGroupBoxes;
+  NCollection_Vector<TopoDS_Shape>       aGroupPrims; // the only primitive of the group, NULL if there are several ones
+  NCollection_DataMap<TCollection_AsciiString, Standard_Integer> aNodeGroups;
+  NCollection_Sequence<Handle(RWGltf_GltfFaceList)> aNodeFaces;
+  for (XCAFPrs_DocumentExplorer aDocExplorer (theDocument, theRootLabels, XCAFPrs_DocumentExplorerFlags_OnlyLeafNodes);
+       aDocExplorer.More(); aDocExplorer.Next())
+  {
+    const XCAFPrs_DocumentNode& aDocNode = aDocExplorer.Current();
+    if (theLabelFilter != NULL
+    && !theLabelFilter->Contains (aDocNode.Id))
+    {
+      continue;
+    }
+
+    // faces of the mesh of the node, as written by writeMeshes()
+    aNodeFaces.Clear();
+    if (myToMergeFaces)
+    {
+      TopoDS_Shape aShape;
+      if (!XCAFDoc_ShapeTool::GetShape (aDocNode.RefLabel, aShape)
+       || aShape.IsNull())
+      {
+        continue;
+      }
+
+      aShape.Location (TopLoc_Location());
+      if (const Handle(RWGltf_GltfFaceList)* aGltfFaceList = myBinDataMap.Seek (RWGltf_StyledShape (aShape, aDocNode.Style)))
+      {
+        aNodeFaces.Append (*aGltfFaceList);
+      }
+    }
+    else
+    {
+      for (RWMesh_FaceIterator aFaceIter (aDocNode.RefLabel, TopLoc_Location(), true, aDocNode.Style); aFaceIter.More(); aFaceIter.Next())
+      {
+        if (toSkipFaceMesh (aFaceIter))
+        {
+          continue;
+        }
+        if (const Handle(RWGltf_GltfFaceList)* aGltfFaceList = myBinDataMap.Seek (RWGltf_StyledShape (aFaceIter.Face(), aFaceIter.FaceStyle())))
+        {
+          aNodeFaces.Append (*aGltfFaceList);
+        }
+      }
+    }
+
+    Standard_Integer aNodeGroup = -1;
+    for (NCollection_Sequence<Handle(RWGltf_GltfFaceList)>::Iterator aFaceListIter (aNodeFaces); aFaceListIter.More(); aFaceListIter.Next())
+    {
+      for (RWGltf_GltfFaceList::Iterator aGltfFaceIter (*aFaceListIter.Value()); aGltfFaceIter.More(); aGltfFaceIter.Next())
+      {
+        const Handle(RWGltf_GltfFace)& aGltfFace = aGltfFaceIter.Value();
+        Standard_Integer aGroup = -1;
+        if (const Standard_Integer* aPrimGroup = aPrimGroups.Seek (aGltfFace->Shape))
+        {
+          aGroup = findQuantGroup (aGroupParents, *aPrimGroup);
+        }
+        else
+        {
+          aGroup = aGroupParents.Length();
+          aGroupParents.Append (aGroup);
+          aGroupPrims.Append (aGltfFace->Shape);
+          Graphic3d_BndBox3d& aBox = aGroupBoxes.Appended();
+          for (RWMesh_FaceIterator aFaceIter (aGltfFace->Shape, aGltfFace->Style); aFaceIter.More(); aFaceIter.Next())
+          {
+            const Standard_Integer aNodeUpper = aFaceIter.NodeUpper();
+            for (Standard_Integer aNodeIter = aFaceIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
+            {
+              gp_XYZ aNode = aFaceIter.NodeTransformed (aNodeIter).XYZ();
+              myCSTrsf.TransformPosition (aNode);
+              aBox.Add (Graphic3d_Vec3d (aNode.X(), aNode.Y(), aNode.Z()));
+            }
+          }
+          aPrimGroups.Bind (aGltfFace->Shape, aGroup);
+        }
+
+        if (aNodeGroup == -1)
+        {
+          aNodeGroup = aGroup;
+        }
+        else if (aGroup != aNodeGroup)
+        {
+          aGroupParents.ChangeValue (aGroup) = aNodeGroup;
+          aGroupBoxes.ChangeValue (aNodeGroup).Combine (aGroupBoxes.Value (aGroup));
+          aGroupPrims.ChangeValue (aNodeGroup).Nullify();
+        }
+      }
+    }
+    if (aNodeGroup != -1)
+    {
+      aNodeGroups.Bind (aDocNode.Id, aNodeGroup);
+    }
+  }
+
+  // the same step is used along all axes to keep dequantization uniform scaling,
+  // so that normals are not distorted by transformation of the node
+  NCollection_Vector<gp_Trsf> aGroupRanges (Max (aGroupParents.Length(), 1));
+  for (Standard_Integer aGroupIter = 0; aGroupIter < aGroupParents.Length(); ++aGroupIter)
+  {
+    gp_Trsf& aRange = aGroupRanges.Appended();
+    if (aGroupParents.Value (aGroupIter) != aGroupIter)
+    {
+      continue;
+    }
+
+    // the range of the compact triangulation of the only face of the mesh is reused, so that its nodes are not quantized again
+    const TopoDS_Shape& aPrim = aGroupPrims.Value (aGroupIter);
+    if (!aPrim.IsNull()
+      && aPrim.ShapeType() == TopAbs_FACE)
+    {
+      TopLoc_Location aLoc;
+      const Handle(Poly_Triangulation)& aPolyTri = BRep_Tool::Triangulation (TopoDS::Face (aPrim), aLoc);
+      if (!aPolyTri.IsNull()
+        && aPolyTri->IsCompact()
+        && aPolyTri->InternalNodes().IsQuantized())
+      {
+        // compact triangulation is quantized with the same step along all axes (up to rounding of the range,
+        // which keeps the same integers after quantization by the largest step), and with zero step along the axis of empty range
+        const gp_XYZ& aStep = aPolyTri->InternalNodes().QuantizationStep();
+        const Standard_Real aMaxStep = Max (aStep.X(), Max (aStep.Y(), aStep.Z()));
+        bool isUniform = aMaxStep > 0.0;
+        for (Standard_Integer aCoordIter = 1; aCoordIter <= 3; ++aCoordIter)
+        {
+          if (aStep.Coord (aCoordIter) > 0.0
+           && aMaxStep - aStep.Coord (aCoordIter) > aMaxStep * 1.0e-6)
+          {
+            isUniform = false;
+          }
+        }
+        if (isUniform)
+        {
+          gp_Trsf anOriginTrsf, aStepTrsf;
+          anOriginTrsf.SetTranslation (gp_Vec (aPolyTri->InternalNodes().QuantizationOrigin()));
+          aStepTrsf.SetScaleFactor (aMaxStep);
+          const gp_Trsf aTrsf = myCSTrsf.PositionTransformation() * aLoc.Transformation() * anOriginTrsf * aStepTrsf;
+          if (!aTrsf.IsNegative())
+          {
+            aRange = aTrsf;
+            continue;
+          }
+        }
+      }
+    }
+
+    const Graphic3d_BndBox3d& aBox = aGroupBoxes.Value (aGroupIter);
+    if (aBox.IsValid())
+    {
+      const Graphic3d_Vec3d aSize = aBox.Size();
+      const Standard_Real aMaxSize = Max (aSize.x(), Max (aSize.y(), aSize.z()));
+      if (aMaxSize > gp::Resolution())
+      {
+        aRange.SetScaleFactor (aMaxSize / 65535.0);
+      }
+      aRange.SetTranslationPart (gp_Vec (aBox.CornerMin().x(), aBox.CornerMin().y(), aBox.CornerMin().z()));
+    }
+  }
+
+  for (NCollection_DataMap<TopoDS_Shape, Standard_Integer, TopTools_ShapeMapHasher>::Iterator aPrimIter (aPrimGroups); aPrimIter.More(); aPrimIter.Next())
+  {
+    myQuantPrimRanges.Bind (aPrimIter.Key(), aGroupRanges.Value (findQuantGroup (aGroupParents, aPrimIter.Value())));
+  }
+  for (NCollection_DataMap<TCollection_AsciiString, Standard_Integer>::Iterator aNodeIter (aNodeGroups); aNodeIter.More(); aNodeIter.Next())
+  {
+    myQuantNodeRanges.Bind (aNodeIter.Key(), aGroupRanges.Value (findQuantGroup (aGroupParents, aNodeIter.Value())));
+  }
+}
+
 // =======================================================================
 // function : saveNodes
 // purpose  :
@@ -310,23 +530,45 @@ void RWGltf_CafWriter::saveNodes (RWGltf_GltfFace& theGltfFace,
     theGltfFace.NodePos.Id            = theAccessorNb++;
     theGltfFace.NodePos.ByteOffset    = (int64_t )theBinFile.tellp() - myBuffViewPos.ByteOffset;
     theGltfFace.NodePos.Type          = RWGltf_GltfAccessorLayout_Vec3;
-    theGltfFace.NodePos.ComponentType = RWGltf_GltfAccessorCompType_Float32;
+    theGltfFace.NodePos.ComponentType = toQuantizeMesh()
+                                      ? RWGltf_GltfAccessorCompType_UInt16
+                                      : RWGltf_GltfAccessorCompType_Float32;
   }
   else
   {
     if (theMesh.get() == nullptr)
     {
-      const int64_t aPos = theGltfFace.NodePos.ByteOffset + myBuffViewPos.ByteOffset + theGltfFace.NodePos.Count * sizeof(Graphic3d_Vec3);
+      const int64_t aPos = theGltfFace.NodePos.ByteOffset + myBuffViewPos.ByteOffset + theGltfFace.NodePos.Count * myBuffViewPos.ByteStride;
       Standard_ASSERT_RAISE(aPos == (int64_t)theBinFile.tellp(), "wrong offset");
     }
   }
   theGltfFace.NodePos.Count += theFaceIter.NbNodes();
 
+  // positions are quantized within the range of the mesh
+  gp_Trsf aQuantTrsf;
+  if (toQuantizeMesh())
+  {
+    myQuantPrimRanges.Find (theGltfFace.Shape, aQuantTrsf);
+    aQuantTrsf.Invert();
+  }
+
   const Standard_Integer aNodeUpper = theFaceIter.NodeUpper();
   for (Standard_Integer aNodeIter = theFaceIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
   {
     gp_XYZ aNode = theFaceIter.NodeTransformed (aNodeIter).XYZ();
     myCSTrsf.TransformPosition (aNode);
+    if (toQuantizeMesh())
+    {
+      gp_XYZ aValue = aNode;
+      aQuantTrsf.Transforms (aValue);
+      const NCollection_Vec3<uint16_t> aQuantNode (quantizePosition (aValue.X()),
+                                                   quantizePosition (aValue.Y()),
+                                                   quantizePosition (aValue.Z()));
+      theGltfFace.NodePos.BndBox.Add (Graphic3d_Vec3d (aQuantNode.x(), aQuantNode.y(), aQuantNode.z()));
+      writeVec3Padded (theBinFile, aQuantNode);
+      continue;
+    }
+
     theGltfFace.NodePos.BndBox.Add (Graphic3d_Vec3d(aNode.X(), aNode.Y(), aNode.Z()));
     if (theMesh.get() != nullptr)
     {
@@ -359,25 +601,51 @@ void RWGltf_CafWriter::saveNormals (RWGltf_GltfFace& theGltfFace,
     theGltfFace.NodeNorm.Id            = theAccessorNb++;
     theGltfFace.NodeNorm.ByteOffset    = (int64_t )theBinFile.tellp() - myBuffViewNorm.ByteOffset;
     theGltfFace.NodeNorm.Type          = RWGltf_GltfAccessorLayout_Vec3;
-    theGltfFace.NodeNorm.ComponentType = RWGltf_GltfAccessorCompType_Float32;
+    theGltfFace.NodeNorm.ComponentType = toQuantizeMesh()
+                                       ? RWGltf_GltfAccessorCompType_Int16
+                                       : RWGltf_GltfAccessorCompType_Float32;
+    theGltfFace.NodeNorm.IsNormalized  = toQuantizeMesh();
   }
   else
   {
     if (theMesh.get() == nullptr)
     {
-      const int64_t aPos = theGltfFace.NodeNorm.ByteOffset + myBuffViewNorm.ByteOffset + theGltfFace.NodeNorm.Count * sizeof(Graphic3d_Vec3);
+      const int64_t aPos = theGltfFace.NodeNorm.ByteOffset + myBuffViewNorm.ByteOffset + theGltfFace.NodeNorm.Count * myBuffViewNorm.ByteStride;
       Standard_ASSERT_RAISE(aPos == (int64_t)theBinFile.tellp(), "wrong offset");
     }
   }
   theGltfFace.NodeNorm.Count += theFaceIter.NbNodes();
 
+  // normals are transformed into quantized space of positions,
+  // which may be rotated relative to the space of the mesh
+  gp_Trsf aQuantTrsf;
+  if (toQuantizeMesh())
+  {
+    myQuantPrimRanges.Find (theGltfFace.Shape, aQuantTrsf);
+    aQuantTrsf.Invert();
+  }
+
   const Standard_Integer aNodeUpper = theFaceIter.NodeUpper();
   for (Standard_Integer aNodeIter = theFaceIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
   {
     const gp_Dir aNormal = theFaceIter.NormalTransformed (aNodeIter);
     Graphic3d_Vec3 aVecNormal ((float )aNormal.X(), (float )aNormal.Y(), (float )aNormal.Z());
     myCSTrsf.TransformNormal (aVecNormal);
-    if (theMesh.get() != nullptr)
+    if (toQuantizeMesh())
+    {
+      gp_Vec aQuantNormal (aVecNormal.x(), aVecNormal.y(), aVecNormal.z());
+      aQuantNormal.Transform (aQuantTrsf);
+      const Standard_Real aModulus = aQuantNormal.Magnitude();
+      if (aModulus > gp::Resolution())
+      {
+        aQuantNormal /= aModulus;
+        aVecNormal.SetValues ((float )aQuantNormal.X(), (float )aQuantNormal.Y(), (float )aQuantNormal.Z());
+      }
+      writeVec3Padded (theBinFile, NCollection_Vec3<int16_t> (quantizeNormal (aVecNormal.x()),
+                                                              quantizeNormal (aVecNormal.y()),
+                                                              quantizeNormal (aVecNormal.z())));
+    }
+    else if (theMesh.get() != nullptr)
     {
       theMesh->NormalsVec.push_back(aVecNormal);
     }
@@ -576,17 +844,23 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
     return false;
   }
 #endif
+  if (myToQuantizeMesh
+   && myDracoParameters.DracoCompression)
+  {
+    Message::SendWarning ("Warning: mesh quantization is ignored in combination with Draco compression.");
+  }
 
+  // quantized attributes are padded to 4-byte alignment
   myBuffViewPos.Id               = RWGltf_GltfAccessor::INVALID_ID;
   myBuffViewPos.ByteOffset       = 0;
   myBuffViewPos.ByteLength       = 0;
-  myBuffViewPos.ByteStride       = 12;
+  myBuffViewPos.ByteStride       = toQuantizeMesh() ? 8 : 12;
   myBuffViewPos.Target           = RWGltf_GltfBufferViewTarget_ARRAY_BUFFER;
 
   myBuffViewNorm.Id              = RWGltf_GltfAccessor::INVALID_ID;
   myBuffViewNorm.ByteOffset      = 0;
   myBuffViewNorm.ByteLength      = 0;
-  myBuffViewNorm.ByteStride      = 12;
+  myBuffViewNorm.ByteStride      = toQuantizeMesh() ? 8 : 12;
   myBuffViewNorm.Target          = RWGltf_GltfBufferViewTarget_ARRAY_BUFFER;
 
   myBuffViewTextCoord.Id         = RWGltf_GltfAccessor::INVALID_ID;
@@ -716,6 +990,11 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
     }
   }
 
+  if (toQuantizeMesh())
+  {
+    computeQuantizationRange (theDocument, theRootLabels, theLabelFilter);
+  }
+
   std::vector<std::shared_ptr<RWGltf_CafWriter::Mesh>> aMeshes;
   Standard_Integer aNbAccessors = 0;
   NCollection_Map<Handle(RWGltf_GltfFaceList)> aWrittenFaces;
@@ -1317,7 +1596,25 @@ void RWGltf_CafWriter::writePositions (const RWGltf_GltfFace& theGltfFace)
   myWriter->Key    ("count");
   myWriter->Int64  (theGltfFace.NodePos.Count);
 
-  if (theGltfFace.NodePos.BndBox.IsValid())
+  if (theGltfFace.NodePos.BndBox.IsValid()
+   && theGltfFace.NodePos.ComponentType != RWGltf_GltfAccessorCompType_Float32)
+  {
+    // integer values should be written for quantized positions
+    myWriter->Key ("max");
+    myWriter->StartArray();
+    myWriter->Int ((int )theGltfFace.NodePos.BndBox.CornerMax().x());
+    myWriter->Int ((int )theGltfFace.NodePos.BndBox.CornerMax().y());
+    myWriter->Int ((int )theGltfFace.NodePos.BndBox.CornerMax().z());
+    myWriter->EndArray();
+
+    myWriter->Key("min");
+    myWriter->StartArray();
+    myWriter->Int ((int )theGltfFace.NodePos.BndBox.CornerMin().x());
+    myWriter->Int ((int )theGltfFace.NodePos.BndBox.CornerMin().y());
+    myWriter->Int ((int )theGltfFace.NodePos.BndBox.CornerMin().z());
+    myWriter->EndArray();
+  }
+  else if (theGltfFace.NodePos.BndBox.IsValid())
   {
     myWriter->Key ("max");
     myWriter->StartArray();
@@ -1367,6 +1664,11 @@ void RWGltf_CafWriter::writeNormals (const RWGltf_GltfFace& theGltfFace)
   myWriter->Int    (theGltfFace.NodeNorm.ComponentType);
   myWriter->Key    ("count");
   myWriter->Int64  (theGltfFace.NodeNorm.Count);
+  if (theGltfFace.NodeNorm.IsNormalized)
+  {
+    myWriter->Key  ("normalized");
+    myWriter->Bool (true);
+  }
   // min/max values are optional, and not very useful for normals - skip them
   /*{
     myWriter->Key ("max");
@@ -1670,13 +1972,23 @@ void RWGltf_CafWriter::writeExtensions()
 #ifdef HAVE_RAPIDJSON
   Standard_ProgramError_Raise_if (myWriter.get() == NULL, "Internal error: RWGltf_CafWriter::writeExtensions()");
 
+  const char* anExtension = NULL;
   if (myDracoParameters.DracoCompression)
+  {
+    anExtension = "KHR_draco_mesh_compression";
+  }
+  else if (toQuantizeMesh())
+  {
+    anExtension = "KHR_mesh_quantization";
+  }
+
+  if (anExtension != NULL)
   {
     myWriter->Key(RWGltf_GltfRootElementName(RWGltf_GltfRootElement_ExtensionsUsed));
 
     myWriter->StartArray();
     {
-      myWriter->Key("KHR_draco_mesh_compression");
+      myWriter->Key(anExtension);
     }
     myWriter->EndArray();
 
@@ -1684,7 +1996,7 @@ void RWGltf_CafWriter::writeExtensions()
 
     myWriter->StartArray();
     {
-      myWriter->Key("KHR_draco_mesh_compression");
+      myWriter->Key(anExtension);
     }
     myWriter->EndArray();
   }
@@ -2036,12 +2348,27 @@ void RWGltf_CafWriter::writeNodes (const Handle(TDocStd_Document)&  theDocument,
         myWriter->EndArray();
       }
     }
-    if (!aDocNode.LocalTrsf.IsIdentity())
+    // Mesh order of current node is equal to order of this node in scene nodes map
+    const Standard_Integer aMeshIdx = !aDocNode.IsAssembly ? theSceneNodeMap.FindIndex (aDocNode.Id) : 0;
+
+    // dequantization of positions is put into transformation of the node referring the mesh
+    const gp_Trsf* aQuantTrsf = aMeshIdx > 0 && toQuantizeMesh()
+                               ? myQuantNodeRanges.Seek (aDocNode.Id)
+                               : NULL;
+    if (!aDocNode.LocalTrsf.IsIdentity()
+     || aQuantTrsf != NULL)
     {
       gp_Trsf aTrsf = aDocNode.LocalTrsf.Transformation();
       if (aTrsf.Form() != gp_Identity)
       {
         myCSTrsf.TransformTransformation (aTrsf);
+      }
+      if (aQuantTrsf != NULL)
+      {
+        aTrsf.Multiply (*aQuantTrsf);
+      }
+      if (aTrsf.Form() != gp_Identity)
+      {
         const gp_Quaternion aQuaternion = aTrsf.GetRotation();
         const bool hasRotation = Abs (aQuaternion.X())       > gp::Resolution()
                               || Abs (aQuaternion.Y())       > gp::Resolution()
@@ -2112,15 +2439,10 @@ void RWGltf_CafWriter::writeNodes (const Handle(TDocStd_Document)&  theDocument,
         }
       }
     }
-    if (!aDocNode.IsAssembly)
+    if (aMeshIdx > 0)
     {
-      // Mesh order of current node is equal to order of this node in scene nodes map
-      Standard_Integer aMeshIdx = theSceneNodeMap.FindIndex (aDocNode.Id);
-      if (aMeshIdx > 0)
-      {
-        myWriter->Key ("mesh");
-        myWriter->Int (aMeshIdx - 1);
-      }
+      myWriter->Key ("mesh");
+      myWriter->Int (aMeshIdx - 1);
     }
     {
       const TCollection_AsciiString aNodeName = formatName (myNodeNameFormat, aDocNode.Label, aDocNode.RefLabel);
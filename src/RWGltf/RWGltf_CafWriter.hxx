@@ -26,6 +26,9 @@
 #include <RWMesh_NameFormat.hxx>
 #include <XCAFPrs_Style.hxx>
 #include <Poly_Triangle.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_XYZ.hxx>
+#include <NCollection_DataMap.hxx>
 
 #include <memory>
 
@@ -131,6 +134,20 @@ public:
   //! Setup multithreaded execution.
   void SetParallel (bool theToParallel) { myToParallel = theToParallel; }
 
+  //! Return flag to write quantized vertex data (KHR_mesh_quantization extension); FALSE by default.
+  bool ToQuantizeMesh() const { return myToQuantizeMesh; }
+
+  //! Set flag to write quantized vertex data (KHR_mesh_quantization extension).
+  //! Positions are written as 16-bit unsigned integers within the range of each mesh
+  //! with dequantization put into transformations of scene nodes referring the mesh,
+  //! and normals are written as normalized 16-bit integers.
+  //! The nodes of a mesh consisting of a single face with compact triangulation
+  //! (see Poly_Triangulation::SetCompact()) keep the quantization of the triangulation.
+  //! Reduces size of binary data at the cost of precision of positions
+  //! limited by 1/65535 of the largest dimension of the mesh.
+  //! Has no effect when Draco compression is used.
+  void SetMeshQuantization (bool theToQuantize) { myToQuantizeMesh = theToQuantize; }
+
   //! Return Draco parameters
   const RWGltf_DracoParameters& CompressionParameters() const { return myDracoParameters; }
 
@@ -193,6 +210,20 @@ protected:
 
 protected:
 
+  //! Return TRUE if vertex data should be written quantized (see SetMeshQuantization()).
+  bool toQuantizeMesh() const { return myToQuantizeMesh && !myDracoParameters.DracoCompression; }
+
+  //! Compute the ranges of quantized positions of the meshes to be written.
+  //! The primitives of one mesh, as well as the meshes sharing a primitive, use the same range,
+  //! which is the range of the compact triangulation of the face when the mesh consists of this face only.
+  //! Should be called after filling the map of faces myBinDataMap.
+  //! @param theDocument    [in] input document
+  //! @param theRootLabels  [in] list of root shapes to export
+  //! @param theLabelFilter [in] optional filter with document nodes to export
+  Standard_EXPORT virtual void computeQuantizationRange (const Handle(TDocStd_Document)& theDocument,
+                                                         const TDF_LabelSequence& theRootLabels,
+                                                         const TColStd_MapOfAsciiString* theLabelFilter);
+
   //! Return TRUE if face mesh should be skipped (e.g. because it is invalid or empty).
   Standard_EXPORT virtual Standard_Boolean toSkipFaceMesh (const RWMesh_FaceIterator& theFaceIter);
 
@@ -415,6 +446,11 @@ protected:
   std::vector<RWGltf_GltfBufferView>            myBuffViewsDraco;    //!< vector of buffers view with compression data
   Standard_Boolean                              myToParallel;        //!< flag to use multithreading; FALSE by default
   RWGltf_DracoParameters                        myDracoParameters;   //!< Draco parameters
+  Standard_Boolean                              myToQuantizeMesh;    //!< flag to write quantized vertex data
+  NCollection_DataMap<TopoDS_Shape, gp_Trsf, TopTools_ShapeMapHasher>
+                                                myQuantPrimRanges;   //!< dequantization of positions of primitives (glTF faces)
+  NCollection_DataMap<TCollection_AsciiString, gp_Trsf>
+                                                myQuantNodeRanges;   //!< dequantization of positions of meshes of scene nodes
 };
 
 #endif // _RWGltf_CafWriter_HeaderFiler
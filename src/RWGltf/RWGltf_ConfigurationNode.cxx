@@ -110,6 +110,8 @@ bool RWGltf_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRe
     theResource->BooleanVal("write.merge.faces", InternalParameters.WriteMergeFaces, aScope);
   InternalParameters.WriteSplitIndices16 = 
     theResource->BooleanVal("write.split.indices16", InternalParameters.WriteSplitIndices16, aScope);
+  InternalParameters.WriteMeshQuantization = 
+    theResource->BooleanVal("write.mesh.quantization", InternalParameters.WriteMeshQuantization, aScope);
   return true;
 }
 
@@ -286,6 +288,12 @@ TCollection_AsciiString RWGltf_ConfigurationNode::Save() const
   aResult += aScope + "write.split.indices16 :\t " + InternalParameters.WriteSplitIndices16 + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Flag to write quantized vertex data (KHR_mesh_quantization extension)\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "write.mesh.quantization :\t " + InternalParameters.WriteMeshQuantization + "\n";
+  aResult += "!\n";
+
   aResult += "!*****************************************************************************\n";
   return aResult;
 }
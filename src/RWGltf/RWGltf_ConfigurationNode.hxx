@@ -111,6 +111,7 @@ public:
     bool WriteEmbedTexturesInGlb = true; //!< Flag to write image textures into GLB file
     bool WriteMergeFaces = false; //!< Flag to merge faces within a single part
     bool WriteSplitIndices16 = false; //!< Flag to prefer keeping 16-bit indexes while merging face
+    bool WriteMeshQuantization = false; //!< Flag to write quantized vertex data (KHR_mesh_quantization)
   } InternalParameters;
 };
 
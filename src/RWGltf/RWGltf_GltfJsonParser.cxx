@@ -1660,6 +1660,7 @@ bool RWGltf_GltfJsonParser::gltfParseAccessor (const Handle(RWGltf_GltfLatePrimi
   const RWGltf_JsonValue* aByteStride     = findObjectMember (theAccessor, "byteStride"); // byteStride was part of bufferView in glTF 1.0
   const RWGltf_JsonValue* aCompType       = findObjectMember (theAccessor, "componentType");
   const RWGltf_JsonValue* aCount          = findObjectMember (theAccessor, "count");
+  const RWGltf_JsonValue* aNormalized     = findObjectMember (theAccessor, "normalized");
   if (aTypeStr == NULL
   || !aTypeStr->IsString())
   {
@@ -1711,6 +1712,9 @@ bool RWGltf_GltfJsonParser::gltfParseAccessor (const Handle(RWGltf_GltfLatePrimi
                      ? aByteStride->GetInt()
                      : 0;
   aStruct.Count = (int64_t )aCount->GetDouble();
+  aStruct.IsNormalized = aNormalized != NULL
+                      && aNormalized->IsBool()
+                      && aNormalized->GetBool();
 
   if (aStruct.ByteOffset < 0)
   {
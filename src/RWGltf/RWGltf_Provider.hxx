@@ -134,6 +134,12 @@ public:
   //! @return provider's vendor name
   Standard_EXPORT virtual TCollection_AsciiString GetVendor() const Standard_OVERRIDE;
 
+  //! Returns true: files can be read concurrently by several providers
+  virtual Standard_Boolean CanReadConcurrently() const Standard_OVERRIDE
+  {
+    return Standard_True;
+  }
+
 };
 
 #endif // _RWGltf_Provider_HeaderFile
@@ -33,6 +33,73 @@ namespace
   static const Standard_Integer   THE_LOWER_NODE_INDEX = 1;
   static const Standard_ShortReal THE_NORMAL_PREC2 = 0.001f;
 
+  //! Return size of vector of three components of specified type or 0 if type is unsupported.
+  static size_t vec3Size (RWGltf_GltfAccessorCompType theType)
+  {
+    switch (theType)
+    {
+      case RWGltf_GltfAccessorCompType_Int8:
+      case RWGltf_GltfAccessorCompType_UInt8:   return 3 * sizeof(uint8_t);
+      case RWGltf_GltfAccessorCompType_Int16:
+      case RWGltf_GltfAccessorCompType_UInt16:  return 3 * sizeof(uint16_t);
+      case RWGltf_GltfAccessorCompType_Float32: return sizeof(Graphic3d_Vec3);
+      default: break;
+    }
+    return 0;
+  }
+
+  //! Read vector of three integer components (KHR_mesh_quantization) and convert it to floating point one.
+  //! Normalized values are mapped into [0,1] or [-1,1] range.
+  template<typename Type_t>
+  static bool readIntVec3 (Standard_ReadBuffer& theBuffer,
+                           std::istream& theStream,
+                           const bool theIsNormalized,
+                           Graphic3d_Vec3& theVec3)
+  {
+    const NCollection_Vec3<Type_t>* aVec3 = theBuffer.ReadChunk<NCollection_Vec3<Type_t> > (theStream);
+    if (aVec3 == NULL)
+    {
+      return false;
+    }
+
+    theVec3 = Graphic3d_Vec3 ((float )aVec3->x(), (float )aVec3->y(), (float )aVec3->z());
+    if (theIsNormalized)
+    {
+      const float aMaxValue = (float )std::numeric_limits<Type_t>::max();
+      theVec3 = Graphic3d_Vec3 (Max (theVec3.x() / aMaxValue, -1.0f),
+                                Max (theVec3.y() / aMaxValue, -1.0f),
+                                Max (theVec3.z() / aMaxValue, -1.0f));
+    }
+    return true;
+  }
+
+  //! Read vector of three components of the type defined by accessor.
+  static bool readVec3 (Standard_ReadBuffer& theBuffer,
+                        std::istream& theStream,
+                        const RWGltf_GltfAccessor& theAccessor,
+                        Graphic3d_Vec3& theVec3)
+  {
+    switch (theAccessor.ComponentType)
+    {
+      case RWGltf_GltfAccessorCompType_Float32:
+      {
+        const Graphic3d_Vec3* aVec3 = theBuffer.ReadChunk<Graphic3d_Vec3> (theStream);
+        if (aVec3 == NULL)
+        {
+          return false;
+        }
+        theVec3 = *aVec3;
+        return true;
+      }
+      case RWGltf_GltfAccessorCompType_Int8:   return readIntVec3<int8_t>   (theBuffer, theStream, theAccessor.IsNormalized, theVec3);
+      case RWGltf_GltfAccessorCompType_UInt8:  return readIntVec3<uint8_t>  (theBuffer, theStream, theAccessor.IsNormalized, theVec3);
+      case RWGltf_GltfAccessorCompType_Int16:  return readIntVec3<int16_t>  (theBuffer, theStream, theAccessor.IsNormalized, theVec3);
+      case RWGltf_GltfAccessorCompType_UInt16: return readIntVec3<uint16_t> (theBuffer, theStream, theAccessor.IsNormalized, theVec3);
+      default: break;
+    }
+    return false;
+  }
+
 #ifdef HAVE_DRACO
   //! Return array type from Draco attribute type.
   static RWGltf_GltfArrayType arrayTypeFromDraco (draco::GeometryAttribute::Type theType)
@@ -750,7 +817,9 @@ bool RWGltf_TriangulationReader::readBuffer (const Handle(RWGltf_GltfLatePrimiti
     }
     case RWGltf_GltfArrayType_Position:
     {
-      if (theAccessor.ComponentType != RWGltf_GltfAccessorCompType_Float32
+      // integer positions are allowed by KHR_mesh_quantization extension
+      const size_t aVec3Size = vec3Size (theAccessor.ComponentType);
+      if (aVec3Size == 0
        || theAccessor.Type != RWGltf_GltfAccessorLayout_Vec3)
       {
         break;
@@ -763,26 +832,26 @@ bool RWGltf_TriangulationReader::readBuffer (const Handle(RWGltf_GltfLatePrimiti
 
       const size_t aStride = theAccessor.ByteStride != 0
                            ? theAccessor.ByteStride
-                           : sizeof(Graphic3d_Vec3);
+                           : aVec3Size;
       const Standard_Integer aNbNodes = (Standard_Integer )theAccessor.Count;
       if (!setNbPositionNodes (theDestMesh, aNbNodes))
       {
         return false;
       }
 
-      Standard_ReadBuffer aBuffer (theAccessor.Count * aStride - (aStride - sizeof(Graphic3d_Vec3)), aStride, true);
+      Standard_ReadBuffer aBuffer (theAccessor.Count * aStride - (aStride - aVec3Size), aStride, true);
+      Graphic3d_Vec3 aVec3;
       if (!myCoordSysConverter.IsEmpty())
       {
         for (Standard_Integer aVertIter = 0; aVertIter < aNbNodes; ++aVertIter)
         {
-          const Graphic3d_Vec3* aVec3 = aBuffer.ReadChunk<Graphic3d_Vec3> (theStream);
-          if (aVec3 == NULL)
+          if (!readVec3 (aBuffer, theStream, theAccessor, aVec3))
           {
             reportError (TCollection_AsciiString ("Buffer '") + aName + "' reading error.");
             return false;
           }
 
-          gp_Pnt anXYZ (aVec3->x(), aVec3->y(), aVec3->z());
+          gp_Pnt anXYZ (aVec3.x(), aVec3.y(), aVec3.z());
           myCoordSysConverter.TransformPosition (anXYZ.ChangeCoord());
           setNodePosition (theDestMesh, THE_LOWER_NODE_INDEX + aVertIter, anXYZ);
         }
@@ -791,21 +860,23 @@ bool RWGltf_TriangulationReader::readBuffer (const Handle(RWGltf_GltfLatePrimiti
       {
         for (Standard_Integer aVertIter = 0; aVertIter < aNbNodes; ++aVertIter)
         {
-          const Graphic3d_Vec3* aVec3 = aBuffer.ReadChunk<Graphic3d_Vec3> (theStream);
-          if (aVec3 == NULL)
+          if (!readVec3 (aBuffer, theStream, theAccessor, aVec3))
           {
             reportError (TCollection_AsciiString ("Buffer '") + aName + "' reading error.");
             return false;
           }
-          setNodePosition (theDestMesh, THE_LOWER_NODE_INDEX + aVertIter, gp_Pnt (aVec3->x(), aVec3->y(), aVec3->z()));
+          setNodePosition (theDestMesh, THE_LOWER_NODE_INDEX + aVertIter, gp_Pnt (aVec3.x(), aVec3.y(), aVec3.z()));
         }
       }
       break;
     }
     case RWGltf_GltfArrayType_Normal:
     {
-      if (theAccessor.ComponentType != RWGltf_GltfAccessorCompType_Float32
-       || theAccessor.Type != RWGltf_GltfAccessorLayout_Vec3)
+      // normalized integer normals are allowed by KHR_mesh_quantization extension
+      const size_t aVec3Size = vec3Size (theAccessor.ComponentType);
+      if (aVec3Size == 0
+       || theAccessor.Type != RWGltf_GltfAccessorLayout_Vec3
+       || (theAccessor.ComponentType != RWGltf_GltfAccessorCompType_Float32 && !theAccessor.IsNormalized))
       {
         break;
       }
@@ -817,27 +888,27 @@ bool RWGltf_TriangulationReader::readBuffer (const Handle(RWGltf_GltfLatePrimiti
 
       const size_t aStride = theAccessor.ByteStride != 0
                            ? theAccessor.ByteStride
-                           : sizeof(Graphic3d_Vec3);
+                           : aVec3Size;
       const Standard_Integer aNbNodes = (Standard_Integer )theAccessor.Count;
       if (!setNbNormalNodes (theDestMesh, aNbNodes))
       {
         return false;
       }
-      Standard_ReadBuffer aBuffer (theAccessor.Count * aStride - (aStride - sizeof(Graphic3d_Vec3)), aStride, true);
+      Standard_ReadBuffer aBuffer (theAccessor.Count * aStride - (aStride - aVec3Size), aStride, true);
+      Graphic3d_Vec3 aVec3;
       if (!myCoordSysConverter.IsEmpty())
       {
         for (Standard_Integer aVertIter = 0; aVertIter < aNbNodes; ++aVertIter)
         {
-          Graphic3d_Vec3* aVec3 = aBuffer.ReadChunk<Graphic3d_Vec3> (theStream);
-          if (aVec3 == NULL)
+          if (!readVec3 (aBuffer, theStream, theAccessor, aVec3))
           {
             reportError (TCollection_AsciiString ("Buffer '") + aName + "' reading error.");
             return false;
           }
-          if (aVec3->SquareModulus() >= THE_NORMAL_PREC2)
+          if (aVec3.SquareModulus() >= THE_NORMAL_PREC2)
           {
-            myCoordSysConverter.TransformNormal (*aVec3);
-            setNodeNormal (theDestMesh, THE_LOWER_NODE_INDEX + aVertIter, *aVec3);
+            myCoordSysConverter.TransformNormal (aVec3);
+            setNodeNormal (theDestMesh, THE_LOWER_NODE_INDEX + aVertIter, aVec3);
           }
           else
           {
@@ -849,15 +920,14 @@ bool RWGltf_TriangulationReader::readBuffer (const Handle(RWGltf_GltfLatePrimiti
       {
         for (Standard_Integer aVertIter = 0; aVertIter < aNbNodes; ++aVertIter)
         {
-          const Graphic3d_Vec3* aVec3 = aBuffer.ReadChunk<Graphic3d_Vec3> (theStream);
-          if (aVec3 == NULL)
+          if (!readVec3 (aBuffer, theStream, theAccessor, aVec3))
           {
             reportError (TCollection_AsciiString ("Buffer '") + aName + "' reading error.");
             return false;
           }
-          if (aVec3->SquareModulus() >= THE_NORMAL_PREC2)
+          if (aVec3.SquareModulus() >= THE_NORMAL_PREC2)
           {
-            setNodeNormal (theDestMesh, THE_LOWER_NODE_INDEX + aVertIter, *aVec3);
+            setNodeNormal (theDestMesh, THE_LOWER_NODE_INDEX + aVertIter, aVec3);
           }
           else
           {
@@ -192,19 +192,28 @@ void RWMesh_CafReader::fillDocument()
     Message::SendWarning("Warning: Length unit of document not equal to the system length unit");
   }
 
-  const Standard_Boolean wasAutoNaming = XCAFDoc_ShapeTool::AutoNaming();
-  XCAFDoc_ShapeTool::SetAutoNaming (Standard_False);
   const TCollection_AsciiString aRootName; // = generateRootName (theFile);
   CafDocumentTools aTools;
   aTools.ShapeTool = XCAFDoc_DocumentTool::ShapeTool (myXdeDoc->Main());
+  // auto-naming is disabled for this document only, as other documents may be filled concurrently
+  const Standard_Boolean hadAutoNaming = aTools.ShapeTool->HasDocumentAutoNaming();
+  const Standard_Boolean wasAutoNaming = aTools.ShapeTool->IsAutoNaming();
+  aTools.ShapeTool->SetDocumentAutoNaming (Standard_False);
   aTools.ColorTool = XCAFDoc_DocumentTool::ColorTool (myXdeDoc->Main());
   aTools.VisMaterialTool = XCAFDoc_DocumentTool::VisMaterialTool (myXdeDoc->Main());
   for (TopTools_SequenceOfShape::Iterator aRootIter (myRootShapes); aRootIter.More(); aRootIter.Next())
   {
     addShapeIntoDoc (aTools, aRootIter.Value(), TDF_Label(), aRootName);
   }
-  XCAFDoc_DocumentTool::ShapeTool (myXdeDoc->Main())->UpdateAssemblies();
-  XCAFDoc_ShapeTool::SetAutoNaming (wasAutoNaming);
+  aTools.ShapeTool->UpdateAssemblies();
+  if (hadAutoNaming)
+  {
+    aTools.ShapeTool->SetDocumentAutoNaming (wasAutoNaming);
+  }
+  else
+  {
+    aTools.ShapeTool->UnsetDocumentAutoNaming();
+  }
 }
 
 // =======================================================================
@@ -163,6 +163,19 @@ public:
     }
   }
 
+  //! Return transformation applied to positions by TransformPosition().
+  gp_Trsf PositionTransformation() const
+  {
+    gp_Trsf aTrsf;
+    if (myHasScale)
+    {
+      aTrsf.SetScaleFactor (myUnitFactor);
+    }
+    return myTrsf.Form() != gp_Identity
+         ? myTrsf * aTrsf
+         : aTrsf;
+  }
+
   //! Transform normal (e.g. exclude translation/scale part of transformation).
   void TransformNormal (Graphic3d_Vec3& theNorm) const
   {
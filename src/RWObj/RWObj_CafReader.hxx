@@ -32,6 +32,12 @@ public:
   //! Setup single/double precision flag for reading vertex data (coordinates).
   void SetSinglePrecision (Standard_Boolean theIsSinglePrecision) { myIsSinglePrecision = theIsSinglePrecision; }
 
+  //! Return TRUE if multithreaded decoding of text records is allowed; FALSE by default.
+  Standard_Boolean ToParallel() const { return myToParallel; }
+
+  //! Setup multithreaded decoding of text records (see RWObj_Reader::SetParallel()).
+  void SetParallel (Standard_Boolean theToParallel) { myToParallel = theToParallel; }
+
 protected:
 
   //! Read the mesh from specified file.
@@ -59,6 +65,7 @@ protected:
 
   NCollection_DataMap<TCollection_AsciiString, Handle(XCAFDoc_VisMaterial)> myObjMaterialMap;
   Standard_Boolean myIsSinglePrecision; //!< flag for reading vertex data with single or double floating point precision
+  Standard_Boolean myToParallel;        //!< flag to decode text records in multiple threads
 };
 
 #endif // _RWObj_CafReader_HeaderFile
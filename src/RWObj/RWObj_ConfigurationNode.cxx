@@ -75,6 +75,8 @@ bool RWObj_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRes
     theResource->BooleanVal("read.fill.incomplete", InternalParameters.ReadFillIncomplete, aScope);
   InternalParameters.ReadMemoryLimitMiB = 
     theResource->IntegerVal("read.memory.limit.mib", InternalParameters.ReadMemoryLimitMiB, aScope);
+  InternalParameters.ReadParallel = 
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
 
   InternalParameters.WriteComment = 
     theResource->StringVal("write.comment", InternalParameters.WriteComment, aScope);
@@ -156,6 +158,12 @@ TCollection_AsciiString RWObj_ConfigurationNode::Save() const
   aResult += aScope + "read.memory.limit.mib :\t " + InternalParameters.ReadMemoryLimitMiB + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Flag to use multithreading\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write parameters:\n";
   aResult += "!\n";
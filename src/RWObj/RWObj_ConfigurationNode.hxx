@@ -92,6 +92,7 @@ public:
     bool ReadFillDoc = true; //!< Flag for fill document from shape sequence
     bool ReadFillIncomplete = true; //!< Flag for fill the document with partially retrieved data even if reader has failed with error
     int ReadMemoryLimitMiB = -1; //!< Memory usage limit
+    bool ReadParallel = false; //!< Flag to use multithreading
     // Writing
     TCollection_AsciiString WriteComment; //!< Export special comment
     TCollection_AsciiString WriteAuthor; //!< Author of exported file name
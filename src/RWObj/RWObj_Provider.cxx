@@ -88,6 +88,7 @@ bool RWObj_Provider::Read(const TCollection_AsciiString& thePath,
   Handle(RWObj_ConfigurationNode) aNode = Handle(RWObj_ConfigurationNode)::DownCast(GetNode());
   RWObj_CafReader aReader;
   aReader.SetSinglePrecision(aNode->InternalParameters.ReadSinglePrecision);
+  aReader.SetParallel(aNode->InternalParameters.ReadParallel);
   aReader.SetSystemLengthUnit(aNode->GlobalParameters.LengthUnit / 1000);
   aReader.SetSystemCoordinateSystem(aNode->InternalParameters.SystemCS);
   aReader.SetFileLengthUnit(aNode->InternalParameters.FileLengthUnit);
@@ -199,6 +200,7 @@ bool RWObj_Provider::Read(const TCollection_AsciiString& thePath,
   aSimpleReader.SetCreateShapes(aNode->InternalParameters.ReadCreateShapes);
   aSimpleReader.SetSinglePrecision(aNode->InternalParameters.ReadSinglePrecision);
   aSimpleReader.SetMemoryLimit(aNode->InternalParameters.ReadMemoryLimitMiB);
+  aSimpleReader.SetParallel(aNode->InternalParameters.ReadParallel);
   if (!aSimpleReader.Read(thePath, theProgress))
   {
     Message::SendFail() << "Error in the RWObj_ConfigurationNode during reading the file " << thePath;
@@ -24,6 +24,7 @@
 #include <Message_ProgressScope.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <OSD_OpenFile.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Path.hxx>
 #include <OSD_Timer.hxx>
 #include <Standard_CLocaleSentry.hxx>
@@ -47,6 +48,12 @@ namespace
   // The length of buffer to read (in bytes)
   static const size_t THE_BUFFER_SIZE = 4 * 1024;
 
+  // The length of block of lines decoded concurrently in parallel mode (in bytes)
+  static const size_t THE_BLOCK_SIZE = 4 * 1024 * 1024;
+
+  // The number of lines within the block decoded by one task in parallel mode
+  static const int THE_BLOCK_TASK_NB_LINES = 4096;
+
 
   //! Return TRUE if given polygon has clockwise node order.
   static bool isClockwisePolygon (const Handle(BRepMesh_DataStructureOfDelaun)& theMesh,
@@ -77,7 +84,8 @@ RWObj_Reader::RWObj_Reader()
   myNbProbeNodes (0),
   myNbProbeElems (0),
   myNbElemsBig (0),
-  myToAbort (false)
+  myToAbort (false),
+  myToParallel (false)
 {
   //
 }
@@ -141,6 +149,11 @@ Standard_Boolean RWObj_Reader::read (std::istream& theStream,
   size_t aLineLen = 0;
   int64_t aReadBytes = 0;
   const char* aLine = NULL;
+
+  // in parallel mode, lines are accumulated into blocks to be decoded concurrently
+  const bool toDecodeBlocks = myToParallel && !theToProbe;
+  std::vector<char>   aBlockText;
+  std::vector<size_t> aBlockLines;
   for (;;)
   {
     aLine = aBuffer.ReadLine (theStream, aLineLen, aReadBytes);
@@ -148,7 +161,6 @@ Standard_Boolean RWObj_Reader::read (std::istream& theStream,
     {
       break;
     }
-    ++myNbLines;
     aPosition += aReadBytes;
     if (aTimer.ElapsedTime() > 1.0)
     {
@@ -164,98 +176,33 @@ Standard_Boolean RWObj_Reader::read (std::istream& theStream,
       aTimer.Start();
     }
 
-    if (*aLine == '#')
+    if (!toDecodeBlocks)
     {
-      if (isStart)
+      if (!processLine (aLine, NULL, isStart, theToProbe))
       {
-        TCollection_AsciiString aComment (aLine + 1);
-        aComment.LeftAdjust();
-        aComment.RightAdjust();
-        if (!aComment.IsEmpty())
-        {
-          if (!myFileComments.IsEmpty())
-          {
-            myFileComments += "\n";
-          }
-          myFileComments += aComment;
-        }
+        return false;
       }
       continue;
     }
-    else if (*aLine == '\n'
-          || *aLine == '\0')
-    {
 
-      continue;
-    }
-    isStart = false;
-
-    if (theToProbe)
+    aBlockLines.push_back (aBlockText.size());
+    aBlockText.insert (aBlockText.end(), aLine, aLine + aLineLen);
+    aBlockText.push_back ('\0');
+    if (aBlockText.size() >= THE_BLOCK_SIZE)
     {
-      if (::strncmp (aLine, "mtllib", 6) == 0)
+      if (!processBlock (aBlockText, aBlockLines, isStart))
       {
-        readMaterialLib (IsSpace (aLine[6]) ? aLine + 7 : "");
-      }
-      else if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar (aLine[1]))
-      {
-        ++myNbProbeNodes;
-      }
-      else if (aLine[0] == 'f' && RWObj_Tools::isSpaceChar (aLine[1]))
-      {
-        ++myNbProbeElems;
+        return false;
       }
-      continue;
-    }
-
-    if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar (aLine[1]))
-    {
-      ++myNbProbeNodes;
-      pushVertex (aLine + 2);
-    }
-    else if (aLine[0] == 'v'
-          && aLine[1] == 'n'
-          && RWObj_Tools::isSpaceChar (aLine[2]))
-    {
-      pushNormal (aLine + 3);
-    }
-    else if (aLine[0] == 'v'
-          && aLine[1] == 't'
-          && RWObj_Tools::isSpaceChar (aLine[2]))
-    {
-      pushTexel (aLine + 3);
-    }
-    else if (aLine[0] == 'f' && RWObj_Tools::isSpaceChar (aLine[1]))
-    {
-      ++myNbProbeElems;
-      pushIndices (aLine + 2);
-    }
-    else if (aLine[0] == 'g' && IsSpace (aLine[1]))
-    {
-      pushGroup (aLine + 2);
-    }
-    else if (aLine[0] == 's' && IsSpace (aLine[1]))
-    {
-      pushSmoothGroup (aLine + 2);
-    }
-    else if (aLine[0] == 'o' && IsSpace (aLine[1]))
-    {
-      pushObject (aLine + 2);
-    }
-    else if (::strncmp (aLine, "mtllib", 6) == 0)
-    {
-      readMaterialLib (IsSpace (aLine[6]) ? aLine + 7 : "");
-    }
-    else if (::strncmp (aLine, "usemtl", 6) == 0)
-    {
-      pushMaterial (IsSpace (aLine[6]) ? aLine + 7 : "");
-    }
-
-    if (!checkMemory())
-    {
-      addMesh (myActiveSubMesh, RWObj_SubMeshReason_NewObject);
-      return false;
+      aBlockText.clear();
+      aBlockLines.clear();
     }
   }
+  if (!aBlockLines.empty()
+   && !processBlock (aBlockText, aBlockLines, isStart))
+  {
+    return false;
+  }
 
   // collect external references
   for (NCollection_DataMap<TCollection_AsciiString, RWObj_Material>::Iterator aMatIter (myMaterials); aMatIter.More(); aMatIter.Next())
@@ -289,15 +236,197 @@ Standard_Boolean RWObj_Reader::read (std::istream& theStream,
 }
 
 // =======================================================================
-// function : pushIndices
+// function : processLine
 // purpose  :
 // =======================================================================
-void RWObj_Reader::pushIndices (const char* thePos)
+bool RWObj_Reader::processLine (const char* theLine,
+                                const DecodedRecord* theRecord,
+                                bool& theIsStart,
+                                const Standard_Boolean theToProbe)
 {
-  char* aNext = NULL;
+  ++myNbLines;
+  if (*theLine == '#')
+  {
+    if (theIsStart)
+    {
+      TCollection_AsciiString aComment (theLine + 1);
+      aComment.LeftAdjust();
+      aComment.RightAdjust();
+      if (!aComment.IsEmpty())
+      {
+        if (!myFileComments.IsEmpty())
+        {
+          myFileComments += "\n";
+        }
+        myFileComments += aComment;
+      }
+    }
+    return true;
+  }
+  else if (*theLine == '\n'
+        || *theLine == '\0')
+  {
+    return true;
+  }
+  theIsStart = false;
 
-  Standard_Integer aNbElemNodes = 0;
-  for (Standard_Integer aNode = 0;; ++aNode)
+  if (theToProbe)
+  {
+    if (::strncmp (theLine, "mtllib", 6) == 0)
+    {
+      readMaterialLib (IsSpace (theLine[6]) ? theLine + 7 : "");
+    }
+    else if (theLine[0] == 'v' && RWObj_Tools::isSpaceChar (theLine[1]))
+    {
+      ++myNbProbeNodes;
+    }
+    else if (theLine[0] == 'f' && RWObj_Tools::isSpaceChar (theLine[1]))
+    {
+      ++myNbProbeElems;
+    }
+    return true;
+  }
+
+  if (theLine[0] == 'v' && RWObj_Tools::isSpaceChar (theLine[1]))
+  {
+    ++myNbProbeNodes;
+    pushVertex (theRecord != NULL ? theRecord->Position : readVertex (theLine + 2));
+  }
+  else if (theLine[0] == 'v'
+        && theLine[1] == 'n'
+        && RWObj_Tools::isSpaceChar (theLine[2]))
+  {
+    pushNormal (theRecord != NULL ? theRecord->Normal : readNormal (theLine + 3));
+  }
+  else if (theLine[0] == 'v'
+        && theLine[1] == 't'
+        && RWObj_Tools::isSpaceChar (theLine[2]))
+  {
+    pushTexel (theRecord != NULL ? theRecord->UV : readTexel (theLine + 3));
+  }
+  else if (theLine[0] == 'f' && RWObj_Tools::isSpaceChar (theLine[1]))
+  {
+    ++myNbProbeElems;
+    if (theRecord != NULL)
+    {
+      pushIndices (theRecord->Indices, theRecord->NbIndices);
+    }
+    else
+    {
+      myCurrIndices.clear();
+      readIndices (theLine + 2, myCurrIndices);
+      pushIndices (myCurrIndices.data(), (Standard_Integer )myCurrIndices.size());
+    }
+  }
+  else if (theLine[0] == 'g' && IsSpace (theLine[1]))
+  {
+    pushGroup (theLine + 2);
+  }
+  else if (theLine[0] == 's' && IsSpace (theLine[1]))
+  {
+    pushSmoothGroup (theLine + 2);
+  }
+  else if (theLine[0] == 'o' && IsSpace (theLine[1]))
+  {
+    pushObject (theLine + 2);
+  }
+  else if (::strncmp (theLine, "mtllib", 6) == 0)
+  {
+    readMaterialLib (IsSpace (theLine[6]) ? theLine + 7 : "");
+  }
+  else if (::strncmp (theLine, "usemtl", 6) == 0)
+  {
+    pushMaterial (IsSpace (theLine[6]) ? theLine + 7 : "");
+  }
+
+  if (!checkMemory())
+  {
+    addMesh (myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+    return false;
+  }
+  return true;
+}
+
+// =======================================================================
+// function : processBlock
+// purpose  :
+// =======================================================================
+bool RWObj_Reader::processBlock (const std::vector<char>& theText,
+                                 const std::vector<size_t>& theLines,
+                                 bool& theIsStart)
+{
+  // decode records concurrently, each task fills its own list of face indices;
+  // relative (negative) indices, range checks and node packing depend on the preceding records,
+  // so that they are handled later while processing lines in the original order
+  const int aNbLines = (int )theLines.size();
+  const int aNbTasks = (aNbLines + THE_BLOCK_TASK_NB_LINES - 1) / THE_BLOCK_TASK_NB_LINES;
+  std::vector<DecodedRecord> aRecords (aNbLines);
+  std::vector< std::vector<Graphic3d_Vec3i> > aTaskIndices (aNbTasks);
+  OSD_Parallel::For (0, aNbTasks, [&](int theTaskIndex)
+  {
+    std::vector<Graphic3d_Vec3i>& anIndices = aTaskIndices[theTaskIndex];
+    const int aLineFrom = theTaskIndex * THE_BLOCK_TASK_NB_LINES;
+    const int aLineTo   = std::min (aLineFrom + THE_BLOCK_TASK_NB_LINES, aNbLines);
+    for (int aLineIter = aLineFrom; aLineIter < aLineTo; ++aLineIter)
+    {
+      const char* aLine = &theText[theLines[aLineIter]];
+      DecodedRecord& aRecord = aRecords[aLineIter];
+      if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar (aLine[1]))
+      {
+        aRecord.Position = readVertex (aLine + 2);
+      }
+      else if (aLine[0] == 'v'
+            && aLine[1] == 'n'
+            && RWObj_Tools::isSpaceChar (aLine[2]))
+      {
+        aRecord.Normal = readNormal (aLine + 3);
+      }
+      else if (aLine[0] == 'v'
+            && aLine[1] == 't'
+            && RWObj_Tools::isSpaceChar (aLine[2]))
+      {
+        aRecord.UV = readTexel (aLine + 3);
+      }
+      else if (aLine[0] == 'f' && RWObj_Tools::isSpaceChar (aLine[1]))
+      {
+        const size_t aNbIndicesBefore = anIndices.size();
+        readIndices (aLine + 2, anIndices);
+        aRecord.NbIndices = Standard_Integer(anIndices.size() - aNbIndicesBefore);
+      }
+    }
+
+    // the list of the task is complete, so that its memory will not be reallocated anymore
+    size_t anOffset = 0;
+    for (int aLineIter = aLineFrom; aLineIter < aLineTo; ++aLineIter)
+    {
+      DecodedRecord& aRecord = aRecords[aLineIter];
+      if (aRecord.NbIndices > 0)
+      {
+        aRecord.Indices = anIndices.data() + anOffset;
+        anOffset += aRecord.NbIndices;
+      }
+    }
+  });
+
+  for (int aLineIter = 0; aLineIter < aNbLines; ++aLineIter)
+  {
+    if (!processLine (&theText[theLines[aLineIter]], &aRecords[aLineIter], theIsStart, Standard_False))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : readIndices
+// purpose  :
+// =======================================================================
+void RWObj_Reader::readIndices (const char* thePos,
+                                std::vector<Graphic3d_Vec3i>& theIndices)
+{
+  char* aNext = NULL;
+  for (;;)
   {
     Graphic3d_Vec3i a3Indices (-1, -1, -1);
     a3Indices[0] = int(strtol (thePos, &aNext, 10) - 1);
@@ -322,6 +451,32 @@ void RWObj_Reader::pushIndices (const char* thePos)
         thePos = aNext;
       }
     }
+    theIndices.push_back (a3Indices);
+
+    if (*thePos == '\n'
+     || *thePos == '\0')
+    {
+      break;
+    }
+
+    if (*thePos != ' ')
+    {
+      ++thePos;
+    }
+  }
+}
+
+// =======================================================================
+// function : pushIndices
+// purpose  :
+// =======================================================================
+void RWObj_Reader::pushIndices (const Graphic3d_Vec3i* theIndices,
+                                const Standard_Integer theNbIndices)
+{
+  Standard_Integer aNbElemNodes = 0;
+  for (Standard_Integer aNode = 0; aNode < theNbIndices; ++aNode)
+  {
+    Graphic3d_Vec3i a3Indices = theIndices[aNode];
 
     // handle negative indices
     if (a3Indices[0] < -1)
@@ -406,17 +561,6 @@ void RWObj_Reader::pushIndices (const char* thePos)
     }
     myCurrElem[aNode] = anIndex;
     aNbElemNodes = aNode + 1;
-
-    if (*thePos == '\n'
-     || *thePos == '\0')
-    {
-      break;
-    }
-
-    if (*thePos != ' ')
-    {
-      ++thePos;
-    }
   }
 
   if (myCurrElem[0] < 0
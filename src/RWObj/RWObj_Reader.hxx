@@ -128,6 +128,15 @@ public:
   //! Setup single/double precision flag for reading vertex data (coordinates).
   void SetSinglePrecision (Standard_Boolean theIsSinglePrecision) { myObjVerts.SetSinglePrecision (theIsSinglePrecision); }
 
+  //! Return TRUE if multithreaded decoding of text records is allowed; FALSE by default.
+  Standard_Boolean ToParallel() const { return myToParallel; }
+
+  //! Setup multithreaded decoding of text records.
+  //! The file is read by blocks of lines; vertex, normal, texture coordinates and face records
+  //! of a block are decoded concurrently and then passed to the interface methods in the original order,
+  //! so that the result is the same as in sequential mode.
+  void SetParallel (Standard_Boolean theToParallel) { myToParallel = theToParallel; }
+
 protected:
 
   //! Reads data from OBJ file.
@@ -184,45 +193,98 @@ protected:
 //! @name implementation details
 private:
 
-  //! Handle "v X Y Z".
-  void pushVertex (const char* theXYZ)
+  //! Values of a record decoded in advance (in parallel mode).
+  struct DecodedRecord
   {
-    char* aNext = NULL;
-    gp_Pnt anXYZ;
-    RWObj_Tools::ReadVec3 (theXYZ, aNext, anXYZ.ChangeCoord());
-    myCSTrsf.TransformPosition (anXYZ.ChangeCoord());
+    gp_XYZ                 Position;  //!< vertex position of "v" record, transformed
+    Graphic3d_Vec3         Normal;    //!< normal of "vn" record, transformed
+    Graphic3d_Vec2         UV;        //!< texture coordinates of "vt" record
+    const Graphic3d_Vec3i* Indices;   //!< node indices of "f" record (relative indices are not resolved)
+    Standard_Integer       NbIndices; //!< number of nodes of "f" record
 
-    myMemEstim += myObjVerts.IsSinglePrecision() ? sizeof(Graphic3d_Vec3) : sizeof(gp_Pnt);
-    myObjVerts.Append (anXYZ);
+    DecodedRecord() : Indices (NULL), NbIndices (0) {}
+  };
+
+  //! Process the line: decode the record (unless theRecord is not NULL) and pass it to the interface methods.
+  //! @param theLine    null-terminated line
+  //! @param theRecord  values decoded in advance or NULL
+  //! @param theIsStart flag indicating that only comments have been read so far
+  //! @param theToProbe flag to probe the file
+  //! @return FALSE if reading should be stopped
+  bool processLine (const char* theLine,
+                    const DecodedRecord* theRecord,
+                    bool& theIsStart,
+                    const Standard_Boolean theToProbe);
+
+  //! Decode vertex, normal, texture coordinates and face records of the block of lines concurrently,
+  //! and process all lines of the block in the original order.
+  //! @param theText    null-terminated lines of the block
+  //! @param theLines   offsets of lines within theText
+  //! @param theIsStart flag indicating that only comments have been read so far
+  //! @return FALSE if reading should be stopped
+  bool processBlock (const std::vector<char>& theText,
+                     const std::vector<size_t>& theLines,
+                     bool& theIsStart);
+
+  //! Decode "v X Y Z" record.
+  gp_XYZ readVertex (const char* theXYZ) const
+  {
+    char* aNext = NULL;
+    gp_XYZ anXYZ;
+    RWObj_Tools::ReadVec3 (theXYZ, aNext, anXYZ);
+    myCSTrsf.TransformPosition (anXYZ);
+    return anXYZ;
   }
 
-  //! Handle "vn NX NY NZ".
-  void pushNormal (const char* theXYZ)
+  //! Decode "vn NX NY NZ" record.
+  Graphic3d_Vec3 readNormal (const char* theXYZ) const
   {
     char* aNext = NULL;
     Graphic3d_Vec3 aNorm;
     RWObj_Tools::ReadVec3 (theXYZ, aNext, aNorm);
     myCSTrsf.TransformNormal (aNorm);
-
-    myMemEstim += sizeof(Graphic3d_Vec3);
-    myObjNorms.Append (aNorm);
+    return aNorm;
   }
 
-  //! Handle "vt U V".
-  void pushTexel (const char* theUV)
+  //! Decode "vt U V" record.
+  static Graphic3d_Vec2 readTexel (const char* theUV)
   {
     char* aNext = NULL;
     Graphic3d_Vec2 anUV;
     anUV.x() = (float )Strtod (theUV, &aNext);
     theUV = aNext;
     anUV.y() = (float )Strtod (theUV, &aNext);
+    return anUV;
+  }
 
+  //! Decode "f indices" record and append node indices (zero-based, relative indices are not resolved).
+  static void readIndices (const char* thePos,
+                           std::vector<Graphic3d_Vec3i>& theIndices);
+
+  //! Handle "v X Y Z".
+  void pushVertex (const gp_XYZ& theXYZ)
+  {
+    myMemEstim += myObjVerts.IsSinglePrecision() ? sizeof(Graphic3d_Vec3) : sizeof(gp_Pnt);
+    myObjVerts.Append (gp_Pnt (theXYZ));
+  }
+
+  //! Handle "vn NX NY NZ".
+  void pushNormal (const Graphic3d_Vec3& theNorm)
+  {
+    myMemEstim += sizeof(Graphic3d_Vec3);
+    myObjNorms.Append (theNorm);
+  }
+
+  //! Handle "vt U V".
+  void pushTexel (const Graphic3d_Vec2& theUV)
+  {
     myMemEstim += sizeof(Graphic3d_Vec2);
-    myObjVertsUV.Append (anUV);
+    myObjVertsUV.Append (theUV);
   }
 
   //! Handle "f indices".
-  void pushIndices (const char* thePos);
+  void pushIndices (const Graphic3d_Vec3i* theIndices,
+                    const Standard_Integer theNbIndices);
 
   //! Compute the center of planar polygon.
   //! @param theIndices polygon indices
@@ -366,6 +428,7 @@ protected:
   Standard_Integer                   myNbProbeElems;  //!< number of probed elements
   Standard_Integer                   myNbElemsBig;    //!< number of big elements (polygons with 5+ nodes)
   Standard_Boolean                   myToAbort;       //!< flag indicating abort state (e.g. syntax error)
+  Standard_Boolean                   myToParallel;    //!< flag to decode records in multiple threads
 
   // Each node in the Element specifies independent indices of Vertex position, Texture coordinates and Normal.
   // This scheme does not match natural definition of Primitive Array
@@ -382,6 +445,7 @@ protected:
 
   RWObj_SubMesh                      myActiveSubMesh; //!< active sub-mesh definition
   std::vector<Standard_Integer>      myCurrElem;      //!< indices for the current element
+  std::vector<Graphic3d_Vec3i>       myCurrIndices;   //!< decoded node indices of the current element
 };
 
 #endif // _RWObj_Reader_HeaderFile
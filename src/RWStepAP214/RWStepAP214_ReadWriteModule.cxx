@@ -25,6 +25,7 @@
 #include <StepAP214_Protocol.hxx>
 #include <StepData_StepReaderData.hxx>
 #include <StepData_StepWriter.hxx>
+#include <StepData_TypeNameTable.hxx>
 #include <StepData_WriterLib.hxx>
 #include <TCollection_AsciiString.hxx>
 
@@ -2357,6 +2358,8 @@ static TCollection_AsciiString Reco_TriangulatedSurfaceSet("TRIANGULATED_SURFACE
 
 static NCollection_DataMap<TCollection_AsciiString, Standard_Integer> typenums;
 static NCollection_DataMap<TCollection_AsciiString, Standard_Integer> typeshor;
+// perfect hash table of long and short types, built from keys of both maps above
+static StepData_TypeNameTable typetable;
 
 RWStepAP214_ReadWriteModule::RWStepAP214_ReadWriteModule ()
 {
@@ -3650,7 +3653,17 @@ RWStepAP214_ReadWriteModule::RWStepAP214_ReadWriteModule ()
   typeshor.Bind ("ANNPLN", 704);
   typeshor.Bind ("CNGMRP", 712);
   typeshor.Bind ("CGRR", 713);
-    
+
+  // long types are added first : they take precedence over short ones
+  for (NCollection_DataMap<TCollection_AsciiString, Standard_Integer>::Iterator anIter (typenums); anIter.More(); anIter.Next())
+  {
+    typetable.Add (anIter.Key().ToCString(), anIter.Value());
+  }
+  for (NCollection_DataMap<TCollection_AsciiString, Standard_Integer>::Iterator anIter (typeshor); anIter.More(); anIter.Next())
+  {
+    typetable.Add (anIter.Key().ToCString(), anIter.Value());
+  }
+  typetable.Build();
 }
 
 // --- Case Recognition ---
@@ -3658,13 +3671,19 @@ RWStepAP214_ReadWriteModule::RWStepAP214_ReadWriteModule ()
 Standard_Integer RWStepAP214_ReadWriteModule::CaseStep
 (const TCollection_AsciiString& key) const
 {
-  // FMA - le 25-07-96 : Optimisation -> on teste en premier les types les plus
-  //                     frequents dans le fichier cad geometry/topology
-  Standard_Integer num;
-  if (key.IsEqual(Reco_CartesianPoint)) return 59;  // car tres courant
-  if (typenums.Find(key, num)) return num;
-  if (typeshor.Find(key, num)) return num; // AJOUT DES TYPES COURTS
-  return 0;
+  // long and short types are found by one probe of the perfect hash table
+  return typetable.Find (key.ToCString(), key.Length());
+}
+
+//=======================================================================
+//function : CaseStep
+//purpose  : 
+//=======================================================================
+
+Standard_Integer RWStepAP214_ReadWriteModule::CaseStep
+(const Standard_CString theType) const
+{
+  return typetable.Find (theType);
 }
 
 
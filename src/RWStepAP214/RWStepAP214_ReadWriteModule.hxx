@@ -44,6 +44,10 @@ public:
   //! associates a positive Case Number to each type of StepAP214 entity,
   //! given as a String defined in the EXPRESS form
   Standard_EXPORT Standard_Integer CaseStep (const TCollection_AsciiString& atype) const Standard_OVERRIDE;
+
+  //! Same as above for a type given as a null-terminated string;
+  //! does not allocate memory
+  Standard_EXPORT virtual Standard_Integer CaseStep (const Standard_CString theType) const Standard_OVERRIDE;
   
   //! associates a positive Case Number to each type of StepAP214 Complex entity,
   //! given as a String defined in the EXPRESS form
@@ -143,10 +143,12 @@ namespace
 //=============================================================================
 Handle(Poly_Triangulation) RWStl::ReadFile (const Standard_CString theFile,
                                             const Standard_Real theMergeAngle,
+                                            const Standard_Boolean theToParallel,
                                             const Message_ProgressRange& theProgress)
 {
   Reader aReader;
   aReader.SetMergeAngle (theMergeAngle);
+  aReader.SetParallel (theToParallel);
   aReader.Read (theFile, theProgress);
   // note that returned bool value is ignored intentionally -- even if something went wrong,
   // but some data have been read, we at least will return these data
@@ -157,13 +159,15 @@ Handle(Poly_Triangulation) RWStl::ReadFile (const Standard_CString theFile,
 //function : ReadFile
 //purpose  :
 //=============================================================================
-void RWStl::ReadFile(const Standard_CString theFile,
-                     const Standard_Real theMergeAngle,
-                     NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
-                     const Message_ProgressRange& theProgress)
+void RWStl::ReadFile (const Standard_CString theFile,
+                      const Standard_Real theMergeAngle,
+                      const Standard_Boolean theToParallel,
+                      NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
+                      const Message_ProgressRange& theProgress)
 {
   MultiDomainReader aReader;
   aReader.SetMergeAngle (theMergeAngle);
+  aReader.SetParallel (theToParallel);
   aReader.Read (theFile, theProgress);
   theTriangList.Clear();
   theTriangList.Append (aReader.ChangeTriangulationList());
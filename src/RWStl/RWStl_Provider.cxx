@@ -183,7 +183,8 @@ bool RWStl_Provider::Read(const TCollection_AsciiString& thePath,
   }
   if (!aNode->InternalParameters.ReadBRep)
   {
-    Handle(Poly_Triangulation) aTriangulation = RWStl::ReadFile(thePath.ToCString(), aMergeAngle, theProgress);
+    Handle(Poly_Triangulation) aTriangulation = RWStl::ReadFile(thePath.ToCString(), aMergeAngle,
+                                                                      aNode->InternalParameters.ReadParallel, theProgress);
 
     TopoDS_Face aFace;
     BRep_Builder aB;
@@ -131,6 +131,12 @@ public:
   //! Gets provider's vendor name of associated provider
   //! @return provider's vendor name
   Standard_EXPORT virtual TCollection_AsciiString GetVendor() const Standard_OVERRIDE;
+
+  //! Returns true: files can be read concurrently by several providers
+  virtual Standard_Boolean CanReadConcurrently() const Standard_OVERRIDE
+  {
+    return Standard_True;
+  }
 };
 
 #endif // _RWStl_Provider_HeaderFile
@@ -21,13 +21,17 @@
 #include <NCollection_DataMap.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <FSD_BinaryFile.hxx>
+#include <NCollection_Buffer.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Timer.hxx>
 #include <Poly_MergeNodesTool.hxx>
 #include <Standard_CLocaleSentry.hxx>
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
+#include <vector>
 
 IMPLEMENT_STANDARD_RTTIEXT(RWStl_Reader, Standard_Transient)
 
@@ -125,7 +129,8 @@ namespace
 //==============================================================================
 RWStl_Reader::RWStl_Reader()
 : myMergeAngle (M_PI/2.0),
-  myMergeTolearance (0.0)
+  myMergeTolearance (0.0),
+  myToParallel (false)
 {
   //
 }
@@ -138,6 +143,14 @@ Standard_Boolean RWStl_Reader::Read (const char* theFile,
                                      const Message_ProgressRange& theProgress)
 {
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+
+  // parse the file content in place when the file can be mapped into memory
+  Handle(NCollection_Buffer) aFileBuffer = aFileSystem->OpenMemoryBuffer (theFile);
+  if (!aFileBuffer.IsNull())
+  {
+    return Read ((const char* )aFileBuffer->Data(), aFileBuffer->Size(), theProgress);
+  }
+
   std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (theFile, std::ios::in | std::ios::binary);
   if (aStream.get() == NULL)
   {
@@ -185,6 +198,44 @@ Standard_Boolean RWStl_Reader::Read (const char* theFile,
   return ! aStream->fail();
 }
 
+//==============================================================================
+//function : Read
+//purpose  :
+//==============================================================================
+Standard_Boolean RWStl_Reader::Read (const char* theData,
+                                     const size_t theDataLen,
+                                     const Message_ProgressRange& theProgress)
+{
+  if (theData == NULL)
+  {
+    return Standard_False;
+  }
+
+  const bool isAscii = IsAscii (theData, theDataLen);
+
+  // see comments in Read() from stream regarding multi-domain files and progress scale
+  Message_ProgressScope aPS (theProgress, NULL, 1, true);
+  size_t aPos = 0;
+  while (aPos < theDataLen)
+  {
+    const bool isDone = isAscii
+                      ? ReadAscii  (theData, theDataLen, aPos, aPS.Next (2))
+                      : ReadBinary (theData, theDataLen, aPos, aPS.Next (2));
+    if (!isDone)
+    {
+      return Standard_False;
+    }
+
+    // skip any white spaces
+    while (aPos < theDataLen && isspace ((unsigned char )theData[aPos]))
+    {
+      ++aPos;
+    }
+    AddSolid();
+  }
+  return Standard_True;
+}
+
 //==============================================================================
 //function : IsAscii
 //purpose  :
@@ -234,6 +285,30 @@ Standard_Boolean RWStl_Reader::IsAscii (Standard_IStream& theStream,
   return true;
 }
 
+//==============================================================================
+//function : IsAscii
+//purpose  :
+//==============================================================================
+Standard_Boolean RWStl_Reader::IsAscii (const char*  theData,
+                                        const size_t theDataLen)
+{
+  // if file is shorter than size of binary file with 1 facet, it must be ascii
+  if (theDataLen < THE_STL_MIN_FILE_SIZE)
+  {
+    return true;
+  }
+
+  // otherwise, detect binary format by presence of non-ascii symbols in first bytes
+  for (size_t aByteIter = 0; aByteIter < THE_STL_MIN_FILE_SIZE; ++aByteIter)
+  {
+    if ((unsigned char )theData[aByteIter] > (unsigned char )'~')
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 // adapted from Standard_CString.cxx
 #ifdef __APPLE__
   // There are a lot of *_l functions available on Mac OS X - we use them
@@ -261,142 +336,396 @@ Standard_Boolean RWStl_Reader::IsAscii (Standard_IStream& theStream,
   #define GETPOS(aPos) ((int64_t)aPos)
 #endif
 
-static inline bool str_starts_with (const char* theStr, const char* theWord, int theN)
+// Note that the line passed to the functions below is not necessarily null-terminated
+// (line within memory-mapped file), thus the end of line theEnd is checked explicitly.
+static inline bool str_starts_with (const char* theStr, const char* theEnd, const char* theWord, int theN)
 {
-  while (isspace (*theStr) && *theStr != '\0') theStr++;
-  return !strncasecmp (theStr, theWord, theN);
+  while (theStr < theEnd && isspace ((unsigned char)*theStr) && *theStr != '\0') theStr++;
+  return theEnd - theStr >= theN
+      && !strncasecmp (theStr, theWord, theN);
 }
 
-static bool ReadVertex (const char* theStr, double& theX, double& theY, double& theZ)
+static bool ReadVertex (const char* theStr, const char* theEnd, double& theX, double& theY, double& theZ)
 {
   const char *aStr = theStr;
 
   // skip 'vertex'
-  while (isspace ((unsigned char)*aStr) || isalpha ((unsigned char)*aStr)) 
+  while (aStr < theEnd && (isspace ((unsigned char)*aStr) || isalpha ((unsigned char)*aStr)))
     ++aStr;
 
-  // read values
-  char *aEnd;
-  theX = Strtod (aStr, &aEnd);
-  theY = Strtod (aStr = aEnd, &aEnd);
-  theZ = Strtod (aStr = aEnd, &aEnd);
+  // read values;
+  // white spaces are skipped here to prevent Strtod() from going beyond the end of line
+  char *aEnd = (char* )aStr;
+  double* aValues[3] = { &theX, &theY, &theZ };
+  for (int aCoordIter = 0; aCoordIter < 3; ++aCoordIter)
+  {
+    for (aStr = aEnd; aStr < theEnd && isspace ((unsigned char)*aStr); ++aStr) {}
+    if (aStr < theEnd)
+    {
+      *aValues[aCoordIter] = Strtod (aStr, &aEnd);
+    }
+    else
+    {
+      *aValues[aCoordIter] = 0.0;
+      aEnd = (char* )aStr;
+    }
+  }
 
   return aEnd != aStr;
 }
 
-//==============================================================================
-//function : ReadAscii
-//purpose  :
-//==============================================================================
-Standard_Boolean RWStl_Reader::ReadAscii (Standard_IStream& theStream,
-                                          Standard_ReadLineBuffer& theBuffer,
-                                          const std::streampos theUntilPos,
-                                          const Message_ProgressRange& theProgress)
+namespace
 {
-  // use method seekpos() to get true 64-bit offset to enable
-  // handling of large files (VS 2010 64-bit)
-  const int64_t aStartPos = GETPOS(theStream.tellg());
-  size_t aLineLen = 0;
-  const char* aLine;
-
-  // skip header "solid ..."
-  aLine = theBuffer.ReadLine (theStream, aLineLen);
-  // skip empty lines
-  while (aLine && !*aLine)
+  //! Reads lines from the stream using Standard_ReadLineBuffer.
+  class StreamLineReader
   {
-    aLine = theBuffer.ReadLine (theStream, aLineLen);
-  }
-  if (aLine == NULL)
-  {
-    Message::SendFail ("Error: premature end of file");
-    return false;
-  }
+  public:
 
-  MergeNodeTool aMergeTool (this);
-  aMergeTool.SetMergeAngle (myMergeAngle);
-  aMergeTool.SetMergeTolerance (myMergeTolearance);
+    StreamLineReader (Standard_IStream& theStream, Standard_ReadLineBuffer& theBuffer)
+    : myStream (theStream), myBuffer (theBuffer) {}
 
-  Standard_CLocaleSentry::clocale_t aLocale = Standard_CLocaleSentry::GetCLocale();
-  (void)aLocale; // to avoid warning on GCC where it is actually not used
-  SAVE_TL() // for GCC only, set C locale globally
+    //! Returns the next null-terminated line and its end, or NULL at end of stream.
+    const char* ReadLine (const char*& theLineEnd)
+    {
+      size_t aLineLen = 0;
+      const char* aLine = myBuffer.ReadLine (myStream, aLineLen);
+      theLineEnd = aLine + aLineLen;
+      return aLine;
+    }
 
-  // report progress every 1 MiB of read data
-  const int aStepB = 1024 * 1024;
-  const Standard_Integer aNbSteps = 1 + Standard_Integer((GETPOS(theUntilPos) - aStartPos) / aStepB);
-  Message_ProgressScope aPS (theProgress, "Reading text STL file", aNbSteps);
-  int64_t aProgressPos = aStartPos + aStepB;
-  int aNbLine = 1;
+    //! Reads coordinates of the vertex from the line.
+    bool ReadVertex (const char* theLine, const char* theLineEnd, gp_XYZ& theVertex) const
+    {
+      return ::ReadVertex (theLine, theLineEnd, theVertex.ChangeCoord (1), theVertex.ChangeCoord (2), theVertex.ChangeCoord (3));
+    }
 
-  while (aPS.More())
+    //! Returns current position in the stream.
+    int64_t Position() { return GETPOS(myStream.tellg()); }
+
+  private:
+    Standard_IStream&        myStream;
+    Standard_ReadLineBuffer& myBuffer;
+  };
+
+  //! Reads lines in place from the file content kept in memory (e.g. memory-mapped file).
+  //! Returned lines are not null-terminated, except the last line of data
+  //! not followed by end of line symbol, which is copied into an internal buffer.
+  class MemoryLineReader
   {
-    if (GETPOS(theStream.tellg()) > aProgressPos)
+  public:
+
+    MemoryLineReader (const char* theData, size_t theDataLen, size_t& thePos)
+    : myData (theData), myDataLen (theDataLen), myPos (thePos) {}
+
+    //! Returns the next line and its end (excluding end of line symbols), or NULL at end of data.
+    const char* ReadLine (const char*& theLineEnd)
     {
-      aPS.Next();
-      aProgressPos += aStepB;
+      if (myPos >= myDataLen)
+      {
+        return NULL;
+      }
+
+      const char* aLine = myData + myPos;
+      const char* aNext = (const char* )::memchr (aLine, '\n', myDataLen - myPos);
+      if (aNext == NULL)
+      {
+        myLastLine.assign (aLine, myData + myDataLen);
+        myLastLine.push_back ('\0');
+        myPos = myDataLen;
+        theLineEnd = &myLastLine.back();
+        return &myLastLine.front();
+      }
+
+      myPos = size_t(aNext - myData) + 1;
+      theLineEnd = (aNext > aLine && aNext[-1] == '\r') ? aNext - 1 : aNext;
+      return aLine;
     }
 
-    aLine = theBuffer.ReadLine (theStream, aLineLen); // "facet normal nx ny nz"
-    if (aLine == NULL)
+    //! Reads coordinates of the vertex from the line.
+    bool ReadVertex (const char* theLine, const char* theLineEnd, gp_XYZ& theVertex) const
     {
-      Message::SendFail ("Error: premature end of file");
-      return false;
+      return ::ReadVertex (theLine, theLineEnd, theVertex.ChangeCoord (1), theVertex.ChangeCoord (2), theVertex.ChangeCoord (3));
     }
-    if (str_starts_with (aLine, "endsolid", 8))
+
+    //! Returns current position within data.
+    int64_t Position() const { return (int64_t )myPos; }
+
+  private:
+    const char*       myData;
+    size_t            myDataLen;
+    size_t&           myPos;
+    std::vector<char> myLastLine;
+  };
+
+  //! Reads lines by blocks using another line reader, and decodes vertex records of each block
+  //! concurrently in advance, see RWStl_Reader::SetParallel().
+  //! A block ends after "endsolid" keyword, so that no line of the next solid is read.
+  template<class LineReader_T>
+  class BlockLineReader
+  {
+  public:
+
+    //! The length of block of lines (in bytes)
+    static const size_t THE_BLOCK_SIZE = 4 * 1024 * 1024;
+
+    //! The number of lines within the block decoded by one task
+    static const int THE_TASK_NB_LINES = 4096;
+
+  public:
+
+    BlockLineReader (LineReader_T& theLines) : myLines (theLines), myLineIter (0) {}
+
+    //! Returns the next null-terminated line and its end, or NULL at end of data.
+    const char* ReadLine (const char*& theLineEnd)
     {
-      // end of STL code
-      break;
+      if (myLineIter >= myLineStarts.size()
+      && !readBlock())
+      {
+        return NULL;
+      }
+
+      const size_t aLineIndex = myLineIter++;
+      theLineEnd = &myText[myLineEnds[aLineIndex]];
+      return &myText[myLineStarts[aLineIndex]];
     }
-    if (!str_starts_with (aLine, "facet", 5))
+
+    //! Reads coordinates of the vertex from the line returned last by ReadLine();
+    //! the coordinates decoded in advance are used when available.
+    bool ReadVertex (const char* theLine, const char* theLineEnd, gp_XYZ& theVertex) const
     {
-      Message::SendFail (TCollection_AsciiString ("Error: unexpected format of facet at line ") + (aNbLine + 1));
-      return false;
+      const DecodedVertex& aVertex = myVertices[myLineIter - 1];
+      if (aVertex.IsDecoded)
+      {
+        theVertex = aVertex.XYZ;
+        return aVertex.IsValid;
+      }
+      return myLines.ReadVertex (theLine, theLineEnd, theVertex);
     }
 
-    aLine = theBuffer.ReadLine (theStream, aLineLen);  // "outer loop"
-    if (aLine == NULL || !str_starts_with (aLine, "outer", 5))
+    //! Returns current position of the underlying reader.
+    int64_t Position() { return myLines.Position(); }
+
+  private:
+
+    //! Reads the next block of lines and decodes its vertex records.
+    bool readBlock()
     {
-      Message::SendFail (TCollection_AsciiString ("Error: unexpected format of facet at line ") + (aNbLine + 1));
+      myText.clear();
+      myLineStarts.clear();
+      myLineEnds.clear();
+      myLineIter = 0;
+      const char* aLineEnd = NULL;
+      while (myText.size() < THE_BLOCK_SIZE)
+      {
+        const char* aLine = myLines.ReadLine (aLineEnd);
+        if (aLine == NULL)
+        {
+          break;
+        }
+
+        myLineStarts.push_back (myText.size());
+        myText.insert (myText.end(), aLine, aLineEnd);
+        myLineEnds.push_back (myText.size());
+        myText.push_back ('\0');
+        if (str_starts_with (aLine, aLineEnd, "endsolid", 8))
+        {
+          break;
+        }
+      }
+      if (myLineStarts.empty())
+      {
+        return false;
+      }
+
+      const int aNbLines = (int )myLineStarts.size();
+      myVertices.assign (aNbLines, DecodedVertex());
+      OSD_Parallel::For (0, (aNbLines + THE_TASK_NB_LINES - 1) / THE_TASK_NB_LINES, [this, aNbLines](int theTaskIndex)
+      {
+        const int aLineTo = std::min ((theTaskIndex + 1) * THE_TASK_NB_LINES, aNbLines);
+        for (int aLineIter = theTaskIndex * THE_TASK_NB_LINES; aLineIter < aLineTo; ++aLineIter)
+        {
+          const char* aLine    = &myText[myLineStarts[aLineIter]];
+          const char* aLineEnd = &myText[myLineEnds[aLineIter]];
+          if (str_starts_with (aLine, aLineEnd, "vertex", 6))
+          {
+            DecodedVertex& aVertex = myVertices[aLineIter];
+            aVertex.IsValid   = myLines.ReadVertex (aLine, aLineEnd, aVertex.XYZ);
+            aVertex.IsDecoded = true;
+          }
+        }
+      });
+      return true;
+    }
+
+  private:
+
+    //! Vertex coordinates decoded in advance.
+    struct DecodedVertex
+    {
+      gp_XYZ XYZ;
+      bool   IsDecoded;
+      bool   IsValid;
+
+      DecodedVertex() : IsDecoded (false), IsValid (false) {}
+    };
+
+  private:
+    LineReader_T&              myLines;      //!< underlying line reader
+    std::vector<char>          myText;       //!< null-terminated lines of the block
+    std::vector<size_t>        myLineStarts; //!< offsets of lines within the block
+    std::vector<size_t>        myLineEnds;   //!< offsets of line ends within the block
+    std::vector<DecodedVertex> myVertices;   //!< vertices decoded in advance, per line
+    size_t                     myLineIter;   //!< index of the next line to return
+  };
+
+  //! Reads Ascii STL data using specified line reader, see RWStl_Reader::ReadAscii().
+  template<class LineReader_T>
+  static bool readAsciiLines (RWStl_Reader* theReader,
+                              LineReader_T& theLines,
+                              const int64_t theUntilPos,
+                              const Message_ProgressRange& theProgress)
+  {
+    const int64_t aStartPos = theLines.Position();
+    const char* aLine = NULL;
+    const char* aLineEnd = NULL;
+
+    // skip header "solid ..."
+    aLine = theLines.ReadLine (aLineEnd);
+    // skip empty lines
+    while (aLine && aLine == aLineEnd)
+    {
+      aLine = theLines.ReadLine (aLineEnd);
+    }
+    if (aLine == NULL)
+    {
+      Message::SendFail ("Error: premature end of file");
       return false;
     }
 
-    gp_XYZ aVertex[3];
-    Standard_Boolean isEOF = false;
-    for (Standard_Integer i = 0; i < 3; i++)
+    MergeNodeTool aMergeTool (theReader);
+    aMergeTool.SetMergeAngle (theReader->MergeAngle());
+    aMergeTool.SetMergeTolerance (theReader->MergeTolerance());
+
+    Standard_CLocaleSentry::clocale_t aLocale = Standard_CLocaleSentry::GetCLocale();
+    (void)aLocale; // to avoid warning on GCC where it is actually not used
+    SAVE_TL() // for GCC only, set C locale globally
+
+    // report progress every 1 MiB of read data
+    const int aStepB = 1024 * 1024;
+    const Standard_Integer aNbSteps = 1 + Standard_Integer((theUntilPos - aStartPos) / aStepB);
+    Message_ProgressScope aPS (theProgress, "Reading text STL file", aNbSteps);
+    int64_t aProgressPos = aStartPos + aStepB;
+    int aNbLine = 1;
+
+    while (aPS.More())
     {
-      aLine = theBuffer.ReadLine (theStream, aLineLen);
+      if (theLines.Position() > aProgressPos)
+      {
+        aPS.Next();
+        aProgressPos += aStepB;
+      }
+
+      aLine = theLines.ReadLine (aLineEnd); // "facet normal nx ny nz"
       if (aLine == NULL)
       {
-        isEOF = true;
+        Message::SendFail ("Error: premature end of file");
+        return false;
+      }
+      if (str_starts_with (aLine, aLineEnd, "endsolid", 8))
+      {
+        // end of STL code
         break;
       }
-      gp_XYZ aReadVertex;
-      if (!ReadVertex (aLine, aReadVertex.ChangeCoord (1), aReadVertex.ChangeCoord (2), aReadVertex.ChangeCoord (3)))
+      if (!str_starts_with (aLine, aLineEnd, "facet", 5))
       {
-        Message::SendFail (TCollection_AsciiString ("Error: cannot read vertex coordinates at line ") + aNbLine);
+        Message::SendFail (TCollection_AsciiString ("Error: unexpected format of facet at line ") + (aNbLine + 1));
         return false;
       }
-      aVertex[i] = aReadVertex;
-    }
 
-    // stop reading if end of file is reached;
-    // note that well-formatted file never ends by the vertex line
-    if (isEOF)
-    {
-      break;
-    }
+      aLine = theLines.ReadLine (aLineEnd);  // "outer loop"
+      if (aLine == NULL || !str_starts_with (aLine, aLineEnd, "outer", 5))
+      {
+        Message::SendFail (TCollection_AsciiString ("Error: unexpected format of facet at line ") + (aNbLine + 1));
+        return false;
+      }
 
-    aNbLine += 5;
+      gp_XYZ aVertex[3];
+      Standard_Boolean isEOF = false;
+      for (Standard_Integer i = 0; i < 3; i++)
+      {
+        aLine = theLines.ReadLine (aLineEnd);
+        if (aLine == NULL)
+        {
+          isEOF = true;
+          break;
+        }
+        gp_XYZ aReadVertex;
+        if (!theLines.ReadVertex (aLine, aLineEnd, aReadVertex))
+        {
+          Message::SendFail (TCollection_AsciiString ("Error: cannot read vertex coordinates at line ") + aNbLine);
+          return false;
+        }
+        aVertex[i] = aReadVertex;
+      }
+
+      // stop reading if end of file is reached;
+      // note that well-formatted file never ends by the vertex line
+      if (isEOF)
+      {
+        break;
+      }
+
+      aNbLine += 5;
 
-    // add triangle
-    aMergeTool.AddTriangle (aVertex);
+      // add triangle
+      aMergeTool.AddTriangle (aVertex);
 
-    theBuffer.ReadLine (theStream, aLineLen); // skip "endloop"
-    theBuffer.ReadLine (theStream, aLineLen); // skip "endfacet"
+      theLines.ReadLine (aLineEnd); // skip "endloop"
+      theLines.ReadLine (aLineEnd); // skip "endfacet"
+
+      aNbLine += 2;
+    }
 
-    aNbLine += 2;
+    return aPS.More();
   }
+}
 
-  return aPS.More();
+//==============================================================================
+//function : ReadAscii
+//purpose  :
+//==============================================================================
+Standard_Boolean RWStl_Reader::ReadAscii (Standard_IStream& theStream,
+                                          Standard_ReadLineBuffer& theBuffer,
+                                          const std::streampos theUntilPos,
+                                          const Message_ProgressRange& theProgress)
+{
+  // use method seekpos() to get true 64-bit offset to enable
+  // handling of large files (VS 2010 64-bit)
+  StreamLineReader aLines (theStream, theBuffer);
+  if (myToParallel)
+  {
+    BlockLineReader<StreamLineReader> aBlockLines (aLines);
+    return readAsciiLines (this, aBlockLines, GETPOS(theUntilPos), theProgress);
+  }
+  return readAsciiLines (this, aLines, GETPOS(theUntilPos), theProgress);
+}
+
+//==============================================================================
+//function : ReadAscii
+//purpose  :
+//==============================================================================
+Standard_Boolean RWStl_Reader::ReadAscii (const char*  theData,
+                                          const size_t theDataLen,
+                                          size_t&      thePos,
+                                          const Message_ProgressRange& theProgress)
+{
+  MemoryLineReader aLines (theData, theDataLen, thePos);
+  if (myToParallel)
+  {
+    BlockLineReader<MemoryLineReader> aBlockLines (aLines);
+    return readAsciiLines (this, aBlockLines, (int64_t )theDataLen, theProgress);
+  }
+  return readAsciiLines (this, aLines, (int64_t )theDataLen, theProgress);
 }
 
 //==============================================================================
@@ -477,3 +806,56 @@ Standard_Boolean RWStl_Reader::ReadBinary (Standard_IStream& theStream,
 
   return aPS.More();
 }
+
+//==============================================================================
+//function : ReadBinary
+//purpose  :
+//==============================================================================
+Standard_Boolean RWStl_Reader::ReadBinary (const char*  theData,
+                                           const size_t theDataLen,
+                                           size_t&      thePos,
+                                           const Message_ProgressRange& theProgress)
+{
+  if (theDataLen < thePos + THE_STL_HEADER_SIZE)
+  {
+    Message::SendFail ("Error: Corrupted binary STL file");
+    return false;
+  }
+
+  // number of facets is stored as 32-bit integer at position 80
+  int32_t aNbFacetsInHeader = 0;
+  memcpy (&aNbFacetsInHeader, theData + thePos + 80, sizeof(int32_t));
+  const Standard_Integer aNbFacets = aNbFacetsInHeader;
+  thePos += THE_STL_HEADER_SIZE;
+
+  MergeNodeTool aMergeTool (this, aNbFacets);
+  aMergeTool.SetMergeAngle (myMergeAngle);
+  aMergeTool.SetMergeTolerance (myMergeTolearance);
+
+  Message_ProgressScope aPS (theProgress, "Reading binary STL file", aNbFacets);
+
+  // normal + 3 nodes + 2 extra bytes
+  const size_t aVec3Size    = sizeof(float) * 3;
+  const size_t aFaceDataLen = aVec3Size * 4 + 2;
+  for (Standard_Integer aNbFacetRead = 0; aNbFacetRead < aNbFacets && aPS.More();
+       ++aNbFacetRead, thePos += aFaceDataLen, aPS.Next())
+  {
+    if (theDataLen - thePos < aFaceDataLen)
+    {
+      Message::SendFail ("Error: binary STL read failed");
+      return false;
+    }
+
+    // get points directly from the data
+    const char* aFacetPtr = theData + thePos;
+    gp_XYZ aTriNodes[3] =
+    {
+      readStlFloatVec3 (aFacetPtr + aVec3Size),
+      readStlFloatVec3 (aFacetPtr + aVec3Size * 2),
+      readStlFloatVec3 (aFacetPtr + aVec3Size * 3)
+    };
+    aMergeTool.AddTriangle (aTriNodes);
+  }
+
+  return aPS.More();
+}
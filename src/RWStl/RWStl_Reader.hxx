@@ -48,6 +48,14 @@ public:
   Standard_EXPORT Standard_Boolean Read (const char* theFile,
                                          const Message_ProgressRange& theProgress);
 
+  //! Reads STL data (either binary or Ascii) from the file content kept in memory (e.g. memory-mapped file).
+  //! The data is parsed in place, without copying it into intermediate buffers.
+  //! Multi-domain data is supported in the same way as by Read() from file.
+  //! Returns true if success, false on error or user break.
+  Standard_EXPORT Standard_Boolean Read (const char*  theData,
+                                         const size_t theDataLen,
+                                         const Message_ProgressRange& theProgress);
+
   //! Guess whether the stream is an Ascii STL file, by analysis of the first bytes (~200).
   //! If the stream does not support seekg() then the parameter isSeekgAvailable should
   //! be passed as 'false', in this case the function attempts to put back the read symbols
@@ -56,6 +64,11 @@ public:
   Standard_EXPORT Standard_Boolean IsAscii (Standard_IStream& theStream,
                                             const bool isSeekgAvailable);
 
+  //! Guess whether the data kept in memory is an Ascii STL file, by analysis of the first bytes.
+  //! Returns true if the data seems to contain Ascii STL.
+  Standard_EXPORT Standard_Boolean IsAscii (const char*  theData,
+                                            const size_t theDataLen);
+
   //! Reads STL data from binary stream.
   //! The stream must be opened in binary mode.
   //! Stops after reading the number of triangles recorded in the file header.
@@ -75,6 +88,24 @@ public:
                                               const std::streampos theUntilPos,
                                               const Message_ProgressRange& theProgress);
 
+  //! Reads binary STL data from the memory buffer starting at position thePos.
+  //! Stops after reading the number of triangles recorded in the header;
+  //! on return, thePos points to the data following the last read triangle.
+  //! Returns true if success, false on error or user break.
+  Standard_EXPORT Standard_Boolean ReadBinary (const char*  theData,
+                                               const size_t theDataLen,
+                                               size_t&      thePos,
+                                               const Message_ProgressRange& theProgress);
+
+  //! Reads Ascii STL data from the memory buffer starting at position thePos.
+  //! Reading stops at the end of data, or when keyword "endsolid" is found;
+  //! on return, thePos points to the data following the last read line.
+  //! Returns true if success, false on error or user break.
+  Standard_EXPORT Standard_Boolean ReadAscii (const char*  theData,
+                                              const size_t theDataLen,
+                                              size_t&      thePos,
+                                              const Message_ProgressRange& theProgress);
+
 public:
 
   //! Callback function to be implemented in descendant.
@@ -103,10 +134,20 @@ public:
   //! Set linear merge tolerance.
   void SetMergeTolerance (double theTolerance) { myMergeTolearance = theTolerance; }
 
+  //! Return TRUE if multithreaded decoding of Ascii STL data is allowed; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup multithreaded decoding of Ascii STL data.
+  //! Lines are read by blocks, vertex records of a block are decoded concurrently
+  //! and then passed to the interface methods in the original order,
+  //! so that the result is the same as in sequential mode.
+  void SetParallel (bool theToParallel) { myToParallel = theToParallel; }
+
 protected:
 
   Standard_Real myMergeAngle;
   Standard_Real myMergeTolearance;
+  bool          myToParallel;
 
 };
 
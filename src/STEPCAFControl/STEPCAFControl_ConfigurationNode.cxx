@@ -116,6 +116,14 @@ bool STEPCAFControl_ConfigurationNode::Load(const Handle(DE_ConfigurationContext
     theResource->BooleanVal("read.layer", InternalParameters.ReadLayer, aScope);
   InternalParameters.ReadProps =
     theResource->BooleanVal("read.props", InternalParameters.ReadProps, aScope);
+  InternalParameters.ReadParallelParse =
+    theResource->BooleanVal("read.parallel.parse", InternalParameters.ReadParallelParse, aScope);
+  InternalParameters.ReadParallelEntities =
+    theResource->BooleanVal("read.parallel.entities", InternalParameters.ReadParallelEntities, aScope);
+  InternalParameters.ReadParallelTransfer =
+    theResource->BooleanVal("read.parallel.transfer", InternalParameters.ReadParallelTransfer, aScope);
+  InternalParameters.ReadNbThreads =
+    theResource->IntegerVal("read.nbthreads", InternalParameters.ReadNbThreads, aScope);
 
   InternalParameters.WritePrecisionMode = (StepData_ConfParameters::WriteMode_PrecisionMode)
     theResource->IntegerVal("write.precision.mode", InternalParameters.WritePrecisionMode, aScope);
@@ -151,6 +159,8 @@ bool STEPCAFControl_ConfigurationNode::Load(const Handle(DE_ConfigurationContext
     theResource->BooleanVal("write.props", InternalParameters.WriteProps, aScope);
   InternalParameters.WriteModelType = (STEPControl_StepModelType)
     theResource->IntegerVal("write.model.type", InternalParameters.WriteModelType, aScope);
+  InternalParameters.WriteShortestReal =
+    theResource->BooleanVal("write.real.shortest", InternalParameters.WriteShortestReal, aScope);
 
   return true;
 }
@@ -370,6 +380,30 @@ TCollection_AsciiString STEPCAFControl_ConfigurationNode::Save() const
   aResult += aScope + "read.props :\t " + InternalParameters.ReadProps + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Defines whether the DATA section of the file is split into parts parsed in parallel threads\n";
+  aResult += "!Default value: -. Available values: \"-\", \"+\"\n";
+  aResult += aScope + "read.parallel.parse :\t " + InternalParameters.ReadParallelParse + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Defines whether the parameters of entities are read in parallel threads\n";
+  aResult += "!Default value: -. Available values: \"-\", \"+\"\n";
+  aResult += aScope + "read.parallel.entities :\t " + InternalParameters.ReadParallelEntities + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Defines whether the shapes of solid representation items are translated in parallel threads\n";
+  aResult += "!Default value: -. Available values: \"-\", \"+\"\n";
+  aResult += aScope + "read.parallel.transfer :\t " + InternalParameters.ReadParallelTransfer + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Defines the number of threads used by parallel reading modes\n";
+  aResult += "!Default value: 0 (default number of threads). Available values: any non-negative integer\n";
+  aResult += aScope + "read.nbthreads :\t " + InternalParameters.ReadNbThreads + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write Parameters:\n";
   aResult += "!\n";
@@ -480,6 +514,12 @@ TCollection_AsciiString STEPCAFControl_ConfigurationNode::Save() const
   aResult += aScope + "write.model.type :\t " + InternalParameters.WriteModelType + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Defines whether reals are written with the shortest text giving back the same value\n";
+  aResult += "!Default value: -. Available values: \"-\", \"+\"\n";
+  aResult += aScope + "write.real.shortest :\t " + InternalParameters.WriteShortestReal + "\n";
+  aResult += "!\n";
+
   aResult += "!*****************************************************************************\n";
 
   return aResult;
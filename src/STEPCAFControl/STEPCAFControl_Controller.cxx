@@ -39,13 +39,12 @@ STEPCAFControl_Controller::STEPCAFControl_Controller ()
 
 Standard_Boolean STEPCAFControl_Controller::Init ()
 {
+  // the lock is held until the registration is complete, so that
+  // another thread cannot use the controller before
   static Standard_Mutex theMutex;
-  {
-    Standard_Mutex::Sentry aSentry(theMutex);
-    static Standard_Boolean inic = Standard_False;
-    if (inic) return Standard_True;
-    inic = Standard_True;
-  }
+  Standard_Mutex::Sentry aSentry(theMutex);
+  static Standard_Boolean inic = Standard_False;
+  if (inic) return Standard_True;
   // self-registering
   Handle(STEPCAFControl_Controller) STEPCTL = new STEPCAFControl_Controller;
   // do XSAlgo::Init, cause it does not called before.
@@ -73,5 +72,6 @@ Standard_Boolean STEPCAFControl_Controller::Init ()
   Interface_Static::Init   ("stepcaf", "read.stepcaf.subshapes.name", '&', "eval On");  // 1
   Interface_Static::SetIVal("read.stepcaf.subshapes.name", 0); // Disabled by default
 
+  inic = Standard_True;
   return Standard_True;
 }
@@ -300,6 +300,15 @@ TCollection_AsciiString STEPCAFControl_Provider::GetVendor() const
   return TCollection_AsciiString("OCC");
 }
 
+//=======================================================================
+// function : InitConcurrentReading
+// purpose  :
+//=======================================================================
+void STEPCAFControl_Provider::InitConcurrentReading()
+{
+  STEPCAFControl_Controller::Init();
+}
+
 //=======================================================================
 // function : personizeWS
 // purpose  :
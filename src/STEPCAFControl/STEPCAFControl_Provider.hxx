@@ -133,6 +133,15 @@ public:
   //! @return provider's vendor name
   Standard_EXPORT virtual TCollection_AsciiString GetVendor() const Standard_OVERRIDE;
 
+  //! Returns true: files can be read concurrently by several providers
+  virtual Standard_Boolean CanReadConcurrently() const Standard_OVERRIDE
+  {
+    return Standard_True;
+  }
+
+  //! Registers the STEP controller and its static parameters
+  Standard_EXPORT virtual void InitConcurrentReading() Standard_OVERRIDE;
+
  private:
 
   //! Personizes work session with current format.
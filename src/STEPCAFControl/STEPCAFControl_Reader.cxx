@@ -592,6 +592,11 @@ Standard_Boolean STEPCAFControl_Reader::Transfer (STEPControl_Reader &reader,
     for (i = 1; i <= num && aPS.More(); i++)
       reader.TransferOneRoot (i, aPS.Next());
   }
+  // release the solids translated in parallel and not taken by the transfer
+  Handle(STEPControl_ActorRead) anActorRead =
+    Handle(STEPControl_ActorRead)::DownCast (reader.WS()->TransferReader()->Actor());
+  if (!anActorRead.IsNull())
+    anActorRead->ReleaseSolids();
   if (aPSRoot.UserBreak())
     return Standard_False;
 
@@ -392,6 +392,7 @@ Standard_Boolean STEPCAFControl_Writer::Transfer(const Handle(TDocStd_Document)&
                                                  const Message_ProgressRange& theProgress)
 {
   const Handle(StepData_StepModel) aModel = Handle(StepData_StepModel)::DownCast(myWriter.WS()->Model());
+  Interface_StaticSnapshot::Sentry aParamsSentry (myWriter.WS()->Parameters());
   aModel->InternalParameters.InitFromStatic();
   return Transfer(theDoc, aModel->InternalParameters, theMode, theMulti, theProgress);
 }
@@ -429,6 +430,7 @@ Standard_Boolean STEPCAFControl_Writer::Transfer(const TDF_Label& theLabel,
                                                  const Message_ProgressRange& theProgress)
 {
   const Handle(StepData_StepModel) aModel = Handle(StepData_StepModel)::DownCast(myWriter.WS()->Model());
+  Interface_StaticSnapshot::Sentry aParamsSentry (myWriter.WS()->Parameters());
   aModel->InternalParameters.InitFromStatic();
   return Transfer(theLabel, aModel->InternalParameters, theMode, theIsMulti, theProgress);
 }
@@ -466,6 +468,7 @@ Standard_Boolean STEPCAFControl_Writer::Transfer(const TDF_LabelSequence& theLab
                                                  const Message_ProgressRange& theProgress)
 {
   const Handle(StepData_StepModel) aModel = Handle(StepData_StepModel)::DownCast(myWriter.WS()->Model());
+  Interface_StaticSnapshot::Sentry aParamsSentry (myWriter.WS()->Parameters());
   aModel->InternalParameters.InitFromStatic();
   return Transfer(theLabels, aModel->InternalParameters, theMode, theIsMulti, theProgress);
 }
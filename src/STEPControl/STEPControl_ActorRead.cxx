@@ -23,13 +23,19 @@
 #include <gp_Ax3.hxx>
 #include <gp_Trsf.hxx>
 #include <HeaderSection_FileName.hxx>
+#include <Interface_Check.hxx>
 #include <Interface_EntityIterator.hxx>
 #include <Interface_Graph.hxx>
 #include <Interface_InterfaceModel.hxx>
 #include <Interface_Macros.hxx>
 #include <Interface_Static.hxx>
+#include <Interface_StaticSnapshot.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Map.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <OSD_Timer.hxx>
 #include <Precision.hxx>
 #include <Standard_ErrorHandler.hxx>
@@ -88,6 +94,7 @@
 #include <StepShape_ShapeDefinitionRepresentation.hxx>
 #include <StepShape_ShapeRepresentation.hxx>
 #include <StepShape_ShellBasedSurfaceModel.hxx>
+#include <StepShape_TopologicalRepresentationItem.hxx>
 #include <StepVisual_TriangulatedFace.hxx>
 #include <StepVisual_TriangulatedSurfaceSet.hxx>
 #include <StepVisual_TessellatedShell.hxx>
@@ -115,6 +122,7 @@
 #include <TopTools_MapOfShape.hxx>
 #include <Transfer_Binder.hxx>
 #include <Transfer_TransientProcess.hxx>
+#include <Transfer_VoidBinder.hxx>
 #include <TransferBRep.hxx>
 #include <TransferBRep_ShapeBinder.hxx>
 #include <UnitsMethods.hxx>
@@ -204,8 +212,130 @@ namespace {
   // The better way is to pass this information via binder or via TopoDS_Shape itself, however,
   // this is very specific info to do so...
   Standard_Boolean NM_DETECTED = Standard_False;
+
+  //! Returns True if both sets of unit factors are equal
+  static Standard_Boolean isSameFactors (const StepData_Factors& theFactors1,
+                                         const StepData_Factors& theFactors2)
+  {
+    return theFactors1.LengthFactor()     == theFactors2.LengthFactor()
+        && theFactors1.PlaneAngleFactor() == theFactors2.PlaneAngleFactor()
+        && theFactors1.SolidAngleFactor() == theFactors2.SolidAngleFactor()
+        && theFactors1.CascadeUnit()      == theFactors2.CascadeUnit();
+  }
+
+  //! Marks the solids sharing topological items (shells, faces, edges, vertices) with other
+  //! solids: the results of these items depend on the order of translation of the solids
+  static void markSharedSolids (const Interface_Graph& theGraph,
+                                const NCollection_Vector<Handle(Standard_Transient)>& theSolids,
+                                NCollection_Array1<Standard_Boolean>& theIsShared)
+  {
+    // number of the first solid containing the entity
+    NCollection_Array1<Standard_Integer> anOwners(1, Max(theGraph.Size(), 1));
+    anOwners.Init(0);
+    NCollection_Vector<Handle(Standard_Transient)> aStack;
+    for (Standard_Integer aSolidIter = 0; aSolidIter < theSolids.Length(); ++aSolidIter)
+    {
+      aStack.Append(theSolids(aSolidIter));
+      while (!aStack.IsEmpty())
+      {
+        const Handle(Standard_Transient) anEnt = aStack.Last();
+        aStack.EraseLast();
+        for (Interface_EntityIterator aSubIter = theGraph.Shareds(anEnt); aSubIter.More(); aSubIter.Next())
+        {
+          const Handle(Standard_Transient)& aSub = aSubIter.Value();
+          const Standard_Integer aNum = theGraph.EntityNumber(aSub);
+          if (aNum == 0 || !aSub->IsKind(STANDARD_TYPE(StepShape_TopologicalRepresentationItem)))
+            continue;
+          // the items of another solid have been explored by it
+          Standard_Integer& anOwner = anOwners(aNum);
+          if (anOwner == 0)
+          {
+            anOwner = aSolidIter + 1;
+            aStack.Append(aSub);
+          }
+          else if (anOwner != aSolidIter + 1)
+          {
+            theIsShared(anOwner - 1) = Standard_True;
+            theIsShared(aSolidIter) = Standard_True;
+          }
+        }
+      }
+    }
+  }
 }
 
+//=======================================================================
+//class    : STEPControl_ActorRead_SolidTranslator
+//purpose  : Functor translating solid representation items in parallel
+//=======================================================================
+
+class STEPControl_ActorRead_SolidTranslator
+{
+public:
+
+  STEPControl_ActorRead_SolidTranslator (const NCollection_Vector<STEPControl_ActorRead::SolidItem*>& theSolids,
+                                         const Handle(StepData_StepModel)& theModel)
+  : mySolids (theSolids), myModel (theModel), myParameters (Interface_StaticSnapshot::Active()) {}
+
+  //! Translates and fixes the solid <theIndex> with its own transient process;
+  //! the solid is left for sequential translation if an exception is raised
+  void operator() (int theThreadIndex, int theIndex) const
+  {
+    (void )theThreadIndex;
+    Interface_StaticSnapshot::Sentry aParamsSentry (myParameters);
+    STEPControl_ActorRead::SolidItem& aSolid = *mySolids.Value (theIndex);
+    Handle(Transfer_TransientProcess) aTP = new Transfer_TransientProcess (100);
+    aTP->SetModel (myModel);
+    aTP->SetTraceLevel (0);
+
+    const Handle(Standard_Transient)& anItem = aSolid.Item;
+    StepToTopoDS_Builder aBuilder;
+    aBuilder.SetPrecision (aSolid.Precision);
+    aBuilder.SetMaxTol (aSolid.MaxTol);
+    try
+    {
+      OCC_CATCH_SIGNALS
+      if (anItem->IsKind (STANDARD_TYPE(StepShape_FacetedBrep)))
+      {
+        aBuilder.Init (Handle(StepShape_FacetedBrep)::DownCast (anItem), aTP, aSolid.Factors);
+      }
+      else if (anItem->IsKind (STANDARD_TYPE(StepShape_BrepWithVoids)))
+      {
+        aBuilder.Init (Handle(StepShape_BrepWithVoids)::DownCast (anItem), aTP, aSolid.Factors);
+      }
+      else if (anItem->IsKind (STANDARD_TYPE(StepShape_ManifoldSolidBrep)))
+      {
+        aBuilder.Init (Handle(StepShape_ManifoldSolidBrep)::DownCast (anItem), aTP, aSolid.Factors);
+      }
+      else
+      {
+        aBuilder.Init (Handle(StepShape_FacetedBrepAndBrepWithVoids)::DownCast (anItem), aTP, aSolid.Factors);
+      }
+
+      if (aBuilder.IsDone())
+      {
+        Handle(Standard_Transient) anInfo;
+        aSolid.Shape = XSAlgo::AlgoContainer()->ProcessShape (aBuilder.Value(), aSolid.Precision, aSolid.MaxTol,
+                                                              "read.step.resource.name",
+                                                              "read.step.sequence", anInfo);
+        XSAlgo::AlgoContainer()->MergeTransferInfo (aTP, anInfo, 1);
+      }
+    }
+    catch (Standard_Failure const&)
+    {
+      aSolid.Shape.Nullify();
+      return;
+    }
+    aSolid.TP = aTP;
+  }
+
+private:
+
+  const NCollection_Vector<STEPControl_ActorRead::SolidItem*>& mySolids;
+  Handle(StepData_StepModel) myModel;
+  Handle(Interface_StaticSnapshot) myParameters; //!< parameters active in the calling thread
+};
+
 // ============================================================================
 // Method  : STEPControl_ActorRead::STEPControl_ActorRead  ()    
 // Purpose : Empty constructor
@@ -333,6 +463,12 @@ Handle(Transfer_Binder)  STEPControl_ActorRead::Transfer
     }
   }
   // [END] Get version of preprocessor (to detect I-Deas case) (ssv; 23.11.2010)
+  // translate the solids of the whole model at once, in parallel threads
+  if (aStepModel->InternalParameters.ReadParallelTransfer
+   && mySolidsModel != aStepModel)
+  {
+    TransferSolids(TP, aLocalFactors, aStepModel->InternalParameters.ReadNbThreads);
+  }
   Standard_Boolean aTrsfUse = (aStepModel->InternalParameters.ReadRootTransformation == 1);
   return TransferShape(start, TP, aLocalFactors, Standard_True, aTrsfUse, theProgress);
 }
@@ -1438,6 +1574,15 @@ Handle(TransferBRep_ShapeBinder) STEPControl_ActorRead::TransferEntity
   myShapeBuilder.SetPrecision(myPrecision);
   myShapeBuilder.SetMaxTol(myMaxTol);
 
+  // take the solid translated by TransferSolids() in the same context
+  if (isManifold && !mySolids.IsEmpty() && takeSolid(start, TP, aLocalFactors, shbinder))
+  {
+    if ( oldSRContext.IsNull() && ! mySRContext.IsNull() ) //:S4136
+      PrepareUnits ( oldSRContext, TP, aLocalFactors);
+    TP->Bind(start, shbinder);
+    return shbinder;
+  }
+
   // Start progress scope (no need to check if progress exists -- it is safe)
   Message_ProgressScope aPS(theProgress, "Transfer stage", isManifold ? 2 : 1);
   const Standard_Boolean aReadTessellatedWhenNoBRepOnly = (aStepModel->InternalParameters.ReadTessellated == 2);
@@ -2090,4 +2235,160 @@ void STEPControl_ActorRead::computeIDEASClosings(const TopoDS_Compound& comp,
 void STEPControl_ActorRead::SetModel(const Handle(Interface_InterfaceModel)& theModel)
 {
   myModel = theModel;
+  ReleaseSolids();
+}
+
+//=======================================================================
+//function : ReleaseSolids
+//purpose  : 
+//=======================================================================
+
+void STEPControl_ActorRead::ReleaseSolids()
+{
+  mySolids.Clear(Standard_True);
+  mySolidsModel.Nullify();
+}
+
+//=======================================================================
+//function : TransferSolids
+//purpose  : 
+//=======================================================================
+
+void STEPControl_ActorRead::TransferSolids(const Handle(Transfer_TransientProcess)& TP,
+                                           const StepData_Factors& theLocalFactors,
+                                           const Standard_Integer theNbThreads)
+{
+  ReleaseSolids();
+  Handle(StepData_StepModel) aStepModel = Handle(StepData_StepModel)::DownCast(TP->Model());
+  if (aStepModel.IsNull())
+    return;
+  // the model is held, so that the solids are never taken for another model
+  mySolidsModel = aStepModel;
+
+  // Collect the solids with the units and precision of their shape representations;
+  // warnings on units are not kept here, they are added by the sequential transfer
+  Handle(Transfer_TransientProcess) aUnitsTP = new Transfer_TransientProcess(100);
+  aUnitsTP->SetModel(aStepModel);
+  aUnitsTP->SetTraceLevel(0);
+  const Handle(StepRepr_Representation) anOldSRContext = mySRContext;
+  const Standard_Real anOldPrecision = myPrecision;
+  const Standard_Real anOldMaxTol = myMaxTol;
+  const Standard_Boolean isNMMode = aStepModel->InternalParameters.ReadNonmanifold != 0;
+  NCollection_Vector<SolidItem> aCandidates;
+  NCollection_Vector<Handle(Standard_Transient)> aCandidateItems;
+  NCollection_Map<Handle(Standard_Transient)> aCandidatesMap;
+  const Standard_Integer aNbEntities = aStepModel->NbEntities();
+  for (Standard_Integer anEntIter = 1; anEntIter <= aNbEntities; ++anEntIter)
+  {
+    Handle(StepShape_ShapeRepresentation) aSR =
+      Handle(StepShape_ShapeRepresentation)::DownCast(aStepModel->Value(anEntIter));
+    // items of non-manifold representations are not fixed separately
+    if (aSR.IsNull() || aSR->Items().IsNull()
+     || (isNMMode && aSR->IsKind(STANDARD_TYPE(StepShape_NonManifoldSurfaceShapeRepresentation))))
+      continue;
+
+    StepData_Factors aLocalFactors = theLocalFactors;
+    Standard_Boolean isPrepared = Standard_False;
+    for (Standard_Integer anItemIter = 1; anItemIter <= aSR->NbItems(); ++anItemIter)
+    {
+      Handle(StepRepr_RepresentationItem) anItem = aSR->ItemsValue(anItemIter);
+      if (anItem.IsNull() || !anItem->IsKind(STANDARD_TYPE(StepShape_ManifoldSolidBrep))
+       || aCandidatesMap.Contains(anItem) || TP->IsBound(anItem))
+        continue;
+
+      if (!isPrepared)
+      {
+        PrepareUnits(aSR, aUnitsTP, aLocalFactors);
+        isPrepared = Standard_True;
+      }
+      SolidItem aSolid;
+      aSolid.Item = anItem;
+      aSolid.Factors = aLocalFactors;
+      aSolid.Precision = myPrecision;
+      aSolid.MaxTol = myMaxTol;
+      aCandidates.Append(aSolid);
+      aCandidateItems.Append(anItem);
+      aCandidatesMap.Add(anItem);
+    }
+  }
+  mySRContext = anOldSRContext;
+  myPrecision = anOldPrecision;
+  myMaxTol = anOldMaxTol;
+  if (aCandidates.IsEmpty())
+    return;
+
+  // Solids sharing topological items are left for the sequential transfer, which binds
+  // these items in the usual order; each other solid is translated by its own process
+  NCollection_Array1<Standard_Boolean> isShared(0, aCandidates.Length() - 1);
+  isShared.Init(Standard_False);
+  if (TP->HasGraph())
+  {
+    markSharedSolids(TP->Graph(), aCandidateItems, isShared);
+  }
+  else
+  {
+    markSharedSolids(Interface_Graph(aStepModel), aCandidateItems, isShared);
+  }
+  NCollection_Vector<SolidItem*> aSolids;
+  for (Standard_Integer aSolidIter = 0; aSolidIter < aCandidates.Length(); ++aSolidIter)
+  {
+    if (!isShared(aSolidIter))
+      aSolids.Append(mySolids.Bound(aCandidateItems(aSolidIter), aCandidates(aSolidIter)));
+  }
+  if (aSolids.IsEmpty())
+    return;
+
+  const Handle(OSD_ThreadPool)& aPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = theNbThreads > 0 ? theNbThreads : aPool->NbDefaultThreadsToLaunch();
+  OSD_ThreadPool::Launcher aLauncher(*aPool, Min(aNbThreads, aSolids.Length()));
+  STEPControl_ActorRead_SolidTranslator aFunctor(aSolids, aStepModel);
+  aLauncher.Perform(0, aSolids.Length(), aFunctor);
+}
+
+//=======================================================================
+//function : takeSolid
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean STEPControl_ActorRead::takeSolid(const Handle(Standard_Transient)& theItem,
+                                                  const Handle(Transfer_TransientProcess)& theTP,
+                                                  const StepData_Factors& theLocalFactors,
+                                                  Handle(TransferBRep_ShapeBinder)& theBinder)
+{
+  SolidItem* aSolid = mySolids.ChangeSeek(theItem);
+  if (aSolid == NULL)
+    return Standard_False;
+
+  // the solid is translated in another context (or has failed) : translate it again
+  const Standard_Boolean isTaken = !aSolid->TP.IsNull()
+                                && aSolid->Precision == myPrecision
+                                && aSolid->MaxTol == myMaxTol
+                                && isSameFactors(aSolid->Factors, theLocalFactors);
+  if (isTaken)
+  {
+    // binders of sub-entities, as if they were translated with <theTP>;
+    // sub-entities already translated keep their results
+    const Handle(Transfer_TransientProcess)& aSolidTP = aSolid->TP;
+    for (Standard_Integer aMapIter = 1; aMapIter <= aSolidTP->NbMapped(); ++aMapIter)
+    {
+      const Handle(Transfer_Binder)& aBinder = aSolidTP->MapItem(aMapIter);
+      if (aBinder.IsNull())
+        continue;
+      const Handle(Standard_Transient)& anEnt = aSolidTP->Mapped(aMapIter);
+      Handle(Transfer_Binder) aFormer = theTP->Find(anEnt);
+      if (aFormer.IsNull() || aFormer->DynamicType() == STANDARD_TYPE(Transfer_VoidBinder))
+        theTP->Bind(anEnt, aBinder);
+      else
+        aFormer->CCheck()->GetMessages(aBinder->Check());
+    }
+    if (!aSolid->Shape.IsNull())
+      theBinder = new TransferBRep_ShapeBinder(aSolid->Shape);
+  }
+  mySolids.UnBind(theItem);
+  if (mySolids.IsEmpty())
+  {
+    // all solids are taken : release the memory, but do not translate them again for this model
+    mySolids.Clear(Standard_True);
+  }
+  return isTaken;
 }
@@ -22,11 +22,15 @@
 
 #include <StepToTopoDS_NMTool.hxx>
 #include <Transfer_ActorOfTransientProcess.hxx>
+#include <Transfer_TransientProcess.hxx>
 #include <Standard_Integer.hxx>
 #include <TopTools_ListOfShape.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <Message_ProgressRange.hxx>
 #include <Interface_InterfaceModel.hxx>
+#include <NCollection_DataMap.hxx>
+#include <StepData_Factors.hxx>
+#include <TopoDS_Shape.hxx>
 
 class StepRepr_Representation;
 class Standard_Transient;
@@ -95,6 +99,25 @@ public:
   //! Set model
   Standard_EXPORT void SetModel(const Handle(Interface_InterfaceModel)& theModel);
 
+  //! Translates in parallel threads the shapes of all solid representation
+  //! items (ManifoldSolidBrep and its subtypes) of the model, each one with
+  //! its own transient process, in the context (units and precision) of
+  //! the shape representation containing it.
+  //! The shapes and the binders of their sub-entities are then taken by
+  //! the sequential transfer of roots, which binds them into <TP> in the
+  //! usual order, and builds assemblies, locations and instances as usual.
+  //! The solids sharing topological items with other solids are left for the
+  //! sequential transfer, so that these items are bound as without this mode.
+  //! Called by Transfer() for the first root if read.step.parallel.transfer is On.
+  Standard_EXPORT void TransferSolids (const Handle(Transfer_TransientProcess)& TP,
+                                       const StepData_Factors& theLocalFactors,
+                                       const Standard_Integer theNbThreads = 0);
+
+  //! Releases the solids translated by TransferSolids() and not taken by the transfer,
+  //! so that the next transfer of roots translates the remaining solids again.
+  //! Called at the end of transfer of roots by STEPControl_Reader and STEPCAFControl_Reader.
+  Standard_EXPORT void ReleaseSolids();
+
   //! Computes transformation defined by two axis placements (in MAPPED_ITEM
   //! or ITEM_DEFINED_TRANSFORMATION) taking into account their
   //! representation contexts (i.e. units, which may be different)
@@ -206,11 +229,36 @@ private:
 
   Standard_EXPORT void computeIDEASClosings (const TopoDS_Compound& comp, TopTools_IndexedDataMapOfShapeListOfShape& shellClosingMap);
 
+  //! Takes the shape of solid <theItem> translated by TransferSolids() if it has been
+  //! translated with the same factors and precision, and binds into <theTP> the
+  //! binders of its sub-entities. Returns False if the item has to be translated.
+  Standard_Boolean takeSolid (const Handle(Standard_Transient)& theItem,
+                              const Handle(Transfer_TransientProcess)& theTP,
+                              const StepData_Factors& theLocalFactors,
+                              Handle(TransferBRep_ShapeBinder)& theBinder);
+
+  friend class STEPControl_ActorRead_SolidTranslator;
+
+  //! Solid representation item translated by TransferSolids()
+  struct SolidItem
+  {
+    Handle(Standard_Transient)        Item;      //!< representation item
+    Handle(Transfer_TransientProcess) TP;        //!< binders of the item and its sub-entities
+    TopoDS_Shape                      Shape;     //!< resulting shape
+    StepData_Factors                  Factors;   //!< unit factors used for translation
+    Standard_Real                     Precision; //!< precision used for translation
+    Standard_Real                     MaxTol;    //!< maximal tolerance used for translation
+
+    SolidItem() : Precision (0.0), MaxTol (0.0) {}
+  };
+
   StepToTopoDS_NMTool myNMTool;
   Standard_Real myPrecision;
   Standard_Real myMaxTol;
   Handle(StepRepr_Representation) mySRContext;
   Handle(Interface_InterfaceModel) myModel;
+  NCollection_DataMap<Handle(Standard_Transient), SolidItem> mySolids;
+  Handle(Interface_InterfaceModel) mySolidsModel; //!< model for which TransferSolids() has been called
 
 };
 
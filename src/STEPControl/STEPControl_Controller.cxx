@@ -319,6 +319,37 @@ STEPControl_Controller::STEPControl_Controller ()
     Interface_Static::Init("step", "write.step.tessellated", '&', "eval OnNoBRep"); // 2
     Interface_Static::SetCVal("write.step.tessellated", "OnNoBRep");
 
+    // Parallel parsing of the DATA section: Off by default
+    Interface_Static::Init("step", "read.step.parallel.parse", 'e', "");
+    Interface_Static::Init("step", "read.step.parallel.parse", '&', "enum 0");
+    Interface_Static::Init("step", "read.step.parallel.parse", '&', "eval Off");    // 0
+    Interface_Static::Init("step", "read.step.parallel.parse", '&', "eval On");     // 1
+    Interface_Static::SetCVal("read.step.parallel.parse", "Off");
+
+    // Parallel reading of entity parameters (two-phase reading): Off by default
+    Interface_Static::Init("step", "read.step.parallel.entities", 'e', "");
+    Interface_Static::Init("step", "read.step.parallel.entities", '&', "enum 0");
+    Interface_Static::Init("step", "read.step.parallel.entities", '&', "eval Off");    // 0
+    Interface_Static::Init("step", "read.step.parallel.entities", '&', "eval On");     // 1
+    Interface_Static::SetCVal("read.step.parallel.entities", "Off");
+
+    // Parallel translation of solid representation items: Off by default
+    Interface_Static::Init("step", "read.step.parallel.transfer", 'e', "");
+    Interface_Static::Init("step", "read.step.parallel.transfer", '&', "enum 0");
+    Interface_Static::Init("step", "read.step.parallel.transfer", '&', "eval Off");    // 0
+    Interface_Static::Init("step", "read.step.parallel.transfer", '&', "eval On");     // 1
+    Interface_Static::SetCVal("read.step.parallel.transfer", "Off");
+
+    // Number of threads used by parallel reading modes: 0 means default number of threads
+    Interface_Static::Init("step", "read.step.nbthreads", 'i', "0");
+
+    // Writing of reals with the shortest text giving back the same value: Off by default
+    Interface_Static::Init("step", "write.step.real.shortest", 'e', "");
+    Interface_Static::Init("step", "write.step.real.shortest", '&', "enum 0");
+    Interface_Static::Init("step", "write.step.real.shortest", '&', "eval Off");    // 0
+    Interface_Static::Init("step", "write.step.real.shortest", '&', "eval On");     // 1
+    Interface_Static::SetCVal("write.step.real.shortest", "Off");
+
     Standard_STATIC_ASSERT((int)Resource_FormatType_CP850 - (int)Resource_FormatType_CP1250 == 18); // "Error: Invalid Codepage Enumeration"
 
     init = Standard_True;
@@ -441,6 +472,8 @@ IFSelect_ReturnStatus  STEPControl_Controller::TransferWriteShape
 
 Standard_Boolean STEPControl_Controller::Init ()
 {
+  static Standard_Mutex theMutex;
+  Standard_Mutex::Sentry aSentry(theMutex);
   static Standard_Boolean inic = Standard_False;
   if (!inic) {
     Handle(STEPControl_Controller) STEPCTL = new STEPControl_Controller;
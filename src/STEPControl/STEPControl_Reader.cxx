@@ -34,6 +34,7 @@
 #include <StepBasic_SiUnitName.hxx>
 #include <StepBasic_SolidAngleMeasureWithUnit.hxx>
 #include <STEPConstruct_UnitContext.hxx>
+#include <STEPControl_ActorRead.hxx>
 #include <STEPControl_Controller.hxx>
 #include <STEPControl_Reader.hxx>
 #include <StepData_StepModel.hxx>
@@ -107,6 +108,7 @@ IFSelect_ReturnStatus STEPControl_Reader::ReadFile(const Standard_CString filena
   if (aLibrary.IsNull()) return IFSelect_RetVoid;
   if (aProtocol.IsNull()) return IFSelect_RetVoid;
   Handle(StepData_StepModel) aStepModel = new StepData_StepModel;
+  Interface_StaticSnapshot::Sentry aParamsSentry (WS()->Parameters());
   aStepModel->InternalParameters.InitFromStatic();
   aStepModel->SetSourceCodePage(aStepModel->InternalParameters.ReadCodePage);
   IFSelect_ReturnStatus status = IFSelect_RetVoid;
@@ -144,6 +146,7 @@ IFSelect_ReturnStatus STEPControl_Reader::ReadFile(const Standard_CString filena
   if (aProtocol.IsNull()) return IFSelect_RetVoid;
   Handle(StepData_StepModel) aStepModel = new StepData_StepModel;
   aStepModel->InternalParameters = theParams;
+  Interface_StaticSnapshot::Sentry aParamsSentry (WS()->Parameters());
   aStepModel->SetSourceCodePage(aStepModel->InternalParameters.ReadCodePage);
   IFSelect_ReturnStatus status = IFSelect_RetVoid;
   try {
@@ -179,6 +182,7 @@ IFSelect_ReturnStatus STEPControl_Reader::ReadStream(const Standard_CString theN
   if (aLibrary.IsNull()) return IFSelect_RetVoid;
   if (aProtocol.IsNull()) return IFSelect_RetVoid;
   Handle(StepData_StepModel) aStepModel = new StepData_StepModel;
+  Interface_StaticSnapshot::Sentry aParamsSentry (WS()->Parameters());
   aStepModel->InternalParameters.InitFromStatic();
   aStepModel->SetSourceCodePage(aStepModel->InternalParameters.ReadCodePage);
   IFSelect_ReturnStatus status = IFSelect_RetVoid;
@@ -251,6 +255,23 @@ Standard_Boolean STEPControl_Reader::TransferRoot (const Standard_Integer num,
   return TransferOneRoot(num, theProgress);
 }
 
+//=======================================================================
+//function : TransferRoots
+//purpose  : 
+//=======================================================================
+
+Standard_Integer STEPControl_Reader::TransferRoots (const Message_ProgressRange& theProgress)
+{
+  const Standard_Integer aNbTransferred = XSControl_Reader::TransferRoots (theProgress);
+  Handle(STEPControl_ActorRead) anActor =
+    Handle(STEPControl_ActorRead)::DownCast (WS()->TransferReader()->Actor());
+  if (!anActor.IsNull())
+  {
+    anActor->ReleaseSolids();
+  }
+  return aNbTransferred;
+}
+
 //=======================================================================
 //function : NbRootsForTransfer
 //purpose  : 
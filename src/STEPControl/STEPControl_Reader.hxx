@@ -109,6 +109,11 @@ public:
   //! Same as inherited TransferOneRoot, kept for compatibility
   Standard_EXPORT Standard_Boolean TransferRoot (const Standard_Integer num = 1,
                                                  const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Translates all translatable roots and returns the number of successful translations.
+  //! Releases then the solids translated in parallel (read.step.parallel.transfer)
+  //! and not taken by the transfer.
+  Standard_EXPORT virtual Standard_Integer TransferRoots (const Message_ProgressRange& theProgress = Message_ProgressRange()) Standard_OVERRIDE;
   
   //! Determines the list of root entities from Model which are candidate for
   //! a transfer to a Shape (type of entities is PRODUCT)
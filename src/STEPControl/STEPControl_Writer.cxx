@@ -132,6 +132,7 @@ IFSelect_ReturnStatus STEPControl_Writer::Transfer
   Handle(StepData_StepModel) aStepModel = Handle(StepData_StepModel)::DownCast(thesession->Model());
   if (!aStepModel.IsNull())
   {
+    Interface_StaticSnapshot::Sentry aParamsSentry (thesession->Parameters());
     aStepModel->InternalParameters.InitFromStatic();
   }
   return Transfer(sh, mode, aStepModel->InternalParameters, compgraph, theProgress);
@@ -154,6 +155,7 @@ IFSelect_ReturnStatus STEPControl_Writer::Transfer
     default : break;
   }
   if (mws < 0) return IFSelect_RetError;    // cas non reconnu
+  Interface_StaticSnapshot::Sentry aParamsSentry (thesession->Parameters());
   thesession->TransferWriter()->SetTransferMode (mws);
   if (!Model()->IsInitializedUnit())
   {
@@ -167,7 +169,20 @@ IFSelect_ReturnStatus STEPControl_Writer::Transfer
   Handle(STEPControl_ActorWrite) ActWrite =
     Handle(STEPControl_ActorWrite)::DownCast(WS()->NormAdaptor()->ActorWrite());
   ActWrite->SetGroupMode(Handle(StepData_StepModel)::DownCast(thesession->Model())->InternalParameters.WriteAssembly);
-  return thesession->TransferWriteShape(sh, compgraph, theProgress);
+  if (!IsStreaming())
+  {
+    return thesession->TransferWriteShape(sh, compgraph, theProgress);
+  }
+
+  // the produced entities are written at once, then the transfer results
+  // are cleared to let them be released
+  IFSelect_ReturnStatus aStatus = thesession->TransferWriteShape(sh, Standard_False, theProgress);
+  thesession->TransferWriter()->Clear (0);
+  thesession->ClearData (2);
+  Handle(StepData_StepModel) aModel = Model();
+  myStreamWriter->FloatWriter().SetShortestRoundTrip (aModel->InternalParameters.WriteShortestReal);
+  myStreamWriter->SendEntities (Handle(StepData_Protocol)::DownCast (aModel->Protocol()));
+  return aStatus;
 }
 
 
@@ -177,6 +192,11 @@ IFSelect_ReturnStatus STEPControl_Writer::Transfer
 //=======================================================================
 IFSelect_ReturnStatus STEPControl_Writer::Write (const Standard_CString theFileName)
 {
+  if (IsStreaming())
+  {
+    return IFSelect_RetError;
+  }
+  Interface_StaticSnapshot::Sentry aParamsSentry (thesession->Parameters());
   return thesession->SendAll (theFileName);
 }
 
@@ -186,6 +206,10 @@ IFSelect_ReturnStatus STEPControl_Writer::Write (const Standard_CString theFileN
 //=======================================================================
 IFSelect_ReturnStatus STEPControl_Writer::WriteStream (std::ostream& theOStream)
 {
+  if (IsStreaming())
+  {
+    return IFSelect_RetError;
+  }
   Handle(StepData_StepModel) aModel = Model();
   if (aModel.IsNull())
   {
@@ -199,12 +223,57 @@ IFSelect_ReturnStatus STEPControl_Writer::WriteStream (std::ostream& theOStream)
   }
 
   StepData_StepWriter aWriter (aModel);
+  aWriter.SetStream (&theOStream);
   aWriter.SendModel (aProtocol);
   return aWriter.Print (theOStream)
        ? IFSelect_RetDone
        : IFSelect_RetFail;
 }
 
+//=======================================================================
+//function : BeginStream
+//purpose  :
+//=======================================================================
+Standard_Boolean STEPControl_Writer::BeginStream (std::ostream& theOStream)
+{
+  Handle(StepData_StepModel) aModel = Model();
+  if (IsStreaming() || aModel.IsNull())
+  {
+    return Standard_False;
+  }
+
+  Handle(StepData_Protocol) aProtocol = Handle(StepData_Protocol)::DownCast (aModel->Protocol());
+  if (aProtocol.IsNull())
+  {
+    return Standard_False;
+  }
+
+  myStreamWriter = std::make_shared<StepData_StepWriter> (aModel);
+  myStreamWriter->SetStream (&theOStream);
+  myStreamWriter->BeginData (aProtocol);
+  return Standard_True;
+}
+
+//=======================================================================
+//function : EndStream
+//purpose  :
+//=======================================================================
+IFSelect_ReturnStatus STEPControl_Writer::EndStream()
+{
+  if (!IsStreaming())
+  {
+    return IFSelect_RetError;
+  }
+
+  Handle(StepData_StepModel) aModel = Model();
+  myStreamWriter->SendEntities (Handle(StepData_Protocol)::DownCast (aModel->Protocol()));
+  const Standard_Boolean isGood = myStreamWriter->EndData();
+  myStreamWriter.reset();
+  return isGood
+       ? IFSelect_RetDone
+       : IFSelect_RetFail;
+}
+
 //=======================================================================
 //function : PrintStatsTransfer
 //purpose  : 
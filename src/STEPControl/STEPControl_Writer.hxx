@@ -28,8 +28,11 @@
 #include <Standard_Integer.hxx>
 #include <Message_ProgressRange.hxx>
 
+#include <memory>
+
 class XSControl_WorkSession;
 class StepData_StepModel;
+class StepData_StepWriter;
 class TopoDS_Shape;
 
 
@@ -104,6 +107,26 @@ public:
   //! Writes a STEP model in the std::ostream.
   Standard_EXPORT IFSelect_ReturnStatus WriteStream (std::ostream& theOStream);
 
+  //! Begins writing the STEP file in the std::ostream while shapes are
+  //! transferred : the HEADER Section (which shall be filled before)
+  //! is written, then each call to Transfer() writes the entities it
+  //! produced and releases the ones not referenced by the translator
+  //! anymore, so that the model is never held completely in memory.
+  //! The file is ended by EndStream(); Write() and WriteStream() are
+  //! not available meanwhile.
+  //! As the transfer results are not kept, shapes transferred by
+  //! distinct calls do not share their STEP entities (except the
+  //! contexts), and the model cannot be edited after transfer.
+  //! Returns False if the model has no STEP protocol or if the
+  //! writing is already begun
+  Standard_EXPORT Standard_Boolean BeginStream (std::ostream& theOStream);
+
+  //! Ends the STEP file begun by BeginStream()
+  Standard_EXPORT IFSelect_ReturnStatus EndStream();
+
+  //! Returns True if the writing is begun by BeginStream()
+  Standard_Boolean IsStreaming() const { return myStreamWriter.get() != NULL; }
+
   //! Displays the statistics for the
   //! last translation. what defines the kind of statistics that are displayed:
   //! - 0 gives general statistics   (number of translated roots,
@@ -140,6 +163,7 @@ private:
 
 
   Handle(XSControl_WorkSession) thesession;
+  std::shared_ptr<StepData_StepWriter> myStreamWriter; //!< writer of the file begun by BeginStream()
 
 
 };
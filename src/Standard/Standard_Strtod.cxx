@@ -26,14 +26,31 @@
  3. strtod() is renamed to Strtod() (OCCT signature)
  4. dtoa(), freedtoa() and supporting functions are disabled (see DISABLE_DTOA)
  5. Compiler warnings are suppressed
+ 6. Macro MULTIPLE_THREADS is defined, with locks protecting the shared pools of big integers,
+    so that Strtod() can be called concurrently
 
 */
 
 #include <Standard_CString.hxx>
 
+#include <mutex>
+
 #define IEEE_8087 1
 #define DISABLE_DTOA
 
+#define MULTIPLE_THREADS
+namespace
+{
+  //! Locks of the pool of big integers (0) and of the cache of powers of 5 (1);
+  //! std::mutex is used as it is initialized statically
+  static std::mutex THE_DTOA_LOCKS[2];
+
+  //! All threads share the same data structures protected by locks
+  static unsigned int dtoa_get_threadno() { return 0; }
+}
+#define ACQUIRE_DTOA_LOCK(n) THE_DTOA_LOCKS[n].lock()
+#define FREE_DTOA_LOCK(n)    THE_DTOA_LOCKS[n].unlock()
+
 #ifdef _MSC_VER
 #pragma warning(disable: 4706 4244 4127 4334)
 #endif
@@ -58,6 +58,10 @@ void StepData_ConfParameters::InitFromStatic()
   ReadName = Interface_Static::IVal("read.name") == 1;
   ReadLayer = Interface_Static::IVal("read.layer") == 1;
   ReadProps = Interface_Static::IVal("read.props") == 1;
+  ReadParallelParse = Interface_Static::IVal("read.step.parallel.parse") == 1;
+  ReadParallelEntities = Interface_Static::IVal("read.step.parallel.entities") == 1;
+  ReadParallelTransfer = Interface_Static::IVal("read.step.parallel.transfer") == 1;
+  ReadNbThreads = Interface_Static::IVal("read.step.nbthreads");
 
   WritePrecisionMode = (StepData_ConfParameters::WriteMode_PrecisionMode)Interface_Static::IVal("write.precision.mode");
   WritePrecisionVal = Interface_Static::RVal("write.precision.val");
@@ -77,6 +81,7 @@ void StepData_ConfParameters::InitFromStatic()
   WriteLayer = Interface_Static::IVal("write.layer") == 1;
   WriteProps = Interface_Static::IVal("write.props") == 1;
   WriteModelType = (STEPControl_StepModelType)Interface_Static::IVal("write.model.type");
+  WriteShortestReal = Interface_Static::IVal("write.step.real.shortest") == 1;
 }
 
 //=======================================================================
@@ -166,6 +166,10 @@ public:
   bool ReadName = true; //<! NameMode is used to indicate read Name or not
   bool ReadLayer = true; //<! LayerMode is used to indicate read Layers or not
   bool ReadProps = true; //<! PropsMode is used to indicate read Validation properties or not
+  bool ReadParallelParse = false; //<! Defines whether the DATA section of the file is split into parts parsed in parallel threads
+  bool ReadParallelEntities = false; //<! Defines whether the parameters of entities are read in parallel threads (two-phase reading)
+  bool ReadParallelTransfer = false; //<! Defines whether the shapes of solid representation items are translated in parallel threads
+  int ReadNbThreads = 0; //<! Defines the number of threads used by parallel reading modes (0 means default number of threads)
   
   // Write
   WriteMode_PrecisionMode WritePrecisionMode = WriteMode_PrecisionMode_Average; //<! Specifies the mode of writing the resolution value into the STEP file
@@ -186,6 +190,7 @@ public:
   bool WriteLayer = true; //<! LayerMode is used to indicate write Layers or not
   bool WriteProps = true; //<! PropsMode is used to indicate write Validation properties or not
   STEPControl_StepModelType WriteModelType = STEPControl_AsIs; //<! Gives you the choice of translation mode for an Open CASCADE shape that is being translated to STEP
+  bool WriteShortestReal = false; //<! Defines whether reals are written with the shortest text giving back the same value
 };
 
 #endif // _StepData_ConfParameters_HeaderFile
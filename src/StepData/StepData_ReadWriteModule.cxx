@@ -37,6 +37,11 @@ Standard_Integer  StepData_ReadWriteModule::CaseNum
   return CaseStep (stepdat->RecordType(num));
 }
 
+Standard_Integer  StepData_ReadWriteModule::CaseStep (const Standard_CString theType) const
+{
+  return CaseStep (TCollection_AsciiString (theType));
+}
+
 Standard_Integer  StepData_ReadWriteModule::CaseStep (const TColStd_SequenceOfAsciiString&) const
 {  
   return 0;
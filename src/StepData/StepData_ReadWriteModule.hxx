@@ -59,6 +59,12 @@ public:
   //! Warning : CaseStep must give the same Value as Protocol does for the
   //! Entity type which corresponds to this Type given as a String
   Standard_EXPORT virtual Standard_Integer CaseStep (const TCollection_AsciiString& atype) const = 0;
+
+  //! Same as above for a type given as a null-terminated string.
+  //! The provided Default converts the string and calls CaseStep (atype)
+  //! above; modules with a static table of types may redefine it
+  //! to avoid the conversion.
+  Standard_EXPORT virtual Standard_Integer CaseStep (const Standard_CString theType) const;
   
   //! Same a above but for a Complex Type Entity ("Plex")
   //! The provided Default recognizes nothing
@@ -57,7 +57,6 @@ IMPLEMENT_STANDARD_RTTIEXT(StepData_StepReaderData, Interface_FileReaderData)
 //  #########################################################################
 //  ....   Creation et Acces de base aux donnees atomiques du fichier    ....
 typedef TCollection_HAsciiString String;
-static char txtmes[200];  // plus commode que redeclarer partout
 
 
 static Standard_Boolean initstr = Standard_False;
@@ -98,7 +97,8 @@ static Standard_Integer convertCharacterTo16bit(const Standard_ExtCharacter theC
 //function : cleanText
 //purpose  : 
 //=======================================================================
-void StepData_StepReaderData::cleanText(const Handle(TCollection_HAsciiString)& theVal) const
+void StepData_StepReaderData::cleanText(const Standard_Integer theNum,
+                                        const Handle(TCollection_HAsciiString)& theVal) const
 {
   if (theVal->Length() == 2)
   {
@@ -137,7 +137,7 @@ void StepData_StepReaderData::cleanText(const Handle(TCollection_HAsciiString)&
         }
         else
         {
-          thecheck->AddWarning("String control directive \\P*\\ with an unsupported symbol in place of *");
+          recordCheck(theNum)->AddWarning("String control directive \\P*\\ with an unsupported symbol in place of *");
         }
         isConverted = Standard_True;
         aStringInd += 3;
@@ -201,7 +201,7 @@ void StepData_StepReaderData::cleanText(const Handle(TCollection_HAsciiString)&
           if (aStrLen % anIterStep)
           {
             aTempExtString.AssignCat('?');
-            thecheck->AddWarning("String control directive \\X2\\ is followed by number of digits not multiple of 4");
+            recordCheck(theNum)->AddWarning("String control directive \\X2\\ is followed by number of digits not multiple of 4");
           }
           else
           {
@@ -226,7 +226,7 @@ void StepData_StepReaderData::cleanText(const Handle(TCollection_HAsciiString)&
           if (aStrLen % 8)
           {
             aTempExtString.AssignCat('?');
-            thecheck->AddWarning("String control directive \\X4\\ is followed by number of digits not multiple of 8");
+            recordCheck(theNum)->AddWarning("String control directive \\X4\\ is followed by number of digits not multiple of 8");
           }
           else
           {
@@ -562,6 +562,7 @@ Standard_Boolean  StepData_StepReaderData::NamedForComplex
 (const Standard_CString name, const Standard_Integer num0,
   Standard_Integer& num, Handle(Interface_Check)& ach) const
 {
+  char txtmes[200];
   //Standard_Boolean stat = Standard_True;
   Standard_Integer n = (num <= 0 ? num0 : NextForComplex(num));
   // sln 04,10.2001. BUC61003. if(n==0) the next  function is not called in order to avoid exception
@@ -598,6 +599,7 @@ Standard_Boolean  StepData_StepReaderData::NamedForComplex
   const Standard_Integer num0, Standard_Integer& num,
   Handle(Interface_Check)& ach) const
 {
+  char txtmes[200];
   Standard_Integer n = (num <= 0 ? num0 : NextForComplex(num));
 
   if ((n != 0) && (!strcmp(RecordType(n).ToCString(), theName) ||
@@ -642,6 +644,7 @@ Standard_Boolean StepData_StepReaderData::CheckNbParams(const Standard_Integer n
   Handle(Interface_Check)& ach,
   const Standard_CString mess) const
 {
+  char txtmes[200];
   if (NbParams(num) == nbreq) return Standard_True;
   Handle(String) errmess;
   if (mess[0] == '\0') errmess = new String("Count of Parameters is not %d");
@@ -666,6 +669,7 @@ Standard_Boolean StepData_StepReaderData::ReadSubList(const Standard_Integer num
   const Standard_Integer /* lenmin */,
   const Standard_Integer /* lenmax */) const
 {
+  char txtmes[200];
   numsub = SubListNumber(num, nump, Standard_False);
   if (numsub > 0)
   {
@@ -776,7 +780,7 @@ Standard_Integer StepData_StepReaderData::ReadSub(const Standard_Integer numsub,
     case 6: {
       if (FT != Interface_ParamText) { kod = 0; break; }
       Handle(TCollection_HAsciiString) txt = new TCollection_HAsciiString(str);
-      cleanText(txt);
+      cleanText(numsub, txt);
       hst->SetValue(ip, txt);
       break;
     }
@@ -850,7 +854,7 @@ Standard_Integer StepData_StepReaderData::ReadSub(const Standard_Integer numsub,
     case Interface_ParamLogical: break;
     case Interface_ParamText: {
       Handle(TCollection_HAsciiString) txt = new TCollection_HAsciiString(str);
-      cleanText(txt);
+      cleanText(numsub, txt);
       htr->SetValue(ip, txt);
       break;
     }
@@ -881,6 +885,7 @@ Standard_Boolean StepData_StepReaderData::ReadMember(const Standard_Integer num,
   Handle(Interface_Check)& ach,
   Handle(StepData_SelectMember)& val) const
 {
+  char txtmes[200];
   Handle(Standard_Transient) v = val;
   Handle(StepData_PDescr) nuldescr;
   if (v.IsNull())
@@ -930,7 +935,7 @@ Standard_Boolean StepData_StepReaderData::ReadField(const Standard_Integer num,
   case Interface_ParamVoid:  break;
   case Interface_ParamText:
     txt = new TCollection_HAsciiString(str);
-    cleanText(txt);
+    cleanText(num, txt);
     fild.Set(txt);
     break;
   case Interface_ParamEnum:
@@ -1059,7 +1064,7 @@ Standard_Boolean StepData_StepReaderData::ReadAny(const Standard_Integer num,
   case Interface_ParamLogical: break;
   case Interface_ParamText: {
     Handle(TCollection_HAsciiString) txt = new TCollection_HAsciiString(str);
-    cleanText(txt);
+    cleanText(num, txt);
 
     // PDN May 2000: for reading SOURCE_ITEM (external references)
     if (!val.IsNull()) {
@@ -1133,6 +1138,7 @@ Standard_Boolean StepData_StepReaderData::ReadXY(const Standard_Integer num,
   Handle(Interface_Check)& ach,
   Standard_Real& X, Standard_Real& Y) const
 {
+  char txtmes[200];
   Handle(String) errmess;  // Null si pas d erreur
   Standard_Integer numsub = SubListNumber(num, nump, Standard_False);
   if (numsub != 0) {
@@ -1171,6 +1177,7 @@ Standard_Boolean StepData_StepReaderData::ReadXYZ(const Standard_Integer num,
   Standard_Real& X, Standard_Real& Y,
   Standard_Real& Z) const
 {
+  char txtmes[200];
   Handle(String) errmess;  // Null si pas d erreur
   Standard_Integer numsub = SubListNumber(num, nump, Standard_False);
   if (numsub != 0) {
@@ -1213,6 +1220,7 @@ Standard_Boolean StepData_StepReaderData::ReadReal(const Standard_Integer num,
   Handle(Interface_Check)& ach,
   Standard_Real& val) const
 {
+  char txtmes[200];
   Handle(String) errmess;  // Null si pas d erreur
   if (nump > 0 && nump <= NbParams(num)) {
     const Interface_FileParameter& FP = Param(num, nump);
@@ -1244,6 +1252,7 @@ Standard_Boolean StepData_StepReaderData::ReadEntity(const Standard_Integer num,
   const Handle(Standard_Type)& atype,
   Handle(Standard_Transient)& ent) const
 {
+  char txtmes[200];
   Handle(String) errmess;  // Null si pas d erreur
   Standard_Boolean warn = Standard_False;
   if (nump > 0 && nump <= NbParams(num)) {
@@ -1292,6 +1301,7 @@ Standard_Boolean StepData_StepReaderData::ReadEntity(const Standard_Integer num,
   Handle(Interface_Check)& ach,
   StepData_SelectType& sel) const
 {
+  char txtmes[200];
   Handle(String) errmess;  // Null si pas d erreur
   Standard_Boolean warn = Standard_False;
   if (nump > 0 && nump <= NbParams(num)) {
@@ -1357,6 +1367,7 @@ Standard_Boolean StepData_StepReaderData::ReadInteger(const Standard_Integer num
   Handle(Interface_Check)& ach,
   Standard_Integer& val) const
 {
+  char txtmes[200];
   Handle(String) errmess;  // Null si pas d erreur
   if (nump > 0 && nump <= NbParams(num)) {
     const Interface_FileParameter& FP = Param(num, nump);
@@ -1383,6 +1394,7 @@ Standard_Boolean StepData_StepReaderData::ReadBoolean(const Standard_Integer num
   Handle(Interface_Check)& ach,
   Standard_Boolean& flag) const
 {
+  char txtmes[200];
   flag = Standard_True;
   Handle(String) errmess;  // Null si pas d erreur
   if (nump > 0 && nump <= NbParams(num)) {
@@ -1415,6 +1427,7 @@ Standard_Boolean StepData_StepReaderData::ReadLogical(const Standard_Integer num
   Handle(Interface_Check)& ach,
   StepData_Logical& flag) const
 {
+  char txtmes[200];
   Handle(String) errmess;  // Null si pas d erreur
   if (nump > 0 && nump <= NbParams(num)) {
     const Interface_FileParameter& FP = Param(num, nump);
@@ -1447,6 +1460,7 @@ Standard_Boolean StepData_StepReaderData::ReadString(const Standard_Integer num,
   Handle(Interface_Check)& ach,
   Handle(TCollection_HAsciiString)& val) const
 {
+  char txtmes[200];
   Handle(String) errmess;  // Null si pas d erreur
   Standard_Boolean warn = Standard_False;
   if (nump > 0 && nump <= NbParams(num)) {
@@ -1460,7 +1474,7 @@ Standard_Boolean StepData_StepReaderData::ReadString(const Standard_Integer num,
         CleanText (val);
       }*/
       val = new TCollection_HAsciiString(FP.CValue());
-      cleanText(val);
+      cleanText(num, val);
     } else {
       if (acceptvoid && FP.ParamType() == Interface_ParamVoid) warn = Standard_True;
       errmess = new String("Parameter n0.%d (%s) not a quoted String");
@@ -1487,6 +1501,7 @@ Standard_Boolean StepData_StepReaderData::ReadEnumParam(const Standard_Integer n
   Handle(Interface_Check)& ach,
   Standard_CString& text) const
 {
+  char txtmes[200];
   Handle(String) errmess;  // Null si pas d erreur
   Standard_Boolean warn = Standard_False;
   if (nump > 0 && nump <= NbParams(num)) {
@@ -1521,6 +1536,7 @@ void  StepData_StepReaderData::FailEnumValue(const Standard_Integer /* num */,
   const Standard_CString mess,
   Handle(Interface_Check)& ach) const
 {
+  char txtmes[200];
   Handle(String) errmess =
     new String("Parameter n0.%d (%s) : Incorrect Enumeration Value");
   sprintf(txtmes, errmess->ToCString(), nump, mess);
@@ -1540,6 +1556,7 @@ Standard_Boolean StepData_StepReaderData::ReadEnum(const Standard_Integer num,
   const StepData_EnumTool& enumtool,
   Standard_Integer& val) const
 {
+  char txtmes[200];
   //  reprendre avec ReadEnumParam ?
   Handle(String) errmess;  // Null si pas d erreur
   Standard_Boolean warn = Standard_False;
@@ -1585,6 +1602,7 @@ Standard_Boolean StepData_StepReaderData::ReadTypedParam(const Standard_Integer
   Standard_Integer& numrp,
   TCollection_AsciiString& typ) const
 {
+  char txtmes[200];
   Handle(String) errmess;  // Null si pas d erreur
   if (nump > 0 && nump <= NbParams(num)) {
     const Interface_FileParameter& FP = Param(num, nump);
@@ -1624,6 +1642,7 @@ Standard_Boolean StepData_StepReaderData::CheckDerived(const Standard_Integer nu
   Handle(Interface_Check)& ach,
   const Standard_Boolean errstat) const
 {
+  char txtmes[200];
   Handle(String) errmess;  // Null si pas d erreur
   Standard_Boolean warn = !errstat;
   if (nump > 0 && nump <= NbParams(num)) {
@@ -2181,3 +2200,72 @@ const Handle(Interface_Check)  StepData_StepReaderData::GlobalCheck() const
 {
   return thecheck;
 }
+
+
+//=======================================================================
+//function : SetDeferredWarnings
+//purpose  : 
+//=======================================================================
+
+void StepData_StepReaderData::SetDeferredWarnings (const Standard_Boolean theToDefer)
+{
+  if (!theToDefer)
+  {
+    FlushDeferredWarnings (1, NbRecords());
+    myDeferredChecks.Nullify();
+  }
+  else if (myDeferredChecks.IsNull())
+  {
+    myDeferredChecks = new TColStd_HArray1OfTransient (1, NbRecords());
+  }
+}
+
+
+//=======================================================================
+//function : FlushDeferredWarnings
+//purpose  : 
+//=======================================================================
+
+void StepData_StepReaderData::FlushDeferredWarnings (const Standard_Integer theFirst,
+                                                     const Standard_Integer theLast)
+{
+  if (myDeferredChecks.IsNull())
+  {
+    return;
+  }
+  for (Standard_Integer aNum = Max (theFirst, myDeferredChecks->Lower());
+       aNum <= Min (theLast, myDeferredChecks->Upper()); ++aNum)
+  {
+    Handle(Interface_Check) aCheck = Handle(Interface_Check)::DownCast (myDeferredChecks->Value (aNum));
+    if (!aCheck.IsNull())
+    {
+      thecheck->GetMessages (aCheck);
+      myDeferredChecks->ChangeValue (aNum).Nullify();
+    }
+  }
+}
+
+
+//=======================================================================
+//function : recordCheck
+//purpose  : 
+//=======================================================================
+
+Handle(Interface_Check) StepData_StepReaderData::recordCheck (const Standard_Integer theNum) const
+{
+  // header records are always read sequentially
+  if (myDeferredChecks.IsNull()
+   || theNum <= thenbhead
+   || theNum > myDeferredChecks->Upper())
+  {
+    return thecheck;
+  }
+
+  // the slot of the record is accessed only by the thread reading this record
+  Handle(Standard_Transient)& aCheck = myDeferredChecks->ChangeValue (theNum);
+  if (aCheck.IsNull())
+  {
+    aCheck = new Interface_Check;
+  }
+  return Handle(Interface_Check)::DownCast (aCheck);
+}
@@ -23,6 +23,7 @@
 
 #include <Interface_IndexedMapOfAsciiString.hxx>
 #include <TColStd_DataMapOfIntegerInteger.hxx>
+#include <TColStd_HArray1OfTransient.hxx>
 #include <Standard_Integer.hxx>
 #include <Interface_FileReaderData.hxx>
 #include <Standard_CString.hxx>
@@ -328,6 +329,19 @@ public:
   //! Undefined References (detected by SetEntityNumbers)
   Standard_EXPORT const Handle(Interface_Check) GlobalCheck() const;
 
+  //! Enables or disables deferred mode for the warnings issued while
+  //! decoding string parameters, which are otherwise added to the Global Check
+  //! at once. In deferred mode the warnings are kept per record, so that
+  //! different records can be read concurrently, until they are moved to the
+  //! Global Check by FlushDeferredWarnings() (in the order of records).
+  //! Disabling deferred mode flushes all remaining warnings.
+  Standard_EXPORT void SetDeferredWarnings (const Standard_Boolean theToDefer);
+
+  //! Moves the warnings deferred for records from <theFirst> to <theLast>
+  //! into the Global Check. Does nothing if deferred mode is off.
+  Standard_EXPORT void FlushDeferredWarnings (const Standard_Integer theFirst,
+                                              const Standard_Integer theLast);
+
 
 
 
@@ -351,7 +365,13 @@ private:
   //! clean only special characters without conversion;
   //! else convert a string to UTF8 using the code page
   //! and handle the control directives.
-  Standard_EXPORT void cleanText(const Handle(TCollection_HAsciiString)& theVal) const;
+  //! <theNum> is the number of the record containing the string.
+  Standard_EXPORT void cleanText(const Standard_Integer theNum,
+                                 const Handle(TCollection_HAsciiString)& theVal) const;
+
+  //! Returns the check to record warnings related to the record <theNum>:
+  //! the Global Check, or the deferred check of the record in deferred mode.
+  Standard_EXPORT Handle(Interface_Check) recordCheck (const Standard_Integer theNum) const;
 
 private:
 
@@ -365,6 +385,7 @@ private:
   Standard_Integer thenbhead;
   Standard_Integer thenbscop;
   Handle(Interface_Check) thecheck;
+  Handle(TColStd_HArray1OfTransient) myDeferredChecks;
   Resource_FormatType mySourceCodePage;
 
 
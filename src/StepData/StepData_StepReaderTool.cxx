@@ -16,6 +16,8 @@
 #include <Interface_Macros.hxx>
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Transient.hxx>
@@ -35,12 +37,69 @@
 StepData_StepReaderTool::StepData_StepReaderTool
   (const Handle(StepData_StepReaderData)& reader,
    const Handle(StepData_Protocol)& protocol)
-:  theglib(protocol) , therlib(protocol)
+:  theglib(protocol) , therlib(protocol),
+   myNbFlushed (0)
 {
   SetData(reader,protocol);
 }
 
 
+//=======================================================================
+//class    : StepData_StepReaderTool_EntityReader
+//purpose  : Functor reading entities of ranges of records in parallel
+//=======================================================================
+
+class StepData_StepReaderTool_EntityReader
+{
+public:
+
+  //! Number of records read by a thread at once
+  static const Standard_Integer THE_RANGE_SIZE = 256;
+
+  StepData_StepReaderTool_EntityReader (const StepData_StepReaderTool& theTool,
+                                        const Handle(StepData_StepReaderData)& theData,
+                                        const NCollection_Vector<Standard_Integer>& theRecords,
+                                        NCollection_Array1<Handle(Interface_Check)>& theChecks)
+  : myTool (theTool), myData (theData), myRecords (theRecords), myChecks (theChecks) {}
+
+  //! Reads the entities of the range of records <theRangeIndex>;
+  //! each record (and its check) is accessed by one thread only
+  void operator() (int theThreadIndex, int theRangeIndex) const
+  {
+    (void )theThreadIndex;
+    const Standard_Integer aLower = theRangeIndex * THE_RANGE_SIZE;
+    const Standard_Integer anUpper = Min (aLower + THE_RANGE_SIZE, myRecords.Length());
+    for (Standard_Integer anIter = aLower; anIter < anUpper; ++anIter)
+    {
+      const Standard_Integer aNum = myRecords.Value (anIter);
+      const Handle(Standard_Transient)& anEnt = myData->BoundEntity (aNum);
+      if (anEnt.IsNull())
+      {
+        continue;
+      }
+
+      Handle(Interface_Check) aCheck = new Interface_Check (anEnt);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        myTool.readRecord (aNum, anEnt, aCheck);
+        myChecks.ChangeValue (aNum) = aCheck;
+      }
+      catch (Standard_Failure const&)
+      {
+        // the record is left to LoadModel, which reports the exception
+      }
+    }
+  }
+
+private:
+  const StepData_StepReaderTool& myTool;
+  Handle(StepData_StepReaderData) myData;
+  const NCollection_Vector<Standard_Integer>& myRecords;
+  NCollection_Array1<Handle(Interface_Check)>& myChecks;
+};
+
+
 //=======================================================================
 //function : Recognize
 //purpose  : 
@@ -110,6 +169,41 @@ void StepData_StepReaderTool::Prepare (const Standard_Boolean optim)
 }
 
 
+//=======================================================================
+//function : ReadEntities
+//purpose  : 
+//=======================================================================
+
+void StepData_StepReaderTool::ReadEntities (const Standard_Integer theNbThreads)
+{
+  DeclareAndCast(StepData_StepReaderData,stepdat,Data());
+  NCollection_Vector<Standard_Integer> aRecords (4096);
+  for (Standard_Integer num = stepdat->FindNextRecord(0); num > 0; num = stepdat->FindNextRecord(num))
+  {
+    aRecords.Append (num);
+  }
+  if (aRecords.IsEmpty())
+  {
+    return;
+  }
+
+  myReadChecks.Resize (1, stepdat->NbRecords(), Standard_False);
+  myNbFlushed = 0;
+
+  // warnings on decoding strings go to the global check : keep them per record
+  // to add them in the order of records, as for sequential reading
+  stepdat->SetDeferredWarnings (Standard_True);
+
+  const Standard_Integer aNbRanges = (aRecords.Length() + StepData_StepReaderTool_EntityReader::THE_RANGE_SIZE - 1)
+                                   / StepData_StepReaderTool_EntityReader::THE_RANGE_SIZE;
+  const Handle(OSD_ThreadPool)& aPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = theNbThreads > 0 ? theNbThreads : aPool->NbDefaultThreadsToLaunch();
+  OSD_ThreadPool::Launcher aLauncher (*aPool, Min (aNbThreads, aNbRanges));
+  StepData_StepReaderTool_EntityReader aFunctor (*this, stepdat, aRecords, myReadChecks);
+  aLauncher.Perform (0, aNbRanges, aFunctor);
+}
+
+
 // ....            Gestion du Header : Preparation, lecture            .... //
 
 
@@ -212,6 +306,37 @@ Standard_Boolean StepData_StepReaderTool::AnalyseRecord
   (const Standard_Integer num,
    const Handle(Standard_Transient)& anent,
    Handle(Interface_Check)& acheck)
+{
+//  Entite deja lue par ReadEntities : on reprend son Check
+  if (num >= myReadChecks.Lower() && num <= myReadChecks.Upper()
+  && !myReadChecks.Value(num).IsNull()) {
+    DeclareAndCast(StepData_StepReaderData,stepdat,Data());
+    if (stepdat->BoundEntity(num) == anent) {
+      // warnings deferred for this record, its sub-lists and its parts
+      // (for complex types) : up to the next entity
+      const Standard_Integer next = stepdat->FindNextRecord(num);
+      const Standard_Integer last = (next > 0 ? next - 1 : stepdat->NbRecords());
+      stepdat->FlushDeferredWarnings (myNbFlushed + 1, last);
+      myNbFlushed = Max (myNbFlushed, last);
+
+      acheck->GetMessages (myReadChecks.Value(num));
+      myReadChecks.ChangeValue(num).Nullify();
+      return (!acheck->HasFailed());
+    }
+  }
+  return readRecord (num, anent, acheck);
+}
+
+
+//=======================================================================
+//function : readRecord
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean StepData_StepReaderTool::readRecord
+  (const Standard_Integer num,
+   const Handle(Standard_Transient)& anent,
+   Handle(Interface_Check)& acheck) const
 {
   DeclareAndCast(StepData_StepReaderData,stepdat,Data());
   Handle(Interface_ReaderModule) imodule;
@@ -243,6 +368,11 @@ void StepData_StepReaderTool::EndRead
 {
   DeclareAndCast(StepData_StepReaderData,stepdat,Data());
   DeclareAndCast(StepData_StepModel,stepmodel,amodel);
+  if (!myReadChecks.IsEmpty()) {
+//  Fin de la lecture en deux phases : restent les warnings differes
+    stepdat->SetDeferredWarnings (Standard_False);
+    myReadChecks = NCollection_Array1<Handle(Interface_Check)>();
+  }
   if (stepmodel.IsNull()) return;
   Standard_Integer i = 0;
   while ( (i = stepdat->FindNextRecord(i)) != 0) {
@@ -24,6 +24,7 @@
 #include <Interface_GeneralLib.hxx>
 #include <Interface_ReaderLib.hxx>
 #include <Interface_FileReaderTool.hxx>
+#include <NCollection_Array1.hxx>
 #include <Standard_Integer.hxx>
 class StepData_FileRecognizer;
 class StepData_StepReaderData;
@@ -74,6 +75,18 @@ public:
   //! defined in the Header (not every type can be)
   Standard_EXPORT void PrepareHeader (const Handle(StepData_FileRecognizer)& reco);
   
+  //! Reads the parameters of all data entities, bound to records by
+  //! Prepare, in parallel threads working on ranges of records.
+  //! This is the optional second phase of two-phase reading : the
+  //! Checks filled for the records are kept and then taken by
+  //! AnalyseRecord when called by LoadModel, which still adds the
+  //! entities to the model one by one, so that Checks are reported in
+  //! the same (deterministic) order as for sequential reading.
+  //! Records which raised an exception are read again by LoadModel.
+  //! <theNbThreads> is the number of threads, 0 means the default
+  //! number of threads of OSD_ThreadPool
+  Standard_EXPORT void ReadEntities (const Standard_Integer theNbThreads = 0);
+
   //! fills model's header; that is, gives to it Header entities
   //! and commands their loading. Also fills StepModel's Global
   //! Check from StepReaderData's GlobalCheck
@@ -81,6 +94,8 @@ public:
   
   //! fills an entity, given record no; works by using a ReaderLib
   //! to load each entity, which must be a Transient
+  //! If the entity has already been read by ReadEntities, only
+  //! takes the messages of its Check
   //! Actually, returned value is True if no fail, False else
   Standard_EXPORT Standard_Boolean AnalyseRecord (const Standard_Integer num, const Handle(Standard_Transient)& anent, Handle(Interface_Check)& acheck) Standard_OVERRIDE;
   
@@ -99,11 +114,19 @@ protected:
 
 private:
 
+  //! fills an entity, given record no, as AnalyseRecord does;
+  //! can be called concurrently for different records
+  Standard_Boolean readRecord (const Standard_Integer num, const Handle(Standard_Transient)& anent, Handle(Interface_Check)& acheck) const;
 
+private:
 
   Handle(StepData_FileRecognizer) thereco;
   Interface_GeneralLib theglib;
   Interface_ReaderLib therlib;
+  NCollection_Array1<Handle(Interface_Check)> myReadChecks; //!< checks of records read by ReadEntities
+  Standard_Integer myNbFlushed;                             //!< last record with flushed deferred warnings
+
+  friend class StepData_StepReaderTool_EntityReader;
 
 
 };
@@ -17,9 +17,12 @@
 
 #include <Interface_Check.hxx>
 #include <Interface_EntityIterator.hxx>
+#include <Interface_GeneralLib.hxx>
+#include <Interface_GeneralModule.hxx>
 #include <Interface_InterfaceMismatch.hxx>
 #include <Interface_Macros.hxx>
 #include <Interface_ReportEntity.hxx>
+#include <NCollection_IndexedMap.hxx>
 #include <Standard_Transient.hxx>
 #include <StepData_ESDescr.hxx>
 #include <StepData_FieldList.hxx>
@@ -64,14 +67,17 @@ static TCollection_AsciiString  textunknown  (".U.");
 //=======================================================================
 
 StepData_StepWriter::StepData_StepWriter(const Handle(StepData_StepModel)& amodel)
-    : thecurr (StepLong) , thefloatw (12)
+    : thecurr (StepLong) , thestream (NULL) , thefloatw (12)
 {
   themodel = amodel;  thelabmode = thetypmode = 0;
   thefile  = new TColStd_HSequenceOfHAsciiString();
   thesect  = Standard_False;  thefirst = Standard_True;
   themult  = Standard_False;  thecomm  = Standard_False;
   thelevel = theindval = 0;   theindent = Standard_False;
+  theidoffset = 0;
 //  Format flottant : reporte dans le FloatWriter
+  if (!themodel.IsNull())
+    thefloatw.SetShortestRoundTrip (themodel->InternalParameters.WriteShortestReal);
 }
 
 //  ....                Controle d Envoi des Flottants                ....
@@ -164,11 +170,44 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
   StepData_WriterLib lib(protocol);
 
   if (!headeronly)
-    thefile->Append (new TCollection_HAsciiString("ISO-10303-21;"));
+    AddLine ("ISO-10303-21;");
   SendHeader();
 
 //  ....                Header : suite d entites sans Ident                ....
 
+  sendHeaderEntities (lib);
+  EndSec();
+  if (headeronly) return;
+
+//  Data : Comme Header mais avec des Idents ... sinon le code est le meme
+  SendData();
+
+// ....                    Erreurs Globales (silya)                    ....
+
+  sendGlobalCheck();
+
+//  ....                Sortie des Entites une par une                ....
+
+  Standard_Integer nb = themodel->NbEntities();
+  for (Standard_Integer i = 1 ; i <= nb; i ++) {
+//    Liste principale : on n envoie pas les Entites dans un Scope
+//    Elles le seront par l intermediaire du Scope qui les contient
+    if (!thescopebeg.IsNull()) {  if (thescopenext->Value(i) != 0) continue;  }
+    SendEntity (i,lib);
+  }
+
+  EndSec();
+  EndFile();
+}
+
+
+//=======================================================================
+//function : sendHeaderEntities
+//purpose  : 
+//=======================================================================
+
+void StepData_StepWriter::sendHeaderEntities (const StepData_WriterLib& lib)
+{
   Interface_EntityIterator header = themodel->Header();
   thenum = 0;
   for (header.Start(); header.More(); header.Next()) {
@@ -196,14 +235,16 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
    }
     EndEntity ();
   }
-  EndSec();
-  if (headeronly) return;
+}
 
-//  Data : Comme Header mais avec des Idents ... sinon le code est le meme
-  SendData();
 
-// ....                    Erreurs Globales (silya)                    ....
+//=======================================================================
+//function : sendGlobalCheck
+//purpose  : 
+//=======================================================================
 
+void StepData_StepWriter::sendGlobalCheck ()
+{
   Handle(Interface_Check) achglob = themodel->GlobalCheck();
   Standard_Integer nbfails = achglob->NbFails();
   if (nbfails > 0) {
@@ -215,19 +256,187 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
     Comment(Standard_False);
     NewLine(Standard_False);
   }
+}
 
-//  ....                Sortie des Entites une par une                ....
+//  ....                ENVOI DU MODELE PAR PARTIES                ....
 
-  Standard_Integer nb = themodel->NbEntities();
-  for (Standard_Integer i = 1 ; i <= nb; i ++) {
-//    Liste principale : on n envoie pas les Entites dans un Scope
-//    Elles le seront par l intermediaire du Scope qui les contient
-    if (!thescopebeg.IsNull()) {  if (thescopenext->Value(i) != 0) continue;  }
-    SendEntity (i,lib);
+
+//=======================================================================
+//function : BeginData
+//purpose  : 
+//=======================================================================
+
+void StepData_StepWriter::BeginData (const Handle(StepData_Protocol)& theProtocol)
+{
+  StepData_WriterLib aLib (theProtocol);
+  AddLine ("ISO-10303-21;");
+  SendHeader();
+  sendHeaderEntities (aLib);
+  EndSec();
+  SendData();
+  sendGlobalCheck();
+}
+
+
+//=======================================================================
+//function : SendEntities
+//purpose  : 
+//=======================================================================
+
+Standard_Integer StepData_StepWriter::SendEntities (const Handle(StepData_Protocol)& theProtocol)
+{
+  if (!thesect) throw Interface_InterfaceMismatch("StepWriter : SendEntities, Data section not begun");
+
+  // the entities kept from former calls stay in the Model, to be found by
+  // the next transfers : only the new ones are numbered, as SendModel does
+  Standard_Integer aNbEntities = themodel->NbEntities();
+  NCollection_Vector<Handle(Standard_Transient)> anEntities (Max (aNbEntities, 1));
+  for (Standard_Integer anEntIter = 1; anEntIter <= aNbEntities; ++anEntIter)
+  {
+    const Handle(Standard_Transient)& anEntity = themodel->Value (anEntIter);
+    if (!thesentids.Contains (anEntity))
+    {
+      anEntities.Append (anEntity);
+    }
+  }
+  themodel->ClearEntities();
+  for (NCollection_Vector<Handle(Standard_Transient)>::Iterator anEntIter (anEntities); anEntIter.More(); anEntIter.Next())
+  {
+    themodel->AddEntity (anEntIter.Value());
+  }
+  aNbEntities = themodel->NbEntities();
+
+  StepData_WriterLib aLib (theProtocol);
+  for (Standard_Integer anEntIter = 1; anEntIter <= aNbEntities; ++anEntIter)
+  {
+    SendEntity (anEntIter, aLib);
   }
 
+  themodel->ClearEntities();
+  const Standard_Integer aFirstId = theidoffset + 1;
+  theidoffset += aNbEntities;
+  releaseSentEntities (theProtocol, anEntities, aFirstId);
+  for (Standard_Integer aSentIter = 1; aSentIter <= thesentids.Extent(); ++aSentIter)
+  {
+    themodel->AddEntity (thesentids.FindKey (aSentIter));
+  }
+  return aNbEntities;
+}
+
+
+//=======================================================================
+//function : releaseSentEntities
+//purpose  : 
+//=======================================================================
+
+void StepData_StepWriter::releaseSentEntities (const Handle(StepData_Protocol)& theProtocol,
+                                               NCollection_Vector<Handle(Standard_Transient)>& theEntities,
+                                               const Standard_Integer theFirstId)
+{
+  // the entities kept from former calls and the new ones are moved to one map,
+  // which is then the only container of the writer referencing them
+  NCollection_IndexedMap<Handle(Standard_Transient)> anEntityMap;
+  NCollection_Vector<Standard_Integer> anIds (Max (thesentids.Extent() + theEntities.Length(), 1));
+  for (Standard_Integer aSentIter = 1; aSentIter <= thesentids.Extent(); ++aSentIter)
+  {
+    anEntityMap.Add (thesentids.FindKey (aSentIter));
+    anIds.Append (thesentids.FindFromIndex (aSentIter));
+  }
+  Standard_Integer anId = theFirstId;
+  for (NCollection_Vector<Handle(Standard_Transient)>::Iterator anEntIter (theEntities); anEntIter.More(); anEntIter.Next(), ++anId)
+  {
+    if (anEntityMap.Add (anEntIter.Value()) > anIds.Length())
+    {
+      anIds.Append (anId);
+    }
+  }
+  thesentids.Clear();
+  theEntities.Clear();
+
+  // reverse reference counts : for each entity, the count of references
+  // to it from the other entities of the map, given by their shared lists
+  const Standard_Integer aNbEntities = anEntityMap.Extent();
+  NCollection_Vector<Standard_Integer> aNbSharings (Max (aNbEntities, 1));
+  NCollection_Vector<Standard_Integer> aSharedFirst (Max (aNbEntities, 1)), aShareds;
+  for (Standard_Integer anEntIter = 1; anEntIter <= aNbEntities; ++anEntIter)
+  {
+    aNbSharings.Append (0);
+  }
+  Interface_GeneralLib aLib (theProtocol);
+  for (Standard_Integer anEntIter = 1; anEntIter <= aNbEntities; ++anEntIter)
+  {
+    aSharedFirst.Append (aShareds.Length());
+    Handle(Interface_GeneralModule) aModule;
+    Standard_Integer aCN = 0;
+    if (!aLib.Select (anEntityMap (anEntIter), aModule, aCN))
+    {
+      continue;
+    }
+    Interface_EntityIterator aSharedIter;
+    aModule->FillShared (themodel, aCN, anEntityMap (anEntIter), aSharedIter);
+    for (aSharedIter.Start(); aSharedIter.More(); aSharedIter.Next())
+    {
+      const Standard_Integer aShared = anEntityMap.FindIndex (aSharedIter.Value());
+      if (aShared != 0)
+      {
+        aShareds.Append (aShared);
+        ++aNbSharings.ChangeValue (aShared - 1);
+      }
+    }
+  }
+  aSharedFirst.Append (aShareds.Length());
+
+  // an entity referenced by no other object than the map and the entities of
+  // the map cannot be referenced by entities created later : it is released
+  // once the last entity referencing it is released
+  NCollection_Vector<Standard_Boolean> isHeld (Max (aNbEntities, 1));
+  NCollection_Vector<Standard_Integer> aReleased (Max (aNbEntities, 1));
+  for (Standard_Integer anEntIter = 1; anEntIter <= aNbEntities; ++anEntIter)
+  {
+    const Standard_Integer aNbEntSharings = aNbSharings (anEntIter - 1);
+    isHeld.Append (anEntityMap (anEntIter)->GetRefCount() > 1 + aNbEntSharings);
+    if (!isHeld (anEntIter - 1) && aNbEntSharings == 0)
+    {
+      aReleased.Append (anEntIter);
+    }
+  }
+  for (Standard_Integer aReleasedIter = 0; aReleasedIter < aReleased.Length(); ++aReleasedIter)
+  {
+    const Standard_Integer anEntity = aReleased (aReleasedIter);
+    for (Standard_Integer aSharedIter = aSharedFirst (anEntity - 1); aSharedIter < aSharedFirst (anEntity); ++aSharedIter)
+    {
+      const Standard_Integer aShared = aShareds (aSharedIter);
+      if (--aNbSharings.ChangeValue (aShared - 1) == 0 && !isHeld (aShared - 1))
+      {
+        aReleased.Append (aShared);
+      }
+    }
+  }
+
+  // the remaining entities are recorded with their numbers
+  for (Standard_Integer anEntIter = 1; anEntIter <= aNbEntities; ++anEntIter)
+  {
+    if (isHeld (anEntIter - 1) || aNbSharings (anEntIter - 1) != 0)
+    {
+      thesentids.Add (anEntityMap (anEntIter), anIds (anEntIter - 1));
+    }
+  }
+}
+
+
+//=======================================================================
+//function : EndData
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean StepData_StepWriter::EndData ()
+{
   EndSec();
   EndFile();
+  thesentids.Clear();
+  if (thestream == NULL) return Standard_True;
+  thestream->flush();
+  return thestream->good();
 }
 
 
@@ -242,7 +451,7 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
 void StepData_StepWriter::SendHeader ()
 {
   NewLine(Standard_False);
-  thefile->Append (new TCollection_HAsciiString("HEADER;"));
+  AddLine ("HEADER;");
   thesect = Standard_True;
 }
 
@@ -256,7 +465,7 @@ void StepData_StepWriter::SendData ()
 {
   if (thesect) throw Interface_InterfaceMismatch("StepWriter : Data section");
   NewLine(Standard_False);
-  thefile->Append (new TCollection_HAsciiString("DATA;"));
+  AddLine ("DATA;");
   thesect = Standard_True;
 }
 
@@ -268,7 +477,7 @@ void StepData_StepWriter::SendData ()
 
 void StepData_StepWriter::EndSec ()
 {
-  thefile->Append (new TCollection_HAsciiString("ENDSEC;"));
+  AddLine ("ENDSEC;");
   thesect = Standard_False;
 }
 
@@ -282,7 +491,7 @@ void StepData_StepWriter::EndFile ()
 {
   if (thesect) throw Interface_InterfaceMismatch("StepWriter : EndFile");
   NewLine(Standard_False);
-  thefile->Append (new TCollection_HAsciiString("END-ISO-10303-21;"));
+  AddLine ("END-ISO-10303-21;");
   thesect = Standard_False;
 }
 
@@ -300,12 +509,12 @@ void StepData_StepWriter::SendEntity(const Standard_Integer num,
 {
   char lident[20];
   Handle(Standard_Transient) anent = themodel->Entity(num);
-  Standard_Integer idnum = num , idtrue = 0;
+  Standard_Integer idnum = theidoffset + num , idtrue = 0;
 
     //   themodel->Number(anent) et-ou IdentLabel(anent)
   if (thelabmode > 0) idtrue = themodel->IdentLabel(anent);
   if (thelabmode == 1) idnum = idtrue;
-  if (idnum == 0) idnum = num;
+  if (idnum == 0) idnum = theidoffset + num;
   if (thelabmode < 2 || idnum == idtrue) sprintf(lident,"#%d = ",idnum); //skl 29.01.2003
   else sprintf(lident,"%d:#%d = ",idnum,idtrue); //skl 29.01.2003
 
@@ -397,7 +606,7 @@ void StepData_StepWriter::SendEntity(const Standard_Integer num,
 void StepData_StepWriter::NewLine (const Standard_Boolean evenempty)
 {
   if (evenempty || thecurr.Length() > 0) {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
   }
   Standard_Integer indst = thelevel * 2; if (theindent) indst += theindval;
   thecurr.SetInitial(indst);  thecurr.Clear();
@@ -461,7 +670,7 @@ void StepData_StepWriter::SendScope ()
 void StepData_StepWriter::SendEndscope ()
 {
   NewLine(Standard_False);
-  thefile->Append(new TCollection_HAsciiString(textendscope));
+  AddLine (textendscope.ToCString());
 }
 
 
@@ -766,7 +975,7 @@ void StepData_StepWriter::Send (const Standard_Integer val)
 void StepData_StepWriter::Send (const Standard_Real val)
 {
 //    Valeur flottante, expurgee de "0000" qui trainent et de "E+00"
-  char lval[24] = {};
+  char lval[32] = {};
   Standard_Integer lng = thefloatw.Write(val,lval);
   AddParam();
   AddString(lval,lng);    // gere le format specifique : si besoin est
@@ -806,7 +1015,7 @@ void StepData_StepWriter::Send (const TCollection_AsciiString& val)
   if (thecurr.CanGet(nn)) AddString(aval,0);
   //:i2
   else {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
     Standard_Integer indst = thelevel * 2; if (theindent) indst += theindval;
     if ( indst+nn <= StepLong ) thecurr.SetInitial(indst);
     else thecurr.SetInitial(0);
@@ -830,7 +1039,7 @@ void StepData_StepWriter::Send (const TCollection_AsciiString& val)
 	  }
 	}
 	TCollection_AsciiString bval = aval.Split(stop);
-	thefile->Append(new TCollection_HAsciiString(aval));
+	AddLine (aval.ToCString());
 	aval = bval;
 	nn -= stop;
       }
@@ -842,7 +1051,7 @@ void StepData_StepWriter::Send (const TCollection_AsciiString& val)
     Standard_Integer ncurr = thecurr.Length();
     Standard_Integer nbuff = StepLong - ncurr;
     thecurr.Add (aval.ToCString(),nbuff);
-    thefile->Append(thecurr.Moved());
+    FlushLine();
     aval.Remove(1,nbuff);
     nn -= nbuff;
     while (nn > 0) {
@@ -880,8 +1089,15 @@ void StepData_StepWriter::Send (const Handle(Standard_Transient)& val)
     return;
   }
   Standard_Integer num = themodel->Number(val);
+//  Entite deja envoyee par SendEntities : son Ident est conserve
+  Standard_Integer sentnum = 0;
+  if (num == 0 && thesentids.FindFromKey(val,sentnum)) {
+    sprintf(lident,"#%d",sentnum);
+    AddParam();
+    AddString(lident,(Standard_Integer) strlen(lident));
+  }
 //  String ? (si non repertoriee dans le Modele)
-  if (num == 0) {
+  else if (num == 0) {
     if (val->IsKind(STANDARD_TYPE(TCollection_HAsciiString))) {
       DeclareAndCast(TCollection_HAsciiString,strval,val);
       Send (TCollection_AsciiString(strval->ToCString()));
@@ -906,10 +1122,10 @@ void StepData_StepWriter::Send (const Handle(Standard_Transient)& val)
   }
 //  Cas normal : une bonne Entite, on envoie son Ident.
   else {
-    Standard_Integer idnum = num, idtrue = 0;
+    Standard_Integer idnum = theidoffset + num, idtrue = 0;
     if (thelabmode > 0) idtrue = themodel->IdentLabel(val);
     if (thelabmode == 1) idnum = idtrue;
-    if (idnum == 0) idnum = num;
+    if (idnum == 0) idnum = theidoffset + num;
     if (thelabmode < 2 || idnum == idtrue) sprintf(lident,"#%d",idnum);
     else sprintf(lident,"%d:#%d",idnum,idtrue);
     AddParam();
@@ -1078,7 +1294,7 @@ void StepData_StepWriter::AddString(const TCollection_AsciiString& astr,
                                     const Standard_Integer more)
 {
   while (!thecurr.CanGet(astr.Length() + more)) {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
     Standard_Integer indst = thelevel * 2; if (theindent) indst += theindval;
     thecurr.SetInitial(indst);
   }
@@ -1096,7 +1312,7 @@ void StepData_StepWriter::AddString(const Standard_CString astr,
                                     const Standard_Integer more)
 {
   while (!thecurr.CanGet(lnstr + more)) {
-    thefile->Append(thecurr.Moved());
+    FlushLine();
     Standard_Integer indst = thelevel * 2; if (theindent) indst += theindval;
     thecurr.SetInitial(indst);
   }
@@ -1107,6 +1323,35 @@ void StepData_StepWriter::AddString(const Standard_CString astr,
 //   ENVOI FINAL
 
 
+//=======================================================================
+//function : FlushLine
+//purpose  : 
+//=======================================================================
+
+void StepData_StepWriter::FlushLine ()
+{
+  if (thestream == NULL) {
+    thefile->Append(thecurr.Moved());
+    return;
+  }
+  theline.Clear();
+  thecurr.Move (theline);
+  *thestream << theline.ToCString() << "\n";
+}
+
+
+//=======================================================================
+//function : AddLine
+//purpose  : 
+//=======================================================================
+
+void StepData_StepWriter::AddLine (const Standard_CString theLine)
+{
+  if (thestream == NULL) thefile->Append (new TCollection_HAsciiString (theLine));
+  else                   *thestream << theLine << "\n";
+}
+
+
 //=======================================================================
 //function : CheckList
 //purpose  : 
@@ -1137,6 +1382,17 @@ Handle(TCollection_HAsciiString) StepData_StepWriter::Line
 {  return thefile->Value(num);  }
 
 
+//=======================================================================
+//function : SetStream
+//purpose  : 
+//=======================================================================
+
+void StepData_StepWriter::SetStream (Standard_OStream* theStream)
+{
+  thestream = theStream;
+}
+
+
 //=======================================================================
 //function : Printw
 //purpose  : 
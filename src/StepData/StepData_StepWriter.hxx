@@ -31,6 +31,9 @@
 #include <StepData_Logical.hxx>
 #include <TColStd_HArray1OfReal.hxx>
 #include <Standard_OStream.hxx>
+#include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Transient.hxx>
 class StepData_StepModel;
 class StepData_Protocol;
 class StepData_WriterLib;
@@ -41,7 +44,6 @@ class StepData_PDescr;
 class StepData_SelectMember;
 class StepData_FieldList;
 class StepData_ESDescr;
-class Standard_Transient;
 
 
 //! manages atomic file writing, under control of StepModel (for
@@ -97,6 +99,30 @@ public:
   //! (used to Dump the Header of a StepModel)
   Standard_EXPORT void SendModel (const Handle(StepData_Protocol)& protocol, const Standard_Boolean headeronly = Standard_False);
   
+  //! Sends the beginning of the file : the HEADER Section and the
+  //! beginning of the DATA Section. The DATA Section is then sent in
+  //! parts by SendEntities() and ended by EndData(), so that the
+  //! entities can be written as soon as they are added to the Model
+  //! and released after writing (see STEPControl_Writer::BeginStream)
+  Standard_EXPORT void BeginData (const Handle(StepData_Protocol)& theProtocol);
+
+  //! Sends the entities of the Model not sent by a former call,
+  //! numbered after the entities already sent, as SendModel would
+  //! number them, then removes them from the Model.
+  //! The sent entities still referenced by other objects (e.g. by
+  //! a translator) are kept with their numbers and left in the Model,
+  //! as they may be referenced by entities added later; they are not
+  //! sent again. The other ones are released.
+  //! Returns the count of sent entities
+  Standard_EXPORT Standard_Integer SendEntities (const Handle(StepData_Protocol)& theProtocol);
+
+  //! Ends the DATA Section begun by BeginData and the file.
+  //! Returns False if the stream is in error state
+  Standard_EXPORT Standard_Boolean EndData();
+
+  //! Returns the count of entities sent by SendEntities()
+  Standard_Integer NbSentEntities() const { return theidoffset; }
+
   //! Begins model header
   Standard_EXPORT void SendHeader();
   
@@ -267,6 +293,13 @@ public:
   //! then clears it
   Standard_EXPORT Standard_Boolean Print (Standard_OStream& S);
 
+  //! Sets the stream on which the lines are written as soon as they
+  //! are completed, instead of being kept until Print (streaming mode) :
+  //! the text of the whole file is then never held in memory.
+  //! NbLines and Line only give the lines not yet written, Print only
+  //! flushes the stream. Null stream (default) restores keeping lines.
+  Standard_EXPORT void SetStream (Standard_OStream* theStream);
+
 
 
 
@@ -287,10 +320,33 @@ private:
   //! Same as above, but the string is given by CString + Length
   Standard_EXPORT void AddString (const Standard_CString str, const Standard_Integer lnstr, const Standard_Integer more = 0);
 
+  //! Ends the current line : writes it on the stream in streaming mode,
+  //! else adds it to the lines of the file
+  Standard_EXPORT void FlushLine();
+
+  //! Adds a complete line, the current line being left as is
+  Standard_EXPORT void AddLine (const Standard_CString theLine);
+
+  //! Sends the entities of the HEADER Section
+  Standard_EXPORT void sendHeaderEntities (const StepData_WriterLib& theLib);
+
+  //! Sends the global fail messages of the Model as comments
+  Standard_EXPORT void sendGlobalCheck();
+
+  //! Releases the entities of the list and of the map of sent entities
+  //! which are referenced neither by other objects nor by the remaining
+  //! entities, as given by their shared lists, then records the remaining
+  //! entities of the list in the map of sent entities, numbered from <theFirstId>
+  Standard_EXPORT void releaseSentEntities (const Handle(StepData_Protocol)& theProtocol,
+                                            NCollection_Vector<Handle(Standard_Transient)>& theEntities,
+                                            const Standard_Integer theFirstId);
+
 
   Handle(StepData_StepModel) themodel;
   Handle(TColStd_HSequenceOfHAsciiString) thefile;
   Interface_LineBuffer thecurr;
+  Standard_OStream* thestream;
+  TCollection_AsciiString theline;
   Standard_Boolean thesect;
   Standard_Boolean thecomm;
   Standard_Boolean thefirst;
@@ -306,6 +362,8 @@ private:
   Handle(TColStd_HArray1OfInteger) thescopebeg;
   Handle(TColStd_HArray1OfInteger) thescopeend;
   Handle(TColStd_HArray1OfInteger) thescopenext;
+  Standard_Integer theidoffset; //!< count of entities sent by SendEntities()
+  NCollection_IndexedDataMap<Handle(Standard_Transient), Standard_Integer> thesentids; //!< numbers of sent entities still referenced
 
 
 };
@@ -0,0 +1,225 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepData_TypeNameTable.hxx>
+
+#include <Standard_ProgramError.hxx>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  //! Maximum number of seeds tried for one bucket before enlarging the table
+  static const Standard_Integer THE_MAX_SEED = 1 << 16;
+}
+
+//=======================================================================
+//function : StepData_TypeNameTable
+//purpose  :
+//=======================================================================
+StepData_TypeNameTable::StepData_TypeNameTable()
+: myNames (1024),
+  mySlotMask (0),
+  myNbNames (0)
+{
+  //
+}
+
+//=======================================================================
+//function : Add
+//purpose  :
+//=======================================================================
+void StepData_TypeNameTable::Add (const Standard_CString theName,
+                                  const Standard_Integer theNum)
+{
+  if (IsBuilt())
+  {
+    throw Standard_ProgramError ("StepData_TypeNameTable::Add() - the table is already built");
+  }
+
+  TypeName aName;
+  aName.Name   = theName;
+  aName.Length = strlen (theName);
+  aName.Hash   = hashName (theName, aName.Length);
+  aName.Num    = theNum;
+  myNames.Append (aName);
+}
+
+//=======================================================================
+//function : Build
+//purpose  :
+//=======================================================================
+void StepData_TypeNameTable::Build()
+{
+  // remove duplicated names, keeping the first one
+  {
+    std::vector<Standard_Integer> anOrder (myNames.Length());
+    for (Standard_Integer aNameIter = 0; aNameIter < myNames.Length(); ++aNameIter)
+    {
+      anOrder[aNameIter] = aNameIter;
+    }
+    std::stable_sort (anOrder.begin(), anOrder.end(), [this] (Standard_Integer theLeft, Standard_Integer theRight)
+    {
+      return myNames.Value (theLeft).Hash < myNames.Value (theRight).Hash;
+    });
+
+    // equal names are adjacent and sorted in the order of addition
+    std::vector<bool> isDuplicated (anOrder.size(), false);
+    for (size_t anIter = 1; anIter < anOrder.size(); ++anIter)
+    {
+      const TypeName& aName = myNames.Value (anOrder[anIter]);
+      const TypeName& aPrev = myNames.Value (anOrder[anIter - 1]);
+      if (aPrev.Hash != aName.Hash)
+      {
+        continue;
+      }
+      if (aPrev.Length != aName.Length
+       || memcmp (aPrev.Name, aName.Name, aName.Length) != 0)
+      {
+        // different names with the same 64-bit hash value cannot be separated
+        throw Standard_ProgramError ("StepData_TypeNameTable::Build() - hash collision");
+      }
+      isDuplicated[anOrder[anIter]] = true;
+    }
+
+    NCollection_Vector<TypeName> aNames (1024);
+    for (Standard_Integer aNameIter = 0; aNameIter < myNames.Length(); ++aNameIter)
+    {
+      if (!isDuplicated[aNameIter])
+      {
+        aNames.Append (myNames.Value (aNameIter));
+      }
+    }
+    myNames = aNames;
+  }
+
+  myNbNames = myNames.Length();
+  if (myNbNames == 0)
+  {
+    return;
+  }
+
+  // use at least twice more slots than names to find seeds quickly
+  Standard_Size aNbSlots = 1;
+  while (aNbSlots < 2 * (Standard_Size )myNbNames)
+  {
+    aNbSlots <<= 1;
+  }
+  while (!build (aNbSlots))
+  {
+    aNbSlots <<= 1;
+  }
+}
+
+//=======================================================================
+//function : build
+//purpose  :
+//=======================================================================
+Standard_Boolean StepData_TypeNameTable::build (const Standard_Size theNbSlots)
+{
+  const Standard_Integer aNbBuckets = myNbNames / 2 + 1;
+  const Standard_Size aMask = theNbSlots - 1;
+
+  // distribute names into buckets
+  std::vector< std::vector<Standard_Integer> > aBuckets (aNbBuckets);
+  for (Standard_Integer aNameIter = 0; aNameIter < myNbNames; ++aNameIter)
+  {
+    aBuckets[myNames.Value (aNameIter).Hash % aNbBuckets].push_back (aNameIter);
+  }
+
+  // place the largest buckets first
+  std::vector<Standard_Integer> anOrder (aNbBuckets);
+  for (Standard_Integer aBucketIter = 0; aBucketIter < aNbBuckets; ++aBucketIter)
+  {
+    anOrder[aBucketIter] = aBucketIter;
+  }
+  std::stable_sort (anOrder.begin(), anOrder.end(), [&aBuckets] (Standard_Integer theLeft, Standard_Integer theRight)
+  {
+    return aBuckets[theLeft].size() > aBuckets[theRight].size();
+  });
+
+  NCollection_Array1<Standard_Integer> aSeeds  (0, aNbBuckets - 1);
+  NCollection_Array1<Standard_Integer> aSlots  (0, (Standard_Integer )theNbSlots - 1);
+  aSeeds.Init (0);
+  aSlots.Init (0);
+  std::vector<Standard_Size> aBucketSlots;
+  for (std::vector<Standard_Integer>::const_iterator aBucketIter = anOrder.begin(); aBucketIter != anOrder.end(); ++aBucketIter)
+  {
+    const std::vector<Standard_Integer>& aBucket = aBuckets[*aBucketIter];
+    if (aBucket.empty())
+    {
+      break;
+    }
+
+    Standard_Boolean isPlaced = Standard_False;
+    for (Standard_Integer aSeed = 0; aSeed < THE_MAX_SEED && !isPlaced; ++aSeed)
+    {
+      aBucketSlots.clear();
+      isPlaced = Standard_True;
+      for (std::vector<Standard_Integer>::const_iterator aNameIter = aBucket.begin(); aNameIter != aBucket.end(); ++aNameIter)
+      {
+        const Standard_Size aSlot = slotIndex (myNames.Value (*aNameIter).Hash, aSeed, aMask);
+        if (aSlots.Value ((Standard_Integer )aSlot) != 0
+         || std::find (aBucketSlots.begin(), aBucketSlots.end(), aSlot) != aBucketSlots.end())
+        {
+          isPlaced = Standard_False;
+          break;
+        }
+        aBucketSlots.push_back (aSlot);
+      }
+      if (isPlaced)
+      {
+        aSeeds.SetValue (*aBucketIter, aSeed);
+        for (size_t aNameIter = 0; aNameIter < aBucket.size(); ++aNameIter)
+        {
+          aSlots.SetValue ((Standard_Integer )aBucketSlots[aNameIter], aBucket[aNameIter] + 1);
+        }
+      }
+    }
+    if (!isPlaced)
+    {
+      return Standard_False;
+    }
+  }
+
+  mySeeds.Move (aSeeds);
+  mySlots.Move (aSlots);
+  mySlotMask = aMask;
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Find
+//purpose  :
+//=======================================================================
+Standard_Integer StepData_TypeNameTable::Find (const Standard_CString theName,
+                                               const Standard_Size    theLength) const
+{
+  if (mySlots.IsEmpty())
+  {
+    return 0;
+  }
+
+  const uint64_t aHash = hashName (theName, theLength);
+  const Standard_Integer aSeed = mySeeds.Value ((Standard_Integer )(aHash % (uint64_t )mySeeds.Size()));
+  const Standard_Integer anIndex = mySlots.Value ((Standard_Integer )slotIndex (aHash, aSeed, mySlotMask));
+  if (anIndex == 0)
+  {
+    return 0;
+  }
+
+  const TypeName& aName = myNames.Value (anIndex - 1);
+  return aName.Length == theLength
+      && memcmp (aName.Name, theName, theLength) == 0 ? aName.Num : 0;
+}
@@ -0,0 +1,122 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _StepData_TypeNameTable_HeaderFile
+#define _StepData_TypeNameTable_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_CString.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Integer.hxx>
+
+#include <cstring>
+
+//! Static perfect hash table mapping the names of STEP types
+//! (long and short ones) to the Case Numbers of a ReadWriteModule.
+//!
+//! The table is filled once by Add() and then prepared by Build(), which
+//! computes a perfect hash function for the given set of names (hash and
+//! displace method : names are distributed into buckets, and for each bucket
+//! a seed is searched which places all its names into free slots).
+//! Then Find() computes one hash value, reads one seed and compares
+//! one name : it does not allocate memory and can be called concurrently.
+//!
+//! The names are not copied : they must remain valid while the table is used.
+class StepData_TypeNameTable
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates an empty table.
+  Standard_EXPORT StepData_TypeNameTable();
+
+  //! Adds the name of a type with its Case Number (must be positive).
+  //! If the same name is added several times, the first Case Number is kept.
+  //! Must be called before Build().
+  Standard_EXPORT void Add (const Standard_CString theName,
+                            const Standard_Integer theNum);
+
+  //! Computes the perfect hash function for the added names.
+  Standard_EXPORT void Build();
+
+  //! Returns True if the table has been built.
+  Standard_Boolean IsBuilt() const { return !mySlots.IsEmpty(); }
+
+  //! Returns the number of distinct names in the table.
+  Standard_Integer Size() const { return myNbNames; }
+
+  //! Returns the Case Number of the type given by its name of <theLength>
+  //! characters (not necessarily null-terminated), or 0 if not found.
+  Standard_EXPORT Standard_Integer Find (const Standard_CString theName,
+                                         const Standard_Size    theLength) const;
+
+  //! Returns the Case Number of the type given by its null-terminated name,
+  //! or 0 if not found.
+  Standard_Integer Find (const Standard_CString theName) const
+  {
+    return Find (theName, strlen (theName));
+  }
+
+private:
+
+  //! Name of the type with its Case Number.
+  struct TypeName
+  {
+    Standard_CString Name;
+    Standard_Size    Length;
+    uint64_t         Hash;
+    Standard_Integer Num;
+  };
+
+  //! Returns the hash value of the name.
+  static uint64_t hashName (const Standard_CString theName,
+                            const Standard_Size    theLength)
+  {
+    // FNV-1a
+    uint64_t aHash = 14695981039346656037ULL;
+    for (Standard_Size aCharIter = 0; aCharIter < theLength; ++aCharIter)
+    {
+      aHash ^= (unsigned char )theName[aCharIter];
+      aHash *= 1099511628211ULL;
+    }
+    return aHash;
+  }
+
+  //! Returns the slot of the name for the given hash value and bucket seed.
+  static Standard_Size slotIndex (const uint64_t         theHash,
+                                  const Standard_Integer theSeed,
+                                  const Standard_Size    theMask)
+  {
+    uint64_t aHash = theHash + (uint64_t )(theSeed + 1) * 0x9E3779B97F4A7C15ULL;
+    aHash ^= aHash >> 33;
+    aHash *= 0xFF51AFD7ED558CCDULL;
+    aHash ^= aHash >> 33;
+    return (Standard_Size )aHash & theMask;
+  }
+
+  //! Tries to distribute the names into <theNbSlots> slots.
+  Standard_Boolean build (const Standard_Size theNbSlots);
+
+private:
+
+  NCollection_Vector<TypeName>         myNames;   //!< names added to the table
+  NCollection_Array1<Standard_Integer> mySeeds;   //!< seeds of buckets
+  NCollection_Array1<Standard_Integer> mySlots;   //!< index of name in myNames + 1 for each slot, 0 if empty
+  Standard_Size                        mySlotMask;
+  Standard_Integer                     myNbNames;
+
+};
+
+#endif // _StepData_TypeNameTable_HeaderFile
@@ -36,12 +36,21 @@
 #include <Message_Messenger.hxx>
 
 #include <OSD_FileSystem.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <OSD_Timer.hxx>
 
+#include <NCollection_Array1.hxx>
+#include <NCollection_Buffer.hxx>
+#include <NCollection_Vector.hxx>
+
 #include "step.tab.hxx"
 
 #include <stdio.h>
 
+#include <algorithm>
+#include <cctype>
+#include <vector>
+
 #ifdef OCCT_DEBUG
 #define CHRONOMESURE
 #endif
@@ -55,6 +64,332 @@ void StepFile_Interrupt(Standard_CString theErrorMessage, const Standard_Boolean
   sout << "**** ERR StepFile : " << theErrorMessage << "    ****" << std::endl;
 }
 
+namespace
+{
+  //! Text framing a part of the DATA section to make it a complete STEP file for the parser.
+  //! Line breaks are intentionally omitted to keep line numbers in error messages.
+  static const char THE_CHUNK_PREFIX[] = "ISO-10303-21;HEADER;ENDSEC;DATA;";
+  static const char THE_CHUNK_SUFFIX[] = "ENDSEC;END-ISO-10303-21;";
+
+  //! Minimal size of the DATA section part processed by one parsing job.
+  static const size_t THE_MIN_CHUNK_SIZE = 1024 * 1024;
+
+  //! Read-only stream buffer presenting a part of the file kept in memory (e.g. mapped file),
+  //! optionally framed by prefix and suffix texts.
+  //! The text is not copied, so the memory should be kept until the end of the parsing.
+  class StepFile_ChunkStreamBuf : public std::streambuf
+  {
+  public:
+
+    //! Main constructor.
+    StepFile_ChunkStreamBuf (const char* thePrefix,
+                             const char* theData, size_t theDataLen,
+                             const char* theSuffix)
+    : mySegment (0)
+    {
+      mySegments[0] = thePrefix;
+      mySegments[1] = theData;
+      mySegments[2] = theSuffix;
+      myLengths[0]  = thePrefix != NULL ? strlen (thePrefix) : 0;
+      myLengths[1]  = theDataLen;
+      myLengths[2]  = theSuffix != NULL ? strlen (theSuffix) : 0;
+      setg (NULL, NULL, NULL);
+    }
+
+  protected:
+
+    //! Switches to the next non-empty segment.
+    virtual int_type underflow() Standard_OVERRIDE
+    {
+      if (gptr() < egptr())
+      {
+        return traits_type::to_int_type (*gptr());
+      }
+      for (; mySegment < 3; ++mySegment)
+      {
+        if (myLengths[mySegment] == 0)
+        {
+          continue;
+        }
+        char* aBegin = const_cast<char*> (mySegments[mySegment]);
+        setg (aBegin, aBegin, aBegin + myLengths[mySegment]);
+        ++mySegment;
+        return traits_type::to_int_type (*gptr());
+      }
+      return traits_type::eof();
+    }
+
+  private:
+    const char* mySegments[3];
+    size_t      myLengths[3];
+    int         mySegment;
+  };
+
+  //! Part of the file to be parsed by its own scanner and parser.
+  struct StepFile_Chunk
+  {
+    const char*       Prefix;     //!< text preceding the chunk, or NULL
+    const char*       Data;       //!< start of the chunk in the file content
+    size_t            DataLen;    //!< length of the chunk
+    const char*       Suffix;     //!< text following the chunk, or NULL
+    int               LineNumber; //!< number of the first line of the chunk in the file
+    int               Status;     //!< parsing status: 0 on success, 1 in case of parsing error
+    StepFile_ReadData DataModel;  //!< records and arguments read from the chunk
+
+    StepFile_Chunk() : Prefix (NULL), Data (NULL), DataLen (0), Suffix (NULL), LineNumber (1), Status (0) {}
+  };
+
+  //! Returns TRUE if the character can be a part of the keyword or type name.
+  static bool isNameChar (const char theChar)
+  {
+    return (theChar >= 'A' && theChar <= 'Z')
+        || (theChar >= 'a' && theChar <= 'z')
+        || (theChar >= '0' && theChar <= '9')
+        || theChar == '_';
+  }
+
+  //! Returns TRUE if the buffer at theIter starts with the given keyword (case-insensitive),
+  //! which is not a tail of the longer name.
+  static bool isKeyword (const char* theBegin, const char* theIter, const char* theEnd,
+                         const char* theKeyword)
+  {
+    if (theIter != theBegin && isNameChar (theIter[-1]))
+    {
+      return false;
+    }
+    for (; *theKeyword != '\0'; ++theKeyword, ++theIter)
+    {
+      if (theIter == theEnd
+       || toupper ((unsigned char )*theIter) != *theKeyword)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //! Splits the DATA section of the file into the parts starting at entity instances "#id=".
+  //! The scan follows the lexical rules of the parser for comments and text strings,
+  //! so that split positions are always at the boundary of top-level records.
+  //! @param theBuffer   file content
+  //! @param theLength   file content length
+  //! @param theNbChunks requested number of parts
+  //! @param theSplits   positions of the parts found, each with the number of its first line
+  //! @return FALSE if the file cannot be split (e.g. DATA section contains scopes)
+  static bool splitDataSection (const char* theBuffer, const size_t theLength,
+                                const int theNbChunks,
+                                NCollection_Vector<std::pair<size_t, int> >& theSplits)
+  {
+    const char* const anEnd = theBuffer + theLength;
+    const char* aDataStart = NULL;
+    size_t aChunkSize = 0, aNextSplit = 0;
+    int aNbLines = 1;
+    bool isAfterRecord = false;
+    for (const char* anIter = theBuffer; anIter < anEnd; ++anIter)
+    {
+      const char aChar = *anIter;
+      if (aChar == '\n')
+      {
+        ++aNbLines;
+        continue;
+      }
+      if (aChar == ' ' || aChar == '\t' || aChar == '\r' || aChar == '\0')
+      {
+        continue;
+      }
+      if (aChar == '/' && anIter + 1 < anEnd && anIter[1] == '*')
+      {
+        // skip comment
+        for (anIter += 2; anIter < anEnd; ++anIter)
+        {
+          if (*anIter == '\n')
+          {
+            ++aNbLines;
+          }
+          else if (*anIter == '*' && anIter + 1 < anEnd && anIter[1] == '/')
+          {
+            ++anIter;
+            break;
+          }
+        }
+        continue;
+      }
+
+      const bool wasAfterRecord = isAfterRecord;
+      isAfterRecord = false;
+      if (aChar == '\'')
+      {
+        // skip text string; it is finished by apostrophe followed by comma or closing parenthesis
+        for (++anIter; anIter < anEnd; ++anIter)
+        {
+          if (*anIter == '\n')
+          {
+            ++aNbLines;
+          }
+          else if (*anIter == '\'')
+          {
+            const char* aNext = anIter + 1;
+            for (; aNext < anEnd && (*aNext == ' ' || *aNext == '\n' || *aNext == '\r'); ++aNext) {}
+            if (aNext < anEnd && (*aNext == ')' || *aNext == ','))
+            {
+              break;
+            }
+          }
+        }
+        continue;
+      }
+      else if (aChar == ';')
+      {
+        isAfterRecord = true;
+        continue;
+      }
+
+      if (aDataStart == NULL)
+      {
+        if (isKeyword (theBuffer, anIter, anEnd, "DATA;"))
+        {
+          aDataStart = anIter;
+          aChunkSize = std::max ((size_t )(theLength - (anIter - theBuffer)) / (size_t )theNbChunks, THE_MIN_CHUNK_SIZE);
+          aNextSplit = (size_t )(anIter - theBuffer) + aChunkSize;
+          anIter += 4;
+          isAfterRecord = true;
+        }
+        continue;
+      }
+
+      if (aChar == '&')
+      {
+        // scopes may span over the whole DATA section
+        return false;
+      }
+      else if (aChar == '#')
+      {
+        const size_t aPos = (size_t )(anIter - theBuffer);
+        if (wasAfterRecord && aPos >= aNextSplit)
+        {
+          theSplits.Append (std::make_pair (aPos, aNbLines));
+          aNextSplit = aPos + aChunkSize;
+        }
+      }
+      else if ((aChar == 'E' || aChar == 'e')
+             && isKeyword (theBuffer, anIter, anEnd, "ENDSEC;"))
+      {
+        break;
+      }
+    }
+    return aDataStart != NULL;
+  }
+
+  //! Functor for parsing chunks of the file in parallel threads.
+  class StepFile_ChunkParser
+  {
+  public:
+
+    //! Main constructor.
+    StepFile_ChunkParser (NCollection_Array1<StepFile_Chunk>& theChunks)
+    : myChunks (theChunks) {}
+
+    //! Parses the chunk.
+    void operator() (int theThreadIndex, int theChunkIndex) const
+    {
+      (void )theThreadIndex;
+      StepFile_Chunk& aChunk = myChunks.ChangeValue (theChunkIndex);
+      aChunk.Status = StepFile_ChunkParser::Parse (aChunk);
+    }
+
+    //! Parses the chunk within the current thread.
+    //! @return 0 on success, 1 in case of parsing error
+    static int Parse (StepFile_Chunk& theChunk)
+    {
+      StepFile_ChunkStreamBuf aBuffer (theChunk.Prefix, theChunk.Data, theChunk.DataLen, theChunk.Suffix);
+      std::istream aStream (&aBuffer);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        step::scanner aScanner (&theChunk.DataModel, &aStream);
+        aScanner.yyrestart (&aStream);
+        aScanner.SetLineNumber (theChunk.LineNumber);
+        step::parser aParser (&aScanner);
+        if (aParser.parse() != 0)
+        {
+          return 1;
+        }
+      }
+      catch (Standard_Failure const& anException)
+      {
+        theChunk.DataModel.AddError (anException.GetMessageString());
+        return 1;
+      }
+      return 0;
+    }
+
+  private:
+    NCollection_Array1<StepFile_Chunk>& myChunks;
+  };
+
+  //! Reads the whole stream into memory.
+  static bool readStreamContent (std::istream& theStream, std::vector<char>& theContent)
+  {
+    const std::streampos aStartPos = theStream.tellg();
+    theStream.seekg (0, std::ios::end);
+    const std::streampos anEndPos = theStream.tellg();
+    if (aStartPos >= 0 && anEndPos >= aStartPos)
+    {
+      theStream.seekg (aStartPos);
+      theContent.resize ((size_t )(anEndPos - aStartPos));
+      theStream.read (theContent.data(), (std::streamsize )theContent.size());
+      theContent.resize ((size_t )theStream.gcount());
+      return !theStream.bad();
+    }
+
+    // stream does not support positioning
+    theStream.clear();
+    char aBuffer[4096];
+    while (theStream.read (aBuffer, sizeof(aBuffer)) || theStream.gcount() > 0)
+    {
+      theContent.insert (theContent.end(), aBuffer, aBuffer + theStream.gcount());
+    }
+    return !theStream.bad();
+  }
+
+  //! Parses the file content kept in memory, split into several chunks parsed in parallel threads.
+  //! @param theData      file content
+  //! @param theDataLen   file content length
+  //! @param theSplits    positions of chunks after the first one
+  //! @param theNbThreads number of threads to use
+  //! @param theChunks    output chunks holding the parsed data
+  static void parseChunks (const char* theData,
+                           const size_t theDataLen,
+                           const NCollection_Vector<std::pair<size_t, int> >& theSplits,
+                           const int theNbThreads,
+                           NCollection_Array1<StepFile_Chunk>& theChunks)
+  {
+    const int aNbChunks = theChunks.Size();
+    for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      StepFile_Chunk& aChunk = theChunks.ChangeValue (aChunkIter);
+      const size_t aBegin = aChunkIter == 0 ? 0 : theSplits.Value (aChunkIter - 1).first;
+      const size_t anEnd  = aChunkIter == aNbChunks - 1 ? theDataLen : theSplits.Value (aChunkIter).first;
+      aChunk.Prefix     = aChunkIter == 0 ? NULL : THE_CHUNK_PREFIX;
+      aChunk.Suffix     = aChunkIter == aNbChunks - 1 ? NULL : THE_CHUNK_SUFFIX;
+      aChunk.Data       = theData + aBegin;
+      aChunk.DataLen    = anEnd - aBegin;
+      aChunk.LineNumber = aChunkIter == 0 ? 1 : theSplits.Value (aChunkIter - 1).second;
+    }
+
+    if (aNbChunks == 1)
+    {
+      StepFile_Chunk& aChunk = theChunks.ChangeFirst();
+      aChunk.Status = StepFile_ChunkParser::Parse (aChunk);
+      return;
+    }
+
+    OSD_ThreadPool::Launcher aLauncher (*OSD_ThreadPool::DefaultPool(), Min (theNbThreads, aNbChunks));
+    StepFile_ChunkParser aFunctor (theChunks);
+    aLauncher.Perform (0, aNbChunks, aFunctor);
+  }
+}
+
 static Standard_Integer StepFile_Read (const char* theName,
                                        std::istream* theIStream,
                                        const Handle(StepData_StepModel)& theStepModel,
@@ -62,16 +397,23 @@ static Standard_Integer StepFile_Read (const char* theName,
                                        const Handle(StepData_FileRecognizer)& theRecogHeader,
                                        const Handle(StepData_FileRecognizer)& theRecogData)
 {
-  // if stream is not provided, open file stream here
+  // if stream is not provided, open the file as memory buffer to be scanned in place,
+  // or open file stream if file system cannot provide such buffer
   std::istream* aStreamPtr = theIStream;
   std::shared_ptr<std::istream> aFileStream;
+  Handle(NCollection_Buffer) aFileBuffer;
   if (aStreamPtr == nullptr)
   {
     const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
-    aFileStream = aFileSystem->OpenIStream (theName, std::ios::in | std::ios::binary);
-    aStreamPtr = aFileStream.get();
+    aFileBuffer = aFileSystem->OpenMemoryBuffer (theName);
+    if (aFileBuffer.IsNull())
+    {
+      aFileStream = aFileSystem->OpenIStream (theName, std::ios::in | std::ios::binary);
+      aStreamPtr = aFileStream.get();
+    }
   }
-  if (aStreamPtr == nullptr || aStreamPtr->fail())
+  if (aFileBuffer.IsNull()
+   && (aStreamPtr == nullptr || aStreamPtr->fail()))
   {
     return -1;
   }
@@ -85,23 +427,72 @@ static Standard_Integer StepFile_Read (const char* theName,
   Message_Messenger::StreamBuffer sout = Message::SendTrace();
   sout << "      ...    Step File Reading : '" << theName << "'";
 
-  StepFile_ReadData aFileDataModel;
-  try {
-    OCC_CATCH_SIGNALS
-    int aLetat = 0;
-    step::scanner aScanner(&aFileDataModel, aStreamPtr);
-    aScanner.yyrestart(aStreamPtr);
-    step::parser aParser(&aScanner);
-    aLetat = aParser.parse();
-    if (aLetat != 0) {
-      StepFile_Interrupt(aFileDataModel.GetLastError(), Standard_True);
+  // file content kept in memory: either mapped file,
+  // or stream content loaded in parallel mode to be split into chunks
+  const Standard_Boolean isParallel = theStepModel->InternalParameters.ReadParallelParse;
+  const char* aData = NULL;
+  size_t aDataLen = 0;
+  std::vector<char> aContent;
+  if (!aFileBuffer.IsNull())
+  {
+    aData    = (const char* )aFileBuffer->Data();
+    aDataLen = aFileBuffer->Size();
+  }
+  else if (isParallel)
+  {
+    if (!readStreamContent (*aStreamPtr, aContent))
+    {
+      return -1;
+    }
+    aData    = aContent.data();
+    aDataLen = aContent.size();
+  }
+
+  int aNbThreads = 1;
+  NCollection_Vector<std::pair<size_t, int> > aSplits;
+  if (isParallel)
+  {
+    aNbThreads = theStepModel->InternalParameters.ReadNbThreads > 0
+               ? theStepModel->InternalParameters.ReadNbThreads
+               : OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch();
+    // use more chunks than threads to balance the load
+    if (aNbThreads < 2
+    || !splitDataSection (aData, aDataLen, aNbThreads * 4, aSplits))
+    {
+      aSplits.Clear();
+    }
+  }
+
+  // parsed parts of the file, in the order of the file; single part for sequential reading
+  NCollection_Array1<StepFile_Chunk> aChunks (0, aSplits.Length());
+  if (aData != NULL)
+  {
+    parseChunks (aData, aDataLen, aSplits, aNbThreads, aChunks);
+  }
+  else
+  {
+    try {
+      OCC_CATCH_SIGNALS
+      int aLetat = 0;
+      step::scanner aScanner(&aChunks.ChangeFirst().DataModel, aStreamPtr);
+      aScanner.yyrestart(aStreamPtr);
+      step::parser aParser(&aScanner);
+      aLetat = aParser.parse();
+      aChunks.ChangeFirst().Status = aLetat != 0 ? 1 : 0;
+    }
+    catch (Standard_Failure const& anException) {
+      Message::SendFail() << " ...  Exception Raised while reading Step File : '" << theName << "':\n"
+                          << anException << "    ...";
       return 1;
     }
   }
-  catch (Standard_Failure const& anException) {
-    Message::SendFail() << " ...  Exception Raised while reading Step File : '" << theName << "':\n"
-                        << anException << "    ...";
-    return 1;
+
+  for (NCollection_Array1<StepFile_Chunk>::Iterator aChunkIter (aChunks); aChunkIter.More(); aChunkIter.Next())
+  {
+    if (aChunkIter.Value().Status != 0) {
+      StepFile_Interrupt(aChunkIter.Value().DataModel.GetLastError(), Standard_True);
+      return 1;
+    }
   }
 
 #ifdef CHRONOMESURE
@@ -110,26 +501,44 @@ static Standard_Integer StepFile_Read (const char* theName,
 
   sout << "      ...    STEP File   Read    ...\n";
 
-  Standard_Integer nbhead, nbrec, nbpar;
-  aFileDataModel.GetFileNbR (&nbhead,&nbrec,&nbpar);  // renvoi par lex/yacc
+  // header records are read from the first chunk only
+  Standard_Integer nbhead = 0, nbrec = 0, nbpar = 0;
+  for (NCollection_Array1<StepFile_Chunk>::Iterator aChunkIter (aChunks); aChunkIter.More(); aChunkIter.Next())
+  {
+    Standard_Integer aNbHead = 0, aNbRec = 0, aNbPar = 0;
+    aChunkIter.ChangeValue().DataModel.GetFileNbR (&aNbHead, &aNbRec, &aNbPar);  // renvoi par lex/yacc
+    nbhead += aNbHead;
+    nbrec  += aNbRec;
+    nbpar  += aNbPar;
+  }
   Handle(StepData_StepReaderData) undirec =
     new StepData_StepReaderData(nbhead,nbrec,nbpar, theStepModel->SourceCodePage());  // creation tableau de records
-  for ( Standard_Integer nr = 1; nr <= nbrec; nr ++) {
-    int nbarg; char* ident; char* typrec = 0;
-    aFileDataModel.GetRecordDescription(&ident, &typrec, &nbarg);
-    undirec->SetRecord (nr, ident, typrec, nbarg);
-
-    if (nbarg>0) {
-      Interface_ParamType typa; char* val;
-      while(aFileDataModel.GetArgDescription (&typa, &val) == 1) {
-        undirec->AddStepParam (nr, val, typa);
+  Standard_Integer nr = 1;
+  for (NCollection_Array1<StepFile_Chunk>::Iterator aChunkIter (aChunks); aChunkIter.More(); aChunkIter.Next())
+  {
+    StepFile_ReadData& aFileDataModel = aChunkIter.ChangeValue().DataModel;
+    const Standard_Integer aNbChunkRec = aFileDataModel.GetNbRecord();
+    for (Standard_Integer aRecIter = 1; aRecIter <= aNbChunkRec; aRecIter ++, nr ++) {
+      int nbarg; char* ident; char* typrec = 0;
+      aFileDataModel.GetRecordDescription(&ident, &typrec, &nbarg);
+      undirec->SetRecord (nr, ident, typrec, nbarg);
+
+      if (nbarg>0) {
+        Interface_ParamType typa; char* val;
+        while(aFileDataModel.GetArgDescription (&typa, &val) == 1) {
+          undirec->AddStepParam (nr, val, typa);
+        }
       }
+      undirec->InitParams(nr);
+      aFileDataModel.NextRecord();
     }
-    undirec->InitParams(nr);
-    aFileDataModel.NextRecord();
   }
 
-  aFileDataModel.ErrorHandle(undirec->GlobalCheck());
+  for (NCollection_Array1<StepFile_Chunk>::Iterator aChunkIter (aChunks); aChunkIter.More(); aChunkIter.Next())
+  {
+    aChunkIter.Value().DataModel.ErrorHandle(undirec->GlobalCheck());
+    aChunkIter.ChangeValue().DataModel.ClearRecorder(1);
+  }
   Standard_Integer anFailsCount = undirec->GlobalCheck()->NbFails();
   if (anFailsCount > 0)
   {
@@ -137,8 +546,6 @@ static Standard_Integer StepFile_Read (const char* theName,
       << anFailsCount << " ****";
   }
 
-  aFileDataModel.ClearRecorder(1);
-
   sout << "      ... Step File loaded  ...\n";
   sout << "   " << undirec->NbRecords() << " records (entities,sub-lists,scopes), " << nbpar << " parameters";
 
@@ -153,6 +560,10 @@ static Standard_Integer StepFile_Read (const char* theName,
 
   readtool.PrepareHeader(theRecogHeader);  // Header. reco nul -> pour Protocol
   readtool.Prepare(theRecogData);          // Data.   reco nul -> pour Protocol
+  if (theStepModel->InternalParameters.ReadParallelEntities)
+  {
+    readtool.ReadEntities (theStepModel->InternalParameters.ReadNbThreads);
+  }
 
   sout << "      ... Parameters prepared ...\n";
 
@@ -162,7 +573,10 @@ static Standard_Integer StepFile_Read (const char* theName,
 
   readtool.LoadModel(theStepModel);
   if (theStepModel->Protocol().IsNull()) theStepModel->SetProtocol (theProtocol);
-  aFileDataModel.ClearRecorder(2);
+  for (NCollection_Array1<StepFile_Chunk>::Iterator aChunkIter (aChunks); aChunkIter.More(); aChunkIter.Next())
+  {
+    aChunkIter.ChangeValue().DataModel.ClearRecorder(2);
+  }
   anFailsCount = undirec->GlobalCheck()->NbFails() - anFailsCount;
   if (anFailsCount > 0)
   {
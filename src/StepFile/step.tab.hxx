@@ -853,6 +853,10 @@ namespace step {
 
       int lex(step::parser::semantic_type* yylval);
 
+      //! Sets the number of the current line;
+      //! used when only a part of the file is given to the scanner
+      void SetLineNumber(int theLineNumber) { yylineno = theLineNumber; }
+
       StepFile_ReadData* myDataModel;
     };
 
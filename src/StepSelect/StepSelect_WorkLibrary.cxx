@@ -94,6 +94,8 @@ Standard_Boolean  StepSelect_WorkLibrary::WriteFile
   }
   sout << " Step File Name : "<<ctx.FileName();
   StepData_StepWriter SW(stepmodel);
+  // lines are written as soon as produced, the text of the file is not kept
+  SW.SetStream (aStream.get());
   sout<<"("<<stepmodel->NbEntities()<<" ents) ";
 
 //  File Modifiers
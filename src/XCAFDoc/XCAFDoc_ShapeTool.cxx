@@ -91,6 +91,8 @@ Handle(XCAFDoc_ShapeTool) XCAFDoc_ShapeTool::Set(const TDF_Label& L)
 //=======================================================================
 
 XCAFDoc_ShapeTool::XCAFDoc_ShapeTool()
+: hasAutoNaming (Standard_False),
+  myIsAutoNaming (Standard_True)
 {
   hasSimpleShapes = Standard_False;
 }
@@ -442,7 +444,7 @@ void XCAFDoc_ShapeTool::SetShape (const TDF_Label& L, const TopoDS_Shape& S)
 
 void XCAFDoc_ShapeTool::MakeReference (const TDF_Label &L, 
 				    const TDF_Label &refL,
-				    const TopLoc_Location &loc)
+				    const TopLoc_Location &loc) const
 {
   // store location
   XCAFDoc_Location::Set(L, loc);
@@ -454,7 +456,7 @@ void XCAFDoc_ShapeTool::MakeReference (const TDF_Label &L,
   refNode->Remove(); // abv: fix against bug in TreeNode::Append()
   mainNode->Append(refNode);
 
-  if (theAutoNaming)
+  if (IsAutoNaming())
     SetLabelNameByLink(L);
 }
 
@@ -529,7 +531,7 @@ TDF_Label XCAFDoc_ShapeTool::addShape (const TopoDS_Shape& S, const Standard_Boo
 //  }
   A->SetShape(S);
   
-  if (theAutoNaming)
+  if (IsAutoNaming())
     SetLabelNameByShape(ShapeLabel);
 
   // if shape is Compound and flag is set, create assembly
@@ -537,7 +539,7 @@ TDF_Label XCAFDoc_ShapeTool::addShape (const TopoDS_Shape& S, const Standard_Boo
     // mark assembly by assigning UAttribute
     Handle(TDataStd_UAttribute) Uattr;
     Uattr = TDataStd_UAttribute::Set ( ShapeLabel, XCAFDoc::AssemblyGUID() );
-    if (theAutoNaming)
+    if (IsAutoNaming())
       TDataStd_Name::Set(ShapeLabel, TCollection_ExtendedString("ASSEMBLY"));
 
     // iterate on components
@@ -706,6 +708,40 @@ Standard_Boolean XCAFDoc_ShapeTool::AutoNaming()
 }
 
 
+//=======================================================================
+//function : SetDocumentAutoNaming
+//purpose  : 
+//=======================================================================
+
+void XCAFDoc_ShapeTool::SetDocumentAutoNaming (const Standard_Boolean theIsAutoNaming)
+{
+  hasAutoNaming = Standard_True;
+  myIsAutoNaming = theIsAutoNaming;
+}
+
+
+//=======================================================================
+//function : UnsetDocumentAutoNaming
+//purpose  : 
+//=======================================================================
+
+void XCAFDoc_ShapeTool::UnsetDocumentAutoNaming()
+{
+  hasAutoNaming = Standard_False;
+}
+
+
+//=======================================================================
+//function : IsAutoNaming
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean XCAFDoc_ShapeTool::IsAutoNaming() const
+{
+  return hasAutoNaming ? myIsAutoNaming : theAutoNaming;
+}
+
+
 //=======================================================================
 //function : ComputeShapes
 //purpose  : 
@@ -1564,7 +1600,7 @@ Standard_Boolean XCAFDoc_ShapeTool::SetSHUO (const TDF_LabelSequence& labels,
   
   TDF_TagSource aTag;
   TDF_Label UpperSubL = aTag.NewChild( labels( 1 ) );
-  if (theAutoNaming) {
+  if (IsAutoNaming()) {
     TCollection_ExtendedString Entry("SHUO");
     TDataStd_Name::Set(UpperSubL, TCollection_ExtendedString( Entry ));
   }
@@ -1575,7 +1611,7 @@ Standard_Boolean XCAFDoc_ShapeTool::SetSHUO (const TDF_LabelSequence& labels,
   // add other next_usage occurrences.
   for (i = 2; i <= labels.Length(); i++) {
     TDF_Label NextSubL = aTag.NewChild( labels( i ) );
-    if (theAutoNaming) {
+    if (IsAutoNaming()) {
       TCollection_ExtendedString EntrySub("SHUO-");
       EntrySub += i;
       TDataStd_Name::Set(NextSubL, TCollection_ExtendedString( EntrySub ));
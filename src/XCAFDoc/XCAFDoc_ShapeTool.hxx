@@ -218,7 +218,7 @@ public:
   //! as assemblies (creates assembly structure).
   //! NOTE: <makePrepare> replace components without location
   //! in assembly by located components to avoid some problems.
-  //! If AutoNaming() is True then automatically attaches names.
+  //! If IsAutoNaming() is True then automatically attaches names.
   Standard_EXPORT TDF_Label AddShape (const TopoDS_Shape& S, const Standard_Boolean makeAssembly = Standard_True, const Standard_Boolean makePrepare = Standard_True);
   
   //! Removes shape (whole label and all its sublabels)
@@ -238,8 +238,8 @@ public:
   //! "=>[0:1:1:2]" (where a tag is a label containing a shape
   //! without a location); for assemblies it is "ASSEMBLY", and
   //! "SHUO" for SHUO's.
-  //! This setting is global; it cannot be made a member function
-  //! as it is used by static methods as well.
+  //! This setting is global; it may be overridden for a document
+  //! by SetDocumentAutoNaming().
   //! By default, auto-naming is enabled.
   //! See also AutoNaming().
   Standard_EXPORT static void SetAutoNaming (const Standard_Boolean V);
@@ -247,6 +247,23 @@ public:
   //! Returns current auto-naming mode. See SetAutoNaming() for
   //! description.
   Standard_EXPORT static Standard_Boolean AutoNaming();
+
+  //! Sets auto-naming mode of this document, which is then used
+  //! by this tool instead of the global mode set by SetAutoNaming().
+  //! Unlike the global mode, it does not affect other documents,
+  //! which may be filled concurrently.
+  //! The mode of the document is neither stored nor copied with the document.
+  Standard_EXPORT void SetDocumentAutoNaming (const Standard_Boolean theIsAutoNaming);
+
+  //! Removes auto-naming mode of this document; the global mode is used again.
+  Standard_EXPORT void UnsetDocumentAutoNaming();
+
+  //! Returns True if auto-naming mode is set for this document.
+  Standard_Boolean HasDocumentAutoNaming() const { return hasAutoNaming; }
+
+  //! Returns auto-naming mode used for this document: the mode
+  //! of the document if it is set, the global mode otherwise.
+  Standard_EXPORT Standard_Boolean IsAutoNaming() const;
   
   //! recursive
   Standard_EXPORT void ComputeShapes (const TDF_Label& L);
@@ -457,7 +474,7 @@ private:
   
   //! Makes a shape on label L to be a reference to shape refL
   //! with location loc
-  Standard_EXPORT static void MakeReference (const TDF_Label& L, const TDF_Label& refL, const TopLoc_Location& loc);
+  Standard_EXPORT void MakeReference (const TDF_Label& L, const TDF_Label& refL, const TopLoc_Location& loc) const;
 
   //! Auxiliary method for Expand
   //! Add declared under expanded theMainShapeL subshapes to new part label thePart
@@ -468,6 +485,8 @@ private:
   XCAFDoc_DataMapOfShapeLabel mySubShapes;
   XCAFDoc_DataMapOfShapeLabel mySimpleShapes;
   Standard_Boolean hasSimpleShapes;
+  Standard_Boolean hasAutoNaming;  //!< flag indicating that auto-naming mode is set for the document
+  Standard_Boolean myIsAutoNaming; //!< auto-naming mode of the document
 
 
 };
@@ -17,6 +17,7 @@
 #include <IFSelect_Functions.hxx>
 #include <IFSelect_SessionPilot.hxx>
 #include <Interface_Static.hxx>
+#include <Interface_StaticSnapshot.hxx>
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
 #include <TColStd_HSequenceOfTransient.hxx>
@@ -454,6 +455,33 @@ static IFSelect_ReturnStatus XSControl_settransfert(const Handle(IFSelect_Sessio
 }
 
 
+//=======================================================================
+//function : xparam
+//=======================================================================
+static IFSelect_ReturnStatus XSControl_xparam(const Handle(IFSelect_SessionPilot)& pilot)
+{
+  Standard_Integer argc = pilot->NbWords();
+  const Standard_CString arg1 = pilot->Arg(1);
+  //        ****    xparam        ****
+  Message_Messenger::StreamBuffer sout = Message::SendInfo();
+  if (argc < 2) {
+    sout<<"Give parameter name [and new value]"<<std::endl;
+    return IFSelect_RetError;
+  }
+  if (!Interface_Static::IsPresent(arg1)) {
+    sout<<" Parameter "<<arg1<<" undefined"<<std::endl;
+    return IFSelect_RetError;
+  }
+  Handle(XSControl_WorkSession) WS = XSControl::Session(pilot);
+  if (argc > 2 && !WS->SetParameter (arg1, pilot->Arg(2))) {
+    sout<<" Value "<<pilot->Arg(2)<<" not accepted for parameter "<<arg1<<std::endl;
+    return IFSelect_RetFail;
+  }
+  Interface_StaticSnapshot::Sentry aParamsSentry (WS->Parameters());
+  sout<<arg1<<" : "<<Interface_Static::CVal(arg1)<<std::endl;
+  return (argc > 2 ? IFSelect_RetDone : IFSelect_RetVoid);
+}
+
 
 static int THE_XSControl_Functions_initactor = 0;
 
@@ -475,6 +503,8 @@ void XSControl_Functions::Init ()
   IFSelect_Act::AddFunc ("xinit","[norm:string to change norme] reinitialises according to the norm",XSControl_xinit);
   IFSelect_Act::AddFunc ("xnorm","displays current norm   +norm : changes it",XSControl_xnorm);
 
+  IFSelect_Act::AddFunc ("xparam","par_name [par_value] : displays or changes the parameter for the session only (not the global value)",XSControl_xparam);
+
   IFSelect_Act::AddFunc ("newmodel","produces a new empty model, for the session",XSControl_newmodel);
 
   IFSelect_Act::AddFunc ("tpclear","Clears  TransferProcess (READ)",XSControl_tpclear);
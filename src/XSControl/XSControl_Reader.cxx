@@ -122,6 +122,7 @@ Handle(XSControl_WorkSession) XSControl_Reader::WS () const
 
 IFSelect_ReturnStatus  XSControl_Reader::ReadFile (const Standard_CString filename)
 {
+  Interface_StaticSnapshot::Sentry aParamsSentry (thesession->Parameters());
   IFSelect_ReturnStatus stat = thesession->ReadFile(filename);
   thesession->InitTransferReader(4);
   return stat;
@@ -135,6 +136,7 @@ IFSelect_ReturnStatus  XSControl_Reader::ReadFile (const Standard_CString filena
 IFSelect_ReturnStatus  XSControl_Reader::ReadStream(const Standard_CString theName,
                                                     std::istream& theIStream)
 {
+  Interface_StaticSnapshot::Sentry aParamsSentry (thesession->Parameters());
   IFSelect_ReturnStatus stat = thesession->ReadStream(theName, theIStream);
   thesession->InitTransferReader(4);
   return stat;
@@ -253,6 +255,7 @@ Standard_Boolean  XSControl_Reader::TransferEntity
   (const Handle(Standard_Transient)& start, const Message_ProgressRange& theProgress)
 {
   if (start.IsNull()) return Standard_False;
+  Interface_StaticSnapshot::Sentry aParamsSentry (thesession->Parameters());
   const Handle(XSControl_TransferReader) &TR = thesession->TransferReader();
   TR->BeginTransfer();
   if (TR->TransferOne (start, Standard_True, theProgress) == 0) return Standard_False;
@@ -277,6 +280,7 @@ Standard_Integer  XSControl_Reader::TransferList
   if (list.IsNull()) return 0;
   Standard_Integer nbt = 0;
   Standard_Integer i, nb = list->Length();
+  Interface_StaticSnapshot::Sentry aParamsSentry (thesession->Parameters());
   const Handle(XSControl_TransferReader) &TR = thesession->TransferReader();
   TR->BeginTransfer();
   ClearShapes();
@@ -304,6 +308,7 @@ Standard_Integer  XSControl_Reader::TransferRoots (const Message_ProgressRange&
   NbRootsForTransfer();
   Standard_Integer nbt = 0;
   Standard_Integer i, nb = theroots.Length();
+  Interface_StaticSnapshot::Sentry aParamsSentry (thesession->Parameters());
   const Handle(XSControl_TransferReader) &TR = thesession->TransferReader();
    
   TR->BeginTransfer();
@@ -181,7 +181,7 @@ public:
   //! Translates all translatable
   //! roots and returns the number of successful translations.
   //! Warning - This function clears existing output shapes first.
-  Standard_EXPORT Standard_Integer TransferRoots(const Message_ProgressRange& theProgress = Message_ProgressRange());
+  Standard_EXPORT virtual Standard_Integer TransferRoots(const Message_ProgressRange& theProgress = Message_ProgressRange());
   
   //! Clears the list of shapes that
   //! may have accumulated in calls to TransferOne or TransferRoot.C
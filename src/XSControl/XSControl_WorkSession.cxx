@@ -397,6 +397,7 @@ Standard_Integer XSControl_WorkSession::TransferReadOne (const Handle(Standard_T
   Handle(Interface_InterfaceModel) model = Model();
   if (ent == model) return TransferReadRoots(theProgress);
 
+  Interface_StaticSnapshot::Sentry aParamsSentry (myParameters);
   Handle(TColStd_HSequenceOfTransient) list = GiveList(ent);
   if (list->Length() == 1)
     return myTransferReader->TransferOne(list->Value(1), Standard_True, theProgress);
@@ -412,6 +413,7 @@ Standard_Integer XSControl_WorkSession::TransferReadOne (const Handle(Standard_T
 
 Standard_Integer XSControl_WorkSession::TransferReadRoots (const Message_ProgressRange& theProgress)
 {
+  Interface_StaticSnapshot::Sentry aParamsSentry (myParameters);
   return myTransferReader->TransferRoots(Graph(), theProgress);
 }
 
@@ -459,6 +461,7 @@ IFSelect_ReturnStatus XSControl_WorkSession::TransferWriteShape (const TopoDS_Sh
     return IFSelect_RetVoid;
   }
 
+  Interface_StaticSnapshot::Sentry aParamsSentry (myParameters);
   status = myTransferWriter->TransferWriteShape(model, shape, theProgress);
   if (theProgress.UserBreak())
     return IFSelect_RetStop;
@@ -482,6 +485,68 @@ Interface_CheckIterator XSControl_WorkSession::TransferWriteCheckList () const
 }
 
 
+//=======================================================================
+//function : setParameter
+//purpose  :
+//=======================================================================
+template<typename TheSetter>
+Standard_Boolean XSControl_WorkSession::setParameter (TheSetter theSetter)
+{
+  // the bound snapshot may be in use, so the new value is set in a copy
+  Handle(Interface_StaticSnapshot) aParameters = myParameters.IsNull()
+                                               ? new Interface_StaticSnapshot()
+                                               : new Interface_StaticSnapshot (myParameters);
+  if (!theSetter (aParameters)) return Standard_False;
+  myParameters = aParameters;
+  return Standard_True;
+}
+
+
+//=======================================================================
+//function : SetParameter
+//purpose  :
+//=======================================================================
+
+Standard_Boolean XSControl_WorkSession::SetParameter (const Standard_CString theName,
+                                                      const Standard_CString theValue)
+{
+  return setParameter ([theName, theValue](const Handle(Interface_StaticSnapshot)& theParameters)
+  {
+    return theParameters->SetCVal (theName, theValue);
+  });
+}
+
+
+//=======================================================================
+//function : SetParameter
+//purpose  :
+//=======================================================================
+
+Standard_Boolean XSControl_WorkSession::SetParameter (const Standard_CString theName,
+                                                      const Standard_Integer theValue)
+{
+  return setParameter ([theName, theValue](const Handle(Interface_StaticSnapshot)& theParameters)
+  {
+    return theParameters->SetIVal (theName, theValue);
+  });
+}
+
+
+//=======================================================================
+//function : SetParameter
+//purpose  :
+//=======================================================================
+
+Standard_Boolean XSControl_WorkSession::SetParameter (const Standard_CString theName,
+                                                      const Standard_Real theValue)
+{
+  return setParameter ([theName, theValue](const Handle(Interface_StaticSnapshot)& theParameters)
+  {
+    return theParameters->SetRVal (theName, theValue);
+  });
+}
+
+
 //=======================================================================
 //function : ClearBinders
 //purpose  : 
@@ -22,6 +22,7 @@
 
 #include <IFSelect_WorkSession.hxx>
 #include <IFSelect_ReturnStatus.hxx>
+#include <Interface_StaticSnapshot.hxx>
 #include <XSControl_TransferWriter.hxx>
 class XSControl_Controller;
 class XSControl_TransferReader;
@@ -190,6 +191,37 @@ class XSControl_WorkSession : public IFSelect_WorkSession
   
   void SetVars (const Handle(XSControl_Vars)& theVars)
   { myVars = theVars; }
+
+  //! Returns the translation parameters bound to this session,
+  //! Null if the session uses the global values of Statics
+  const Handle(Interface_StaticSnapshot) & Parameters() const
+  { return myParameters; }
+
+  //! Binds the translation parameters to this session: they are made active
+  //! (see Interface_StaticSnapshot::Sentry) during reading, writing and transfers
+  //! performed through this session, instead of the global values of Statics.
+  //! This allows sessions with different parameters to work concurrently.
+  //! The snapshot should not be modified while it is bound.
+  //! Null means that the global values are used.
+  void SetParameters (const Handle(Interface_StaticSnapshot)& theParameters)
+  { myParameters = theParameters; }
+
+  //! Modifies the text value of the parameter for this session only.
+  //! The parameters bound to the session (or the current global values, if none)
+  //! are copied with the new value, then the copy is bound to the session.
+  //! Returns False if the parameter does not exist or the value is not accepted
+  Standard_EXPORT Standard_Boolean SetParameter (const Standard_CString theName,
+                                                 const Standard_CString theValue);
+
+  //! Modifies the integer value (or the case number of enumeration)
+  //! of the parameter for this session only, see SetParameter() above
+  Standard_EXPORT Standard_Boolean SetParameter (const Standard_CString theName,
+                                                 const Standard_Integer theValue);
+
+  //! Modifies the real value of the parameter for this session only,
+  //! see SetParameter() above
+  Standard_EXPORT Standard_Boolean SetParameter (const Standard_CString theName,
+                                                 const Standard_Real theValue);
   
   DEFINE_STANDARD_RTTIEXT(XSControl_WorkSession,IFSelect_WorkSession)
 
@@ -198,11 +230,17 @@ class XSControl_WorkSession : public IFSelect_WorkSession
   //! Clears binders
   Standard_EXPORT void ClearBinders();
 
+  //! Binds to the session a copy of its parameters (or of the global
+  //! values of Statics, if none) modified by the function
+  template<typename TheSetter>
+  Standard_Boolean setParameter (TheSetter theSetter);
+
   Handle(XSControl_Controller) myController;
   Handle(XSControl_TransferReader) myTransferReader;
   Handle(XSControl_TransferWriter) myTransferWriter;
   XSControl_WorkSessionMap myContext;
   Handle(XSControl_Vars) myVars;
+  Handle(Interface_StaticSnapshot) myParameters;
 };
 
 #endif // _XSControl_WorkSession_HeaderFile
@@ -72,7 +72,10 @@ XSControl_Writer::XSControl_Writer ()
 
     IFSelect_ReturnStatus  XSControl_Writer::WriteFile
   (const Standard_CString filename)
-      {  return thesession->SendAll(filename);  }
+{
+  Interface_StaticSnapshot::Sentry aParamsSentry (thesession->Parameters());
+  return thesession->SendAll(filename);
+}
 
     void  XSControl_Writer::PrintStatsTransfer
   (const Standard_Integer what, const Standard_Integer mode) const
@@ -13,6 +13,7 @@
 
 #include <XSDRAWDE.hxx>
 
+#include <BRep_Builder.hxx>
 #include <DBRep.hxx>
 #include <DDocStd.hxx>
 #include <DDocStd_DrawDocument.hxx>
@@ -27,7 +28,12 @@
 #include <Message.hxx>
 #include <TDataStd_Name.hxx>
 #include <TDocStd_Application.hxx>
+#include <TColStd_SequenceOfAsciiString.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Shape.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_Editor.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
 #include <XSControl_WorkSession.hxx>
 #include <XSDRAW.hxx>
 
@@ -279,6 +285,139 @@ static Standard_Integer ReadFile(Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+//function : ReadFiles
+//purpose  :
+//=======================================================================
+static Standard_Integer ReadFiles(Draw_Interpretor& theDI,
+                                  Standard_Integer theNbArgs,
+                                  const char** theArgVec)
+{
+  TCollection_AsciiString aDocShapeName;
+  TColStd_SequenceOfAsciiString aFilePaths;
+  TCollection_AsciiString aConfString;
+  Standard_Integer aNbThreads = 0;
+  Standard_Size aMemoryBudget = 0;
+  Standard_Boolean isNoDoc = (TCollection_AsciiString(theArgVec[0]) == "readfiles");
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if ((anArg == "-conf") &&
+        (anArgIter + 1 < theNbArgs))
+    {
+      ++anArgIter;
+      aConfString = theArgVec[anArgIter];
+    }
+    else if ((anArg == "-nbthreads") &&
+             (anArgIter + 1 < theNbArgs))
+    {
+      ++anArgIter;
+      aNbThreads = Draw::Atoi(theArgVec[anArgIter]);
+    }
+    else if ((anArg == "-memory") &&
+             (anArgIter + 1 < theNbArgs))
+    {
+      ++anArgIter;
+      const Standard_Real aMegaBytes = Draw::Atof(theArgVec[anArgIter]);
+      aMemoryBudget = aMegaBytes > 0.0 ? static_cast<Standard_Size>(aMegaBytes * 1024.0 * 1024.0) : 0;
+    }
+    else if (aDocShapeName.IsEmpty())
+    {
+      aDocShapeName = theArgVec[anArgIter];
+    }
+    else
+    {
+      aFilePaths.Append(theArgVec[anArgIter]);
+    }
+  }
+  if (aDocShapeName.IsEmpty() || aFilePaths.IsEmpty())
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  Handle(DE_Wrapper) aConf = DE_Wrapper::GlobalWrapper()->Copy();
+  if (!aConfString.IsEmpty() && !aConf->Load(aConfString))
+  {
+    return 1;
+  }
+
+  TColStd_Array1OfAsciiString aPaths(1, aFilePaths.Length());
+  TColStd_Array1OfBoolean aStatuses(1, aFilePaths.Length());
+  for (Standard_Integer anIndex = 1; anIndex <= aFilePaths.Length(); ++anIndex)
+  {
+    aPaths.SetValue(anIndex, aFilePaths.Value(anIndex));
+  }
+
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(theDI, 1);
+  if (isNoDoc)
+  {
+    NCollection_Array1<TopoDS_Shape> aShapes(1, aPaths.Length());
+    aConf->Read(aPaths, aShapes, aStatuses, aMemoryBudget, aNbThreads, aProgress->Start());
+    TopoDS_Compound aCompound;
+    BRep_Builder aBuilder;
+    aBuilder.MakeCompound(aCompound);
+    for (Standard_Integer anIndex = aShapes.Lower(); anIndex <= aShapes.Upper(); ++anIndex)
+    {
+      if (aStatuses.Value(anIndex) && !aShapes.Value(anIndex).IsNull())
+      {
+        aBuilder.Add(aCompound, aShapes.Value(anIndex));
+      }
+    }
+    DBRep::Set(aDocShapeName.ToCString(), aCompound);
+  }
+  else
+  {
+    // each file is read into its own document, then the shapes are merged into the target one
+    Handle(TDocStd_Application) anApp = DDocStd::GetApplication();
+    NCollection_Array1<Handle(TDocStd_Document)> aDocs(1, aPaths.Length());
+    for (Standard_Integer anIndex = aDocs.Lower(); anIndex <= aDocs.Upper(); ++anIndex)
+    {
+      anApp->NewDocument(TCollection_ExtendedString("BinXCAF"), aDocs.ChangeValue(anIndex));
+    }
+    aConf->Read(aPaths, aDocs, aStatuses, aMemoryBudget, aNbThreads, aProgress->Start());
+
+    Handle(TDocStd_Document) aDoc;
+    Standard_CString aNameVar = aDocShapeName.ToCString();
+    if (!DDocStd::GetDocument(aNameVar, aDoc, Standard_False))
+    {
+      anApp->NewDocument(TCollection_ExtendedString("BinXCAF"), aDoc);
+      Handle(DDocStd_DrawDocument) aDrawDoc = new DDocStd_DrawDocument(aDoc);
+      TDataStd_Name::Set(aDoc->GetData()->Root(), aDocShapeName.ToCString());
+      Draw::Set(aDocShapeName.ToCString(), aDrawDoc);
+    }
+    for (Standard_Integer anIndex = aDocs.Lower(); anIndex <= aDocs.Upper(); ++anIndex)
+    {
+      const Handle(TDocStd_Document)& aFileDoc = aDocs.Value(anIndex);
+      if (aStatuses.Value(anIndex))
+      {
+        Standard_Real aLengthUnit = 1.;
+        if (XCAFDoc_DocumentTool::GetLengthUnit(aFileDoc, aLengthUnit)
+        && !XCAFDoc_DocumentTool::GetLengthUnit(aDoc, aLengthUnit))
+        {
+          XCAFDoc_DocumentTool::SetLengthUnit(aDoc, aLengthUnit);
+        }
+        TDF_LabelSequence aLabels;
+        XCAFDoc_DocumentTool::ShapeTool(aFileDoc->Main())->GetFreeShapes(aLabels);
+        XCAFDoc_Editor::Extract(aLabels, aDoc->Main());
+      }
+      anApp->Close(aFileDoc);
+    }
+  }
+
+  Standard_Boolean isAllDone = Standard_True;
+  for (Standard_Integer anIndex = aStatuses.Lower(); anIndex <= aStatuses.Upper(); ++anIndex)
+  {
+    if (!aStatuses.Value(anIndex))
+    {
+      theDI << "Error: cannot read file " << aPaths.Value(anIndex) << "\n";
+      isAllDone = Standard_False;
+    }
+  }
+  return isAllDone ? 0 : 1;
+}
+
 //=======================================================================
 //function : WriteFile
 //purpose  :
@@ -410,6 +549,18 @@ void XSDRAWDE::Factory(Draw_Interpretor& theDI)
             "readfile shapeName filePath [-conf <value|path>]\n"
             "\n\t\t: Read CAD file to shape with registered format's providers. Use global configuration by default.",
             __FILE__, ReadFile, aGroup);
+  theDI.Add("ReadFiles",
+            "ReadFiles docName filePath1 [filePath2 ...] [-conf <value|path>] [-nbThreads N] [-memory MiB]\n"
+            "\n\t\t: Read CAD files concurrently with registered format's providers and merge them into one document."
+            "\n\t\t: Use global configuration by default."
+            "\n\t\t:   '-nbThreads' - maximum number of threads, default number of threads of the pool if not set"
+            "\n\t\t:   '-memory' - maximum total size of files (in MiB) being read at once, no limit if not set",
+            __FILE__, ReadFiles, aGroup);
+  theDI.Add("readfiles",
+            "readfiles shapeName filePath1 [filePath2 ...] [-conf <value|path>] [-nbThreads N] [-memory MiB]\n"
+            "\n\t\t: Read CAD files concurrently with registered format's providers into compound of shapes."
+            "\n\t\t: Options are the same as for ReadFiles.",
+            __FILE__, ReadFiles, aGroup);
   theDI.Add("WriteFile",
             "WriteFile docName filePath [-conf <value|path>]\n"
             "\n\t\t: Write CAD file to document with registered format's providers. Use global configuration by default.",
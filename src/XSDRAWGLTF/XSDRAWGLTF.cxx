@@ -314,6 +314,7 @@ static Standard_Integer WriteGltf(Draw_Interpretor& theDI,
   RWMesh_CoordinateSystem aSystemCoordSys = RWMesh_CoordinateSystem_Zup;
   bool toForceUVExport = false, toEmbedTexturesInGlb = true;
   bool toMergeFaces = false, toSplitIndices16 = false;
+  bool toQuantizeMesh = false;
   bool isParallel = false;
   RWMesh_NameFormat aNodeNameFormat = RWMesh_NameFormat_InstanceOrProduct;
   RWMesh_NameFormat aMeshNameFormat = RWMesh_NameFormat_Product;
@@ -450,6 +451,10 @@ static Standard_Integer WriteGltf(Draw_Interpretor& theDI,
     {
       toEmbedTexturesInGlb = false;
     }
+    else if (anArgCase == "-meshquantization")
+    {
+      toQuantizeMesh = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+    }
     else if (anArgCase == "-draco")
     {
       aDracoParameters.DracoCompression = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
@@ -519,6 +524,7 @@ static Standard_Integer WriteGltf(Draw_Interpretor& theDI,
   aWriter.SetToEmbedTexturesInGlb(toEmbedTexturesInGlb);
   aWriter.SetMergeFaces(toMergeFaces);
   aWriter.SetSplitIndices16(toSplitIndices16);
+  aWriter.SetMeshQuantization(toQuantizeMesh);
   aWriter.SetParallel(isParallel);
   aWriter.SetCompressionParameters(aDracoParameters);
   aWriter.ChangeCoordinateSystemConverter().SetInputLengthUnit(aScaleFactorM);
@@ -565,6 +571,7 @@ void XSDRAWGLTF::Factory(Draw_Interpretor& theDI)
             "\n\t\t:            [-systemCoordSys {Zup|Yup}]=Zup"
             "\n\t\t:            [-comments Text] [-author Name]"
             "\n\t\t:            [-forceUVExport]=0 [-texturesSeparate]=0 [-mergeFaces]=0 [-splitIndices16]=0"
+            "\n\t\t:            [-meshQuantization]=0"
             "\n\t\t:            [-nodeNameFormat {empty|product|instance|instOrProd|prodOrInst|prodAndInst|verbose}]=instOrProd"
             "\n\t\t:            [-meshNameFormat {empty|product|instance|instOrProd|prodOrInst|prodAndInst|verbose}]=product"
             "\n\t\t:            [-draco]=0 [-compressionLevel {0-10}]=7 [-quantizePositionBits Value]=14 [-quantizeNormalBits Value]=10"
@@ -575,6 +582,7 @@ void XSDRAWGLTF::Factory(Draw_Interpretor& theDI)
             "\n\t\t:   -systemCoordSys   system coordinate system; Zup when not specified"
             "\n\t\t:   -mergeFaces       merge Faces within the same Mesh"
             "\n\t\t:   -splitIndices16   split Faces to keep 16-bit indices when -mergeFaces is enabled"
+            "\n\t\t:   -meshQuantization write positions and normals as 16-bit integers (KHR_mesh_quantization)"
             "\n\t\t:   -forceUVExport    always export UV coordinates"
             "\n\t\t:   -texturesSeparate write textures to separate files"
             "\n\t\t:   -nodeNameFormat   name format for Nodes"
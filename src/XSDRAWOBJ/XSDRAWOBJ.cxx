@@ -69,6 +69,7 @@ static Standard_Integer ReadObj (Draw_Interpretor& theDI,
   Standard_Real aFileUnitFactor = -1.0;
   RWMesh_CoordinateSystem aResultCoordSys = RWMesh_CoordinateSystem_Zup, aFileCoordSys = RWMesh_CoordinateSystem_Yup;
   Standard_Boolean toListExternalFiles = Standard_False, isSingleFace = Standard_False, isSinglePrecision = Standard_False;
+  Standard_Boolean toParallel = Standard_False;
   Standard_Boolean isNoDoc = (TCollection_AsciiString(theArgVec[0]) == "readobj");
   for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
   {
@@ -121,6 +122,15 @@ static Standard_Integer ReadObj (Draw_Interpretor& theDI,
         ++anArgIter;
       }
     }
+    else if (anArgCase == "-parallel")
+    {
+      toParallel = Standard_True;
+      if (anArgIter + 1 < theNbArgs
+       && Draw::ParseOnOff (theArgVec[anArgIter + 1], toParallel))
+      {
+        ++anArgIter;
+      }
+    }
     else if (isNoDoc
           && (anArgCase == "-singleface"
            || anArgCase == "-singletriangulation"))
@@ -193,6 +203,7 @@ static Standard_Integer ReadObj (Draw_Interpretor& theDI,
 
   RWObj_CafReader aReader;
   aReader.SetSinglePrecision (isSinglePrecision);
+  aReader.SetParallel (toParallel);
   aReader.SetSystemLengthUnit (aScaleFactorM);
   aReader.SetSystemCoordinateSystem (aResultCoordSys);
   aReader.SetFileLengthUnit (aFileUnitFactor);
@@ -202,6 +213,7 @@ static Standard_Integer ReadObj (Draw_Interpretor& theDI,
   {
     RWObj_TriangulationReader aSimpleReader;
     aSimpleReader.SetSinglePrecision (isSinglePrecision);
+    aSimpleReader.SetParallel (toParallel);
     aSimpleReader.SetCreateShapes (Standard_False);
     aSimpleReader.SetTransformation (aReader.CoordinateSystemConverter());
     aSimpleReader.Read (aFilePath.ToCString(), aProgress->Start());
@@ -367,19 +379,20 @@ void XSDRAWOBJ::Factory(Draw_Interpretor& theDI)
   const char* aGroup = "XSTEP-STL/VRML";  // Step transfer file commands
   theDI.Add("ReadObj",
             "ReadObj Doc file [-fileCoordSys {Zup|Yup}] [-fileUnit Unit]"
-            "\n\t\t:                  [-resultCoordSys {Zup|Yup}] [-singlePrecision]"
+            "\n\t\t:                  [-resultCoordSys {Zup|Yup}] [-singlePrecision] [-parallel]"
             "\n\t\t:                  [-listExternalFiles] [-noCreateDoc]"
             "\n\t\t: Read OBJ file into XDE document."
             "\n\t\t:   -fileUnit       length unit of OBJ file content;"
             "\n\t\t:   -fileCoordSys   coordinate system defined by OBJ file; Yup when not specified."
             "\n\t\t:   -resultCoordSys result coordinate system; Zup when not specified."
             "\n\t\t:   -singlePrecision truncate vertex data to single precision during read; FALSE by default."
+            "\n\t\t:   -parallel       decode vertex and face records in multiple threads; FALSE by default."
             "\n\t\t:   -listExternalFiles do not read mesh and only list external files."
             "\n\t\t:   -noCreateDoc    read into existing XDE document.",
             __FILE__, ReadObj, aGroup);
   theDI.Add("readobj",
             "readobj shape file [-fileCoordSys {Zup|Yup}] [-fileUnit Unit]"
-            "\n\t\t:                    [-resultCoordSys {Zup|Yup}] [-singlePrecision]"
+            "\n\t\t:                    [-resultCoordSys {Zup|Yup}] [-singlePrecision] [-parallel]"
             "\n\t\t:                    [-singleFace]"
             "\n\t\t: Same as ReadObj but reads OBJ file into a shape instead of a document."
             "\n\t\t:   -singleFace merge OBJ content into a single triangulation Face.",
@@ -27,6 +27,8 @@
 #include <OSD_OpenFile.hxx>
 #include <OSD_Parallel.hxx>
 #include <OSD_Path.hxx>
+#include <OSD_Timer.hxx>
+#include <RWStepAP214_ReadWriteModule.hxx>
 #include <STEPCAFControl_Reader.hxx>
 #include <STEPCAFControl_Writer.hxx>
 #include <STEPControl_ActorWrite.hxx>
@@ -41,8 +43,10 @@
 #include <STEPSelections_Counter.hxx>
 #include <StepToTopoDS_MakeTransformed.hxx>
 #include <TDataStd_Name.hxx>
+#include <TColStd_SequenceOfAsciiString.hxx>
 #include <TDocStd_Application.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_SequenceOfShape.hxx>
 #include <UnitsMethods.hxx>
 #include <XSAlgo.hxx>
 #include <XSAlgo_AlgoContainer.hxx>
@@ -538,6 +542,79 @@ static Standard_Integer testwrite(Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+//function : stepstreamwrite
+//purpose  : 
+//=======================================================================
+static Standard_Integer stepstreamwrite(Draw_Interpretor& theDI,
+                                        Standard_Integer theNbArgs,
+                                        const char** theArgVec)
+{
+  Standard_Boolean toStream = Standard_True;
+  Standard_CString aFileName = NULL;
+  TopTools_SequenceOfShape aShapes;
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-nostream")
+    {
+      toStream = Standard_False;
+    }
+    else if (aFileName == NULL)
+    {
+      aFileName = theArgVec[anArgIter];
+    }
+    else
+    {
+      TopoDS_Shape aShape = DBRep::Get(theArgVec[anArgIter]);
+      if (aShape.IsNull())
+      {
+        theDI << "Syntax error: " << theArgVec[anArgIter] << " is not a shape";
+        return 1;
+      }
+      aShapes.Append(aShape);
+    }
+  }
+  if (aShapes.IsEmpty())
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  std::ofstream aStream;
+  OSD_OpenStream(aStream, aFileName, std::ios::out | std::ios::binary);
+  if (!aStream.good())
+  {
+    theDI << "Error: Problem with opening stream by file: " << "[" << aFileName << "]";
+    return 1;
+  }
+
+  StepData_ConfParameters aParameters;
+  aParameters.InitFromStatic();
+  STEPControl_Writer aWriter;
+  if (toStream && !aWriter.BeginStream(aStream))
+  {
+    theDI << "Error: Can't begin writing of file: " << "[" << aFileName << "]";
+    return 1;
+  }
+  for (TopTools_SequenceOfShape::Iterator aShapeIter(aShapes); aShapeIter.More(); aShapeIter.Next())
+  {
+    if (aWriter.Transfer(aShapeIter.Value(), STEPControl_AsIs, aParameters) != IFSelect_RetDone)
+    {
+      theDI << "Error: Can't transfer input shape";
+      return 1;
+    }
+  }
+  const IFSelect_ReturnStatus aStat = toStream ? aWriter.EndStream() : aWriter.WriteStream(aStream);
+  if (aStat != IFSelect_RetDone)
+  {
+    theDI << "Error on writing file: " << "[" << aFileName << "]";
+    return 1;
+  }
+  return 0;
+}
+
 //=======================================================================
 //function : countexpected
 //purpose  :
@@ -1021,6 +1098,168 @@ static Standard_Integer WriteStep(Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+//function : steptypebench
+//purpose  : Benchmark recognition of types of STEP entities
+//=======================================================================
+static Standard_Integer steptypebench(Draw_Interpretor& theDI,
+                                      Standard_Integer theNbArgs,
+                                      const char** theArgVec)
+{
+  if (theNbArgs < 2 || theNbArgs > 3)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  const Standard_Integer aNbIters = theNbArgs > 2 ? Draw::Atoi(theArgVec[2]) : 1;
+  if (aNbIters < 1)
+  {
+    theDI << "Syntax error: wrong number of iterations";
+    return 1;
+  }
+
+  std::ifstream aFile;
+  OSD_OpenStream(aFile, theArgVec[1], std::ios::in | std::ios::binary);
+  if (!aFile.is_open())
+  {
+    theDI << "Error: cannot open file " << theArgVec[1];
+    return 1;
+  }
+
+  // collect types of simple entities written as #N=TYPE(...)
+  TColStd_SequenceOfAsciiString aTypes;
+  std::string aLine;
+  while (std::getline(aFile, aLine))
+  {
+    size_t aPos = 0;
+    while ((aPos = aLine.find('#', aPos)) != std::string::npos)
+    {
+      size_t anEnd = ++aPos;
+      while (anEnd < aLine.size() && isdigit((unsigned char)aLine[anEnd]))
+      {
+        ++anEnd;
+      }
+      while (anEnd < aLine.size() && aLine[anEnd] == ' ')
+      {
+        ++anEnd;
+      }
+      if (anEnd == aPos || anEnd >= aLine.size() || aLine[anEnd] != '=')
+      {
+        continue;
+      }
+      ++anEnd;
+      while (anEnd < aLine.size() && aLine[anEnd] == ' ')
+      {
+        ++anEnd;
+      }
+      const size_t aStart = anEnd;
+      while (anEnd < aLine.size() && (isalnum((unsigned char)aLine[anEnd]) || aLine[anEnd] == '_'))
+      {
+        ++anEnd;
+      }
+      if (anEnd > aStart)
+      {
+        aTypes.Append(TCollection_AsciiString(aLine.substr(aStart, anEnd - aStart).c_str()));
+      }
+      aPos = anEnd;
+    }
+  }
+
+  // reference : the lookup of RWStepAP214_ReadWriteModule::CaseStep() before the perfect hash table,
+  // i.e. comparison with CARTESIAN_POINT, then search in the map of long types, then in the map of short types;
+  // the short types are not exposed by the module, so the map of them is filled by the short types met in the file
+  Handle(RWStepAP214_ReadWriteModule) aModule = new RWStepAP214_ReadWriteModule();
+  NCollection_DataMap<TCollection_AsciiString, Standard_Integer> aLongTypeMap, aShortTypeMap;
+  for (Standard_Integer aCaseIter = 1; aCaseIter <= 1000; ++aCaseIter)
+  {
+    if (!aModule->IsComplex(aCaseIter))
+    {
+      const TCollection_AsciiString& aType = aModule->StepType(aCaseIter);
+      if (aModule->CaseStep(aType) == aCaseIter)
+      {
+        aLongTypeMap.Bind(aType, aCaseIter);
+      }
+    }
+  }
+  const TCollection_AsciiString aCartesianPoint("CARTESIAN_POINT");
+  const Standard_Integer aCartesianPointNum = aModule->CaseStep(aCartesianPoint);
+  for (TColStd_SequenceOfAsciiString::Iterator aTypeIter(aTypes); aTypeIter.More(); aTypeIter.Next())
+  {
+    const TCollection_AsciiString& aType = aTypeIter.Value();
+    const Standard_Integer aNum = aModule->CaseStep(aType);
+    if (aNum != 0 && !aLongTypeMap.IsBound(aType) && !aShortTypeMap.IsBound(aType))
+    {
+      aShortTypeMap.Bind(aType, aNum);
+    }
+  }
+
+  Standard_Integer aNbErrors = 0;
+  for (TColStd_SequenceOfAsciiString::Iterator aTypeIter(aTypes); aTypeIter.More(); aTypeIter.Next())
+  {
+    const TCollection_AsciiString& aType = aTypeIter.Value();
+    Standard_Integer aMapNum = 0;
+    const Standard_Integer aNum = aModule->CaseStep(aType.ToCString());
+    if (aNum != aModule->CaseStep(aType)
+     || (aLongTypeMap.Find(aType, aMapNum) && aMapNum != aNum))
+    {
+      theDI << "Error: type " << aType << " is recognized as " << aNum << " instead of " << aMapNum << "\n";
+      ++aNbErrors;
+    }
+  }
+
+  OSD_Timer aTimer;
+  Standard_Integer aNbMapFound = 0, aNbTableFound = 0;
+  aTimer.Start();
+  for (Standard_Integer anIter = 0; anIter < aNbIters; ++anIter)
+  {
+    for (TColStd_SequenceOfAsciiString::Iterator aTypeIter(aTypes); aTypeIter.More(); aTypeIter.Next())
+    {
+      // the type is given as the record type string kept by the reader data
+      const TCollection_AsciiString& aType = aTypeIter.Value();
+      Standard_Integer aNum = 0;
+      if (aType.IsEqual(aCartesianPoint))
+      {
+        aNum = aCartesianPointNum;
+      }
+      else if (!aLongTypeMap.Find(aType, aNum))
+      {
+        aShortTypeMap.Find(aType, aNum);
+      }
+      if (aNum != 0)
+      {
+        ++aNbMapFound;
+      }
+    }
+  }
+  aTimer.Stop();
+  const Standard_Real aMapTime = aTimer.ElapsedTime();
+
+  aTimer.Reset();
+  aTimer.Start();
+  for (Standard_Integer anIter = 0; anIter < aNbIters; ++anIter)
+  {
+    for (TColStd_SequenceOfAsciiString::Iterator aTypeIter(aTypes); aTypeIter.More(); aTypeIter.Next())
+    {
+      if (aModule->CaseStep(aTypeIter.Value().ToCString()) != 0)
+      {
+        ++aNbTableFound;
+      }
+    }
+  }
+  aTimer.Stop();
+  const Standard_Real aTableTime = aTimer.ElapsedTime();
+
+  theDI << "Nb entities: " << aTypes.Length() << "\n"
+        << "Map lookup: " << aMapTime << " s, recognized " << aNbMapFound / aNbIters << "\n"
+        << "Perfect hash lookup: " << aTableTime << " s, recognized " << aNbTableFound / aNbIters << "\n";
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " types are recognized differently\n";
+  }
+  return 0;
+}
+
 //=======================================================================
 //function : Factory
 //purpose  :
@@ -1038,12 +1277,23 @@ void XSDRAWSTEP::Factory(Draw_Interpretor& theDI)
   theDI.Add("stepwrite", "stepwrite mode[0-4 afsmw] shape", __FILE__, stepwrite, aGroup);
   theDI.Add("testwritestep", "testwritestep [file_1.stp ... file_n.stp] shape [-stream]",
             __FILE__, testwrite, aGroup);
+  theDI.Add("stepstreamwrite",
+            "stepstreamwrite file shape_1 [... shape_n] [-nostream]"
+            "\n\t\t: Writes shapes to STEP file, each one being written and released once transferred."
+            "\n\t\t:  -nostream transfer all shapes before writing the model (for comparison)",
+            __FILE__, stepstreamwrite, aGroup);
   theDI.Add("stepread", "stepread  [file] [f or r (type of model full or reduced)]", __FILE__, stepread, aGroup);
   theDI.Add("testreadstep", "testreadstep [file_1 ... file_n] shape [-stream]", __FILE__, testreadstep, aGroup);
   theDI.Add("steptrans", "steptrans shape stepax1 stepax2", __FILE__, steptrans, aGroup);
   theDI.Add("countexpected", "TEST", __FILE__, countexpected, aGroup);
   theDI.Add("dumpassembly", "TEST", __FILE__, dumpassembly, aGroup);
   theDI.Add("stepfileunits", "stepfileunits name_file", __FILE__, stepfileunits, aGroup);
+  theDI.Add("steptypebench",
+            "steptypebench file [nbIter=1]"
+            "\n\t\t: Measures recognition of types of entities of STEP file"
+            "\n\t\t: by the former lookup in maps of long and short types"
+            "\n\t\t: and by perfect hash table of AP214 module.",
+            __FILE__, steptypebench, aGroup);
   theDI.Add("ReadStep",
             "Doc filename [mode] [-stream]"
             "\n\t\t: Read STEP file to a document."